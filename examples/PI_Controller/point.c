@@ -15,15 +15,16 @@
  */
 
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_pwm.h"
+#include "halo_loop.h"
 #include <stdio.h>
-#include <math.h>
 #define L1 10.0f
 #define L2 10.0f
 // PI gains (tune these!)
 #define KP 1.0f
 #define KI 0.5f
 
-#define M_PI 3.14
 // ---------- helpers ----------
 static inline float clampf(float v, float min, float max) {
     if (v < min) return min;
@@ -34,53 +35,41 @@ static inline float clampf(float v, float min, float max) {
 static inline unsigned int angle_to_duty_us(float angle_rad)
 {
     if (angle_rad < 0) angle_rad = 0;
-    if (angle_rad > M_PI) angle_rad = M_PI;
-    return 1000 + (unsigned int)((angle_rad / M_PI) * 1000.0f);
+    if (angle_rad > HALO_PI_F) angle_rad = HALO_PI_F;
+    return 1000 + (unsigned int)((angle_rad / HALO_PI_F) * 1000.0f);
 }
 static inline float duty_us_to_angle(unsigned int duty)
 {
-    return ((float)(duty - 1000) / 1000.0f) * M_PI;
+    return ((float)(duty - 1000) / 1000.0f) * HALO_PI_F;
 }
 // Inverse Kinematics (choose valid solution in [0,π])
 int computeIK(float x, float y, float* theta1, float* theta2)
 {
-    float r2 = x * x + y * y;
-    float r = sqrtf(r2);
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0;
-    float c2 = (r2 - L1 * L1 - L2 * L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
-    float ang2_up = acosf(c2);
-    float ang2_down = -acosf(c2);
-    float k1_up = L1 + L2 * cosf(ang2_up);
-    float k2_up = L2 * sinf(ang2_up);
-    float k1_down = L1 + L2 * cosf(ang2_down);
-    float k2_down = L2 * sinf(ang2_down);
-    float beta = atan2f(y, x);
-    float ang1_up = beta - atan2f(k2_up, k1_up);
-    float ang1_down = beta - atan2f(k2_down, k1_down);
-    if (ang1_up >= 0 && ang1_up <= M_PI && ang2_up >= 0 && ang2_up <= M_PI) {
-        *theta1 = ang1_up;
-        *theta2 = ang2_up;
-        return 1;
-    }
-    else if (ang1_down >= 0 && ang1_down <= M_PI && ang2_down >= 0 && ang2_down <= M_PI) {
-        *theta1 = ang1_down;
-        *theta2 = ang2_down;
-        return 1;
+    static const halo_arm_t arm = { L1, L2 };
+    for (int elbow = HALO_ELBOW_DOWN; elbow <= HALO_ELBOW_UP; elbow++) {
+        float t1_deg, t2_deg;
+        if (!halo_ik_solve(&arm, x, y, elbow, &t1_deg, &t2_deg))
+            return 0;
+        float ang1 = t1_deg * HALO_DEG_TO_RAD_F;
+        float ang2 = t2_deg * HALO_DEG_TO_RAD_F;
+        if (ang1 >= 0 && ang1 <= HALO_PI_F && ang2 >= 0 && ang2 <= HALO_PI_F) {
+            *theta1 = ang1;
+            *theta2 = ang2;
+            return 1;
+        }
     }
     return 0;
 }
 // ---------- PI Controller for one joint ----------
-unsigned int pi_control(float desired_angle, unsigned int reg_addr, float* integral)
+unsigned int pi_control(float desired_angle, unsigned int reg_addr, float* integral, float dt_s)
 {
     // Read current PWM from register
 
-    float current_angle = READ_REGISTER(reg_addr) * M_PI/180;
+    float current_angle = READ_REGISTER(reg_addr) * HALO_PI_F/180;
     // Error
     float error = desired_angle - current_angle;
     // Integrate error
-    *integral += error * 0.02f; // 20 ms loop
+    *integral += error * dt_s; // measured loop period
     // PI control
     float control = KP * error + KI * (*integral);
     // Convert back to PWM duty
@@ -103,13 +92,15 @@ void fw_main(void)
     float integral1 = 0, integral2 = 0;
     if (computeIK(x, y, &t1_des, &t2_des))
     {
+        halo_loop_t loop;
+        halo_loop_init(&loop, 20000, 10); // 20 ms control loop
         while (1) {
-            unsigned int duty1 = pi_control(t1_des, 0x40001000, &integral1);
-            unsigned int duty2 = pi_control(t2_des, 0x40001004, &integral2);
+            float dt_s = halo_loop_wait(&loop);
+            unsigned int duty1 = pi_control(t1_des, 0x40001000, &integral1, dt_s);
+            unsigned int duty2 = pi_control(t2_des, 0x40001004, &integral2, dt_s);
             printf("%d %d\n", duty1, duty2);
-            WRITE_REGISTER(0x40004004, duty1);
-            WRITE_REGISTER(0x40004044, duty2);
-            delay_us(20); // 20 ms control loop
+            unsigned int pwm_duty[2] = { duty1, duty2 }; // shoulder, elbow
+            halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
         }
     }
 }
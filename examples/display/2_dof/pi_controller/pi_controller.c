@@ -7,8 +7,11 @@
  * @details
  * - Computes joint angles from target (x, y) using IK.
  * - Converts angles to PWM duty cycles for two servo motors.
- * - Uses a PI controller in the angle (degree) domain.
- * - Runs a continuous loop to position the arm at target coordinates.
+ * - Uses a PI controller in the angle (degree) domain, run by the
+ *   fixed-point halo_pi engine (build with -DPI_FLOAT_REFERENCE for the
+ *   float reference).
+ * - Runs a fixed-rate 50 Hz loop (halo_loop) to position the arm at target
+ *   coordinates.
  *
  * @note
  * - Controller: Halo Ver 1.0
@@ -18,18 +21,15 @@
 
 #include "pi_controller.h"
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_pwm.h"
+#include "halo_loop.h"
+#include "halo_pi.h"
 #include <stdio.h>
-#include <math.h>
 
-// ---------- Helpers ----------
+#define LOOP_PERIOD_US 20000    // 50 Hz, one servo period
 
-// Clamp float value between min and max
-static inline float clampf(float v, float min, float max)
-{
-    if (v < min) return min;
-    if (v > max) return max;
-    return v;
-}
+// ---------- Helpers ----------
 
 // Normalize angle to [0, 360)
 static inline float normalize360(float ang_deg)
@@ -52,48 +52,26 @@ static inline unsigned int angle_deg_to_duty_us(float angle_deg)
 
 int computeIK(float x, float y, float* theta1_deg, float* theta2_deg)
 {
-    float r2 = x * x + y * y;
-    float r = sqrtf(r2);
-
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0; // Target unreachable
-
-    float c2 = (r2 - L1 * L1 - L2 * L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
-
-    float ang2_up   = acosf(c2);
-    float ang2_down = -acosf(c2);
+    static const halo_arm_t arm = { L1, L2 };
+    float ang1_deg, ang2_deg;
 
-    float k1_up   = L1 + L2 * cosf(ang2_up);
-    float k2_up   = L2 * sinf(ang2_up);
-    float k1_down = L1 + L2 * cosf(ang2_down);
-    float k2_down = L2 * sinf(ang2_down);
-
-    float beta = atan2f(y, x);
-
-    float ang1_up   = beta - atan2f(k2_up,   k1_up);
-    float ang1_down = beta - atan2f(k2_down, k1_down);
+    // Try elbow-down first, then elbow-up; take the first one inside the servo range
+    for (int elbow = HALO_ELBOW_DOWN; elbow <= HALO_ELBOW_UP; elbow++)
+    {
+        if (!halo_ik_solve(&arm, x, y, elbow, &ang1_deg, &ang2_deg))
+            return 0; // Target unreachable
 
-    // Convert to degrees
-    float ang1_up_deg   = normalize360(ang1_up   * 180.0f / M_PI);
-    float ang2_up_deg   = normalize360(ang2_up   * 180.0f / M_PI);
-    float ang1_down_deg = normalize360(ang1_down * 180.0f / M_PI);
-    float ang2_down_deg = normalize360(ang2_down * 180.0f / M_PI);
+        ang1_deg = normalize360(ang1_deg);
+        ang2_deg = normalize360(ang2_deg);
 
-    // Check if valid servo range
-    if (ang1_up_deg   >= 0 && ang1_up_deg   <= 180 &&
-        ang2_up_deg   >= 0 && ang2_up_deg   <= 180)
-    {
-        *theta1_deg = ang1_up_deg;
-        *theta2_deg = ang2_up_deg;
-        return 1;
-    }
-    else if (ang1_down_deg >= 0 && ang1_down_deg <= 180 &&
-             ang2_down_deg >= 0 && ang2_down_deg <= 180)
-    {
-        *theta1_deg = ang1_down_deg;
-        *theta2_deg = ang2_down_deg;
-        return 1;
+        // Check if valid servo range
+        if (ang1_deg >= 0 && ang1_deg <= 180 &&
+            ang2_deg >= 0 && ang2_deg <= 180)
+        {
+            *theta1_deg = ang1_deg;
+            *theta2_deg = ang2_deg;
+            return 1;
+        }
     }
 
     return 0;
@@ -101,52 +79,82 @@ int computeIK(float x, float y, float* theta1_deg, float* theta2_deg)
 
 // ---------- PI Control ----------
 
-unsigned int pi_control(float desired_angle_deg, unsigned int reg_addr, float* integral)
-{
-    float current_angle_deg = READ_REGISTER(reg_addr);
-    float error = desired_angle_deg - current_angle_deg;
-
-    *integral += error * 0.02f; // 20 ms loop
-    *integral = clampf(*integral, -50.0f, 50.0f);
+// Both joints: output 0–180°, saturation handled by back-calculation
+static const halo_pi_gains_t joint_gains[2] = {
+    { KP, KI, KAW, 0.0f, 180.0f },   // shoulder
+    { KP, KI, KAW, 0.0f, 180.0f },   // elbow
+};
 
-    float control = KP * error + KI * (*integral);
-    float new_angle_deg = current_angle_deg + control;
-
-    if (new_angle_deg < 0) new_angle_deg = 0;
-    if (new_angle_deg > 180.0f) new_angle_deg = 180.0f;
+// Feedback register (whole degrees) → Q15 fraction of 180°
+static inline short deg_to_q15(unsigned int deg)
+{
+    return (short)(deg * 32767u / 180u);
+}
 
-    return angle_deg_to_duty_us(new_angle_deg);
+// Q15 fraction of 180° → PWM duty cycle (1000–2000 µs)
+static inline unsigned int q15_to_duty_us(short q)
+{
+    return 1000u + (((unsigned int)(q < 0 ? 0 : q) * 1000u) >> 15);
 }
 
 // ---------- Main ----------
 
 void fw_main(void)
 {
-    // Configure PWM for Motor 1
-    WRITE_REGISTER(0x40004000, 20000);
-    WRITE_REGISTER(0x40004008, 0x01);
-
-    // Configure PWM for Motor 2
-    WRITE_REGISTER(0x40004040, 20000);
-    WRITE_REGISTER(0x40004048, 0x01);
+    halo_pwm_enable(HALO_PWM_SHOULDER, 20000);
+    halo_pwm_enable(HALO_PWM_ELBOW, 20000);
 
     float x = -10.0f;
     float y = -5.0f;
     float t1_des_deg, t2_des_deg;
-    float integral1 = 0, integral2 = 0;
 
     if (computeIK(x, y, &t1_des_deg, &t2_des_deg))
     {
+#ifdef PI_FLOAT_REFERENCE
+        // Float reference: same equations as the fixed-point engine
+        halo_pi_ref_t pi;
+        halo_pi_ref_init(&pi, 2, joint_gains);
+        pi.target[0] = t1_des_deg;
+        pi.target[1] = t2_des_deg;
+#else
+        halo_pi_t pi;
+        halo_pi_init(&pi, 2, joint_gains, 180.0f, LOOP_PERIOD_US * 1e-6f);
+        pi.target[0] = HALO_PI_Q15(t1_des_deg, 180.0f);
+        pi.target[1] = HALO_PI_Q15(t2_des_deg, 180.0f);
+#endif
+
+        halo_loop_t loop;
+        halo_loop_init(&loop, LOOP_PERIOD_US, 10); // 10 µs jitter bins
+
         while (1)
         {
-            unsigned int duty1 = pi_control(t1_des_deg, 0x40001000, &integral1);
-            unsigned int duty2 = pi_control(t2_des_deg, 0x40001004, &integral2);
-
-            WRITE_REGISTER(0x40004004, duty1);
-            WRITE_REGISTER(0x40004044, duty2);
-
-            delay_us(20000); // 20 ms loop
+            float dt = halo_loop_wait(&loop); // sleep until the next 20 ms deadline, measured dt
+
+            unsigned int pwm_duty[2]; // shoulder, elbow
+#ifdef PI_FLOAT_REFERENCE
+            float meas[2] = { READ_REGISTER(0x40001000), READ_REGISTER(0x40001004) };
+            float out[2];
+            halo_pi_ref_update(&pi, dt, meas, meas, out);  // feed-forward: current angle
+            pwm_duty[0] = angle_deg_to_duty_us(out[0]);
+            pwm_duty[1] = angle_deg_to_duty_us(out[1]);
+#else
+            short meas[2] = { deg_to_q15(READ_REGISTER(0x40001000)),
+                              deg_to_q15(READ_REGISTER(0x40001004)) };
+            short out[2];
+            halo_pi_update(&pi, HALO_PI_DT_Q15(dt, LOOP_PERIOD_US * 1e-6f),
+                           meas, meas, out);               // feed-forward: current angle
+            pwm_duty[0] = q15_to_duty_us(out[0]);
+            pwm_duty[1] = q15_to_duty_us(out[1]);
+#endif
+            halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
+
+            // Loop timing once a second
+            if (loop.count == 50)
+            {
+                printf("period min %u mean %u max %u us, overruns %lu\n",
+                       loop.min_us, halo_loop_mean_us(&loop), loop.max_us, loop.overruns);
+                halo_loop_reset_stats(&loop);
+            }
         }
     }
 }
-
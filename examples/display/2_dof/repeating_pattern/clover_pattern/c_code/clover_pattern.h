@@ -4,12 +4,42 @@
 /**
  * @brief Starts the clover pattern trajectory for a 2-DOF robotic arm.
  * 
- * This function loops infinitely, tracing the precomputed clover
- * path by computing inverse kinematics and generating PWM signals
- * for the servos.
+ * This function loops infinitely, streaming the pre-solved clover
+ * duty table through the PWM FIFOs at one point per 20 ms period.
+ * No floating point and no delay_us timing run in the loop.
  */
 void clover_pattern_gen(void);
 
+/**
+ * @brief Same table, paced by delay_us instead of PWM streaming.
+ */
+void clover_pattern_gen_cpu(void);
+
+/**
+ * @brief Plays the table at a tool speed, CPU-timed.
+ *
+ * Above the speed of one full-density pair per servo period the player
+ * switches to the 1/2 or 1/4 density level from clover_lod.c, so it writes
+ * no more pairs than the servos can follow.
+ */
+void clover_pattern_gen_speed(float tool_speed_cm_s);
+
+/**
+ * @brief Same trajectory, but decodes clover_path and solves IK at run time.
+ *
+ * Use this while tuning the path placement; the default player streams the
+ * pre-solved clover_duty table generated by generate_clover_coords.py.
+ */
+void clover_pattern_gen_ik(void);
+
+/**
+ * @brief Evaluates the cubic clover_curve at run time instead of a point table.
+ *
+ * Points are spaced so the tool moves at tool_speed_cm_s with one point per
+ * servo period (the point tables are generated for 5 cm/s).
+ */
+void clover_pattern_gen_curve(float tool_speed_cm_s);
+
 #endif // CLOVER_PATTERN_H
 
 
@@ -1,2024 +0,0 @@
-#include "clover_coords.h"
-
-// ----------------------------
-// Generated clover coordinates
-// ----------------------------
-
-float clover_coords[][2] = {
-    { -7.68, -0.88 },
-    { -7.68, -1.01 },
-    { -7.68, -1.13 },
-    { -7.68, -1.26 },
-    { -7.68, -1.38 },
-    { -7.68, -1.51 },
-    { -7.68, -1.63 },
-    { -7.68, -1.76 },
-    { -7.68, -1.88 },
-    { -7.68, -2.01 },
-    { -7.68, -2.13 },
-    { -7.68, -2.26 },
-    { -7.68, -2.38 },
-    { -7.70, -2.51 },
-    { -7.70, -2.63 },
-    { -7.73, -2.76 },
-    { -7.73, -2.88 },
-    { -7.73, -3.00 },
-    { -7.75, -3.13 },
-    { -7.75, -3.25 },
-    { -7.75, -3.38 },
-    { -7.78, -3.50 },
-    { -7.80, -3.63 },
-    { -7.80, -3.75 },
-    { -7.83, -3.88 },
-    { -7.83, -4.00 },
-    { -7.85, -4.13 },
-    { -7.88, -4.25 },
-    { -7.90, -4.38 },
-    { -7.93, -4.50 },
-    { -7.93, -4.63 },
-    { -7.95, -4.75 },
-    { -8.00, -4.88 },
-    { -8.00, -5.00 },
-    { -8.05, -5.13 },
-    { -8.08, -5.25 },
-    { -8.13, -5.37 },
-    { -8.15, -5.50 },
-    { -8.20, -5.62 },
-    { -8.25, -5.75 },
-    { -8.28, -5.87 },
-    { -8.33, -6.00 },
-    { -8.38, -6.12 },
-    { -8.43, -6.25 },
-    { -8.48, -6.37 },
-    { -8.55, -6.50 },
-    { -8.60, -6.62 },
-    { -8.68, -6.75 },
-    { -8.72, -6.87 },
-    { -8.80, -7.00 },
-    { -8.87, -7.12 },
-    { -8.97, -7.25 },
-    { -9.07, -7.37 },
-    { -9.20, -7.50 },
-    { -9.32, -7.60 },
-    { -9.45, -7.67 },
-    { -9.57, -7.75 },
-    { -9.70, -7.80 },
-    { -9.82, -7.82 },
-    { -9.95, -7.85 },
-    { -10.07, -7.85 },
-    { -10.20, -7.85 },
-    { -10.32, -7.85 },
-    { -10.45, -7.85 },
-    { -10.57, -7.82 },
-    { -10.70, -7.80 },
-    { -10.82, -7.77 },
-    { -10.95, -7.77 },
-    { -10.97, -7.87 },
-    { -10.85, -7.89 },
-    { -10.72, -7.94 },
-    { -10.60, -7.97 },
-    { -10.47, -7.99 },
-    { -10.35, -8.02 },
-    { -10.22, -8.02 },
-    { -10.10, -8.04 },
-    { -9.97, -8.02 },
-    { -9.85, -8.02 },
-    { -9.72, -7.99 },
-    { -9.60, -7.97 },
-    { -9.47, -7.92 },
-    { -9.35, -7.87 },
-    { -9.22, -7.80 },
-    { -9.10, -7.72 },
-    { -8.97, -7.60 },
-    { -8.85, -7.47 },
-    { -8.77, -7.35 },
-    { -8.68, -7.22 },
-    { -8.60, -7.10 },
-    { -8.53, -6.97 },
-    { -8.48, -6.85 },
-    { -8.43, -6.72 },
-    { -8.35, -6.60 },
-    { -8.30, -6.47 },
-    { -8.25, -6.35 },
-    { -8.20, -6.22 },
-    { -8.15, -6.10 },
-    { -8.10, -5.97 },
-    { -8.05, -5.85 },
-    { -8.03, -5.72 },
-    { -7.98, -5.60 },
-    { -7.95, -5.47 },
-    { -7.90, -5.35 },
-    { -7.88, -5.23 },
-    { -7.85, -5.10 },
-    { -7.80, -4.98 },
-    { -7.80, -4.85 },
-    { -7.75, -4.73 },
-    { -7.75, -4.60 },
-    { -7.73, -4.48 },
-    { -7.70, -4.35 },
-    { -7.68, -4.23 },
-    { -7.68, -4.10 },
-    { -7.65, -3.98 },
-    { -7.63, -3.85 },
-    { -7.63, -3.73 },
-    { -7.60, -3.60 },
-    { -7.60, -3.48 },
-    { -7.60, -3.35 },
-    { -7.60, -3.23 },
-    { -7.58, -3.10 },
-    { -7.58, -2.98 },
-    { -7.55, -2.85 },
-    { -7.55, -2.73 },
-    { -7.55, -2.61 },
-    { -7.55, -2.48 },
-    { -7.55, -2.36 },
-    { -7.55, -2.23 },
-    { -7.58, -2.11 },
-    { -7.58, -1.98 },
-    { -7.60, -1.86 },
-    { -7.60, -1.73 },
-    { -7.60, -1.61 },
-    { -7.60, -1.48 },
-    { -7.60, -1.36 },
-    { -7.63, -1.23 },
-    { -7.63, -1.11 },
-    { -7.63, -0.98 },
-    { -7.63, -0.91 },
-    { -7.63, -1.03 },
-    { -7.63, -1.16 },
-    { -7.63, -1.28 },
-    { -7.60, -1.41 },
-    { -7.60, -1.53 },
-    { -7.60, -1.66 },
-    { -7.60, -1.78 },
-    { -7.58, -1.91 },
-    { -7.58, -2.03 },
-    { -7.58, -2.16 },
-    { -7.55, -2.28 },
-    { -7.55, -2.41 },
-    { -7.55, -2.53 },
-    { -7.55, -2.66 },
-    { -7.55, -2.78 },
-    { -7.55, -2.90 },
-    { -7.58, -3.03 },
-    { -7.58, -3.15 },
-    { -7.60, -3.28 },
-    { -7.60, -3.40 },
-    { -7.60, -3.53 },
-    { -7.60, -3.65 },
-    { -7.63, -3.78 },
-    { -7.63, -3.90 },
-    { -7.65, -4.03 },
-    { -7.68, -4.15 },
-    { -7.68, -4.28 },
-    { -7.70, -4.40 },
-    { -7.73, -4.53 },
-    { -7.75, -4.65 },
-    { -7.78, -4.78 },
-    { -7.80, -4.90 },
-    { -7.83, -5.03 },
-    { -7.85, -5.15 },
-    { -7.88, -5.28 },
-    { -7.93, -5.40 },
-    { -7.95, -5.52 },
-    { -8.00, -5.65 },
-    { -8.03, -5.77 },
-    { -8.08, -5.90 },
-    { -8.13, -6.02 },
-    { -8.18, -6.15 },
-    { -8.23, -6.27 },
-    { -8.28, -6.40 },
-    { -8.33, -6.52 },
-    { -8.38, -6.65 },
-    { -8.45, -6.77 },
-    { -8.53, -6.90 },
-    { -8.58, -7.02 },
-    { -8.65, -7.15 },
-    { -8.72, -7.27 },
-    { -8.82, -7.40 },
-    { -8.92, -7.52 },
-    { -9.05, -7.65 },
-    { -9.17, -7.75 },
-    { -9.30, -7.82 },
-    { -9.42, -7.89 },
-    { -9.55, -7.94 },
-    { -9.67, -7.97 },
-    { -9.80, -7.99 },
-    { -9.92, -8.02 },
-    { -10.05, -8.04 },
-    { -10.17, -8.04 },
-    { -10.30, -8.02 },
-    { -10.42, -7.99 },
-    { -10.55, -7.97 },
-    { -10.67, -7.97 },
-    { -10.80, -7.92 },
-    { -10.92, -7.87 },
-    { -10.95, -7.77 },
-    { -10.82, -7.77 },
-    { -10.70, -7.80 },
-    { -10.57, -7.82 },
-    { -10.45, -7.85 },
-    { -10.32, -7.85 },
-    { -10.20, -7.85 },
-    { -10.07, -7.85 },
-    { -9.95, -7.85 },
-    { -9.82, -7.82 },
-    { -9.70, -7.80 },
-    { -9.57, -7.75 },
-    { -9.45, -7.70 },
-    { -9.32, -7.62 },
-    { -9.20, -7.52 },
-    { -9.07, -7.40 },
-    { -8.97, -7.27 },
-    { -8.87, -7.15 },
-    { -8.80, -7.02 },
-    { -8.72, -6.90 },
-    { -8.68, -6.77 },
-    { -8.60, -6.65 },
-    { -8.55, -6.52 },
-    { -8.50, -6.40 },
-    { -8.45, -6.27 },
-    { -8.38, -6.15 },
-    { -8.35, -6.02 },
-    { -8.30, -5.90 },
-    { -8.25, -5.77 },
-    { -8.20, -5.65 },
-    { -8.15, -5.52 },
-    { -8.13, -5.40 },
-    { -8.08, -5.28 },
-    { -8.05, -5.15 },
-    { -8.03, -5.03 },
-    { -8.00, -4.90 },
-    { -7.98, -4.78 },
-    { -7.95, -4.65 },
-    { -7.93, -4.53 },
-    { -7.90, -4.40 },
-    { -7.88, -4.28 },
-    { -7.85, -4.15 },
-    { -7.85, -4.03 },
-    { -7.83, -3.90 },
-    { -7.80, -3.78 },
-    { -7.80, -3.65 },
-    { -7.78, -3.53 },
-    { -7.75, -3.40 },
-    { -7.75, -3.28 },
-    { -7.75, -3.15 },
-    { -7.73, -3.03 },
-    { -7.73, -2.90 },
-    { -7.73, -2.78 },
-    { -7.70, -2.66 },
-    { -7.70, -2.53 },
-    { -7.70, -2.41 },
-    { -7.68, -2.28 },
-    { -7.68, -2.16 },
-    { -7.68, -2.03 },
-    { -7.68, -1.91 },
-    { -7.68, -1.78 },
-    { -7.68, -1.66 },
-    { -7.68, -1.53 },
-    { -7.68, -1.41 },
-    { -7.68, -1.28 },
-    { -7.68, -1.16 },
-    { -7.68, -1.03 },
-    { -7.68, -0.91 },
-    { -7.93, -0.86 },
-    { -7.93, -0.98 },
-    { -7.93, -1.11 },
-    { -7.93, -1.23 },
-    { -7.93, -1.36 },
-    { -7.93, -1.48 },
-    { -7.93, -1.61 },
-    { -7.93, -1.73 },
-    { -7.93, -1.86 },
-    { -7.93, -1.98 },
-    { -7.95, -2.11 },
-    { -7.95, -2.23 },
-    { -7.95, -2.36 },
-    { -7.95, -2.48 },
-    { -7.95, -2.61 },
-    { -7.98, -2.73 },
-    { -7.98, -2.85 },
-    { -8.00, -2.98 },
-    { -8.00, -3.10 },
-    { -8.00, -3.23 },
-    { -8.03, -3.35 },
-    { -8.05, -3.48 },
-    { -8.05, -3.60 },
-    { -8.08, -3.73 },
-    { -8.08, -3.85 },
-    { -8.10, -3.98 },
-    { -8.13, -4.10 },
-    { -8.13, -4.23 },
-    { -8.15, -4.35 },
-    { -8.18, -4.48 },
-    { -8.20, -4.60 },
-    { -8.23, -4.73 },
-    { -8.25, -4.85 },
-    { -8.28, -4.98 },
-    { -8.33, -5.10 },
-    { -8.35, -5.23 },
-    { -8.38, -5.35 },
-    { -8.43, -5.47 },
-    { -8.45, -5.60 },
-    { -8.50, -5.72 },
-    { -8.55, -5.85 },
-    { -8.60, -5.97 },
-    { -8.65, -6.10 },
-    { -8.70, -6.22 },
-    { -8.77, -6.35 },
-    { -8.82, -6.47 },
-    { -8.87, -6.60 },
-    { -8.95, -6.72 },
-    { -9.02, -6.85 },
-    { -9.10, -6.97 },
-    { -9.20, -7.10 },
-    { -9.30, -7.22 },
-    { -9.42, -7.35 },
-    { -9.55, -7.45 },
-    { -9.67, -7.50 },
-    { -9.80, -7.55 },
-    { -9.92, -7.57 },
-    { -10.05, -7.60 },
-    { -10.17, -7.60 },
-    { -10.30, -7.60 },
-    { -10.42, -7.57 },
-    { -10.55, -7.57 },
-    { -10.67, -7.55 },
-    { -10.80, -7.52 },
-    { -10.92, -7.47 },
-    { -11.05, -7.50 },
-    { -11.17, -7.60 },
-    { -11.24, -7.72 },
-    { -11.24, -7.85 },
-    { -11.22, -7.97 },
-    { -11.12, -8.09 },
-    { -11.00, -8.12 },
-    { -10.87, -8.17 },
-    { -10.75, -8.22 },
-    { -10.62, -8.24 },
-    { -10.50, -8.24 },
-    { -10.37, -8.27 },
-    { -10.25, -8.29 },
-    { -10.12, -8.29 },
-    { -10.00, -8.29 },
-    { -9.87, -8.29 },
-    { -9.75, -8.24 },
-    { -9.62, -8.24 },
-    { -9.50, -8.19 },
-    { -9.37, -8.17 },
-    { -9.25, -8.09 },
-    { -9.12, -8.04 },
-    { -9.00, -7.97 },
-    { -8.87, -7.87 },
-    { -8.75, -7.75 },
-    { -8.65, -7.62 },
-    { -8.55, -7.50 },
-    { -8.48, -7.37 },
-    { -8.40, -7.25 },
-    { -8.33, -7.12 },
-    { -8.25, -7.00 },
-    { -8.20, -6.87 },
-    { -8.13, -6.75 },
-    { -8.08, -6.62 },
-    { -8.03, -6.50 },
-    { -7.98, -6.37 },
-    { -7.93, -6.25 },
-    { -7.88, -6.12 },
-    { -7.83, -6.00 },
-    { -7.80, -5.87 },
-    { -7.75, -5.75 },
-    { -7.73, -5.62 },
-    { -7.68, -5.50 },
-    { -7.65, -5.37 },
-    { -7.60, -5.25 },
-    { -7.58, -5.13 },
-    { -7.55, -5.00 },
-    { -7.53, -4.88 },
-    { -7.50, -4.75 },
-    { -7.48, -4.63 },
-    { -7.48, -4.50 },
-    { -7.43, -4.38 },
-    { -7.43, -4.25 },
-    { -7.40, -4.13 },
-    { -7.40, -4.00 },
-    { -7.38, -3.88 },
-    { -7.35, -3.75 },
-    { -7.35, -3.63 },
-    { -7.35, -3.50 },
-    { -7.33, -3.38 },
-    { -7.33, -3.25 },
-    { -7.30, -3.13 },
-    { -7.30, -3.00 },
-    { -7.30, -2.88 },
-    { -7.30, -2.76 },
-    { -7.30, -2.63 },
-    { -7.30, -2.51 },
-    { -7.30, -2.38 },
-    { -7.30, -2.26 },
-    { -7.30, -2.13 },
-    { -7.30, -2.01 },
-    { -7.30, -1.88 },
-    { -7.33, -1.76 },
-    { -7.35, -1.63 },
-    { -7.35, -1.51 },
-    { -7.35, -1.38 },
-    { -7.35, -1.26 },
-    { -7.40, -1.13 },
-    { -7.40, -1.06 },
-    { -7.38, -1.18 },
-    { -7.35, -1.31 },
-    { -7.35, -1.43 },
-    { -7.35, -1.56 },
-    { -7.33, -1.68 },
-    { -7.33, -1.81 },
-    { -7.30, -1.93 },
-    { -7.30, -2.06 },
-    { -7.30, -2.18 },
-    { -7.30, -2.31 },
-    { -7.30, -2.43 },
-    { -7.30, -2.56 },
-    { -7.30, -2.68 },
-    { -7.30, -2.81 },
-    { -7.30, -2.93 },
-    { -7.30, -3.05 },
-    { -7.30, -3.18 },
-    { -7.33, -3.30 },
-    { -7.35, -3.43 },
-    { -7.35, -3.55 },
-    { -7.35, -3.68 },
-    { -7.35, -3.80 },
-    { -7.38, -3.93 },
-    { -7.40, -4.05 },
-    { -7.40, -4.18 },
-    { -7.43, -4.30 },
-    { -7.45, -4.43 },
-    { -7.48, -4.55 },
-    { -7.48, -4.68 },
-    { -7.50, -4.80 },
-    { -7.55, -4.93 },
-    { -7.55, -5.05 },
-    { -7.60, -5.18 },
-    { -7.63, -5.30 },
-    { -7.65, -5.42 },
-    { -7.68, -5.55 },
-    { -7.73, -5.67 },
-    { -7.75, -5.80 },
-    { -7.80, -5.92 },
-    { -7.85, -6.05 },
-    { -7.90, -6.17 },
-    { -7.95, -6.30 },
-    { -8.00, -6.42 },
-    { -8.05, -6.55 },
-    { -8.10, -6.67 },
-    { -8.15, -6.80 },
-    { -8.23, -6.92 },
-    { -8.30, -7.05 },
-    { -8.38, -7.17 },
-    { -8.45, -7.30 },
-    { -8.53, -7.42 },
-    { -8.60, -7.55 },
-    { -8.70, -7.67 },
-    { -8.82, -7.80 },
-    { -8.95, -7.89 },
-    { -9.07, -7.99 },
-    { -9.20, -8.07 },
-    { -9.32, -8.14 },
-    { -9.45, -8.17 },
-    { -9.57, -8.22 },
-    { -9.70, -8.24 },
-    { -9.82, -8.27 },
-    { -9.95, -8.29 },
-    { -10.07, -8.29 },
-    { -10.20, -8.29 },
-    { -10.32, -8.29 },
-    { -10.45, -8.27 },
-    { -10.57, -8.24 },
-    { -10.70, -8.22 },
-    { -10.82, -8.17 },
-    { -10.95, -8.14 },
-    { -11.07, -8.09 },
-    { -11.20, -7.99 },
-    { -11.24, -7.87 },
-    { -11.24, -7.75 },
-    { -11.17, -7.62 },
-    { -11.05, -7.52 },
-    { -10.92, -7.47 },
-    { -10.80, -7.52 },
-    { -10.67, -7.55 },
-    { -10.55, -7.57 },
-    { -10.42, -7.57 },
-    { -10.30, -7.60 },
-    { -10.17, -7.60 },
-    { -10.05, -7.60 },
-    { -9.92, -7.57 },
-    { -9.80, -7.55 },
-    { -9.67, -7.52 },
-    { -9.55, -7.45 },
-    { -9.42, -7.37 },
-    { -9.30, -7.25 },
-    { -9.20, -7.12 },
-    { -9.10, -7.00 },
-    { -9.02, -6.87 },
-    { -8.95, -6.75 },
-    { -8.87, -6.62 },
-    { -8.82, -6.50 },
-    { -8.77, -6.37 },
-    { -8.70, -6.25 },
-    { -8.65, -6.12 },
-    { -8.60, -6.00 },
-    { -8.55, -5.87 },
-    { -8.50, -5.75 },
-    { -8.48, -5.62 },
-    { -8.43, -5.50 },
-    { -8.38, -5.37 },
-    { -8.35, -5.25 },
-    { -8.33, -5.13 },
-    { -8.28, -5.00 },
-    { -8.25, -4.88 },
-    { -8.23, -4.75 },
-    { -8.20, -4.63 },
-    { -8.18, -4.50 },
-    { -8.15, -4.38 },
-    { -8.13, -4.25 },
-    { -8.13, -4.13 },
-    { -8.10, -4.00 },
-    { -8.08, -3.88 },
-    { -8.08, -3.75 },
-    { -8.05, -3.63 },
-    { -8.05, -3.50 },
-    { -8.03, -3.38 },
-    { -8.00, -3.25 },
-    { -8.00, -3.13 },
-    { -8.00, -3.00 },
-    { -8.00, -2.88 },
-    { -7.98, -2.76 },
-    { -7.95, -2.63 },
-    { -7.95, -2.51 },
-    { -7.95, -2.38 },
-    { -7.95, -2.26 },
-    { -7.95, -2.13 },
-    { -7.93, -2.01 },
-    { -7.93, -1.88 },
-    { -7.93, -1.76 },
-    { -7.93, -1.63 },
-    { -7.93, -1.51 },
-    { -7.93, -1.38 },
-    { -7.93, -1.26 },
-    { -7.93, -1.13 },
-    { -7.93, -1.01 },
-    { -7.93, -0.88 },
-    { -3.19, 1.96 },
-    { -3.31, 1.94 },
-    { -3.44, 1.91 },
-    { -3.56, 1.89 },
-    { -3.68, 1.86 },
-    { -3.81, 1.84 },
-    { -3.93, 1.79 },
-    { -4.06, 1.76 },
-    { -4.18, 1.71 },
-    { -4.31, 1.66 },
-    { -4.43, 1.64 },
-    { -4.56, 1.59 },
-    { -4.68, 1.54 },
-    { -4.81, 1.51 },
-    { -4.93, 1.46 },
-    { -5.06, 1.41 },
-    { -5.18, 1.36 },
-    { -5.31, 1.31 },
-    { -5.43, 1.26 },
-    { -5.56, 1.21 },
-    { -5.68, 1.16 },
-    { -5.81, 1.09 },
-    { -5.93, 1.04 },
-    { -6.06, 0.99 },
-    { -6.18, 0.94 },
-    { -6.30, 0.86 },
-    { -6.43, 0.81 },
-    { -6.55, 0.74 },
-    { -6.68, 0.66 },
-    { -6.80, 0.59 },
-    { -6.93, 0.51 },
-    { -7.05, 0.44 },
-    { -7.18, 0.36 },
-    { -7.30, 0.26 },
-    { -7.38, 0.16 },
-    { -7.28, 0.09 },
-    { -7.15, 0.01 },
-    { -7.03, -0.04 },
-    { -6.90, -0.11 },
-    { -6.78, -0.16 },
-    { -6.65, -0.24 },
-    { -6.53, -0.28 },
-    { -6.40, -0.33 },
-    { -6.28, -0.41 },
-    { -6.16, -0.43 },
-    { -6.03, -0.51 },
-    { -5.91, -0.56 },
-    { -5.78, -0.58 },
-    { -5.66, -0.63 },
-    { -5.53, -0.68 },
-    { -5.41, -0.73 },
-    { -5.28, -0.76 },
-    { -5.16, -0.81 },
-    { -5.03, -0.83 },
-    { -4.91, -0.86 },
-    { -4.78, -0.88 },
-    { -4.66, -0.93 },
-    { -4.53, -0.96 },
-    { -4.41, -0.98 },
-    { -4.31, -1.06 },
-    { -4.28, -1.18 },
-    { -4.41, -1.28 },
-    { -4.53, -1.26 },
-    { -4.66, -1.23 },
-    { -4.78, -1.21 },
-    { -4.91, -1.18 },
-    { -5.03, -1.13 },
-    { -5.16, -1.11 },
-    { -5.28, -1.08 },
-    { -5.41, -1.03 },
-    { -5.53, -1.01 },
-    { -5.66, -0.96 },
-    { -5.78, -0.91 },
-    { -5.91, -0.86 },
-    { -6.03, -0.81 },
-    { -6.16, -0.78 },
-    { -6.28, -0.71 },
-    { -6.40, -0.66 },
-    { -6.53, -0.61 },
-    { -6.65, -0.56 },
-    { -6.78, -0.51 },
-    { -6.90, -0.43 },
-    { -7.03, -0.38 },
-    { -7.15, -0.31 },
-    { -7.28, -0.24 },
-    { -7.40, -0.21 },
-    { -7.35, -0.28 },
-    { -7.33, -0.36 },
-    { -7.28, -0.48 },
-    { -7.23, -0.61 },
-    { -7.18, -0.73 },
-    { -7.13, -0.86 },
-    { -7.08, -0.98 },
-    { -7.03, -1.11 },
-    { -6.95, -1.23 },
-    { -6.90, -1.36 },
-    { -6.85, -1.48 },
-    { -6.80, -1.61 },
-    { -6.73, -1.73 },
-    { -6.68, -1.86 },
-    { -6.63, -1.98 },
-    { -6.58, -2.11 },
-    { -6.50, -2.23 },
-    { -6.45, -2.36 },
-    { -6.38, -2.48 },
-    { -6.33, -2.61 },
-    { -6.25, -2.73 },
-    { -6.20, -2.85 },
-    { -6.13, -2.98 },
-    { -6.06, -3.10 },
-    { -5.98, -3.23 },
-    { -5.91, -3.35 },
-    { -5.83, -3.48 },
-    { -5.76, -3.60 },
-    { -5.68, -3.73 },
-    { -5.61, -3.85 },
-    { -5.51, -3.98 },
-    { -5.41, -4.10 },
-    { -5.31, -4.23 },
-    { -5.18, -4.35 },
-    { -5.06, -4.45 },
-    { -4.93, -4.53 },
-    { -4.81, -4.58 },
-    { -4.68, -4.63 },
-    { -4.56, -4.68 },
-    { -4.43, -4.68 },
-    { -4.31, -4.70 },
-    { -4.18, -4.70 },
-    { -4.06, -4.68 },
-    { -3.93, -4.68 },
-    { -3.81, -4.65 },
-    { -3.68, -4.63 },
-    { -3.56, -4.60 },
-    { -3.44, -4.55 },
-    { -3.31, -4.50 },
-    { -3.19, -4.45 },
-    { -3.06, -4.38 },
-    { -2.94, -4.30 },
-    { -2.81, -4.23 },
-    { -2.69, -4.10 },
-    { -2.56, -3.98 },
-    { -2.46, -3.85 },
-    { -2.39, -3.73 },
-    { -2.34, -3.60 },
-    { -2.31, -3.48 },
-    { -2.26, -3.35 },
-    { -2.26, -3.23 },
-    { -2.26, -3.10 },
-    { -2.26, -2.98 },
-    { -2.26, -2.85 },
-    { -2.26, -2.73 },
-    { -2.31, -2.61 },
-    { -2.31, -2.48 },
-    { -2.36, -2.36 },
-    { -2.39, -2.23 },
-    { -2.44, -2.11 },
-    { -2.49, -1.98 },
-    { -2.56, -1.86 },
-    { -2.64, -1.73 },
-    { -2.66, -1.61 },
-    { -2.54, -1.51 },
-    { -2.41, -1.46 },
-    { -2.29, -1.41 },
-    { -2.16, -1.36 },
-    { -2.04, -1.28 },
-    { -1.91, -1.21 },
-    { -1.79, -1.11 },
-    { -1.66, -1.01 },
-    { -1.56, -0.88 },
-    { -1.46, -0.76 },
-    { -1.39, -0.63 },
-    { -1.31, -0.51 },
-    { -1.26, -0.38 },
-    { -1.24, -0.26 },
-    { -1.21, -0.14 },
-    { -1.19, -0.01 },
-    { -1.16, 0.11 },
-    { -1.16, 0.24 },
-    { -1.19, 0.36 },
-    { -1.21, 0.49 },
-    { -1.21, 0.61 },
-    { -1.26, 0.74 },
-    { -1.29, 0.86 },
-    { -1.34, 0.99 },
-    { -1.41, 1.11 },
-    { -1.46, 1.24 },
-    { -1.56, 1.36 },
-    { -1.66, 1.49 },
-    { -1.79, 1.59 },
-    { -1.91, 1.71 },
-    { -2.04, 1.79 },
-    { -2.16, 1.84 },
-    { -2.29, 1.89 },
-    { -2.41, 1.91 },
-    { -2.54, 1.94 },
-    { -2.66, 1.96 },
-    { -2.79, 1.96 },
-    { -2.91, 1.96 },
-    { -3.04, 1.96 },
-    { -3.16, 1.96 },
-    { -12.94, 1.96 },
-    { -13.07, 1.94 },
-    { -13.19, 1.91 },
-    { -13.32, 1.86 },
-    { -13.44, 1.81 },
-    { -13.57, 1.74 },
-    { -13.69, 1.66 },
-    { -13.81, 1.59 },
-    { -13.94, 1.49 },
-    { -14.06, 1.36 },
-    { -14.16, 1.24 },
-    { -14.24, 1.11 },
-    { -14.31, 0.99 },
-    { -14.36, 0.86 },
-    { -14.41, 0.74 },
-    { -14.44, 0.61 },
-    { -14.46, 0.49 },
-    { -14.49, 0.36 },
-    { -14.51, 0.24 },
-    { -14.51, 0.11 },
-    { -14.49, -0.01 },
-    { -14.46, -0.14 },
-    { -14.46, -0.26 },
-    { -14.41, -0.38 },
-    { -14.36, -0.51 },
-    { -14.29, -0.63 },
-    { -14.21, -0.76 },
-    { -14.11, -0.88 },
-    { -13.99, -0.98 },
-    { -13.86, -1.08 },
-    { -13.74, -1.16 },
-    { -13.62, -1.23 },
-    { -13.49, -1.28 },
-    { -13.37, -1.33 },
-    { -13.24, -1.38 },
-    { -13.12, -1.43 },
-    { -12.99, -1.46 },
-    { -12.87, -1.51 },
-    { -12.77, -1.63 },
-    { -12.82, -1.76 },
-    { -12.89, -1.88 },
-    { -12.97, -2.01 },
-    { -13.04, -2.13 },
-    { -13.09, -2.26 },
-    { -13.14, -2.38 },
-    { -13.17, -2.51 },
-    { -13.22, -2.63 },
-    { -13.24, -2.76 },
-    { -13.24, -2.88 },
-    { -13.27, -3.00 },
-    { -13.24, -3.13 },
-    { -13.24, -3.25 },
-    { -13.22, -3.38 },
-    { -13.19, -3.50 },
-    { -13.14, -3.63 },
-    { -13.09, -3.75 },
-    { -13.02, -3.88 },
-    { -12.94, -4.00 },
-    { -12.84, -4.13 },
-    { -12.72, -4.25 },
-    { -12.59, -4.35 },
-    { -12.47, -4.45 },
-    { -12.34, -4.53 },
-    { -12.22, -4.60 },
-    { -12.09, -4.65 },
-    { -11.97, -4.68 },
-    { -11.84, -4.73 },
-    { -11.72, -4.73 },
-    { -11.59, -4.75 },
-    { -11.47, -4.75 },
-    { -11.34, -4.73 },
-    { -11.22, -4.70 },
-    { -11.10, -4.68 },
-    { -10.97, -4.63 },
-    { -10.85, -4.60 },
-    { -10.72, -4.55 },
-    { -10.60, -4.48 },
-    { -10.47, -4.40 },
-    { -10.35, -4.33 },
-    { -10.22, -4.23 },
-    { -10.10, -4.13 },
-    { -9.97, -4.00 },
-    { -9.87, -3.88 },
-    { -9.75, -3.75 },
-    { -9.67, -3.63 },
-    { -9.57, -3.50 },
-    { -9.50, -3.38 },
-    { -9.42, -3.25 },
-    { -9.37, -3.13 },
-    { -9.32, -3.00 },
-    { -9.27, -2.88 },
-    { -9.20, -2.76 },
-    { -9.15, -2.63 },
-    { -9.10, -2.51 },
-    { -9.02, -2.38 },
-    { -8.97, -2.26 },
-    { -8.92, -2.13 },
-    { -8.87, -2.01 },
-    { -8.80, -1.88 },
-    { -8.75, -1.76 },
-    { -8.70, -1.63 },
-    { -8.63, -1.51 },
-    { -8.58, -1.38 },
-    { -8.53, -1.26 },
-    { -8.45, -1.13 },
-    { -8.40, -1.01 },
-    { -8.35, -0.88 },
-    { -8.28, -0.76 },
-    { -8.23, -0.63 },
-    { -8.18, -0.51 },
-    { -8.10, -0.38 },
-    { -8.05, -0.26 },
-    { -8.15, -0.26 },
-    { -8.28, -0.33 },
-    { -8.40, -0.38 },
-    { -8.53, -0.43 },
-    { -8.65, -0.51 },
-    { -8.77, -0.56 },
-    { -8.90, -0.61 },
-    { -9.02, -0.66 },
-    { -9.15, -0.71 },
-    { -9.27, -0.76 },
-    { -9.40, -0.81 },
-    { -9.52, -0.86 },
-    { -9.65, -0.91 },
-    { -9.77, -0.93 },
-    { -9.90, -0.98 },
-    { -10.02, -1.03 },
-    { -10.15, -1.06 },
-    { -10.27, -1.11 },
-    { -10.40, -1.16 },
-    { -10.52, -1.18 },
-    { -10.65, -1.23 },
-    { -10.77, -1.26 },
-    { -10.90, -1.31 },
-    { -11.02, -1.33 },
-    { -11.15, -1.33 },
-    { -11.24, -1.21 },
-    { -11.17, -1.08 },
-    { -11.05, -1.03 },
-    { -10.92, -0.98 },
-    { -10.80, -0.96 },
-    { -10.67, -0.93 },
-    { -10.55, -0.88 },
-    { -10.42, -0.83 },
-    { -10.30, -0.81 },
-    { -10.17, -0.76 },
-    { -10.05, -0.73 },
-    { -9.92, -0.68 },
-    { -9.80, -0.63 },
-    { -9.67, -0.58 },
-    { -9.55, -0.53 },
-    { -9.42, -0.48 },
-    { -9.30, -0.43 },
-    { -9.17, -0.41 },
-    { -9.05, -0.36 },
-    { -8.92, -0.28 },
-    { -8.80, -0.24 },
-    { -8.68, -0.19 },
-    { -8.55, -0.14 },
-    { -8.43, -0.09 },
-    { -8.30, -0.01 },
-    { -8.18, 0.04 },
-    { -8.05, 0.11 },
-    { -8.08, 0.19 },
-    { -8.20, 0.24 },
-    { -8.33, 0.31 },
-    { -8.45, 0.36 },
-    { -8.58, 0.41 },
-    { -8.70, 0.49 },
-    { -8.82, 0.54 },
-    { -8.95, 0.61 },
-    { -9.07, 0.66 },
-    { -9.20, 0.74 },
-    { -9.32, 0.79 },
-    { -9.45, 0.84 },
-    { -9.57, 0.91 },
-    { -9.70, 0.96 },
-    { -9.82, 1.04 },
-    { -9.95, 1.09 },
-    { -10.07, 1.16 },
-    { -10.20, 1.21 },
-    { -10.32, 1.29 },
-    { -10.45, 1.34 },
-    { -10.57, 1.39 },
-    { -10.70, 1.46 },
-    { -10.82, 1.51 },
-    { -10.95, 1.59 },
-    { -11.07, 1.64 },
-    { -11.20, 1.69 },
-    { -11.32, 1.74 },
-    { -11.44, 1.79 },
-    { -11.57, 1.84 },
-    { -11.69, 1.86 },
-    { -11.82, 1.91 },
-    { -11.94, 1.94 },
-    { -12.07, 1.96 },
-    { -12.19, 1.99 },
-    { -12.32, 1.99 },
-    { -12.44, 1.99 },
-    { -12.57, 1.99 },
-    { -12.69, 1.99 },
-    { -12.82, 1.99 },
-    { -12.67, 2.28 },
-    { -12.79, 2.28 },
-    { -12.92, 2.28 },
-    { -13.04, 2.24 },
-    { -13.17, 2.21 },
-    { -13.29, 2.19 },
-    { -13.42, 2.14 },
-    { -13.54, 2.09 },
-    { -13.67, 2.04 },
-    { -13.79, 1.96 },
-    { -13.91, 1.89 },
-    { -14.04, 1.79 },
-    { -14.16, 1.69 },
-    { -14.29, 1.56 },
-    { -14.39, 1.44 },
-    { -14.49, 1.31 },
-    { -14.56, 1.19 },
-    { -14.61, 1.06 },
-    { -14.66, 0.94 },
-    { -14.71, 0.81 },
-    { -14.74, 0.69 },
-    { -14.76, 0.56 },
-    { -14.79, 0.44 },
-    { -14.79, 0.31 },
-    { -14.79, 0.19 },
-    { -14.79, 0.06 },
-    { -14.79, -0.06 },
-    { -14.79, -0.19 },
-    { -14.74, -0.31 },
-    { -14.71, -0.43 },
-    { -14.66, -0.56 },
-    { -14.61, -0.68 },
-    { -14.54, -0.81 },
-    { -14.46, -0.93 },
-    { -14.36, -1.06 },
-    { -14.24, -1.18 },
-    { -14.11, -1.28 },
-    { -13.99, -1.38 },
-    { -13.86, -1.46 },
-    { -13.74, -1.51 },
-    { -13.62, -1.58 },
-    { -13.49, -1.63 },
-    { -13.37, -1.66 },
-    { -13.24, -1.71 },
-    { -13.22, -1.81 },
-    { -13.29, -1.93 },
-    { -13.34, -2.06 },
-    { -13.39, -2.18 },
-    { -13.44, -2.31 },
-    { -13.49, -2.43 },
-    { -13.52, -2.56 },
-    { -13.54, -2.68 },
-    { -13.54, -2.81 },
-    { -13.57, -2.93 },
-    { -13.57, -3.05 },
-    { -13.57, -3.18 },
-    { -13.54, -3.30 },
-    { -13.52, -3.43 },
-    { -13.49, -3.55 },
-    { -13.44, -3.68 },
-    { -13.39, -3.80 },
-    { -13.34, -3.93 },
-    { -13.27, -4.05 },
-    { -13.19, -4.18 },
-    { -13.09, -4.30 },
-    { -12.97, -4.43 },
-    { -12.84, -4.55 },
-    { -12.72, -4.65 },
-    { -12.59, -4.73 },
-    { -12.47, -4.80 },
-    { -12.34, -4.88 },
-    { -12.22, -4.93 },
-    { -12.09, -4.95 },
-    { -11.97, -5.00 },
-    { -11.84, -5.03 },
-    { -11.72, -5.05 },
-    { -11.59, -5.05 },
-    { -11.47, -5.05 },
-    { -11.34, -5.03 },
-    { -11.22, -5.03 },
-    { -11.10, -5.00 },
-    { -10.97, -4.95 },
-    { -10.85, -4.93 },
-    { -10.72, -4.88 },
-    { -10.60, -4.83 },
-    { -10.47, -4.75 },
-    { -10.35, -4.68 },
-    { -10.22, -4.60 },
-    { -10.10, -4.50 },
-    { -9.97, -4.40 },
-    { -9.85, -4.30 },
-    { -9.72, -4.18 },
-    { -9.62, -4.05 },
-    { -9.50, -3.93 },
-    { -9.42, -3.80 },
-    { -9.32, -3.68 },
-    { -9.25, -3.55 },
-    { -9.17, -3.43 },
-    { -9.12, -3.30 },
-    { -9.07, -3.18 },
-    { -9.00, -3.05 },
-    { -8.95, -2.93 },
-    { -8.90, -2.81 },
-    { -8.82, -2.68 },
-    { -8.77, -2.56 },
-    { -8.72, -2.43 },
-    { -8.68, -2.31 },
-    { -8.63, -2.18 },
-    { -8.55, -2.06 },
-    { -8.50, -1.93 },
-    { -8.45, -1.81 },
-    { -8.38, -1.68 },
-    { -8.33, -1.56 },
-    { -8.25, -1.43 },
-    { -8.20, -1.31 },
-    { -8.15, -1.18 },
-    { -8.10, -1.06 },
-    { -8.03, -0.93 },
-    { -7.98, -0.81 },
-    { -8.00, -0.83 },
-    { -8.05, -0.96 },
-    { -8.10, -1.08 },
-    { -8.15, -1.21 },
-    { -8.23, -1.33 },
-    { -8.28, -1.46 },
-    { -8.35, -1.58 },
-    { -8.40, -1.71 },
-    { -8.45, -1.83 },
-    { -8.53, -1.96 },
-    { -8.58, -2.08 },
-    { -8.63, -2.21 },
-    { -8.68, -2.33 },
-    { -8.75, -2.46 },
-    { -8.80, -2.58 },
-    { -8.85, -2.71 },
-    { -8.90, -2.83 },
-    { -8.97, -2.95 },
-    { -9.02, -3.08 },
-    { -9.07, -3.20 },
-    { -9.12, -3.33 },
-    { -9.20, -3.45 },
-    { -9.27, -3.58 },
-    { -9.37, -3.70 },
-    { -9.45, -3.83 },
-    { -9.55, -3.95 },
-    { -9.65, -4.08 },
-    { -9.77, -4.20 },
-    { -9.90, -4.33 },
-    { -10.02, -4.43 },
-    { -10.15, -4.53 },
-    { -10.27, -4.63 },
-    { -10.40, -4.70 },
-    { -10.52, -4.78 },
-    { -10.65, -4.83 },
-    { -10.77, -4.88 },
-    { -10.90, -4.93 },
-    { -11.02, -4.98 },
-    { -11.15, -5.00 },
-    { -11.27, -5.03 },
-    { -11.39, -5.05 },
-    { -11.52, -5.05 },
-    { -11.64, -5.05 },
-    { -11.77, -5.03 },
-    { -11.89, -5.00 },
-    { -12.02, -5.00 },
-    { -12.14, -4.95 },
-    { -12.27, -4.90 },
-    { -12.39, -4.85 },
-    { -12.52, -4.78 },
-    { -12.64, -4.68 },
-    { -12.77, -4.58 },
-    { -12.89, -4.48 },
-    { -13.02, -4.35 },
-    { -13.12, -4.23 },
-    { -13.22, -4.10 },
-    { -13.29, -3.98 },
-    { -13.37, -3.85 },
-    { -13.42, -3.73 },
-    { -13.47, -3.60 },
-    { -13.52, -3.48 },
-    { -13.54, -3.35 },
-    { -13.57, -3.23 },
-    { -13.57, -3.10 },
-    { -13.57, -2.98 },
-    { -13.57, -2.85 },
-    { -13.54, -2.73 },
-    { -13.52, -2.61 },
-    { -13.49, -2.48 },
-    { -13.44, -2.36 },
-    { -13.42, -2.23 },
-    { -13.37, -2.11 },
-    { -13.29, -1.98 },
-    { -13.24, -1.86 },
-    { -13.19, -1.73 },
-    { -13.32, -1.68 },
-    { -13.44, -1.63 },
-    { -13.57, -1.58 },
-    { -13.69, -1.53 },
-    { -13.81, -1.46 },
-    { -13.94, -1.38 },
-    { -14.06, -1.31 },
-    { -14.19, -1.21 },
-    { -14.31, -1.08 },
-    { -14.41, -0.96 },
-    { -14.51, -0.83 },
-    { -14.59, -0.71 },
-    { -14.66, -0.58 },
-    { -14.71, -0.46 },
-    { -14.74, -0.33 },
-    { -14.76, -0.21 },
-    { -14.79, -0.09 },
-    { -14.79, 0.04 },
-    { -14.79, 0.16 },
-    { -14.79, 0.29 },
-    { -14.79, 0.41 },
-    { -14.76, 0.54 },
-    { -14.74, 0.66 },
-    { -14.71, 0.79 },
-    { -14.66, 0.91 },
-    { -14.61, 1.04 },
-    { -14.56, 1.16 },
-    { -14.49, 1.29 },
-    { -14.39, 1.41 },
-    { -14.29, 1.54 },
-    { -14.16, 1.66 },
-    { -14.04, 1.79 },
-    { -13.91, 1.86 },
-    { -13.79, 1.96 },
-    { -13.67, 2.01 },
-    { -13.54, 2.09 },
-    { -13.42, 2.14 },
-    { -13.29, 2.19 },
-    { -13.17, 2.21 },
-    { -13.04, 2.24 },
-    { -12.92, 2.28 },
-    { -12.79, 2.28 },
-    { -12.67, 2.28 },
-    { -12.54, 2.31 },
-    { -12.42, 2.28 },
-    { -12.29, 2.28 },
-    { -12.17, 2.28 },
-    { -12.04, 2.26 },
-    { -11.92, 2.24 },
-    { -11.79, 2.21 },
-    { -11.67, 2.19 },
-    { -11.54, 2.14 },
-    { -11.42, 2.09 },
-    { -11.29, 2.06 },
-    { -11.17, 2.01 },
-    { -11.05, 1.96 },
-    { -10.92, 1.89 },
-    { -10.80, 1.84 },
-    { -10.67, 1.76 },
-    { -10.55, 1.71 },
-    { -10.42, 1.66 },
-    { -10.30, 1.59 },
-    { -10.17, 1.54 },
-    { -10.05, 1.46 },
-    { -9.92, 1.41 },
-    { -9.80, 1.34 },
-    { -9.67, 1.29 },
-    { -9.55, 1.24 },
-    { -9.42, 1.16 },
-    { -9.30, 1.11 },
-    { -9.17, 1.04 },
-    { -9.05, 0.96 },
-    { -9.02, 0.96 },
-    { -9.15, 1.04 },
-    { -9.27, 1.11 },
-    { -9.40, 1.16 },
-    { -9.52, 1.24 },
-    { -9.65, 1.29 },
-    { -9.77, 1.34 },
-    { -9.90, 1.41 },
-    { -10.02, 1.46 },
-    { -10.15, 1.54 },
-    { -10.27, 1.59 },
-    { -10.40, 1.66 },
-    { -10.52, 1.71 },
-    { -10.65, 1.76 },
-    { -10.77, 1.84 },
-    { -10.90, 1.89 },
-    { -11.02, 1.94 },
-    { -11.15, 1.99 },
-    { -11.27, 2.06 },
-    { -11.39, 2.09 },
-    { -11.52, 2.14 },
-    { -11.64, 2.16 },
-    { -11.77, 2.21 },
-    { -11.89, 2.24 },
-    { -12.02, 2.26 },
-    { -12.14, 2.28 },
-    { -12.27, 2.28 },
-    { -12.39, 2.28 },
-    { -12.52, 2.31 },
-    { -9.72, 6.43 },
-    { -9.85, 6.43 },
-    { -9.97, 6.40 },
-    { -10.10, 6.38 },
-    { -10.22, 6.35 },
-    { -10.35, 6.30 },
-    { -10.47, 6.25 },
-    { -10.60, 6.18 },
-    { -10.72, 6.10 },
-    { -10.85, 6.00 },
-    { -10.97, 5.88 },
-    { -11.07, 5.75 },
-    { -11.15, 5.63 },
-    { -11.22, 5.50 },
-    { -11.27, 5.38 },
-    { -11.32, 5.25 },
-    { -11.34, 5.13 },
-    { -11.37, 5.00 },
-    { -11.37, 4.88 },
-    { -11.37, 4.76 },
-    { -11.37, 4.63 },
-    { -11.37, 4.51 },
-    { -11.37, 4.38 },
-    { -11.34, 4.26 },
-    { -11.29, 4.13 },
-    { -11.27, 4.01 },
-    { -11.22, 3.88 },
-    { -11.17, 3.76 },
-    { -11.10, 3.63 },
-    { -11.05, 3.51 },
-    { -10.97, 3.38 },
-    { -10.87, 3.26 },
-    { -10.80, 3.13 },
-    { -10.70, 3.01 },
-    { -10.60, 2.88 },
-    { -10.50, 2.76 },
-    { -10.40, 2.63 },
-    { -10.27, 2.51 },
-    { -10.15, 2.38 },
-    { -10.02, 2.26 },
-    { -9.90, 2.14 },
-    { -9.77, 2.04 },
-    { -9.65, 1.91 },
-    { -9.52, 1.81 },
-    { -9.40, 1.69 },
-    { -9.27, 1.59 },
-    { -9.15, 1.49 },
-    { -9.02, 1.39 },
-    { -8.90, 1.29 },
-    { -8.77, 1.19 },
-    { -8.65, 1.11 },
-    { -8.53, 1.01 },
-    { -8.40, 0.91 },
-    { -8.28, 0.84 },
-    { -8.15, 0.74 },
-    { -8.03, 0.66 },
-    { -7.90, 0.61 },
-    { -7.88, 0.71 },
-    { -7.85, 0.84 },
-    { -7.85, 0.96 },
-    { -7.85, 1.09 },
-    { -7.85, 1.21 },
-    { -7.83, 1.34 },
-    { -7.83, 1.46 },
-    { -7.83, 1.59 },
-    { -7.83, 1.71 },
-    { -7.83, 1.84 },
-    { -7.83, 1.96 },
-    { -7.83, 2.09 },
-    { -7.83, 2.21 },
-    { -7.83, 2.33 },
-    { -7.83, 2.46 },
-    { -7.83, 2.58 },
-    { -7.83, 2.71 },
-    { -7.83, 2.83 },
-    { -7.83, 2.96 },
-    { -7.83, 3.08 },
-    { -7.83, 3.21 },
-    { -7.85, 3.33 },
-    { -7.85, 3.46 },
-    { -7.85, 3.58 },
-    { -7.88, 3.71 },
-    { -7.88, 3.83 },
-    { -7.88, 3.96 },
-    { -7.80, 4.08 },
-    { -7.68, 4.08 },
-    { -7.60, 3.96 },
-    { -7.58, 3.83 },
-    { -7.55, 3.71 },
-    { -7.55, 3.58 },
-    { -7.55, 3.46 },
-    { -7.55, 3.33 },
-    { -7.53, 3.21 },
-    { -7.53, 3.08 },
-    { -7.53, 2.96 },
-    { -7.53, 2.83 },
-    { -7.53, 2.71 },
-    { -7.50, 2.58 },
-    { -7.50, 2.46 },
-    { -7.50, 2.33 },
-    { -7.50, 2.21 },
-    { -7.50, 2.09 },
-    { -7.53, 1.96 },
-    { -7.53, 1.84 },
-    { -7.53, 1.71 },
-    { -7.53, 1.59 },
-    { -7.53, 1.46 },
-    { -7.53, 1.34 },
-    { -7.55, 1.21 },
-    { -7.55, 1.09 },
-    { -7.55, 0.96 },
-    { -7.55, 0.84 },
-    { -7.55, 0.71 },
-    { -7.53, 0.61 },
-    { -7.40, 0.69 },
-    { -7.28, 0.76 },
-    { -7.15, 0.86 },
-    { -7.03, 0.94 },
-    { -6.90, 1.04 },
-    { -6.78, 1.14 },
-    { -6.65, 1.24 },
-    { -6.53, 1.36 },
-    { -6.40, 1.46 },
-    { -6.28, 1.56 },
-    { -6.16, 1.69 },
-    { -6.03, 1.79 },
-    { -5.91, 1.91 },
-    { -5.78, 2.04 },
-    { -5.66, 2.16 },
-    { -5.53, 2.28 },
-    { -5.41, 2.41 },
-    { -5.28, 2.53 },
-    { -5.18, 2.66 },
-    { -5.06, 2.78 },
-    { -4.96, 2.91 },
-    { -4.86, 3.03 },
-    { -4.76, 3.16 },
-    { -4.66, 3.28 },
-    { -4.58, 3.41 },
-    { -4.48, 3.53 },
-    { -4.41, 3.66 },
-    { -4.33, 3.78 },
-    { -4.28, 3.91 },
-    { -4.26, 4.03 },
-    { -4.21, 4.16 },
-    { -4.18, 4.28 },
-    { -4.18, 4.41 },
-    { -4.16, 4.53 },
-    { -4.16, 4.66 },
-    { -4.18, 4.78 },
-    { -4.18, 4.90 },
-    { -4.21, 5.03 },
-    { -4.26, 5.15 },
-    { -4.31, 5.28 },
-    { -4.36, 5.40 },
-    { -4.43, 5.53 },
-    { -4.53, 5.65 },
-    { -4.63, 5.75 },
-    { -4.76, 5.88 },
-    { -4.88, 5.98 },
-    { -5.01, 6.05 },
-    { -5.13, 6.13 },
-    { -5.26, 6.18 },
-    { -5.38, 6.23 },
-    { -5.51, 6.28 },
-    { -5.63, 6.30 },
-    { -5.76, 6.35 },
-    { -5.88, 6.38 },
-    { -6.01, 6.38 },
-    { -6.13, 6.40 },
-    { -6.25, 6.40 },
-    { -6.38, 6.40 },
-    { -6.50, 6.38 },
-    { -6.63, 6.35 },
-    { -6.75, 6.33 },
-    { -6.88, 6.28 },
-    { -7.00, 6.23 },
-    { -7.13, 6.15 },
-    { -7.25, 6.05 },
-    { -7.38, 5.95 },
-    { -7.50, 5.83 },
-    { -7.60, 5.70 },
-    { -7.70, 5.58 },
-    { -7.83, 5.58 },
-    { -7.93, 5.68 },
-    { -8.05, 5.80 },
-    { -8.15, 5.93 },
-    { -8.28, 6.03 },
-    { -8.40, 6.10 },
-    { -8.53, 6.18 },
-    { -8.65, 6.25 },
-    { -8.77, 6.30 },
-    { -8.90, 6.35 },
-    { -9.02, 6.38 },
-    { -9.15, 6.40 },
-    { -9.27, 6.43 },
-    { -9.40, 6.43 },
-    { -9.52, 6.45 },
-    { -9.85, 6.75 },
-    { -9.97, 6.70 },
-    { -10.10, 6.70 },
-    { -10.22, 6.65 },
-    { -10.35, 6.63 },
-    { -10.47, 6.58 },
-    { -10.60, 6.53 },
-    { -10.72, 6.45 },
-    { -10.85, 6.38 },
-    { -10.97, 6.30 },
-    { -11.10, 6.18 },
-    { -11.22, 6.05 },
-    { -11.32, 5.93 },
-    { -11.39, 5.80 },
-    { -11.47, 5.68 },
-    { -11.52, 5.55 },
-    { -11.57, 5.43 },
-    { -11.62, 5.30 },
-    { -11.64, 5.18 },
-    { -11.67, 5.05 },
-    { -11.69, 4.93 },
-    { -11.69, 4.80 },
-    { -11.69, 4.68 },
-    { -11.69, 4.56 },
-    { -11.67, 4.43 },
-    { -11.67, 4.31 },
-    { -11.64, 4.18 },
-    { -11.62, 4.06 },
-    { -11.57, 3.93 },
-    { -11.52, 3.81 },
-    { -11.47, 3.68 },
-    { -11.42, 3.56 },
-    { -11.34, 3.43 },
-    { -11.27, 3.31 },
-    { -11.20, 3.18 },
-    { -11.12, 3.06 },
-    { -11.02, 2.93 },
-    { -10.92, 2.81 },
-    { -10.82, 2.68 },
-    { -10.72, 2.56 },
-    { -10.62, 2.43 },
-    { -10.50, 2.31 },
-    { -10.37, 2.19 },
-    { -10.25, 2.06 },
-    { -10.12, 1.94 },
-    { -10.00, 1.81 },
-    { -9.87, 1.71 },
-    { -9.75, 1.59 },
-    { -9.62, 1.49 },
-    { -9.50, 1.39 },
-    { -9.37, 1.29 },
-    { -9.25, 1.19 },
-    { -9.12, 1.09 },
-    { -9.00, 1.01 },
-    { -8.87, 0.94 },
-    { -8.90, 0.89 },
-    { -8.82, 0.86 },
-    { -8.90, 0.96 },
-    { -9.02, 1.04 },
-    { -9.15, 1.11 },
-    { -9.27, 1.21 },
-    { -9.40, 1.31 },
-    { -9.52, 1.44 },
-    { -9.65, 1.54 },
-    { -9.77, 1.64 },
-    { -9.90, 1.76 },
-    { -10.02, 1.86 },
-    { -10.15, 1.99 },
-    { -10.27, 2.11 },
-    { -10.40, 2.24 },
-    { -10.52, 2.36 },
-    { -10.65, 2.48 },
-    { -10.75, 2.61 },
-    { -10.85, 2.73 },
-    { -10.95, 2.86 },
-    { -11.05, 2.98 },
-    { -11.12, 3.11 },
-    { -11.22, 3.23 },
-    { -11.29, 3.36 },
-    { -11.37, 3.48 },
-    { -11.42, 3.61 },
-    { -11.47, 3.73 },
-    { -11.54, 3.86 },
-    { -11.57, 3.98 },
-    { -11.62, 4.11 },
-    { -11.64, 4.23 },
-    { -11.67, 4.36 },
-    { -11.69, 4.48 },
-    { -11.69, 4.61 },
-    { -11.69, 4.73 },
-    { -11.69, 4.85 },
-    { -11.67, 4.98 },
-    { -11.67, 5.10 },
-    { -11.62, 5.23 },
-    { -11.59, 5.35 },
-    { -11.54, 5.48 },
-    { -11.49, 5.60 },
-    { -11.42, 5.73 },
-    { -11.34, 5.85 },
-    { -11.27, 5.98 },
-    { -11.15, 6.10 },
-    { -11.02, 6.23 },
-    { -10.90, 6.33 },
-    { -10.77, 6.43 },
-    { -10.65, 6.48 },
-    { -10.52, 6.55 },
-    { -10.40, 6.60 },
-    { -10.27, 6.65 },
-    { -10.15, 6.68 },
-    { -10.02, 6.70 },
-    { -9.90, 6.73 },
-    { -9.77, 6.75 },
-    { -9.65, 6.75 },
-    { -9.52, 6.75 },
-    { -9.40, 6.75 },
-    { -9.27, 6.73 },
-    { -9.15, 6.70 },
-    { -9.02, 6.70 },
-    { -8.90, 6.65 },
-    { -8.77, 6.63 },
-    { -8.65, 6.58 },
-    { -8.53, 6.50 },
-    { -8.40, 6.45 },
-    { -8.28, 6.38 },
-    { -8.15, 6.28 },
-    { -8.03, 6.18 },
-    { -7.90, 6.08 },
-    { -7.78, 5.98 },
-    { -7.68, 6.08 },
-    { -7.55, 6.18 },
-    { -7.43, 6.28 },
-    { -7.30, 6.38 },
-    { -7.18, 6.45 },
-    { -7.05, 6.53 },
-    { -6.93, 6.58 },
-    { -6.80, 6.63 },
-    { -6.68, 6.65 },
-    { -6.55, 6.68 },
-    { -6.43, 6.70 },
-    { -6.30, 6.70 },
-    { -6.18, 6.70 },
-    { -6.06, 6.70 },
-    { -5.93, 6.70 },
-    { -5.81, 6.68 },
-    { -5.68, 6.63 },
-    { -5.56, 6.60 },
-    { -5.43, 6.58 },
-    { -5.31, 6.53 },
-    { -5.18, 6.48 },
-    { -5.06, 6.40 },
-    { -4.93, 6.35 },
-    { -4.81, 6.28 },
-    { -4.68, 6.18 },
-    { -4.56, 6.08 },
-    { -4.43, 5.98 },
-    { -4.33, 5.85 },
-    { -4.23, 5.73 },
-    { -4.13, 5.60 },
-    { -4.06, 5.48 },
-    { -4.01, 5.35 },
-    { -3.96, 5.23 },
-    { -3.93, 5.10 },
-    { -3.88, 4.98 },
-    { -3.86, 4.85 },
-    { -3.86, 4.73 },
-    { -3.86, 4.61 },
-    { -3.86, 4.48 },
-    { -3.86, 4.36 },
-    { -3.88, 4.23 },
-    { -3.91, 4.11 },
-    { -3.93, 3.98 },
-    { -3.98, 3.86 },
-    { -4.03, 3.73 },
-    { -4.11, 3.61 },
-    { -4.18, 3.48 },
-    { -4.26, 3.36 },
-    { -4.33, 3.23 },
-    { -4.43, 3.11 },
-    { -4.53, 2.98 },
-    { -4.63, 2.86 },
-    { -4.73, 2.73 },
-    { -4.83, 2.61 },
-    { -4.96, 2.48 },
-    { -5.06, 2.36 },
-    { -5.18, 2.24 },
-    { -5.31, 2.11 },
-    { -5.43, 1.99 },
-    { -5.56, 1.86 },
-    { -5.68, 1.74 },
-    { -5.81, 1.61 },
-    { -5.93, 1.49 },
-    { -6.06, 1.39 },
-    { -6.18, 1.31 },
-    { -6.11, 1.26 },
-    { -5.98, 1.34 },
-    { -5.86, 1.41 },
-    { -5.73, 1.46 },
-    { -5.61, 1.51 },
-    { -5.48, 1.56 },
-    { -5.36, 1.61 },
-    { -5.23, 1.66 },
-    { -5.11, 1.71 },
-    { -4.98, 1.76 },
-    { -4.86, 1.81 },
-    { -4.73, 1.86 },
-    { -4.61, 1.89 },
-    { -4.48, 1.94 },
-    { -4.36, 1.99 },
-    { -4.23, 2.01 },
-    { -4.11, 2.06 },
-    { -3.98, 2.09 },
-    { -3.86, 2.11 },
-    { -3.73, 2.16 },
-    { -3.61, 2.19 },
-    { -3.49, 2.21 },
-    { -3.36, 2.24 },
-    { -3.24, 2.24 },
-    { -3.11, 2.26 },
-    { -2.99, 2.26 },
-    { -2.86, 2.28 },
-    { -2.74, 2.28 },
-    { -2.61, 2.26 },
-    { -2.49, 2.24 },
-    { -2.36, 2.21 },
-    { -2.24, 2.19 },
-    { -2.11, 2.14 },
-    { -1.99, 2.09 },
-    { -1.86, 2.01 },
-    { -1.74, 1.94 },
-    { -1.61, 1.84 },
-    { -1.49, 1.71 },
-    { -1.36, 1.59 },
-    { -1.26, 1.46 },
-    { -1.19, 1.34 },
-    { -1.11, 1.21 },
-    { -1.07, 1.09 },
-    { -1.02, 0.96 },
-    { -0.97, 0.84 },
-    { -0.94, 0.71 },
-    { -0.92, 0.59 },
-    { -0.89, 0.46 },
-    { -0.89, 0.34 },
-    { -0.89, 0.21 },
-    { -0.89, 0.09 },
-    { -0.89, -0.04 },
-    { -0.89, -0.16 },
-    { -0.94, -0.28 },
-    { -0.97, -0.41 },
-    { -1.02, -0.53 },
-    { -1.07, -0.66 },
-    { -1.14, -0.78 },
-    { -1.21, -0.91 },
-    { -1.31, -1.03 },
-    { -1.41, -1.16 },
-    { -1.54, -1.28 },
-    { -1.66, -1.38 },
-    { -1.79, -1.46 },
-    { -1.91, -1.56 },
-    { -2.04, -1.61 },
-    { -2.16, -1.68 },
-    { -2.26, -1.73 },
-    { -2.24, -1.86 },
-    { -2.19, -1.98 },
-    { -2.11, -2.11 },
-    { -2.06, -2.23 },
-    { -2.04, -2.36 },
-    { -2.01, -2.48 },
-    { -1.99, -2.61 },
-    { -1.99, -2.73 },
-    { -1.96, -2.85 },
-    { -1.94, -2.98 },
-    { -1.94, -3.10 },
-    { -1.96, -3.23 },
-    { -1.99, -3.35 },
-    { -1.99, -3.48 },
-    { -2.01, -3.60 },
-    { -2.06, -3.73 },
-    { -2.11, -3.85 },
-    { -2.19, -3.98 },
-    { -2.29, -4.10 },
-    { -2.39, -4.23 },
-    { -2.51, -4.35 },
-    { -2.64, -4.45 },
-    { -2.76, -4.53 },
-    { -2.89, -4.63 },
-    { -3.01, -4.68 },
-    { -3.14, -4.75 },
-    { -3.26, -4.80 },
-    { -3.39, -4.85 },
-    { -3.51, -4.90 },
-    { -3.63, -4.93 },
-    { -3.76, -4.95 },
-    { -3.88, -4.98 },
-    { -4.01, -5.00 },
-    { -4.13, -5.00 },
-    { -4.26, -5.00 },
-    { -4.38, -5.00 },
-    { -4.51, -4.98 },
-    { -4.63, -4.95 },
-    { -4.76, -4.93 },
-    { -4.88, -4.88 },
-    { -5.01, -4.83 },
-    { -5.13, -4.75 },
-    { -5.26, -4.68 },
-    { -5.38, -4.58 },
-    { -5.48, -4.45 },
-    { -5.61, -4.33 },
-    { -5.71, -4.20 },
-    { -5.81, -4.08 },
-    { -5.88, -3.95 },
-    { -5.96, -3.83 },
-    { -6.06, -3.70 },
-    { -6.13, -3.58 },
-    { -6.18, -3.45 },
-    { -6.25, -3.33 },
-    { -6.33, -3.20 },
-    { -6.40, -3.08 },
-    { -6.48, -2.95 },
-    { -6.53, -2.83 },
-    { -6.60, -2.71 },
-    { -6.65, -2.58 },
-    { -6.73, -2.46 },
-    { -6.78, -2.33 },
-    { -6.85, -2.21 },
-    { -6.90, -2.08 },
-    { -6.95, -1.96 },
-    { -7.03, -1.83 },
-    { -7.08, -1.71 },
-    { -7.13, -1.58 },
-    { -7.20, -1.46 },
-    { -7.23, -1.33 },
-    { -7.30, -1.21 },
-    { -7.33, -1.08 },
-    { -7.33, -1.11 },
-    { -7.30, -1.23 },
-    { -7.23, -1.36 },
-    { -7.18, -1.48 },
-    { -7.13, -1.61 },
-    { -7.08, -1.73 },
-    { -7.03, -1.86 },
-    { -6.95, -1.98 },
-    { -6.90, -2.11 },
-    { -6.85, -2.23 },
-    { -6.78, -2.36 },
-    { -6.73, -2.48 },
-    { -6.65, -2.61 },
-    { -6.60, -2.73 },
-    { -6.53, -2.85 },
-    { -6.48, -2.98 },
-    { -6.40, -3.10 },
-    { -6.33, -3.23 },
-    { -6.25, -3.35 },
-    { -6.18, -3.48 },
-    { -6.13, -3.60 },
-    { -6.06, -3.73 },
-    { -5.96, -3.85 },
-    { -5.88, -3.98 },
-    { -5.81, -4.10 },
-    { -5.71, -4.23 },
-    { -5.61, -4.35 },
-    { -5.48, -4.48 },
-    { -5.38, -4.58 },
-    { -5.26, -4.70 },
-    { -5.13, -4.78 },
-    { -5.01, -4.83 },
-    { -4.88, -4.88 },
-    { -4.76, -4.93 },
-    { -4.63, -4.95 },
-    { -4.51, -4.98 },
-    { -4.38, -5.00 },
-    { -4.26, -5.00 },
-    { -4.13, -5.00 },
-    { -4.01, -5.00 },
-    { -3.88, -4.98 },
-    { -3.76, -4.95 },
-    { -3.63, -4.93 },
-    { -3.51, -4.90 },
-    { -3.39, -4.85 },
-    { -3.26, -4.80 },
-    { -3.14, -4.75 },
-    { -3.01, -4.70 },
-    { -2.89, -4.63 },
-    { -2.76, -4.55 },
-    { -2.64, -4.45 },
-    { -2.51, -4.35 },
-    { -2.39, -4.25 },
-    { -2.29, -4.13 },
-    { -2.19, -4.00 },
-    { -2.11, -3.88 },
-    { -2.06, -3.75 },
-    { -2.04, -3.63 },
-    { -1.99, -3.50 },
-    { -1.99, -3.38 },
-    { -1.96, -3.25 },
-    { -1.94, -3.13 },
-    { -1.94, -3.00 },
-    { -1.96, -2.88 },
-    { -1.96, -2.76 },
-    { -1.99, -2.63 },
-    { -2.01, -2.51 },
-    { -2.04, -2.38 },
-    { -2.06, -2.26 },
-    { -2.11, -2.13 },
-    { -2.16, -2.01 },
-    { -2.21, -1.88 },
-    { -2.26, -1.76 },
-    { -2.16, -1.68 },
-    { -2.04, -1.63 },
-    { -1.91, -1.56 },
-    { -1.79, -1.48 },
-    { -1.66, -1.41 },
-    { -1.54, -1.31 },
-    { -1.41, -1.18 },
-    { -1.31, -1.06 },
-    { -1.21, -0.93 },
-    { -1.14, -0.81 },
-    { -1.07, -0.68 },
-    { -1.02, -0.56 },
-    { -0.97, -0.43 },
-    { -0.94, -0.31 },
-    { -0.89, -0.19 },
-    { -0.89, -0.06 },
-    { -0.89, 0.06 },
-    { -0.89, 0.19 },
-    { -0.89, 0.31 },
-    { -0.89, 0.44 },
-    { -0.89, 0.56 },
-    { -0.94, 0.69 },
-    { -0.97, 0.81 },
-    { -0.99, 0.94 },
-    { -1.04, 1.06 },
-    { -1.09, 1.19 },
-    { -1.16, 1.31 },
-    { -1.24, 1.44 },
-    { -1.34, 1.56 },
-    { -1.44, 1.69 },
-    { -1.56, 1.81 },
-    { -1.69, 1.91 },
-    { -1.81, 1.99 },
-    { -1.94, 2.06 },
-    { -2.06, 2.14 },
-    { -2.19, 2.16 },
-    { -2.31, 2.21 },
-    { -2.44, 2.24 },
-    { -2.56, 2.24 },
-    { -2.69, 2.26 },
-    { -2.81, 2.28 },
-    { -2.94, 2.28 },
-    { -3.06, 2.26 },
-    { -3.19, 2.24 },
-    { -3.31, 2.24 },
-    { -3.44, 2.21 },
-    { -3.56, 2.19 },
-    { -3.68, 2.16 },
-    { -3.81, 2.14 },
-    { -3.93, 2.11 },
-    { -4.06, 2.06 },
-    { -4.18, 2.04 },
-    { -4.31, 1.99 },
-    { -4.43, 1.96 },
-    { -4.56, 1.91 },
-    { -4.68, 1.86 },
-    { -4.81, 1.84 },
-    { -4.93, 1.79 },
-    { -5.06, 1.74 },
-    { -5.18, 1.69 },
-    { -5.31, 1.64 },
-    { -5.43, 1.59 },
-    { -5.56, 1.54 },
-    { -5.68, 1.49 },
-    { -5.81, 1.44 },
-    { -5.93, 1.39 },
-    { -6.06, 1.31 },
-    { -6.18, 1.29 },
-    { -6.06, 1.39 },
-    { -5.93, 1.46 },
-    { -5.81, 1.59 },
-    { -5.68, 1.71 },
-    { -5.56, 1.84 },
-    { -5.43, 1.96 },
-    { -5.31, 2.09 },
-    { -5.18, 2.21 },
-    { -5.06, 2.33 },
-    { -4.96, 2.46 },
-    { -4.83, 2.58 },
-    { -4.73, 2.71 },
-    { -4.63, 2.83 },
-    { -4.53, 2.96 },
-    { -4.43, 3.08 },
-    { -4.33, 3.21 },
-    { -4.26, 3.33 },
-    { -4.18, 3.46 },
-    { -4.11, 3.58 },
-    { -4.03, 3.71 },
-    { -3.98, 3.83 },
-    { -3.93, 3.96 },
-    { -3.91, 4.08 },
-    { -3.88, 4.21 },
-    { -3.86, 4.33 },
-    { -3.86, 4.46 },
-    { -3.86, 4.58 },
-    { -3.86, 4.71 },
-    { -3.86, 4.83 },
-    { -3.88, 4.95 },
-    { -3.91, 5.08 },
-    { -3.93, 5.20 },
-    { -3.98, 5.33 },
-    { -4.03, 5.45 },
-    { -4.11, 5.58 },
-    { -4.18, 5.70 },
-    { -4.28, 5.83 },
-    { -4.38, 5.95 },
-    { -4.51, 6.05 },
-    { -4.63, 6.15 },
-    { -4.76, 6.25 },
-    { -4.88, 6.33 },
-    { -5.01, 6.40 },
-    { -5.13, 6.45 },
-    { -5.26, 6.50 },
-    { -5.38, 6.55 },
-    { -5.51, 6.60 },
-    { -5.63, 6.63 },
-    { -5.76, 6.65 },
-    { -5.88, 6.68 },
-    { -6.01, 6.70 },
-    { -6.13, 6.70 },
-    { -6.25, 6.70 },
-    { -6.38, 6.70 },
-    { -6.50, 6.70 },
-    { -6.63, 6.68 },
-    { -6.75, 6.63 },
-    { -6.88, 6.60 },
-    { -7.00, 6.55 },
-    { -7.13, 6.50 },
-    { -7.25, 6.43 },
-    { -7.38, 6.35 },
-    { -7.50, 6.25 },
-    { -7.63, 6.13 },
-    { -7.73, 6.03 },
-    { -7.85, 6.05 },
-    { -7.98, 6.18 },
-    { -8.10, 6.28 },
-    { -8.23, 6.35 },
-    { -8.35, 6.43 },
-    { -8.48, 6.50 },
-    { -8.60, 6.55 },
-    { -8.72, 6.60 },
-    { -8.85, 6.63 },
-    { -8.97, 6.68 },
-    { -9.10, 6.70 },
-    { -9.22, 6.73 },
-    { -9.35, 6.75 },
-    { -9.47, 6.75 },
-    { -9.60, 6.75 },
-    { -9.72, 6.75 },
-};
-
-const int NUM_POINTS = sizeof(clover_coords)/sizeof(clover_coords[0]);
-
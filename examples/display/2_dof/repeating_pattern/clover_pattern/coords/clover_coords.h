@@ -1,9 +0,0 @@
-#ifndef CLOVER_COORDS_H
-#define CLOVER_COORDS_H
-
-extern float clover_coords[][2];
-extern const int NUM_POINTS;
-
-#endif // CLOVER_COORDS_H
-
-
@@ -0,0 +1,316 @@
+#include "clover_curve.h"
+
+// ----------------------------
+// Generated clover curve (do not edit)
+// ----------------------------
+
+static const short clover_curve_ctrl[][6] = {
+    {   -515,    937,   -516,    828,   -506,    808 },
+    {   -497,    790,   -512,    709,   -512,    688 },
+    {   -512,    548,   -547,    410,   -606,    293 },
+    {   -631,    244,   -662,    187,   -717,    159 },
+    {   -729,    153,   -755,    153,   -765,    148 },
+    {   -781,    140,   -814,    140,   -830,    148 },
+    {   -844,    155,   -872,    152,   -887,    159 },
+    {   -937,    184,   -780,    159,   -768,    165 },
+    {   -754,    172,   -739,    173,   -725,    179 },
+    {   -673,    206,   -643,    266,   -620,    313 },
+    {   -597,    359,   -589,    412,   -566,    458 },
+    {   -555,    480,   -560,    510,   -549,    532 },
+    {   -542,    545,   -538,    644,   -535,    651 },
+    {   -526,    668,   -526,    701,   -526,    720 },
+    {   -526,    772,   -520,    822,   -520,    876 },
+    {   -520,    899,   -520,    922,   -520,    944 },
+    {   -520,    949,   -520,    959,   -520,    959 },
+    {   -520,    959,   -520,    949,   -520,    944 },
+    {   -520,    922,   -520,    899,   -520,    876 },
+    {   -520,    820,   -526,    769,   -526,    714 },
+    {   -526,    697,   -527,    666,   -535,    651 },
+    {   -538,    644,   -542,    545,   -549,    532 },
+    {   -560,    510,   -555,    480,   -566,    458 },
+    {   -573,    444,   -573,    427,   -580,    413 },
+    {   -598,    377,   -608,    337,   -626,    302 },
+    {   -647,    259,   -681,    203,   -728,    179 },
+    {   -741,    173,   -755,    171,   -768,    165 },
+    {   -795,    152,   -879,    182,   -896,    174 },
+    {   -900,    172,   -900,    164,   -896,    162 },
+    {   -880,    154,   -842,    154,   -830,    148 },
+    {   -814,    140,   -781,    140,   -765,    148 },
+    {   -753,    154,   -735,    150,   -722,    157 },
+    {   -663,    186,   -634,    238,   -606,    293 },
+    {   -547,    410,   -512,    548,   -512,    688 },
+    {   -512,    709,   -497,    790,   -506,    808 },
+    {   -517,    829,   -515,    926,   -515,    956 },
+    {   -504,    951,   -494,    946,   -483,    942 },
+    {   -464,    865,   -401,    756,   -364,    683 },
+    {   -353,    661,   -335,    642,   -324,    620 },
+    {   -312,    596,   -271,    536,   -245,    523 },
+    {   -224,    513,   -202,    505,   -182,    495 },
+    {   -174,    491,   -162,    494,   -154,    489 },
+    {   -148,    486,   -132,    489,   -125,    489 },
+    {    -53,    489,     71,    534,    105,    603 },
+    {    122,    637,    147,    709,    128,    748 },
+    {    125,    754,    131,    765,    128,    771 },
+    {    116,    795,    111,    828,     97,    856 },
+    {     97,    858,     97,    860,     97,    862 },
+    {     99,    866,    187,    904,    202,    933 },
+    {    213,    955,    230,    976,    242,    998 },
+    {    248,   1011,    247,   1026,    253,   1038 },
+    {    256,   1045,    253,   1062,    253,   1070 },
+    {    253,   1083,    259,   1112,    253,   1124 },
+    {    247,   1137,    248,   1153,    242,   1166 },
+    {    227,   1195,    206,   1254,    171,   1271 },
+    {    153,   1280,    137,   1294,    119,   1303 },
+    {     56,   1334,    -74,   1315,   -134,   1286 },
+    {   -144,   1280,   -160,   1283,   -171,   1277 },
+    {   -211,   1257,   -256,   1249,   -296,   1229 },
+    {   -308,   1222,   -344,   1202,   -347,   1203 },
+    {   -348,   1204,   -349,   1205,   -350,   1206 },
+    {   -350,   1210,   -343,   1211,   -341,   1212 },
+    {   -308,   1228,   -278,   1270,   -250,   1297 },
+    {   -191,   1356,   -137,   1418,   -102,   1488 },
+    {    -93,   1507,    -95,   1531,    -85,   1550 },
+    {    -78,   1565,    -88,   1629,    -94,   1641 },
+    {   -100,   1653,    -99,   1669,   -105,   1681 },
+    {   -112,   1694,   -122,   1705,   -128,   1718 },
+    {   -155,   1772,   -330,   1850,   -390,   1820 },
+    {   -393,   1818,   -400,   1822,   -404,   1820 },
+    {   -417,   1814,   -433,   1813,   -447,   1806 },
+    {   -464,   1797,   -480,   1784,   -498,   1775 },
+    {   -505,   1771,   -529,   1741,   -532,   1741 },
+    {   -534,   1743,   -536,   1744,   -538,   1746 },
+    {   -559,   1768,   -583,   1788,   -609,   1800 },
+    {   -671,   1832,   -777,   1842,   -842,   1809 },
+    {   -923,   1768,   -933,   1741,   -970,   1667 },
+    {   -976,   1655,   -970,   1636,   -975,   1624 },
+    {   -982,   1612,   -982,   1577,   -975,   1564 },
+    {   -970,   1553,   -976,   1534,   -970,   1522 },
+    {   -961,   1503,   -956,   1483,   -947,   1465 },
+    {   -937,   1445,   -923,   1428,   -913,   1408 },
+    {   -895,   1373,   -769,   1241,   -734,   1223 },
+    {   -727,   1220,   -724,   1209,   -717,   1206 },
+    {   -695,   1195,   -678,   1177,   -657,   1166 },
+    {   -646,   1161,   -667,   1164,   -660,   1161 },
+    {   -648,   1155,   -665,   1163,   -654,   1163 },
+    {   -653,   1161,   -652,   1160,   -651,   1158 },
+    {   -651,   1158,   -656,   1167,   -660,   1169 },
+    {   -685,   1182,   -713,   1214,   -731,   1223 },
+    {   -759,   1237,   -885,   1363,   -899,   1391 },
+    {   -910,   1414,   -930,   1433,   -941,   1456 },
+    {   -952,   1478,   -959,   1500,   -970,   1522 },
+    {   -976,   1534,   -970,   1553,   -975,   1564 },
+    {   -982,   1577,   -982,   1612,   -975,   1624 },
+    {   -970,   1635,   -973,   1660,   -967,   1672 },
+    {   -932,   1743,   -906,   1775,   -833,   1812 },
+    {   -820,   1818,   -788,   1819,   -779,   1823 },
+    {   -722,   1852,   -629,   1806,   -583,   1783 },
+    {   -564,   1774,   -553,   1750,   -535,   1741 },
+    {   -528,   1737,   -504,   1770,   -495,   1775 },
+    {   -481,   1782,   -469,   1793,   -455,   1800 },
+    {   -439,   1809,   -420,   1812,   -404,   1820 },
+    {   -391,   1827,   -365,   1823,   -350,   1823 },
+    {   -231,   1823,   -145,   1754,    -94,   1653 },
+    {    -91,   1646,    -94,   1636,    -91,   1630 },
+    {    -84,   1616,    -85,   1601,    -85,   1584 },
+    {    -85,   1483,   -151,   1399,   -222,   1328 },
+    {   -250,   1300,   -279,   1271,   -307,   1243 },
+    {   -321,   1230,   -338,   1221,   -350,   1209 },
+    {   -350,   1207,   -350,   1205,   -350,   1203 },
+    {   -347,   1200,   -308,   1223,   -301,   1226 },
+    {   -254,   1249,   -201,   1259,   -154,   1283 },
+    {   -134,   1293,    -62,   1301,    -48,   1308 },
+    {    -30,   1317,     -1,   1309,     14,   1317 },
+    {     27,   1323,     50,   1320,     63,   1314 },
+    {     73,   1309,     98,   1312,    111,   1306 },
+    {    187,   1268,    209,   1229,    245,   1158 },
+    {    267,   1113,    250,   1016,    230,    976 },
+    {    223,    962,    209,    953,    202,    939 },
+    {    198,    931,    185,    915,    176,    910 },
+    {    152,    898,    132,    879,    108,    868 },
+    {    106,    867,     98,    866,     97,    865 },
+    {     96,    864,     96,    854,     97,    853 },
+    {    105,    837,    111,    821,    119,    805 },
+    {    124,    795,    123,    781,    128,    771 },
+    {    131,    765,    125,    754,    128,    748 },
+    {    145,    714,    129,    650,    114,    620 },
+    {    107,    606,     92,    595,     85,    580 },
+    {     80,    570,     61,    557,     51,    552 },
+    {     35,    544,     22,    529,      6,    521 },
+    {    -63,    487,   -154,    477,   -225,    512 },
+    {   -262,    531,   -301,    579,   -319,    614 },
+    {   -331,    640,   -351,    660,   -364,    686 },
+    {   -398,    753,   -466,    872,   -483,    942 },
+    {   -485,    973,   -487,   1004,   -489,   1035 },
+    {   -486,   1033,   -484,   1038,   -481,   1033 },
+    {   -476,   1024,   -489,   1032,   -486,   1027 },
+    {   -459,    971,   -440,    912,   -412,    856 },
+    {   -383,    797,   -283,    581,   -225,    552 },
+    {   -205,    542,   -184,    536,   -165,    526 },
+    {   -157,    522,   -145,    528,   -137,    523 },
+    {   -128,    519,    -79,    528,    -71,    532 },
+    {    -62,    536,    -49,    533,    -40,    538 },
+    {     29,    572,     97,    610,     97,    700 },
+    {     97,    712,    102,    738,     97,    748 },
+    {     87,    768,     89,    794,     80,    814 },
+    {     71,    831,     60,    847,     51,    865 },
+    {     51,    866,     51,    875,     51,    876 },
+    {     60,    894,    157,    918,    176,    956 },
+    {    180,    964,    189,    970,    193,    979 },
+    {    202,    996,    207,   1015,    216,   1033 },
+    {    218,   1037,    214,   1045,    216,   1050 },
+    {    225,   1067,    225,   1098,    216,   1115 },
+    {    211,   1125,    215,   1139,    210,   1149 },
+    {    184,   1202,    170,   1239,    111,   1269 },
+    {     -1,   1325,   -255,   1212,   -353,   1163 },
+    {   -390,   1145,   -447,   1120,   -478,   1089 },
+    {   -482,   1086,   -490,   1083,   -486,   1075 },
+    {   -483,   1068,   -438,   1051,   -429,   1047 },
+    {   -393,   1028,   -355,   1014,   -319,    996 },
+    {   -292,    982,   -260,    980,   -233,    967 },
+    {   -219,    960,   -142,    952,   -137,    942 },
+    {   -118,    904,   -178,    915,   -196,    924 },
+    {   -206,    929,   -221,    925,   -230,    930 },
+    {   -267,    948,   -311,    952,   -347,    970 },
+    {   -379,    986,   -459,   1028,   -489,   1035 },
+    {   -509,   1066,   -529,   1096,   -549,   1126 },
+    {   -693,   1234,   -844,   1339,   -927,   1505 },
+    {   -957,   1565,   -943,   1716,   -876,   1749 },
+    {   -861,   1757,   -848,   1767,   -833,   1775 },
+    {   -821,   1781,   -803,   1780,   -791,   1786 },
+    {   -777,   1793,   -706,   1799,   -691,   1792 },
+    {   -679,   1786,   -664,   1787,   -651,   1780 },
+    {   -634,   1772,   -617,   1763,   -600,   1755 },
+    {   -577,   1743,   -557,   1703,   -540,   1695 },
+    {   -538,   1694,   -525,   1694,   -523,   1695 },
+    {   -517,   1698,   -473,   1754,   -438,   1772 },
+    {   -352,   1815,   -232,   1776,   -168,   1712 },
+    {   -148,   1692,   -142,   1667,   -131,   1644 },
+    {   -122,   1626,   -112,   1583,   -122,   1562 },
+    {   -125,   1555,   -119,   1545,   -122,   1539 },
+    {   -132,   1520,   -135,   1498,   -145,   1479 },
+    {   -185,   1398,   -274,   1324,   -341,   1257 },
+    {   -374,   1224,   -422,   1177,   -461,   1158 },
+    {   -467,   1154,   -501,   1124,   -506,   1129 },
+    {   -510,   1133,   -503,   1203,   -503,   1212 },
+    {   -503,   1235,   -495,   1350,   -501,   1362 },
+    {   -509,   1379,   -506,   1423,   -506,   1442 },
+    {   -506,   1466,   -499,   1515,   -523,   1527 },
+    {   -551,   1541,   -544,   1444,   -540,   1436 },
+    {   -531,   1418,   -538,   1383,   -538,   1362 },
+    {   -538,   1316,   -532,   1152,   -549,   1126 },
+    {   -553,   1108,   -556,   1090,   -560,   1072 },
+    {   -622,   1041,   -689,   1021,   -751,    990 },
+    {   -782,    974,   -822,    974,   -853,    959 },
+    {   -861,    955,   -965,    932,   -916,    907 },
+    {   -904,    901,   -858,    919,   -848,    924 },
+    {   -833,    932,   -808,    931,   -793,    939 },
+    {   -746,    962,   -693,    972,   -646,    996 },
+    {   -621,   1008,   -597,   1020,   -572,   1033 },
+    {   -571,   1033,   -564,   1033,   -563,   1033 },
+    {   -560,   1030,   -565,   1020,   -566,   1018 },
+    {   -587,    976,   -608,    935,   -629,    893 },
+    {   -663,    825,   -688,    751,   -722,    683 },
+    {   -734,    660,   -761,    637,   -771,    617 },
+    {   -775,    609,   -790,    591,   -799,    586 },
+    {   -825,    573,   -847,    551,   -873,    538 },
+    {   -891,    529,   -913,    529,   -930,    521 },
+    {   -941,    515,   -971,    515,   -981,    521 },
+    {   -985,    523,   -992,    519,   -995,    521 },
+    {  -1014,    530,  -1036,    534,  -1055,    543 },
+    {  -1110,    571,  -1155,    640,  -1155,    700 },
+    {  -1155,    709,  -1159,    712,  -1155,    720 },
+    {  -1150,    728,  -1159,    743,  -1155,    751 },
+    {  -1144,    772,  -1143,    798,  -1132,    819 },
+    {  -1124,    835,  -1111,    849,  -1103,    865 },
+    {  -1102,    868,  -1098,    872,  -1101,    876 },
+    {  -1109,    893,  -1186,    912,  -1206,    922 },
+    {  -1303,    970,  -1318,   1093,  -1274,   1180 },
+    {  -1257,   1216,  -1219,   1244,  -1186,   1260 },
+    {  -1029,   1339,   -855,   1221,   -722,   1155 },
+    {   -689,   1138,   -574,   1093,   -560,   1072 },
+    {   -558,   1039,   -556,   1006,   -555,    973 },
+    {   -566,    927,   -593,    884,   -614,    842 },
+    {   -637,    797,   -652,    748,   -674,    703 },
+    {   -690,    671,   -713,    641,   -728,    612 },
+    {   -737,    594,   -780,    555,   -796,    546 },
+    {   -821,    534,   -841,    515,   -865,    504 },
+    {   -875,    499,   -889,    500,   -899,    495 },
+    {   -976,    456,  -1076,    508,  -1132,    563 },
+    {  -1158,    589,  -1168,    621,  -1183,    651 },
+    {  -1204,    693,  -1188,    785,  -1169,    822 },
+    {  -1163,    833,  -1158,    847,  -1149,    856 },
+    {  -1148,    857,  -1147,    858,  -1146,    859 },
+    {  -1146,    863,  -1190,    875,  -1197,    879 },
+    {  -1220,    890,  -1240,    907,  -1263,    919 },
+    {  -1272,    923,  -1284,    939,  -1288,    947 },
+    {  -1296,    963,  -1309,    975,  -1317,    990 },
+    {  -1343,   1042,  -1336,   1134,  -1311,   1183 },
+    {  -1222,   1361,  -1012,   1338,   -867,   1266 },
+    {   -822,   1243,   -776,   1223,   -731,   1200 },
+    {   -715,   1193,   -692,   1184,   -680,   1172 },
+    {   -677,   1169,   -668,   1166,   -668,   1166 },
+    {   -668,   1166,   -675,   1167,   -677,   1169 },
+    {   -684,   1176,   -697,   1182,   -705,   1186 },
+    {   -731,   1199,   -759,   1210,   -785,   1223 },
+    {   -836,   1249,   -888,   1272,   -939,   1297 },
+    {   -951,   1303,  -1008,   1312,  -1012,   1314 },
+    {  -1018,   1317,  -1073,   1325,  -1078,   1323 },
+    {  -1094,   1314,  -1148,   1317,  -1172,   1306 },
+    {  -1264,   1259,  -1331,   1194,  -1331,   1084 },
+    {  -1331,   1073,  -1336,   1048,  -1331,   1038 },
+    {  -1326,   1029,  -1327,   1016,  -1322,   1007 },
+    {  -1304,    971,  -1279,    922,  -1237,    902 },
+    {  -1227,    897,  -1147,    862,  -1146,    859 },
+    {  -1146,    858,  -1146,    857,  -1146,    856 },
+    {  -1153,    843,  -1162,    832,  -1169,    819 },
+    {  -1181,    794,  -1180,    760,  -1192,    737 },
+    {  -1201,    717,  -1182,    644,  -1175,    629 },
+    {  -1165,    609,  -1148,    592,  -1138,    572 },
+    {  -1132,    561,  -1111,    543,  -1101,    538 },
+    {  -1085,    530,  -1074,    514,  -1058,    506 },
+    {   -996,    476,   -920,    479,   -859,    509 },
+    {   -705,    586,   -686,    698,   -620,    831 },
+    {   -598,    874,   -566,    926,   -555,    973 },
+    {   -553,    972,   -551,    971,   -549,    970 },
+    {   -549,    734,   -561,    497,   -663,    293 },
+    {   -690,    239,   -736,    194,   -799,    194 },
+    {   -806,    194,   -822,    191,   -828,    194 },
+    {   -845,    202,   -870,    196,   -887,    205 },
+    {   -890,    206,   -894,    210,   -899,    208 },
+    {   -930,    192,   -939,    151,   -904,    134 },
+    {   -883,    123,   -846,    126,   -828,    117 },
+    {   -796,    101,   -728,    124,   -702,    137 },
+    {   -621,    178,   -589,    262,   -552,    336 },
+    {   -542,    355,   -539,    379,   -529,    398 },
+    {   -517,    423,   -519,    459,   -506,    484 },
+    {   -504,    487,   -508,    494,   -506,    498 },
+    {   -489,    533,   -501,    589,   -483,    623 },
+    {   -479,    632,   -475,    836,   -481,    848 },
+    {   -490,    867,   -476,    907,   -486,    927 },
+    {   -489,    932,   -489,    942,   -489,    942 },
+    {   -489,    942,   -489,    932,   -486,    927 },
+    {   -476,    907,   -490,    867,   -481,    848 },
+    {   -475,    836,   -479,    632,   -483,    623 },
+    {   -501,    589,   -489,    533,   -506,    498 },
+    {   -508,    494,   -504,    487,   -506,    484 },
+    {   -519,    459,   -517,    423,   -529,    398 },
+    {   -553,    350,   -605,    188,   -657,    162 },
+    {   -677,    152,   -694,    138,   -714,    128 },
+    {   -726,    122,   -744,    126,   -757,    120 },
+    {   -776,    110,   -819,    110,   -839,    120 },
+    {   -846,    123,   -897,    129,   -913,    137 },
+    {   -947,    154,   -919,    197,   -899,    208 },
+    {   -894,    210,   -890,    206,   -887,    205 },
+    {   -870,    196,   -845,    202,   -828,    194 },
+    {   -823,    191,   -810,    194,   -805,    194 },
+    {   -750,    194,   -700,    225,   -674,    276 },
+    {   -657,    309,   -642,    343,   -626,    376 },
+    {   -615,    398,   -611,    424,   -600,    447 },
+    {   -593,    462,   -592,    502,   -586,    515 },
+    {   -576,    534,   -577,    585,   -572,    595 },
+    {   -552,    635,   -549,    903,   -549,    970 },
+};
+
+const halo_curve_t clover_curve = { clover_curve_ctrl, 304, -515, 956 };
+
+const unsigned short clover_curve_elbow_flips[] = { 304 };
@@ -0,0 +1,15 @@
+#ifndef CLOVER_CURVE_H
+#define CLOVER_CURVE_H
+
+#include "halo_curve.h"
+
+// Cubic Bezier clover outline, 0.01 cm fixed point
+extern const halo_curve_t clover_curve;
+
+// Elbow branch (HALO_ELBOW_DOWN/UP) from segment 0, flipped at each
+// segment index in clover_curve_elbow_flips; the list ends with the
+// segment count
+#define CLOVER_CURVE_ELBOW_START 0
+extern const unsigned short clover_curve_elbow_flips[];
+
+#endif // CLOVER_CURVE_H
@@ -0,0 +1,3235 @@
+#include "clover_duty.h"
+
+// ----------------------------
+// Generated clover duty table (do not edit)
+// ----------------------------
+
+const unsigned short clover_duty[][2] = {
+    { 1339, 1634 },
+    { 1339, 1636 },
+    { 1339, 1639 },
+    { 1339, 1642 },
+    { 1338, 1646 },
+    { 1338, 1649 },
+    { 1338, 1652 },
+    { 1338, 1656 },
+    { 1338, 1659 },
+    { 1337, 1662 },
+    { 1337, 1665 },
+    { 1337, 1669 },
+    { 1336, 1672 },
+    { 1336, 1675 },
+    { 1337, 1678 },
+    { 1337, 1681 },
+    { 1336, 1684 },
+    { 1336, 1687 },
+    { 1337, 1690 },
+    { 1337, 1693 },
+    { 1337, 1696 },
+    { 1338, 1699 },
+    { 1338, 1702 },
+    { 1339, 1705 },
+    { 1340, 1707 },
+    { 1341, 1710 },
+    { 1342, 1713 },
+    { 1343, 1716 },
+    { 1344, 1718 },
+    { 1345, 1721 },
+    { 1346, 1723 },
+    { 1348, 1726 },
+    { 1349, 1729 },
+    { 1350, 1731 },
+    { 1351, 1734 },
+    { 1352, 1737 },
+    { 1354, 1739 },
+    { 1357, 1740 },
+    { 1359, 1743 },
+    { 1360, 1745 },
+    { 1362, 1748 },
+    { 1365, 1749 },
+    { 1367, 1751 },
+    { 1369, 1753 },
+    { 1371, 1756 },
+    { 1374, 1758 },
+    { 1377, 1759 },
+    { 1379, 1761 },
+    { 1382, 1763 },
+    { 1385, 1764 },
+    { 1389, 1766 },
+    { 1391, 1768 },
+    { 1395, 1769 },
+    { 1398, 1770 },
+    { 1401, 1772 },
+    { 1405, 1773 },
+    { 1409, 1774 },
+    { 1412, 1775 },
+    { 1416, 1776 },
+    { 1420, 1777 },
+    { 1425, 1777 },
+    { 1429, 1778 },
+    { 1432, 1779 },
+    { 1437, 1780 },
+    { 1441, 1780 },
+    { 1446, 1780 },
+    { 1451, 1780 },
+    { 1454, 1781 },
+    { 1459, 1781 },
+    { 1464, 1781 },
+    { 1469, 1781 },
+    { 1474, 1780 },
+    { 1478, 1781 },
+    { 1483, 1781 },
+    { 1488, 1780 },
+    { 1493, 1779 },
+    { 1498, 1779 },
+    { 1503, 1778 },
+    { 1508, 1777 },
+    { 1512, 1776 },
+    { 1517, 1774 },
+    { 1522, 1773 },
+    { 1527, 1771 },
+    { 1532, 1770 },
+    { 1536, 1767 },
+    { 1541, 1765 },
+    { 1545, 1763 },
+    { 1549, 1760 },
+    { 1553, 1757 },
+    { 1557, 1754 },
+    { 1560, 1751 },
+    { 1564, 1748 },
+    { 1566, 1745 },
+    { 1569, 1742 },
+    { 1572, 1738 },
+    { 1575, 1735 },
+    { 1578, 1732 },
+    { 1579, 1729 },
+    { 1581, 1725 },
+    { 1582, 1722 },
+    { 1584, 1718 },
+    { 1586, 1715 },
+    { 1588, 1711 },
+    { 1589, 1708 },
+    { 1590, 1705 },
+    { 1592, 1701 },
+    { 1592, 1698 },
+    { 1589, 1699 },
+    { 1586, 1702 },
+    { 1584, 1706 },
+    { 1582, 1709 },
+    { 1581, 1713 },
+    { 1579, 1716 },
+    { 1577, 1720 },
+    { 1575, 1723 },
+    { 1572, 1727 },
+    { 1570, 1730 },
+    { 1567, 1734 },
+    { 1565, 1737 },
+    { 1562, 1740 },
+    { 1559, 1744 },
+    { 1556, 1747 },
+    { 1552, 1750 },
+    { 1548, 1753 },
+    { 1545, 1755 },
+    { 1540, 1758 },
+    { 1536, 1760 },
+    { 1532, 1762 },
+    { 1527, 1764 },
+    { 1522, 1766 },
+    { 1518, 1767 },
+    { 1513, 1768 },
+    { 1508, 1770 },
+    { 1503, 1771 },
+    { 1498, 1772 },
+    { 1494, 1772 },
+    { 1489, 1773 },
+    { 1484, 1773 },
+    { 1479, 1773 },
+    { 1475, 1774 },
+    { 1470, 1774 },
+    { 1466, 1774 },
+    { 1462, 1773 },
+    { 1457, 1774 },
+    { 1453, 1773 },
+    { 1448, 1773 },
+    { 1444, 1772 },
+    { 1440, 1771 },
+    { 1436, 1771 },
+    { 1432, 1770 },
+    { 1428, 1769 },
+    { 1424, 1769 },
+    { 1420, 1768 },
+    { 1416, 1767 },
+    { 1412, 1766 },
+    { 1409, 1765 },
+    { 1406, 1763 },
+    { 1402, 1762 },
+    { 1399, 1761 },
+    { 1396, 1759 },
+    { 1393, 1758 },
+    { 1390, 1756 },
+    { 1388, 1754 },
+    { 1384, 1753 },
+    { 1382, 1751 },
+    { 1380, 1749 },
+    { 1377, 1747 },
+    { 1375, 1745 },
+    { 1372, 1744 },
+    { 1370, 1741 },
+    { 1369, 1739 },
+    { 1366, 1737 },
+    { 1364, 1735 },
+    { 1363, 1732 },
+    { 1361, 1730 },
+    { 1359, 1728 },
+    { 1358, 1726 },
+    { 1357, 1723 },
+    { 1355, 1721 },
+    { 1353, 1719 },
+    { 1352, 1716 },
+    { 1351, 1714 },
+    { 1350, 1711 },
+    { 1349, 1708 },
+    { 1348, 1705 },
+    { 1347, 1702 },
+    { 1346, 1700 },
+    { 1346, 1697 },
+    { 1344, 1695 },
+    { 1344, 1692 },
+    { 1343, 1689 },
+    { 1342, 1687 },
+    { 1342, 1684 },
+    { 1341, 1681 },
+    { 1341, 1678 },
+    { 1341, 1675 },
+    { 1341, 1671 },
+    { 1340, 1668 },
+    { 1340, 1665 },
+    { 1340, 1662 },
+    { 1340, 1659 },
+    { 1340, 1656 },
+    { 1340, 1653 },
+    { 1340, 1649 },
+    { 1341, 1646 },
+    { 1341, 1643 },
+    { 1341, 1639 },
+    { 1341, 1636 },
+    { 1341, 1633 },
+    { 1341, 1635 },
+    { 1341, 1638 },
+    { 1341, 1642 },
+    { 1341, 1645 },
+    { 1340, 1648 },
+    { 1340, 1651 },
+    { 1340, 1655 },
+    { 1340, 1658 },
+    { 1340, 1661 },
+    { 1340, 1664 },
+    { 1340, 1667 },
+    { 1341, 1670 },
+    { 1341, 1673 },
+    { 1341, 1677 },
+    { 1341, 1680 },
+    { 1341, 1683 },
+    { 1342, 1686 },
+    { 1343, 1688 },
+    { 1344, 1691 },
+    { 1344, 1694 },
+    { 1346, 1696 },
+    { 1346, 1699 },
+    { 1347, 1701 },
+    { 1348, 1704 },
+    { 1349, 1707 },
+    { 1349, 1710 },
+    { 1350, 1713 },
+    { 1351, 1715 },
+    { 1352, 1718 },
+    { 1354, 1720 },
+    { 1356, 1722 },
+    { 1358, 1725 },
+    { 1359, 1727 },
+    { 1360, 1730 },
+    { 1362, 1732 },
+    { 1363, 1734 },
+    { 1366, 1736 },
+    { 1368, 1738 },
+    { 1370, 1740 },
+    { 1371, 1743 },
+    { 1374, 1745 },
+    { 1377, 1746 },
+    { 1379, 1748 },
+    { 1381, 1751 },
+    { 1383, 1753 },
+    { 1387, 1754 },
+    { 1389, 1756 },
+    { 1392, 1758 },
+    { 1395, 1758 },
+    { 1398, 1760 },
+    { 1401, 1762 },
+    { 1405, 1763 },
+    { 1408, 1764 },
+    { 1411, 1766 },
+    { 1415, 1766 },
+    { 1419, 1767 },
+    { 1423, 1768 },
+    { 1426, 1769 },
+    { 1430, 1770 },
+    { 1435, 1770 },
+    { 1439, 1771 },
+    { 1443, 1772 },
+    { 1447, 1772 },
+    { 1451, 1773 },
+    { 1456, 1773 },
+    { 1460, 1773 },
+    { 1465, 1773 },
+    { 1469, 1773 },
+    { 1474, 1773 },
+    { 1478, 1773 },
+    { 1483, 1772 },
+    { 1488, 1772 },
+    { 1492, 1772 },
+    { 1497, 1771 },
+    { 1502, 1771 },
+    { 1507, 1770 },
+    { 1511, 1769 },
+    { 1516, 1767 },
+    { 1521, 1766 },
+    { 1526, 1764 },
+    { 1530, 1762 },
+    { 1535, 1760 },
+    { 1539, 1758 },
+    { 1543, 1756 },
+    { 1547, 1753 },
+    { 1551, 1750 },
+    { 1555, 1747 },
+    { 1558, 1744 },
+    { 1562, 1741 },
+    { 1564, 1738 },
+    { 1567, 1734 },
+    { 1569, 1731 },
+    { 1572, 1728 },
+    { 1574, 1724 },
+    { 1577, 1721 },
+    { 1579, 1717 },
+    { 1580, 1714 },
+    { 1582, 1710 },
+    { 1583, 1707 },
+    { 1586, 1703 },
+    { 1588, 1700 },
+    { 1591, 1697 },
+    { 1593, 1699 },
+    { 1591, 1703 },
+    { 1589, 1706 },
+    { 1588, 1710 },
+    { 1587, 1713 },
+    { 1585, 1717 },
+    { 1584, 1720 },
+    { 1582, 1724 },
+    { 1580, 1727 },
+    { 1577, 1730 },
+    { 1576, 1734 },
+    { 1573, 1737 },
+    { 1570, 1740 },
+    { 1568, 1744 },
+    { 1565, 1747 },
+    { 1562, 1750 },
+    { 1558, 1753 },
+    { 1555, 1756 },
+    { 1551, 1759 },
+    { 1547, 1762 },
+    { 1543, 1764 },
+    { 1538, 1767 },
+    { 1534, 1769 },
+    { 1529, 1771 },
+    { 1525, 1773 },
+    { 1520, 1774 },
+    { 1515, 1776 },
+    { 1510, 1777 },
+    { 1505, 1778 },
+    { 1500, 1779 },
+    { 1495, 1780 },
+    { 1490, 1780 },
+    { 1485, 1781 },
+    { 1480, 1781 },
+    { 1476, 1781 },
+    { 1471, 1781 },
+    { 1466, 1781 },
+    { 1461, 1782 },
+    { 1457, 1782 },
+    { 1452, 1781 },
+    { 1448, 1781 },
+    { 1443, 1781 },
+    { 1439, 1780 },
+    { 1435, 1779 },
+    { 1431, 1779 },
+    { 1426, 1778 },
+    { 1422, 1778 },
+    { 1419, 1776 },
+    { 1415, 1775 },
+    { 1411, 1774 },
+    { 1407, 1773 },
+    { 1403, 1772 },
+    { 1400, 1771 },
+    { 1396, 1770 },
+    { 1392, 1768 },
+    { 1390, 1766 },
+    { 1387, 1765 },
+    { 1383, 1764 },
+    { 1380, 1762 },
+    { 1378, 1760 },
+    { 1375, 1758 },
+    { 1372, 1757 },
+    { 1370, 1754 },
+    { 1368, 1752 },
+    { 1366, 1750 },
+    { 1363, 1748 },
+    { 1361, 1746 },
+    { 1359, 1744 },
+    { 1358, 1741 },
+    { 1355, 1739 },
+    { 1353, 1738 },
+    { 1352, 1735 },
+    { 1350, 1732 },
+    { 1349, 1730 },
+    { 1348, 1727 },
+    { 1347, 1724 },
+    { 1346, 1722 },
+    { 1345, 1719 },
+    { 1344, 1716 },
+    { 1342, 1714 },
+    { 1341, 1711 },
+    { 1341, 1709 },
+    { 1339, 1707 },
+    { 1338, 1704 },
+    { 1338, 1701 },
+    { 1337, 1698 },
+    { 1337, 1695 },
+    { 1337, 1692 },
+    { 1336, 1689 },
+    { 1336, 1686 },
+    { 1336, 1683 },
+    { 1337, 1679 },
+    { 1337, 1676 },
+    { 1336, 1673 },
+    { 1337, 1670 },
+    { 1337, 1667 },
+    { 1337, 1663 },
+    { 1338, 1660 },
+    { 1338, 1657 },
+    { 1338, 1654 },
+    { 1338, 1650 },
+    { 1338, 1647 },
+    { 1338, 1644 },
+    { 1339, 1640 },
+    { 1339, 1637 },
+    { 1339, 1635 },
+    { 1336, 1638 },
+    { 1332, 1641 },
+    { 1329, 1644 },
+    { 1327, 1647 },
+    { 1326, 1651 },
+    { 1325, 1654 },
+    { 1323, 1658 },
+    { 1321, 1662 },
+    { 1320, 1665 },
+    { 1318, 1669 },
+    { 1316, 1673 },
+    { 1315, 1676 },
+    { 1313, 1680 },
+    { 1311, 1684 },
+    { 1310, 1687 },
+    { 1308, 1691 },
+    { 1307, 1694 },
+    { 1305, 1698 },
+    { 1303, 1701 },
+    { 1302, 1704 },
+    { 1301, 1708 },
+    { 1299, 1711 },
+    { 1297, 1715 },
+    { 1296, 1718 },
+    { 1294, 1722 },
+    { 1292, 1725 },
+    { 1290, 1729 },
+    { 1289, 1732 },
+    { 1287, 1736 },
+    { 1285, 1739 },
+    { 1284, 1743 },
+    { 1282, 1746 },
+    { 1280, 1750 },
+    { 1278, 1753 },
+    { 1276, 1757 },
+    { 1274, 1760 },
+    { 1272, 1763 },
+    { 1270, 1767 },
+    { 1268, 1770 },
+    { 1266, 1774 },
+    { 1264, 1777 },
+    { 1262, 1780 },
+    { 1260, 1784 },
+    { 1257, 1787 },
+    { 1254, 1790 },
+    { 1251, 1793 },
+    { 1249, 1797 },
+    { 1246, 1800 },
+    { 1243, 1803 },
+    { 1240, 1806 },
+    { 1236, 1809 },
+    { 1232, 1812 },
+    { 1228, 1815 },
+    { 1223, 1818 },
+    { 1219, 1821 },
+    { 1214, 1823 },
+    { 1208, 1825 },
+    { 1203, 1827 },
+    { 1197, 1830 },
+    { 1191, 1831 },
+    { 1184, 1832 },
+    { 1179, 1834 },
+    { 1173, 1835 },
+    { 1166, 1836 },
+    { 1160, 1837 },
+    { 1153, 1838 },
+    { 1146, 1839 },
+    { 1140, 1839 },
+    { 1134, 1839 },
+    { 1128, 1838 },
+    { 1121, 1839 },
+    { 1116, 1838 },
+    { 1110, 1837 },
+    { 1104, 1837 },
+    { 1099, 1836 },
+    { 1093, 1835 },
+    { 1088, 1834 },
+    { 1082, 1833 },
+    { 1078, 1831 },
+    { 1074, 1830 },
+    { 1070, 1828 },
+    { 1066, 1826 },
+    { 1062, 1824 },
+    { 1058, 1822 },
+    { 1055, 1820 },
+    { 1053, 1817 },
+    { 1050, 1815 },
+    { 1048, 1812 },
+    { 1047, 1809 },
+    { 1046, 1806 },
+    { 1045, 1803 },
+    { 1044, 1800 },
+    { 1044, 1797 },
+    { 1043, 1794 },
+    { 1045, 1791 },
+    { 1045, 1788 },
+    { 1046, 1785 },
+    { 1048, 1781 },
+    { 1050, 1778 },
+    { 1052, 1775 },
+    { 1054, 1771 },
+    { 1055, 1768 },
+    { 1058, 1765 },
+    { 1060, 1761 },
+    { 1063, 1758 },
+    { 1066, 1755 },
+    { 1069, 1752 },
+    { 1072, 1749 },
+    { 1074, 1745 },
+    { 1077, 1742 },
+    { 1081, 1739 },
+    { 1083, 1736 },
+    { 1086, 1733 },
+    { 1090, 1730 },
+    { 1093, 1727 },
+    { 1096, 1724 },
+    { 1100, 1721 },
+    { 1103, 1718 },
+    { 1106, 1715 },
+    { 1105, 1712 },
+    { 1103, 1711 },
+    { 1101, 1709 },
+    { 1099, 1707 },
+    { 1097, 1705 },
+    { 1096, 1702 },
+    { 1094, 1700 },
+    { 1093, 1697 },
+    { 1092, 1694 },
+    { 1091, 1692 },
+    { 1091, 1689 },
+    { 1090, 1686 },
+    { 1090, 1683 },
+    { 1090, 1679 },
+    { 1090, 1676 },
+    { 1091, 1673 },
+    { 1092, 1669 },
+    { 1093, 1666 },
+    { 1094, 1662 },
+    { 1095, 1659 },
+    { 1097, 1655 },
+    { 1098, 1651 },
+    { 1100, 1647 },
+    { 1101, 1644 },
+    { 1103, 1640 },
+    { 1106, 1636 },
+    { 1108, 1633 },
+    { 1111, 1629 },
+    { 1113, 1625 },
+    { 1116, 1622 },
+    { 1118, 1618 },
+    { 1121, 1614 },
+    { 1123, 1610 },
+    { 1126, 1607 },
+    { 1129, 1604 },
+    { 1132, 1600 },
+    { 1135, 1596 },
+    { 1138, 1593 },
+    { 1141, 1590 },
+    { 1144, 1586 },
+    { 1147, 1583 },
+    { 1151, 1580 },
+    { 1154, 1577 },
+    { 1157, 1574 },
+    { 1160, 1571 },
+    { 1163, 1568 },
+    { 1167, 1565 },
+    { 1170, 1563 },
+    { 1173, 1560 },
+    { 1176, 1558 },
+    { 1180, 1556 },
+    { 1183, 1554 },
+    { 1186, 1552 },
+    { 1189, 1550 },
+    { 1192, 1549 },
+    { 1195, 1547 },
+    { 1198, 1545 },
+    { 1201, 1545 },
+    { 1203, 1544 },
+    { 1206, 1543 },
+    { 1209, 1542 },
+    { 1211, 1542 },
+    { 1214, 1542 },
+    { 1217, 1541 },
+    { 1219, 1540 },
+    { 1222, 1541 },
+    { 1224, 1541 },
+    { 1226, 1542 },
+    { 1228, 1542 },
+    { 1230, 1543 },
+    { 1232, 1543 },
+    { 1234, 1543 },
+    { 1237, 1543 },
+    { 1238, 1545 },
+    { 1240, 1545 },
+    { 1243, 1546 },
+    { 1245, 1546 },
+    { 1246, 1548 },
+    { 1249, 1548 },
+    { 1250, 1549 },
+    { 1252, 1550 },
+    { 1254, 1550 },
+    { 1256, 1552 },
+    { 1258, 1552 },
+    { 1260, 1552 },
+    { 1262, 1553 },
+    { 1264, 1555 },
+    { 1266, 1556 },
+    { 1268, 1556 },
+    { 1270, 1557 },
+    { 1273, 1557 },
+    { 1274, 1558 },
+    { 1276, 1559 },
+    { 1279, 1559 },
+    { 1280, 1561 },
+    { 1282, 1561 },
+    { 1285, 1562 },
+    { 1287, 1562 },
+    { 1289, 1563 },
+    { 1291, 1565 },
+    { 1293, 1564 },
+    { 1295, 1565 },
+    { 1297, 1566 },
+    { 1299, 1567 },
+    { 1301, 1568 },
+    { 1303, 1569 },
+    { 1305, 1567 },
+    { 1303, 1566 },
+    { 1302, 1564 },
+    { 1300, 1563 },
+    { 1299, 1561 },
+    { 1298, 1559 },
+    { 1297, 1557 },
+    { 1296, 1555 },
+    { 1295, 1552 },
+    { 1294, 1550 },
+    { 1293, 1548 },
+    { 1292, 1546 },
+    { 1291, 1543 },
+    { 1290, 1541 },
+    { 1289, 1539 },
+    { 1289, 1536 },
+    { 1288, 1534 },
+    { 1287, 1531 },
+    { 1286, 1529 },
+    { 1286, 1526 },
+    { 1285, 1523 },
+    { 1285, 1521 },
+    { 1285, 1518 },
+    { 1284, 1515 },
+    { 1284, 1512 },
+    { 1284, 1509 },
+    { 1284, 1505 },
+    { 1284, 1502 },
+    { 1285, 1499 },
+    { 1285, 1495 },
+    { 1285, 1492 },
+    { 1285, 1489 },
+    { 1285, 1485 },
+    { 1286, 1482 },
+    { 1286, 1478 },
+    { 1287, 1474 },
+    { 1288, 1470 },
+    { 1289, 1466 },
+    { 1290, 1462 },
+    { 1291, 1458 },
+    { 1292, 1453 },
+    { 1295, 1448 },
+    { 1296, 1444 },
+    { 1298, 1439 },
+    { 1300, 1434 },
+    { 1302, 1429 },
+    { 1304, 1424 },
+    { 1307, 1419 },
+    { 1309, 1414 },
+    { 1312, 1409 },
+    { 1315, 1403 },
+    { 1317, 1398 },
+    { 1320, 1393 },
+    { 1324, 1387 },
+    { 1327, 1382 },
+    { 1330, 1376 },
+    { 1333, 1371 },
+    { 1336, 1366 },
+    { 1340, 1360 },
+    { 1343, 1355 },
+    { 1347, 1349 },
+    { 1350, 1344 },
+    { 1354, 1338 },
+    { 1357, 1333 },
+    { 1361, 1328 },
+    { 1365, 1323 },
+    { 1368, 1318 },
+    { 1372, 1313 },
+    { 1376, 1309 },
+    { 1379, 1304 },
+    { 1383, 1300 },
+    { 1387, 1295 },
+    { 1390, 1291 },
+    { 1394, 1287 },
+    { 1397, 1283 },
+    { 1401, 1279 },
+    { 1404, 1275 },
+    { 1408, 1271 },
+    { 1410, 1268 },
+    { 1414, 1265 },
+    { 1417, 1260 },
+    { 1420, 1258 },
+    { 1423, 1256 },
+    { 1427, 1251 },
+    { 1429, 1250 },
+    { 1432, 1246 },
+    { 1435, 1245 },
+    { 1437, 1243 },
+    { 1440, 1241 },
+    { 1442, 1240 },
+    { 1445, 1238 },
+    { 1447, 1236 },
+    { 1448, 1237 },
+    { 1451, 1235 },
+    { 1452, 1237 },
+    { 1454, 1237 },
+    { 1455, 1237 },
+    { 1456, 1239 },
+    { 1457, 1240 },
+    { 1458, 1242 },
+    { 1459, 1244 },
+    { 1459, 1246 },
+    { 1459, 1249 },
+    { 1459, 1252 },
+    { 1460, 1254 },
+    { 1459, 1258 },
+    { 1459, 1261 },
+    { 1459, 1265 },
+    { 1458, 1269 },
+    { 1460, 1268 },
+    { 1464, 1261 },
+    { 1469, 1254 },
+    { 1473, 1247 },
+    { 1478, 1240 },
+    { 1482, 1233 },
+    { 1487, 1226 },
+    { 1491, 1218 },
+    { 1496, 1211 },
+    { 1501, 1203 },
+    { 1506, 1196 },
+    { 1510, 1190 },
+    { 1515, 1183 },
+    { 1520, 1176 },
+    { 1525, 1168 },
+    { 1530, 1161 },
+    { 1536, 1152 },
+    { 1540, 1147 },
+    { 1544, 1141 },
+    { 1550, 1131 },
+    { 1556, 1123 },
+    { 1560, 1117 },
+    { 1565, 1111 },
+    { 1570, 1104 },
+    { 1575, 1096 },
+    { 1581, 1088 },
+    { 1585, 1082 },
+    { 1587, 1083 },
+    { 1593, 1072 },
+    { 1599, 1064 },
+    { 1602, 1060 },
+    { 1606, 1056 },
+    { 1610, 1051 },
+    { 1614, 1046 },
+    { 1617, 1044 },
+    { 1618, 1045 },
+    { 1619, 1046 },
+    { 1620, 1047 },
+    { 1619, 1052 },
+    { 1618, 1058 },
+    { 1616, 1064 },
+    { 1613, 1073 },
+    { 1611, 1081 },
+    { 1609, 1088 },
+    { 1607, 1095 },
+    { 1605, 1101 },
+    { 1602, 1111 },
+    { 1599, 1120 },
+    { 1596, 1128 },
+    { 1594, 1135 },
+    { 1590, 1146 },
+    { 1588, 1152 },
+    { 1585, 1161 },
+    { 1582, 1168 },
+    { 1579, 1177 },
+    { 1576, 1185 },
+    { 1574, 1192 },
+    { 1570, 1201 },
+    { 1568, 1208 },
+    { 1565, 1215 },
+    { 1562, 1223 },
+    { 1559, 1231 },
+    { 1556, 1239 },
+    { 1553, 1246 },
+    { 1550, 1253 },
+    { 1548, 1260 },
+    { 1545, 1267 },
+    { 1541, 1275 },
+    { 1539, 1281 },
+    { 1536, 1288 },
+    { 1532, 1295 },
+    { 1529, 1302 },
+    { 1527, 1309 },
+    { 1524, 1315 },
+    { 1521, 1322 },
+    { 1518, 1328 },
+    { 1515, 1334 },
+    { 1512, 1340 },
+    { 1509, 1347 },
+    { 1506, 1353 },
+    { 1503, 1359 },
+    { 1500, 1365 },
+    { 1497, 1370 },
+    { 1494, 1376 },
+    { 1491, 1382 },
+    { 1488, 1387 },
+    { 1485, 1393 },
+    { 1482, 1398 },
+    { 1479, 1404 },
+    { 1477, 1409 },
+    { 1474, 1414 },
+    { 1471, 1419 },
+    { 1468, 1424 },
+    { 1465, 1429 },
+    { 1462, 1434 },
+    { 1459, 1439 },
+    { 1456, 1444 },
+    { 1453, 1449 },
+    { 1450, 1453 },
+    { 1447, 1458 },
+    { 1444, 1463 },
+    { 1442, 1467 },
+    { 1439, 1472 },
+    { 1436, 1477 },
+    { 1433, 1481 },
+    { 1430, 1486 },
+    { 1428, 1490 },
+    { 1425, 1494 },
+    { 1422, 1498 },
+    { 1419, 1503 },
+    { 1416, 1507 },
+    { 1413, 1511 },
+    { 1410, 1515 },
+    { 1407, 1519 },
+    { 1404, 1523 },
+    { 1401, 1527 },
+    { 1398, 1530 },
+    { 1395, 1534 },
+    { 1397, 1534 },
+    { 1395, 1535 },
+    { 1394, 1536 },
+    { 1396, 1533 },
+    { 1399, 1529 },
+    { 1402, 1525 },
+    { 1405, 1521 },
+    { 1408, 1517 },
+    { 1411, 1513 },
+    { 1414, 1509 },
+    { 1417, 1505 },
+    { 1420, 1501 },
+    { 1422, 1496 },
+    { 1425, 1492 },
+    { 1428, 1488 },
+    { 1431, 1483 },
+    { 1434, 1479 },
+    { 1437, 1475 },
+    { 1440, 1470 },
+    { 1443, 1466 },
+    { 1445, 1461 },
+    { 1448, 1456 },
+    { 1451, 1451 },
+    { 1454, 1447 },
+    { 1457, 1442 },
+    { 1460, 1437 },
+    { 1462, 1432 },
+    { 1465, 1427 },
+    { 1468, 1422 },
+    { 1471, 1417 },
+    { 1474, 1412 },
+    { 1477, 1407 },
+    { 1480, 1401 },
+    { 1483, 1396 },
+    { 1486, 1390 },
+    { 1489, 1385 },
+    { 1492, 1379 },
+    { 1495, 1374 },
+    { 1498, 1368 },
+    { 1501, 1362 },
+    { 1504, 1356 },
+    { 1507, 1350 },
+    { 1510, 1344 },
+    { 1513, 1338 },
+    { 1516, 1331 },
+    { 1519, 1326 },
+    { 1522, 1319 },
+    { 1525, 1313 },
+    { 1528, 1306 },
+    { 1531, 1299 },
+    { 1534, 1292 },
+    { 1537, 1285 },
+    { 1540, 1278 },
+    { 1543, 1271 },
+    { 1546, 1263 },
+    { 1549, 1257 },
+    { 1552, 1249 },
+    { 1555, 1242 },
+    { 1558, 1235 },
+    { 1561, 1227 },
+    { 1564, 1219 },
+    { 1567, 1211 },
+    { 1569, 1205 },
+    { 1572, 1196 },
+    { 1575, 1188 },
+    { 1578, 1181 },
+    { 1580, 1173 },
+    { 1583, 1165 },
+    { 1586, 1156 },
+    { 1590, 1147 },
+    { 1592, 1140 },
+    { 1594, 1132 },
+    { 1597, 1124 },
+    { 1600, 1116 },
+    { 1603, 1106 },
+    { 1605, 1100 },
+    { 1606, 1094 },
+    { 1608, 1087 },
+    { 1610, 1080 },
+    { 1613, 1072 },
+    { 1615, 1064 },
+    { 1616, 1059 },
+    { 1617, 1053 },
+    { 1617, 1051 },
+    { 1615, 1051 },
+    { 1614, 1050 },
+    { 1613, 1049 },
+    { 1611, 1050 },
+    { 1607, 1055 },
+    { 1603, 1059 },
+    { 1600, 1063 },
+    { 1594, 1071 },
+    { 1587, 1081 },
+    { 1586, 1082 },
+    { 1582, 1086 },
+    { 1576, 1095 },
+    { 1571, 1103 },
+    { 1566, 1110 },
+    { 1561, 1116 },
+    { 1556, 1123 },
+    { 1551, 1131 },
+    { 1546, 1138 },
+    { 1541, 1145 },
+    { 1536, 1151 },
+    { 1531, 1160 },
+    { 1525, 1168 },
+    { 1521, 1175 },
+    { 1516, 1181 },
+    { 1511, 1189 },
+    { 1506, 1196 },
+    { 1501, 1204 },
+    { 1497, 1211 },
+    { 1492, 1218 },
+    { 1487, 1225 },
+    { 1483, 1232 },
+    { 1478, 1239 },
+    { 1474, 1246 },
+    { 1469, 1254 },
+    { 1465, 1261 },
+    { 1461, 1268 },
+    { 1457, 1272 },
+    { 1458, 1268 },
+    { 1458, 1264 },
+    { 1458, 1260 },
+    { 1458, 1257 },
+    { 1459, 1254 },
+    { 1459, 1251 },
+    { 1458, 1248 },
+    { 1457, 1246 },
+    { 1457, 1244 },
+    { 1456, 1242 },
+    { 1455, 1240 },
+    { 1455, 1238 },
+    { 1454, 1237 },
+    { 1453, 1236 },
+    { 1451, 1235 },
+    { 1449, 1237 },
+    { 1448, 1236 },
+    { 1445, 1238 },
+    { 1443, 1240 },
+    { 1440, 1241 },
+    { 1438, 1243 },
+    { 1435, 1244 },
+    { 1433, 1246 },
+    { 1429, 1250 },
+    { 1427, 1251 },
+    { 1424, 1255 },
+    { 1420, 1258 },
+    { 1418, 1260 },
+    { 1414, 1264 },
+    { 1411, 1268 },
+    { 1408, 1270 },
+    { 1405, 1274 },
+    { 1401, 1279 },
+    { 1397, 1283 },
+    { 1394, 1287 },
+    { 1390, 1291 },
+    { 1387, 1296 },
+    { 1383, 1300 },
+    { 1380, 1304 },
+    { 1376, 1309 },
+    { 1372, 1314 },
+    { 1369, 1319 },
+    { 1365, 1323 },
+    { 1361, 1329 },
+    { 1358, 1334 },
+    { 1354, 1339 },
+    { 1350, 1344 },
+    { 1347, 1350 },
+    { 1343, 1355 },
+    { 1340, 1360 },
+    { 1336, 1365 },
+    { 1333, 1371 },
+    { 1330, 1376 },
+    { 1327, 1381 },
+    { 1324, 1387 },
+    { 1321, 1392 },
+    { 1317, 1398 },
+    { 1315, 1403 },
+    { 1312, 1408 },
+    { 1310, 1413 },
+    { 1307, 1419 },
+    { 1305, 1424 },
+    { 1302, 1429 },
+    { 1300, 1434 },
+    { 1298, 1439 },
+    { 1296, 1443 },
+    { 1295, 1448 },
+    { 1293, 1453 },
+    { 1292, 1457 },
+    { 1290, 1461 },
+    { 1289, 1466 },
+    { 1288, 1470 },
+    { 1288, 1473 },
+    { 1287, 1477 },
+    { 1286, 1481 },
+    { 1286, 1485 },
+    { 1285, 1488 },
+    { 1285, 1492 },
+    { 1285, 1495 },
+    { 1285, 1498 },
+    { 1285, 1502 },
+    { 1285, 1505 },
+    { 1285, 1508 },
+    { 1285, 1511 },
+    { 1285, 1514 },
+    { 1286, 1517 },
+    { 1286, 1520 },
+    { 1286, 1523 },
+    { 1286, 1525 },
+    { 1287, 1528 },
+    { 1288, 1530 },
+    { 1288, 1533 },
+    { 1289, 1535 },
+    { 1290, 1538 },
+    { 1291, 1540 },
+    { 1292, 1543 },
+    { 1292, 1545 },
+    { 1293, 1547 },
+    { 1294, 1549 },
+    { 1295, 1552 },
+    { 1296, 1554 },
+    { 1297, 1556 },
+    { 1298, 1558 },
+    { 1299, 1560 },
+    { 1300, 1562 },
+    { 1302, 1564 },
+    { 1304, 1565 },
+    { 1306, 1566 },
+    { 1304, 1569 },
+    { 1302, 1568 },
+    { 1300, 1567 },
+    { 1298, 1566 },
+    { 1296, 1566 },
+    { 1294, 1565 },
+    { 1291, 1565 },
+    { 1289, 1564 },
+    { 1287, 1563 },
+    { 1285, 1563 },
+    { 1283, 1562 },
+    { 1281, 1561 },
+    { 1279, 1560 },
+    { 1277, 1559 },
+    { 1275, 1558 },
+    { 1273, 1558 },
+    { 1271, 1557 },
+    { 1269, 1556 },
+    { 1267, 1555 },
+    { 1265, 1555 },
+    { 1263, 1554 },
+    { 1261, 1553 },
+    { 1259, 1552 },
+    { 1257, 1551 },
+    { 1255, 1550 },
+    { 1253, 1550 },
+    { 1251, 1549 },
+    { 1249, 1548 },
+    { 1246, 1548 },
+    { 1245, 1546 },
+    { 1243, 1546 },
+    { 1241, 1545 },
+    { 1238, 1545 },
+    { 1237, 1544 },
+    { 1235, 1543 },
+    { 1232, 1543 },
+    { 1230, 1543 },
+    { 1228, 1542 },
+    { 1226, 1542 },
+    { 1224, 1541 },
+    { 1222, 1541 },
+    { 1220, 1540 },
+    { 1217, 1541 },
+    { 1214, 1542 },
+    { 1212, 1542 },
+    { 1209, 1542 },
+    { 1207, 1543 },
+    { 1204, 1544 },
+    { 1201, 1545 },
+    { 1198, 1546 },
+    { 1195, 1547 },
+    { 1192, 1549 },
+    { 1189, 1550 },
+    { 1186, 1552 },
+    { 1183, 1554 },
+    { 1180, 1556 },
+    { 1176, 1559 },
+    { 1173, 1561 },
+    { 1170, 1564 },
+    { 1167, 1566 },
+    { 1163, 1569 },
+    { 1160, 1571 },
+    { 1157, 1574 },
+    { 1154, 1577 },
+    { 1150, 1580 },
+    { 1147, 1583 },
+    { 1144, 1587 },
+    { 1141, 1590 },
+    { 1138, 1593 },
+    { 1135, 1597 },
+    { 1132, 1600 },
+    { 1129, 1604 },
+    { 1126, 1607 },
+    { 1123, 1611 },
+    { 1121, 1614 },
+    { 1118, 1618 },
+    { 1116, 1622 },
+    { 1113, 1626 },
+    { 1111, 1629 },
+    { 1108, 1633 },
+    { 1106, 1637 },
+    { 1103, 1640 },
+    { 1101, 1644 },
+    { 1100, 1648 },
+    { 1098, 1652 },
+    { 1097, 1655 },
+    { 1095, 1659 },
+    { 1094, 1663 },
+    { 1093, 1666 },
+    { 1092, 1670 },
+    { 1092, 1673 },
+    { 1091, 1676 },
+    { 1091, 1680 },
+    { 1091, 1683 },
+    { 1091, 1686 },
+    { 1092, 1689 },
+    { 1092, 1692 },
+    { 1093, 1695 },
+    { 1094, 1697 },
+    { 1095, 1700 },
+    { 1096, 1702 },
+    { 1098, 1705 },
+    { 1099, 1707 },
+    { 1101, 1709 },
+    { 1103, 1711 },
+    { 1106, 1713 },
+    { 1106, 1715 },
+    { 1104, 1718 },
+    { 1100, 1721 },
+    { 1097, 1724 },
+    { 1093, 1727 },
+    { 1090, 1730 },
+    { 1086, 1733 },
+    { 1083, 1736 },
+    { 1080, 1739 },
+    { 1077, 1742 },
+    { 1074, 1746 },
+    { 1071, 1749 },
+    { 1069, 1752 },
+    { 1066, 1755 },
+    { 1063, 1758 },
+    { 1060, 1761 },
+    { 1058, 1765 },
+    { 1055, 1768 },
+    { 1054, 1771 },
+    { 1052, 1775 },
+    { 1050, 1778 },
+    { 1048, 1781 },
+    { 1046, 1785 },
+    { 1046, 1788 },
+    { 1044, 1791 },
+    { 1044, 1794 },
+    { 1045, 1797 },
+    { 1045, 1801 },
+    { 1045, 1804 },
+    { 1047, 1807 },
+    { 1048, 1809 },
+    { 1050, 1812 },
+    { 1052, 1815 },
+    { 1054, 1817 },
+    { 1057, 1820 },
+    { 1060, 1822 },
+    { 1064, 1824 },
+    { 1067, 1826 },
+    { 1071, 1828 },
+    { 1075, 1830 },
+    { 1080, 1831 },
+    { 1085, 1833 },
+    { 1090, 1834 },
+    { 1095, 1835 },
+    { 1100, 1837 },
+    { 1106, 1837 },
+    { 1112, 1837 },
+    { 1117, 1838 },
+    { 1123, 1839 },
+    { 1130, 1838 },
+    { 1136, 1839 },
+    { 1142, 1839 },
+    { 1148, 1838 },
+    { 1155, 1838 },
+    { 1161, 1837 },
+    { 1168, 1836 },
+    { 1174, 1835 },
+    { 1181, 1834 },
+    { 1186, 1832 },
+    { 1193, 1830 },
+    { 1199, 1829 },
+    { 1204, 1827 },
+    { 1210, 1824 },
+    { 1215, 1822 },
+    { 1220, 1820 },
+    { 1224, 1817 },
+    { 1229, 1814 },
+    { 1233, 1811 },
+    { 1237, 1808 },
+    { 1240, 1805 },
+    { 1243, 1802 },
+    { 1246, 1799 },
+    { 1249, 1795 },
+    { 1252, 1792 },
+    { 1254, 1789 },
+    { 1257, 1786 },
+    { 1260, 1782 },
+    { 1262, 1779 },
+    { 1264, 1775 },
+    { 1266, 1772 },
+    { 1268, 1769 },
+    { 1270, 1765 },
+    { 1272, 1762 },
+    { 1274, 1758 },
+    { 1276, 1755 },
+    { 1278, 1752 },
+    { 1280, 1748 },
+    { 1282, 1745 },
+    { 1284, 1741 },
+    { 1285, 1738 },
+    { 1287, 1734 },
+    { 1289, 1731 },
+    { 1290, 1727 },
+    { 1292, 1724 },
+    { 1294, 1720 },
+    { 1295, 1717 },
+    { 1297, 1713 },
+    { 1299, 1710 },
+    { 1301, 1706 },
+    { 1302, 1703 },
+    { 1304, 1699 },
+    { 1306, 1696 },
+    { 1307, 1692 },
+    { 1308, 1689 },
+    { 1310, 1685 },
+    { 1312, 1682 },
+    { 1313, 1678 },
+    { 1315, 1675 },
+    { 1317, 1671 },
+    { 1318, 1668 },
+    { 1320, 1664 },
+    { 1321, 1661 },
+    { 1323, 1657 },
+    { 1325, 1653 },
+    { 1326, 1650 },
+    { 1327, 1646 },
+    { 1328, 1643 },
+    { 1329, 1639 },
+    { 1329, 1636 },
+    { 1330, 1632 },
+    { 1331, 1629 },
+    { 1331, 1625 },
+    { 1332, 1622 },
+    { 1333, 1618 },
+    { 1333, 1614 },
+    { 1333, 1612 },
+    { 1331, 1615 },
+    { 1333, 1614 },
+    { 1330, 1618 },
+    { 1329, 1622 },
+    { 1327, 1626 },
+    { 1325, 1630 },
+    { 1323, 1633 },
+    { 1322, 1637 },
+    { 1320, 1641 },
+    { 1319, 1645 },
+    { 1317, 1648 },
+    { 1315, 1652 },
+    { 1313, 1656 },
+    { 1311, 1659 },
+    { 1309, 1663 },
+    { 1308, 1667 },
+    { 1307, 1670 },
+    { 1305, 1674 },
+    { 1303, 1678 },
+    { 1301, 1681 },
+    { 1300, 1685 },
+    { 1298, 1688 },
+    { 1296, 1692 },
+    { 1294, 1695 },
+    { 1293, 1699 },
+    { 1291, 1702 },
+    { 1289, 1706 },
+    { 1288, 1709 },
+    { 1286, 1713 },
+    { 1284, 1716 },
+    { 1282, 1720 },
+    { 1280, 1723 },
+    { 1278, 1727 },
+    { 1276, 1730 },
+    { 1275, 1734 },
+    { 1273, 1737 },
+    { 1271, 1741 },
+    { 1269, 1744 },
+    { 1267, 1748 },
+    { 1265, 1751 },
+    { 1263, 1754 },
+    { 1260, 1758 },
+    { 1258, 1761 },
+    { 1256, 1765 },
+    { 1254, 1768 },
+    { 1251, 1771 },
+    { 1249, 1775 },
+    { 1247, 1778 },
+    { 1245, 1781 },
+    { 1242, 1785 },
+    { 1239, 1788 },
+    { 1236, 1791 },
+    { 1233, 1794 },
+    { 1229, 1797 },
+    { 1226, 1800 },
+    { 1222, 1804 },
+    { 1218, 1807 },
+    { 1215, 1810 },
+    { 1210, 1812 },
+    { 1204, 1814 },
+    { 1199, 1817 },
+    { 1194, 1818 },
+    { 1188, 1820 },
+    { 1183, 1822 },
+    { 1177, 1823 },
+    { 1171, 1824 },
+    { 1165, 1825 },
+    { 1159, 1826 },
+    { 1153, 1826 },
+    { 1147, 1827 },
+    { 1141, 1827 },
+    { 1135, 1828 },
+    { 1130, 1827 },
+    { 1124, 1827 },
+    { 1118, 1826 },
+    { 1113, 1826 },
+    { 1108, 1825 },
+    { 1103, 1824 },
+    { 1098, 1822 },
+    { 1093, 1821 },
+    { 1089, 1820 },
+    { 1084, 1818 },
+    { 1081, 1816 },
+    { 1077, 1814 },
+    { 1074, 1812 },
+    { 1072, 1810 },
+    { 1070, 1807 },
+    { 1068, 1805 },
+    { 1066, 1802 },
+    { 1064, 1799 },
+    { 1062, 1797 },
+    { 1062, 1794 },
+    { 1062, 1790 },
+    { 1062, 1787 },
+    { 1064, 1784 },
+    { 1065, 1781 },
+    { 1065, 1777 },
+    { 1068, 1774 },
+    { 1070, 1771 },
+    { 1072, 1767 },
+    { 1075, 1764 },
+    { 1077, 1761 },
+    { 1079, 1757 },
+    { 1081, 1754 },
+    { 1085, 1751 },
+    { 1087, 1748 },
+    { 1090, 1744 },
+    { 1094, 1741 },
+    { 1097, 1738 },
+    { 1100, 1735 },
+    { 1102, 1731 },
+    { 1106, 1728 },
+    { 1109, 1725 },
+    { 1113, 1722 },
+    { 1116, 1719 },
+    { 1120, 1717 },
+    { 1123, 1714 },
+    { 1125, 1710 },
+    { 1125, 1708 },
+    { 1123, 1706 },
+    { 1120, 1704 },
+    { 1118, 1703 },
+    { 1115, 1701 },
+    { 1113, 1699 },
+    { 1111, 1697 },
+    { 1109, 1695 },
+    { 1108, 1693 },
+    { 1107, 1691 },
+    { 1106, 1688 },
+    { 1104, 1686 },
+    { 1104, 1683 },
+    { 1103, 1680 },
+    { 1103, 1677 },
+    { 1103, 1674 },
+    { 1103, 1670 },
+    { 1104, 1667 },
+    { 1105, 1663 },
+    { 1106, 1660 },
+    { 1107, 1656 },
+    { 1108, 1653 },
+    { 1109, 1649 },
+    { 1111, 1645 },
+    { 1114, 1641 },
+    { 1115, 1638 },
+    { 1117, 1634 },
+    { 1119, 1630 },
+    { 1122, 1627 },
+    { 1124, 1623 },
+    { 1127, 1619 },
+    { 1130, 1616 },
+    { 1133, 1612 },
+    { 1135, 1608 },
+    { 1138, 1606 },
+    { 1141, 1602 },
+    { 1144, 1598 },
+    { 1147, 1595 },
+    { 1150, 1592 },
+    { 1153, 1589 },
+    { 1156, 1586 },
+    { 1159, 1583 },
+    { 1163, 1580 },
+    { 1166, 1577 },
+    { 1169, 1575 },
+    { 1172, 1572 },
+    { 1176, 1570 },
+    { 1179, 1567 },
+    { 1182, 1565 },
+    { 1185, 1563 },
+    { 1188, 1562 },
+    { 1192, 1560 },
+    { 1194, 1559 },
+    { 1197, 1558 },
+    { 1200, 1557 },
+    { 1203, 1557 },
+    { 1206, 1556 },
+    { 1208, 1556 },
+    { 1211, 1556 },
+    { 1213, 1556 },
+    { 1216, 1556 },
+    { 1218, 1556 },
+    { 1220, 1556 },
+    { 1223, 1556 },
+    { 1225, 1557 },
+    { 1227, 1558 },
+    { 1229, 1558 },
+    { 1231, 1559 },
+    { 1233, 1560 },
+    { 1235, 1561 },
+    { 1238, 1561 },
+    { 1239, 1562 },
+    { 1241, 1563 },
+    { 1243, 1563 },
+    { 1245, 1565 },
+    { 1247, 1566 },
+    { 1249, 1566 },
+    { 1251, 1567 },
+    { 1254, 1567 },
+    { 1255, 1568 },
+    { 1257, 1569 },
+    { 1259, 1571 },
+    { 1262, 1570 },
+    { 1263, 1572 },
+    { 1266, 1572 },
+    { 1268, 1573 },
+    { 1270, 1573 },
+    { 1273, 1574 },
+    { 1274, 1575 },
+    { 1276, 1576 },
+    { 1279, 1576 },
+    { 1281, 1577 },
+    { 1283, 1578 },
+    { 1285, 1579 },
+    { 1287, 1579 },
+    { 1290, 1580 },
+    { 1292, 1581 },
+    { 1294, 1581 },
+    { 1296, 1582 },
+    { 1299, 1583 },
+    { 1301, 1583 },
+    { 1303, 1584 },
+    { 1306, 1584 },
+    { 1308, 1585 },
+    { 1310, 1586 },
+    { 1312, 1587 },
+    { 1315, 1587 },
+    { 1317, 1588 },
+    { 1319, 1588 },
+    { 1321, 1589 },
+    { 1323, 1590 },
+    { 1326, 1591 },
+    { 1328, 1591 },
+    { 1330, 1592 },
+    { 1332, 1593 },
+    { 1334, 1594 },
+    { 1336, 1595 },
+    { 1335, 1599 },
+    { 1331, 1602 },
+    { 1328, 1605 },
+    { 1325, 1608 },
+    { 1322, 1611 },
+    { 1319, 1614 },
+    { 1316, 1616 },
+    { 1312, 1619 },
+    { 1309, 1622 },
+    { 1306, 1624 },
+    { 1303, 1627 },
+    { 1299, 1630 },
+    { 1296, 1633 },
+    { 1292, 1636 },
+    { 1289, 1638 },
+    { 1286, 1640 },
+    { 1282, 1643 },
+    { 1279, 1646 },
+    { 1275, 1648 },
+    { 1272, 1650 },
+    { 1268, 1652 },
+    { 1264, 1654 },
+    { 1261, 1657 },
+    { 1257, 1659 },
+    { 1254, 1661 },
+    { 1250, 1663 },
+    { 1246, 1665 },
+    { 1243, 1667 },
+    { 1239, 1668 },
+    { 1236, 1670 },
+    { 1232, 1672 },
+    { 1228, 1673 },
+    { 1225, 1675 },
+    { 1221, 1677 },
+    { 1217, 1678 },
+    { 1214, 1679 },
+    { 1210, 1681 },
+    { 1206, 1682 },
+    { 1203, 1684 },
+    { 1200, 1687 },
+    { 1200, 1691 },
+    { 1202, 1693 },
+    { 1205, 1693 },
+    { 1209, 1692 },
+    { 1213, 1691 },
+    { 1216, 1689 },
+    { 1220, 1687 },
+    { 1224, 1686 },
+    { 1228, 1685 },
+    { 1231, 1683 },
+    { 1235, 1682 },
+    { 1239, 1680 },
+    { 1243, 1677 },
+    { 1246, 1676 },
+    { 1250, 1674 },
+    { 1253, 1672 },
+    { 1257, 1670 },
+    { 1261, 1667 },
+    { 1264, 1665 },
+    { 1268, 1663 },
+    { 1271, 1661 },
+    { 1275, 1659 },
+    { 1279, 1656 },
+    { 1282, 1654 },
+    { 1286, 1651 },
+    { 1289, 1649 },
+    { 1293, 1646 },
+    { 1296, 1644 },
+    { 1299, 1641 },
+    { 1303, 1638 },
+    { 1306, 1636 },
+    { 1310, 1633 },
+    { 1313, 1630 },
+    { 1316, 1627 },
+    { 1319, 1624 },
+    { 1323, 1621 },
+    { 1326, 1618 },
+    { 1329, 1615 },
+    { 1332, 1613 },
+    { 1335, 1610 },
+    { 1337, 1606 },
+    { 1340, 1602 },
+    { 1342, 1598 },
+    { 1344, 1594 },
+    { 1347, 1590 },
+    { 1349, 1586 },
+    { 1351, 1582 },
+    { 1354, 1578 },
+    { 1356, 1574 },
+    { 1358, 1570 },
+    { 1361, 1566 },
+    { 1364, 1563 },
+    { 1367, 1559 },
+    { 1370, 1555 },
+    { 1373, 1552 },
+    { 1376, 1548 },
+    { 1379, 1544 },
+    { 1382, 1540 },
+    { 1385, 1537 },
+    { 1388, 1533 },
+    { 1391, 1529 },
+    { 1394, 1525 },
+    { 1397, 1521 },
+    { 1400, 1517 },
+    { 1403, 1513 },
+    { 1406, 1509 },
+    { 1409, 1505 },
+    { 1412, 1501 },
+    { 1414, 1497 },
+    { 1417, 1492 },
+    { 1420, 1488 },
+    { 1423, 1484 },
+    { 1426, 1479 },
+    { 1429, 1475 },
+    { 1432, 1471 },
+    { 1435, 1466 },
+    { 1438, 1462 },
+    { 1441, 1457 },
+    { 1444, 1452 },
+    { 1447, 1448 },
+    { 1449, 1443 },
+    { 1452, 1438 },
+    { 1455, 1433 },
+    { 1458, 1428 },
+    { 1461, 1423 },
+    { 1464, 1418 },
+    { 1467, 1413 },
+    { 1470, 1408 },
+    { 1473, 1403 },
+    { 1476, 1397 },
+    { 1479, 1392 },
+    { 1482, 1386 },
+    { 1485, 1381 },
+    { 1488, 1375 },
+    { 1491, 1369 },
+    { 1494, 1363 },
+    { 1497, 1358 },
+    { 1500, 1351 },
+    { 1503, 1345 },
+    { 1506, 1339 },
+    { 1509, 1333 },
+    { 1512, 1327 },
+    { 1515, 1320 },
+    { 1518, 1314 },
+    { 1521, 1307 },
+    { 1524, 1301 },
+    { 1527, 1294 },
+    { 1530, 1287 },
+    { 1533, 1279 },
+    { 1536, 1272 },
+    { 1539, 1266 },
+    { 1541, 1259 },
+    { 1544, 1252 },
+    { 1546, 1245 },
+    { 1549, 1237 },
+    { 1552, 1230 },
+    { 1555, 1222 },
+    { 1558, 1214 },
+    { 1561, 1207 },
+    { 1563, 1200 },
+    { 1565, 1193 },
+    { 1568, 1186 },
+    { 1570, 1179 },
+    { 1572, 1171 },
+    { 1574, 1166 },
+    { 1576, 1159 },
+    { 1577, 1153 },
+    { 1578, 1148 },
+    { 1579, 1144 },
+    { 1580, 1139 },
+    { 1580, 1135 },
+    { 1580, 1132 },
+    { 1579, 1131 },
+    { 1578, 1130 },
+    { 1577, 1128 },
+    { 1576, 1127 },
+    { 1574, 1127 },
+    { 1572, 1129 },
+    { 1569, 1131 },
+    { 1567, 1133 },
+    { 1564, 1135 },
+    { 1562, 1136 },
+    { 1557, 1142 },
+    { 1553, 1147 },
+    { 1549, 1153 },
+    { 1547, 1154 },
+    { 1543, 1160 },
+    { 1538, 1165 },
+    { 1534, 1170 },
+    { 1530, 1175 },
+    { 1527, 1180 },
+    { 1521, 1189 },
+    { 1518, 1193 },
+    { 1513, 1198 },
+    { 1509, 1205 },
+    { 1504, 1211 },
+    { 1500, 1218 },
+    { 1495, 1224 },
+    { 1491, 1231 },
+    { 1486, 1238 },
+    { 1482, 1244 },
+    { 1478, 1251 },
+    { 1473, 1258 },
+    { 1469, 1265 },
+    { 1465, 1271 },
+    { 1461, 1278 },
+    { 1456, 1285 },
+    { 1452, 1292 },
+    { 1448, 1299 },
+    { 1445, 1303 },
+    { 1442, 1305 },
+    { 1443, 1302 },
+    { 1443, 1297 },
+    { 1444, 1293 },
+    { 1444, 1290 },
+    { 1444, 1286 },
+    { 1445, 1283 },
+    { 1445, 1279 },
+    { 1445, 1276 },
+    { 1444, 1274 },
+    { 1443, 1272 },
+    { 1443, 1269 },
+    { 1442, 1267 },
+    { 1441, 1267 },
+    { 1440, 1266 },
+    { 1438, 1265 },
+    { 1436, 1265 },
+    { 1434, 1266 },
+    { 1432, 1267 },
+    { 1431, 1267 },
+    { 1428, 1269 },
+    { 1425, 1270 },
+    { 1423, 1272 },
+    { 1420, 1274 },
+    { 1418, 1276 },
+    { 1415, 1277 },
+    { 1412, 1281 },
+    { 1409, 1284 },
+    { 1405, 1288 },
+    { 1402, 1291 },
+    { 1399, 1294 },
+    { 1396, 1297 },
+    { 1392, 1301 },
+    { 1389, 1305 },
+    { 1385, 1309 },
+    { 1382, 1313 },
+    { 1379, 1317 },
+    { 1375, 1321 },
+    { 1371, 1326 },
+    { 1368, 1331 },
+    { 1364, 1335 },
+    { 1361, 1340 },
+    { 1357, 1345 },
+    { 1354, 1350 },
+    { 1350, 1355 },
+    { 1346, 1361 },
+    { 1343, 1366 },
+    { 1340, 1371 },
+    { 1336, 1377 },
+    { 1333, 1382 },
+    { 1330, 1388 },
+    { 1327, 1393 },
+    { 1324, 1398 },
+    { 1321, 1404 },
+    { 1319, 1409 },
+    { 1316, 1414 },
+    { 1314, 1420 },
+    { 1311, 1425 },
+    { 1310, 1429 },
+    { 1307, 1434 },
+    { 1305, 1439 },
+    { 1304, 1443 },
+    { 1303, 1448 },
+    { 1301, 1453 },
+    { 1299, 1457 },
+    { 1298, 1461 },
+    { 1298, 1465 },
+    { 1297, 1469 },
+    { 1296, 1473 },
+    { 1296, 1476 },
+    { 1296, 1480 },
+    { 1296, 1483 },
+    { 1296, 1486 },
+    { 1296, 1489 },
+    { 1295, 1493 },
+    { 1295, 1496 },
+    { 1296, 1499 },
+    { 1296, 1502 },
+    { 1296, 1505 },
+    { 1296, 1508 },
+    { 1296, 1511 },
+    { 1297, 1513 },
+    { 1298, 1516 },
+    { 1298, 1519 },
+    { 1299, 1521 },
+    { 1300, 1524 },
+    { 1300, 1526 },
+    { 1301, 1528 },
+    { 1302, 1531 },
+    { 1303, 1533 },
+    { 1303, 1535 },
+    { 1304, 1538 },
+    { 1305, 1540 },
+    { 1306, 1542 },
+    { 1307, 1544 },
+    { 1308, 1547 },
+    { 1309, 1549 },
+    { 1311, 1550 },
+    { 1312, 1552 },
+    { 1313, 1554 },
+    { 1315, 1556 },
+    { 1316, 1557 },
+    { 1317, 1559 },
+    { 1319, 1561 },
+    { 1320, 1562 },
+    { 1322, 1564 },
+    { 1324, 1565 },
+    { 1325, 1566 },
+    { 1327, 1568 },
+    { 1329, 1569 },
+    { 1331, 1570 },
+    { 1333, 1571 },
+    { 1335, 1572 },
+    { 1337, 1573 },
+    { 1339, 1574 },
+    { 1341, 1575 },
+    { 1343, 1576 },
+    { 1346, 1575 },
+    { 1347, 1571 },
+    { 1348, 1568 },
+    { 1348, 1564 },
+    { 1349, 1560 },
+    { 1350, 1556 },
+    { 1351, 1553 },
+    { 1352, 1549 },
+    { 1353, 1545 },
+    { 1354, 1541 },
+    { 1355, 1537 },
+    { 1356, 1533 },
+    { 1357, 1529 },
+    { 1358, 1525 },
+    { 1359, 1521 },
+    { 1360, 1517 },
+    { 1361, 1513 },
+    { 1361, 1510 },
+    { 1363, 1506 },
+    { 1364, 1502 },
+    { 1366, 1497 },
+    { 1367, 1493 },
+    { 1368, 1489 },
+    { 1370, 1484 },
+    { 1371, 1480 },
+    { 1373, 1476 },
+    { 1374, 1471 },
+    { 1376, 1467 },
+    { 1378, 1462 },
+    { 1379, 1458 },
+    { 1381, 1453 },
+    { 1383, 1448 },
+    { 1384, 1444 },
+    { 1386, 1439 },
+    { 1388, 1434 },
+    { 1390, 1429 },
+    { 1391, 1424 },
+    { 1394, 1420 },
+    { 1396, 1414 },
+    { 1398, 1409 },
+    { 1402, 1404 },
+    { 1405, 1401 },
+    { 1406, 1401 },
+    { 1407, 1403 },
+    { 1405, 1408 },
+    { 1403, 1413 },
+    { 1402, 1418 },
+    { 1400, 1423 },
+    { 1398, 1428 },
+    { 1396, 1432 },
+    { 1394, 1437 },
+    { 1393, 1442 },
+    { 1391, 1446 },
+    { 1389, 1451 },
+    { 1387, 1456 },
+    { 1386, 1460 },
+    { 1384, 1465 },
+    { 1383, 1469 },
+    { 1382, 1473 },
+    { 1380, 1478 },
+    { 1379, 1482 },
+    { 1378, 1486 },
+    { 1376, 1491 },
+    { 1375, 1495 },
+    { 1374, 1499 },
+    { 1373, 1503 },
+    { 1371, 1507 },
+    { 1370, 1511 },
+    { 1369, 1515 },
+    { 1368, 1519 },
+    { 1367, 1523 },
+    { 1366, 1527 },
+    { 1365, 1531 },
+    { 1364, 1535 },
+    { 1363, 1539 },
+    { 1363, 1542 },
+    { 1362, 1546 },
+    { 1361, 1550 },
+    { 1360, 1554 },
+    { 1359, 1557 },
+    { 1359, 1561 },
+    { 1359, 1564 },
+    { 1358, 1568 },
+    { 1359, 1569 },
+    { 1359, 1572 },
+    { 1359, 1575 },
+    { 1359, 1578 },
+    { 1359, 1582 },
+    { 1360, 1585 },
+    { 1361, 1586 },
+    { 1364, 1586 },
+    { 1367, 1585 },
+    { 1369, 1585 },
+    { 1372, 1585 },
+    { 1375, 1584 },
+    { 1378, 1584 },
+    { 1381, 1583 },
+    { 1384, 1583 },
+    { 1386, 1582 },
+    { 1389, 1582 },
+    { 1392, 1581 },
+    { 1395, 1581 },
+    { 1398, 1580 },
+    { 1401, 1579 },
+    { 1404, 1578 },
+    { 1407, 1577 },
+    { 1410, 1576 },
+    { 1413, 1575 },
+    { 1416, 1574 },
+    { 1419, 1573 },
+    { 1422, 1572 },
+    { 1425, 1570 },
+    { 1428, 1568 },
+    { 1431, 1568 },
+    { 1434, 1566 },
+    { 1437, 1564 },
+    { 1440, 1563 },
+    { 1443, 1561 },
+    { 1446, 1560 },
+    { 1449, 1559 },
+    { 1453, 1556 },
+    { 1455, 1555 },
+    { 1459, 1553 },
+    { 1461, 1552 },
+    { 1464, 1550 },
+    { 1468, 1548 },
+    { 1471, 1545 },
+    { 1474, 1545 },
+    { 1476, 1544 },
+    { 1477, 1547 },
+    { 1475, 1551 },
+    { 1473, 1554 },
+    { 1470, 1557 },
+    { 1466, 1560 },
+    { 1463, 1562 },
+    { 1460, 1563 },
+    { 1457, 1566 },
+    { 1454, 1567 },
+    { 1451, 1568 },
+    { 1448, 1571 },
+    { 1445, 1572 },
+    { 1442, 1574 },
+    { 1439, 1575 },
+    { 1436, 1576 },
+    { 1433, 1578 },
+    { 1430, 1579 },
+    { 1427, 1581 },
+    { 1424, 1582 },
+    { 1420, 1583 },
+    { 1417, 1585 },
+    { 1414, 1586 },
+    { 1411, 1587 },
+    { 1408, 1588 },
+    { 1405, 1589 },
+    { 1402, 1590 },
+    { 1399, 1591 },
+    { 1396, 1592 },
+    { 1393, 1593 },
+    { 1390, 1594 },
+    { 1387, 1594 },
+    { 1384, 1595 },
+    { 1381, 1596 },
+    { 1378, 1596 },
+    { 1375, 1597 },
+    { 1372, 1598 },
+    { 1369, 1598 },
+    { 1367, 1598 },
+    { 1364, 1598 },
+    { 1362, 1598 },
+    { 1359, 1600 },
+    { 1359, 1603 },
+    { 1360, 1604 },
+    { 1361, 1607 },
+    { 1362, 1609 },
+    { 1363, 1611 },
+    { 1364, 1613 },
+    { 1366, 1615 },
+    { 1367, 1617 },
+    { 1369, 1619 },
+    { 1370, 1621 },
+    { 1371, 1623 },
+    { 1372, 1625 },
+    { 1374, 1627 },
+    { 1376, 1629 },
+    { 1377, 1631 },
+    { 1379, 1632 },
+    { 1380, 1634 },
+    { 1381, 1636 },
+    { 1383, 1638 },
+    { 1385, 1640 },
+    { 1387, 1641 },
+    { 1389, 1643 },
+    { 1391, 1645 },
+    { 1392, 1646 },
+    { 1394, 1648 },
+    { 1395, 1650 },
+    { 1398, 1651 },
+    { 1400, 1653 },
+    { 1401, 1655 },
+    { 1404, 1656 },
+    { 1406, 1657 },
+    { 1408, 1659 },
+    { 1410, 1661 },
+    { 1412, 1661 },
+    { 1414, 1663 },
+    { 1416, 1665 },
+    { 1419, 1666 },
+    { 1421, 1667 },
+    { 1424, 1668 },
+    { 1426, 1669 },
+    { 1429, 1670 },
+    { 1432, 1670 },
+    { 1435, 1671 },
+    { 1438, 1671 },
+    { 1441, 1671 },
+    { 1444, 1671 },
+    { 1448, 1671 },
+    { 1451, 1671 },
+    { 1454, 1670 },
+    { 1458, 1670 },
+    { 1461, 1670 },
+    { 1465, 1669 },
+    { 1468, 1668 },
+    { 1472, 1667 },
+    { 1475, 1665 },
+    { 1479, 1664 },
+    { 1483, 1663 },
+    { 1486, 1661 },
+    { 1490, 1659 },
+    { 1493, 1657 },
+    { 1497, 1655 },
+    { 1501, 1653 },
+    { 1504, 1651 },
+    { 1508, 1648 },
+    { 1511, 1645 },
+    { 1514, 1642 },
+    { 1518, 1640 },
+    { 1521, 1637 },
+    { 1524, 1634 },
+    { 1527, 1630 },
+    { 1530, 1627 },
+    { 1533, 1624 },
+    { 1536, 1620 },
+    { 1538, 1617 },
+    { 1540, 1613 },
+    { 1543, 1609 },
+    { 1545, 1605 },
+    { 1547, 1601 },
+    { 1549, 1597 },
+    { 1551, 1593 },
+    { 1552, 1590 },
+    { 1554, 1586 },
+    { 1556, 1582 },
+    { 1557, 1578 },
+    { 1558, 1574 },
+    { 1559, 1570 },
+    { 1560, 1566 },
+    { 1561, 1562 },
+    { 1562, 1559 },
+    { 1563, 1555 },
+    { 1563, 1551 },
+    { 1564, 1548 },
+    { 1564, 1544 },
+    { 1564, 1541 },
+    { 1564, 1539 },
+    { 1564, 1535 },
+    { 1564, 1532 },
+    { 1563, 1530 },
+    { 1562, 1528 },
+    { 1561, 1525 },
+    { 1561, 1523 },
+    { 1560, 1521 },
+    { 1559, 1519 },
+    { 1558, 1517 },
+    { 1557, 1515 },
+    { 1555, 1514 },
+    { 1553, 1513 },
+    { 1552, 1511 },
+    { 1550, 1510 },
+    { 1549, 1509 },
+    { 1547, 1508 },
+    { 1545, 1507 },
+    { 1543, 1507 },
+    { 1541, 1507 },
+    { 1539, 1506 },
+    { 1537, 1506 },
+    { 1535, 1505 },
+    { 1534, 1503 },
+    { 1535, 1499 },
+    { 1538, 1495 },
+    { 1540, 1490 },
+    { 1543, 1487 },
+    { 1546, 1482 },
+    { 1549, 1478 },
+    { 1552, 1474 },
+    { 1555, 1469 },
+    { 1558, 1464 },
+    { 1561, 1460 },
+    { 1564, 1455 },
+    { 1566, 1450 },
+    { 1569, 1445 },
+    { 1571, 1441 },
+    { 1574, 1436 },
+    { 1577, 1430 },
+    { 1579, 1425 },
+    { 1581, 1420 },
+    { 1583, 1415 },
+    { 1585, 1410 },
+    { 1587, 1405 },
+    { 1589, 1400 },
+    { 1590, 1396 },
+    { 1592, 1391 },
+    { 1593, 1386 },
+    { 1595, 1382 },
+    { 1596, 1377 },
+    { 1596, 1373 },
+    { 1597, 1369 },
+    { 1598, 1365 },
+    { 1599, 1361 },
+    { 1599, 1357 },
+    { 1599, 1354 },
+    { 1599, 1352 },
+    { 1599, 1348 },
+    { 1600, 1344 },
+    { 1599, 1343 },
+    { 1599, 1339 },
+    { 1598, 1337 },
+    { 1598, 1334 },
+    { 1597, 1332 },
+    { 1596, 1330 },
+    { 1595, 1329 },
+    { 1594, 1327 },
+    { 1592, 1327 },
+    { 1591, 1327 },
+    { 1589, 1327 },
+    { 1587, 1327 },
+    { 1585, 1327 },
+    { 1583, 1328 },
+    { 1581, 1329 },
+    { 1579, 1330 },
+    { 1576, 1331 },
+    { 1573, 1333 },
+    { 1571, 1335 },
+    { 1568, 1337 },
+    { 1565, 1339 },
+    { 1562, 1341 },
+    { 1559, 1345 },
+    { 1556, 1347 },
+    { 1553, 1350 },
+    { 1550, 1354 },
+    { 1547, 1356 },
+    { 1544, 1360 },
+    { 1540, 1364 },
+    { 1537, 1367 },
+    { 1534, 1371 },
+    { 1530, 1375 },
+    { 1527, 1378 },
+    { 1524, 1382 },
+    { 1521, 1386 },
+    { 1518, 1390 },
+    { 1514, 1395 },
+    { 1511, 1398 },
+    { 1508, 1402 },
+    { 1504, 1407 },
+    { 1501, 1411 },
+    { 1498, 1416 },
+    { 1494, 1420 },
+    { 1491, 1424 },
+    { 1488, 1428 },
+    { 1485, 1433 },
+    { 1481, 1437 },
+    { 1479, 1442 },
+    { 1475, 1445 },
+    { 1472, 1450 },
+    { 1469, 1454 },
+    { 1466, 1458 },
+    { 1463, 1463 },
+    { 1460, 1467 },
+    { 1457, 1470 },
+    { 1454, 1475 },
+    { 1451, 1478 },
+    { 1448, 1482 },
+    { 1445, 1486 },
+    { 1442, 1490 },
+    { 1439, 1494 },
+    { 1435, 1498 },
+    { 1432, 1502 },
+    { 1429, 1506 },
+    { 1426, 1509 },
+    { 1423, 1513 },
+    { 1420, 1517 },
+    { 1417, 1520 },
+    { 1414, 1524 },
+    { 1411, 1527 },
+    { 1408, 1531 },
+    { 1405, 1535 },
+    { 1402, 1538 },
+    { 1399, 1542 },
+    { 1396, 1545 },
+    { 1393, 1549 },
+    { 1390, 1552 },
+    { 1387, 1556 },
+    { 1384, 1559 },
+    { 1381, 1562 },
+    { 1378, 1566 },
+    { 1375, 1569 },
+    { 1372, 1572 },
+    { 1369, 1575 },
+    { 1366, 1578 },
+    { 1363, 1581 },
+    { 1360, 1584 },
+    { 1359, 1587 },
+    { 1359, 1591 },
+    { 1358, 1594 },
+    { 1357, 1598 },
+    { 1357, 1601 },
+    { 1356, 1605 },
+    { 1355, 1608 },
+    { 1355, 1612 },
+    { 1354, 1615 },
+    { 1354, 1619 },
+    { 1354, 1622 },
+    { 1354, 1625 },
+    { 1356, 1627 },
+    { 1356, 1629 },
+    { 1358, 1631 },
+    { 1359, 1633 },
+    { 1361, 1635 },
+    { 1362, 1637 },
+    { 1364, 1639 },
+    { 1365, 1640 },
+    { 1366, 1643 },
+    { 1368, 1645 },
+    { 1370, 1646 },
+    { 1372, 1648 },
+    { 1373, 1650 },
+    { 1375, 1651 },
+    { 1377, 1654 },
+    { 1378, 1656 },
+    { 1381, 1657 },
+    { 1382, 1659 },
+    { 1384, 1660 },
+    { 1386, 1662 },
+    { 1388, 1663 },
+    { 1390, 1665 },
+    { 1392, 1666 },
+    { 1394, 1668 },
+    { 1396, 1670 },
+    { 1399, 1671 },
+    { 1401, 1672 },
+    { 1403, 1674 },
+    { 1405, 1676 },
+    { 1408, 1677 },
+    { 1410, 1678 },
+    { 1412, 1679 },
+    { 1415, 1680 },
+    { 1418, 1681 },
+    { 1420, 1682 },
+    { 1423, 1683 },
+    { 1426, 1683 },
+    { 1430, 1683 },
+    { 1433, 1684 },
+    { 1436, 1684 },
+    { 1439, 1684 },
+    { 1443, 1684 },
+    { 1446, 1684 },
+    { 1450, 1683 },
+    { 1453, 1683 },
+    { 1457, 1682 },
+    { 1461, 1681 },
+    { 1464, 1680 },
+    { 1468, 1679 },
+    { 1472, 1678 },
+    { 1475, 1677 },
+    { 1479, 1675 },
+    { 1483, 1674 },
+    { 1486, 1672 },
+    { 1490, 1670 },
+    { 1494, 1668 },
+    { 1497, 1666 },
+    { 1501, 1664 },
+    { 1505, 1662 },
+    { 1508, 1659 },
+    { 1511, 1656 },
+    { 1515, 1654 },
+    { 1518, 1651 },
+    { 1521, 1648 },
+    { 1524, 1645 },
+    { 1528, 1643 },
+    { 1531, 1639 },
+    { 1534, 1636 },
+    { 1537, 1632 },
+    { 1539, 1629 },
+    { 1542, 1625 },
+    { 1544, 1622 },
+    { 1547, 1618 },
+    { 1549, 1614 },
+    { 1552, 1611 },
+    { 1554, 1607 },
+    { 1556, 1603 },
+    { 1558, 1599 },
+    { 1559, 1595 },
+    { 1561, 1591 },
+    { 1563, 1587 },
+    { 1564, 1583 },
+    { 1565, 1580 },
+    { 1567, 1576 },
+    { 1568, 1572 },
+    { 1569, 1568 },
+    { 1570, 1564 },
+    { 1571, 1560 },
+    { 1572, 1556 },
+    { 1573, 1553 },
+    { 1574, 1549 },
+    { 1574, 1545 },
+    { 1574, 1542 },
+    { 1575, 1538 },
+    { 1575, 1535 },
+    { 1575, 1532 },
+    { 1575, 1529 },
+    { 1575, 1526 },
+    { 1575, 1523 },
+    { 1575, 1520 },
+    { 1574, 1518 },
+    { 1574, 1515 },
+    { 1573, 1513 },
+    { 1572, 1510 },
+    { 1571, 1508 },
+    { 1570, 1506 },
+    { 1569, 1505 },
+    { 1568, 1502 },
+    { 1567, 1501 },
+    { 1565, 1500 },
+    { 1564, 1498 },
+    { 1562, 1498 },
+    { 1561, 1495 },
+    { 1560, 1495 },
+    { 1558, 1494 },
+    { 1556, 1493 },
+    { 1554, 1492 },
+    { 1553, 1491 },
+    { 1550, 1491 },
+    { 1550, 1490 },
+    { 1553, 1485 },
+    { 1555, 1481 },
+    { 1558, 1476 },
+    { 1561, 1472 },
+    { 1564, 1467 },
+    { 1566, 1463 },
+    { 1569, 1458 },
+    { 1572, 1453 },
+    { 1574, 1449 },
+    { 1577, 1444 },
+    { 1580, 1439 },
+    { 1582, 1434 },
+    { 1585, 1429 },
+    { 1587, 1424 },
+    { 1589, 1419 },
+    { 1591, 1413 },
+    { 1593, 1408 },
+    { 1596, 1403 },
+    { 1597, 1398 },
+    { 1599, 1393 },
+    { 1600, 1389 },
+    { 1602, 1383 },
+    { 1604, 1379 },
+    { 1605, 1374 },
+    { 1606, 1369 },
+    { 1607, 1365 },
+    { 1608, 1360 },
+    { 1609, 1356 },
+    { 1609, 1353 },
+    { 1610, 1349 },
+    { 1610, 1345 },
+    { 1611, 1341 },
+    { 1611, 1337 },
+    { 1612, 1333 },
+    { 1612, 1330 },
+    { 1611, 1327 },
+    { 1611, 1324 },
+    { 1612, 1321 },
+    { 1611, 1318 },
+    { 1611, 1316 },
+    { 1610, 1313 },
+    { 1610, 1311 },
+    { 1609, 1309 },
+    { 1608, 1307 },
+    { 1607, 1306 },
+    { 1606, 1305 },
+    { 1605, 1304 },
+    { 1603, 1304 },
+    { 1601, 1304 },
+    { 1599, 1304 },
+    { 1597, 1304 },
+    { 1596, 1304 },
+    { 1593, 1305 },
+    { 1591, 1306 },
+    { 1589, 1307 },
+    { 1586, 1309 },
+    { 1584, 1310 },
+    { 1581, 1312 },
+    { 1578, 1314 },
+    { 1575, 1316 },
+    { 1572, 1319 },
+    { 1569, 1323 },
+    { 1566, 1325 },
+    { 1563, 1327 },
+    { 1560, 1331 },
+    { 1557, 1334 },
+    { 1554, 1336 },
+    { 1551, 1340 },
+    { 1547, 1344 },
+    { 1544, 1348 },
+    { 1541, 1350 },
+    { 1538, 1354 },
+    { 1535, 1359 },
+    { 1531, 1362 },
+    { 1528, 1366 },
+    { 1525, 1370 },
+    { 1521, 1375 },
+    { 1518, 1379 },
+    { 1515, 1382 },
+    { 1511, 1387 },
+    { 1508, 1391 },
+    { 1505, 1395 },
+    { 1501, 1400 },
+    { 1498, 1404 },
+    { 1495, 1408 },
+    { 1492, 1412 },
+    { 1488, 1417 },
+    { 1485, 1422 },
+    { 1482, 1426 },
+    { 1479, 1430 },
+    { 1475, 1434 },
+    { 1472, 1439 },
+    { 1469, 1443 },
+    { 1466, 1447 },
+    { 1463, 1452 },
+    { 1460, 1455 },
+    { 1457, 1459 },
+    { 1454, 1463 },
+    { 1451, 1467 },
+    { 1448, 1471 },
+    { 1445, 1475 },
+    { 1442, 1479 },
+    { 1439, 1483 },
+    { 1435, 1487 },
+    { 1432, 1490 },
+    { 1430, 1494 },
+    { 1427, 1498 },
+    { 1424, 1501 },
+    { 1421, 1505 },
+    { 1418, 1509 },
+    { 1414, 1513 },
+    { 1411, 1516 },
+    { 1408, 1520 },
+    { 1405, 1524 },
+    { 1402, 1527 },
+    { 1400, 1530 },
+    { 1403, 1527 },
+    { 1406, 1523 },
+    { 1409, 1519 },
+    { 1412, 1515 },
+    { 1416, 1511 },
+    { 1419, 1508 },
+    { 1422, 1504 },
+    { 1425, 1500 },
+    { 1428, 1496 },
+    { 1431, 1493 },
+    { 1434, 1489 },
+    { 1437, 1485 },
+    { 1440, 1482 },
+    { 1443, 1478 },
+    { 1446, 1473 },
+    { 1449, 1469 },
+    { 1453, 1465 },
+    { 1456, 1461 },
+    { 1459, 1457 },
+    { 1462, 1453 },
+    { 1465, 1449 },
+    { 1468, 1445 },
+    { 1471, 1441 },
+    { 1474, 1437 },
+    { 1477, 1432 },
+    { 1481, 1428 },
+    { 1484, 1423 },
+    { 1487, 1419 },
+    { 1490, 1414 },
+    { 1494, 1410 },
+    { 1497, 1406 },
+    { 1500, 1401 },
+    { 1503, 1397 },
+    { 1507, 1393 },
+    { 1510, 1389 },
+    { 1513, 1384 },
+    { 1517, 1380 },
+    { 1520, 1377 },
+    { 1523, 1372 },
+    { 1527, 1367 },
+    { 1530, 1364 },
+    { 1533, 1360 },
+    { 1537, 1356 },
+    { 1540, 1352 },
+    { 1543, 1349 },
+    { 1546, 1346 },
+    { 1549, 1342 },
+    { 1553, 1338 },
+    { 1556, 1334 },
+    { 1559, 1333 },
+    { 1562, 1329 },
+    { 1565, 1326 },
+    { 1568, 1324 },
+    { 1571, 1320 },
+    { 1574, 1318 },
+    { 1576, 1317 },
+    { 1580, 1313 },
+    { 1582, 1312 },
+    { 1584, 1311 },
+    { 1587, 1310 },
+    { 1589, 1308 },
+    { 1592, 1307 },
+    { 1594, 1305 },
+    { 1596, 1305 },
+    { 1598, 1305 },
+    { 1600, 1305 },
+    { 1601, 1305 },
+    { 1603, 1305 },
+    { 1605, 1306 },
+    { 1606, 1307 },
+    { 1607, 1307 },
+    { 1609, 1309 },
+    { 1609, 1311 },
+    { 1610, 1313 },
+    { 1611, 1315 },
+    { 1611, 1317 },
+    { 1612, 1319 },
+    { 1611, 1323 },
+    { 1611, 1327 },
+    { 1612, 1329 },
+    { 1612, 1332 },
+    { 1611, 1336 },
+    { 1611, 1340 },
+    { 1610, 1344 },
+    { 1610, 1347 },
+    { 1609, 1351 },
+    { 1609, 1355 },
+    { 1609, 1359 },
+    { 1608, 1363 },
+    { 1606, 1368 },
+    { 1605, 1373 },
+    { 1604, 1377 },
+    { 1603, 1382 },
+    { 1601, 1387 },
+    { 1599, 1392 },
+    { 1597, 1397 },
+    { 1595, 1402 },
+    { 1593, 1407 },
+    { 1591, 1412 },
+    { 1589, 1418 },
+    { 1587, 1423 },
+    { 1585, 1428 },
+    { 1582, 1433 },
+    { 1580, 1438 },
+    { 1577, 1443 },
+    { 1575, 1448 },
+    { 1572, 1453 },
+    { 1569, 1458 },
+    { 1567, 1462 },
+    { 1564, 1467 },
+    { 1561, 1471 },
+    { 1559, 1476 },
+    { 1556, 1480 },
+    { 1553, 1484 },
+    { 1550, 1489 },
+    { 1550, 1492 },
+    { 1552, 1492 },
+    { 1554, 1493 },
+    { 1556, 1493 },
+    { 1558, 1493 },
+    { 1559, 1495 },
+    { 1561, 1496 },
+    { 1562, 1497 },
+    { 1564, 1498 },
+    { 1565, 1500 },
+    { 1566, 1501 },
+    { 1568, 1502 },
+    { 1569, 1505 },
+    { 1570, 1506 },
+    { 1571, 1508 },
+    { 1572, 1510 },
+    { 1573, 1512 },
+    { 1574, 1515 },
+    { 1574, 1517 },
+    { 1574, 1520 },
+    { 1574, 1523 },
+    { 1575, 1526 },
+    { 1575, 1529 },
+    { 1575, 1532 },
+    { 1575, 1535 },
+    { 1575, 1539 },
+    { 1574, 1543 },
+    { 1573, 1546 },
+    { 1573, 1550 },
+    { 1572, 1553 },
+    { 1571, 1557 },
+    { 1570, 1561 },
+    { 1569, 1565 },
+    { 1568, 1569 },
+    { 1567, 1573 },
+    { 1566, 1577 },
+    { 1565, 1580 },
+    { 1563, 1584 },
+    { 1562, 1588 },
+    { 1560, 1592 },
+    { 1559, 1596 },
+    { 1557, 1600 },
+    { 1555, 1604 },
+    { 1553, 1608 },
+    { 1551, 1611 },
+    { 1548, 1615 },
+    { 1547, 1619 },
+    { 1544, 1622 },
+    { 1541, 1626 },
+    { 1539, 1630 },
+    { 1536, 1633 },
+    { 1533, 1637 },
+    { 1530, 1640 },
+    { 1527, 1643 },
+    { 1524, 1646 },
+    { 1520, 1649 },
+    { 1517, 1652 },
+    { 1514, 1655 },
+    { 1510, 1657 },
+    { 1507, 1660 },
+    { 1504, 1662 },
+    { 1500, 1664 },
+    { 1496, 1667 },
+    { 1493, 1669 },
+    { 1489, 1671 },
+    { 1485, 1672 },
+    { 1481, 1674 },
+    { 1478, 1675 },
+    { 1474, 1677 },
+    { 1470, 1678 },
+    { 1467, 1679 },
+    { 1463, 1680 },
+    { 1459, 1681 },
+    { 1456, 1682 },
+    { 1452, 1682 },
+    { 1449, 1683 },
+    { 1445, 1683 },
+    { 1442, 1683 },
+    { 1438, 1683 },
+    { 1435, 1683 },
+    { 1432, 1683 },
+    { 1429, 1683 },
+    { 1425, 1682 },
+    { 1422, 1682 },
+    { 1420, 1681 },
+    { 1417, 1680 },
+    { 1414, 1679 },
+    { 1411, 1679 },
+    { 1409, 1677 },
+    { 1407, 1676 },
+    { 1404, 1675 },
+    { 1402, 1673 },
+    { 1400, 1672 },
+    { 1398, 1671 },
+    { 1395, 1669 },
+    { 1393, 1667 },
+    { 1392, 1666 },
+    { 1390, 1664 },
+    { 1388, 1662 },
+    { 1385, 1661 },
+    { 1383, 1659 },
+    { 1381, 1658 },
+    { 1380, 1656 },
+    { 1378, 1654 },
+    { 1376, 1652 },
+    { 1374, 1651 },
+    { 1372, 1649 },
+    { 1371, 1647 },
+    { 1370, 1645 },
+    { 1368, 1643 },
+    { 1366, 1641 },
+    { 1364, 1640 },
+    { 1363, 1638 },
+    { 1362, 1635 },
+    { 1360, 1634 },
+    { 1359, 1631 },
+    { 1357, 1630 },
+    { 1356, 1628 },
+    { 1355, 1625 },
+    { 1354, 1623 },
+    { 1352, 1623 },
+    { 1352, 1624 },
+    { 1351, 1627 },
+    { 1351, 1631 },
+    { 1351, 1634 },
+    { 1351, 1637 },
+    { 1351, 1640 },
+    { 1351, 1643 },
+    { 1351, 1647 },
+    { 1351, 1650 },
+    { 1351, 1653 },
+    { 1351, 1656 },
+    { 1351, 1659 },
+    { 1352, 1662 },
+    { 1352, 1665 },
+    { 1352, 1668 },
+    { 1352, 1671 },
+    { 1353, 1674 },
+    { 1353, 1677 },
+    { 1354, 1680 },
+    { 1354, 1683 },
+    { 1355, 1686 },
+    { 1356, 1689 },
+    { 1357, 1691 },
+    { 1357, 1694 },
+    { 1359, 1696 },
+    { 1360, 1699 },
+    { 1360, 1701 },
+    { 1361, 1704 },
+    { 1362, 1707 },
+    { 1364, 1709 },
+    { 1365, 1711 },
+    { 1367, 1713 },
+    { 1368, 1716 },
+    { 1369, 1718 },
+    { 1371, 1721 },
+    { 1372, 1723 },
+    { 1374, 1726 },
+    { 1376, 1728 },
+    { 1379, 1729 },
+    { 1380, 1731 },
+    { 1382, 1734 },
+    { 1384, 1736 },
+    { 1387, 1738 },
+    { 1390, 1739 },
+    { 1392, 1741 },
+    { 1394, 1743 },
+    { 1397, 1744 },
+    { 1399, 1746 },
+    { 1402, 1748 },
+    { 1405, 1749 },
+    { 1409, 1750 },
+    { 1411, 1753 },
+    { 1414, 1753 },
+    { 1417, 1755 },
+    { 1421, 1756 },
+    { 1424, 1757 },
+    { 1428, 1758 },
+    { 1432, 1758 },
+    { 1435, 1760 },
+    { 1439, 1760 },
+    { 1443, 1761 },
+    { 1447, 1761 },
+    { 1451, 1762 },
+    { 1455, 1763 },
+    { 1459, 1763 },
+    { 1463, 1763 },
+    { 1467, 1763 },
+    { 1472, 1763 },
+    { 1476, 1764 },
+    { 1480, 1764 },
+    { 1484, 1764 },
+    { 1489, 1763 },
+    { 1494, 1763 },
+    { 1498, 1762 },
+    { 1503, 1761 },
+    { 1507, 1761 },
+    { 1512, 1759 },
+    { 1517, 1758 },
+    { 1521, 1756 },
+    { 1526, 1754 },
+    { 1530, 1753 },
+    { 1535, 1751 },
+    { 1539, 1748 },
+    { 1543, 1746 },
+    { 1546, 1743 },
+    { 1549, 1740 },
+    { 1553, 1737 },
+    { 1556, 1734 },
+    { 1558, 1730 },
+    { 1561, 1727 },
+    { 1564, 1723 },
+    { 1566, 1720 },
+    { 1567, 1717 },
+    { 1570, 1713 },
+    { 1571, 1710 },
+    { 1573, 1707 },
+    { 1576, 1703 },
+    { 1577, 1700 },
+    { 1579, 1696 },
+    { 1582, 1693 },
+    { 1586, 1691 },
+    { 1589, 1689 },
+    { 1593, 1687 },
+    { 1597, 1687 },
+    { 1600, 1687 },
+    { 1602, 1688 },
+    { 1603, 1691 },
+    { 1604, 1694 },
+    { 1604, 1697 },
+    { 1602, 1701 },
+    { 1601, 1704 },
+    { 1600, 1708 },
+    { 1599, 1711 },
+    { 1597, 1714 },
+    { 1595, 1718 },
+    { 1594, 1721 },
+    { 1593, 1725 },
+    { 1591, 1728 },
+    { 1589, 1732 },
+    { 1587, 1735 },
+    { 1584, 1739 },
+    { 1582, 1742 },
+    { 1579, 1745 },
+    { 1576, 1748 },
+    { 1573, 1752 },
+    { 1570, 1755 },
+    { 1567, 1758 },
+    { 1563, 1761 },
+    { 1560, 1764 },
+    { 1556, 1766 },
+    { 1552, 1769 },
+    { 1548, 1771 },
+    { 1543, 1774 },
+    { 1539, 1776 },
+    { 1534, 1778 },
+    { 1529, 1780 },
+    { 1524, 1782 },
+    { 1519, 1783 },
+    { 1514, 1785 },
+    { 1509, 1786 },
+    { 1504, 1787 },
+    { 1499, 1788 },
+    { 1494, 1789 },
+    { 1489, 1790 },
+    { 1484, 1790 },
+    { 1478, 1791 },
+    { 1473, 1791 },
+    { 1468, 1791 },
+    { 1464, 1791 },
+    { 1458, 1791 },
+    { 1454, 1791 },
+    { 1449, 1791 },
+    { 1444, 1791 },
+    { 1440, 1790 },
+    { 1435, 1790 },
+    { 1430, 1790 },
+    { 1426, 1789 },
+    { 1422, 1788 },
+    { 1417, 1787 },
+    { 1413, 1787 },
+    { 1408, 1786 },
+    { 1404, 1785 },
+    { 1400, 1784 },
+    { 1397, 1782 },
+    { 1393, 1781 },
+    { 1389, 1780 },
+    { 1386, 1778 },
+    { 1383, 1777 },
+    { 1379, 1776 },
+    { 1376, 1774 },
+    { 1373, 1772 },
+    { 1370, 1771 },
+    { 1368, 1769 },
+    { 1365, 1767 },
+    { 1362, 1765 },
+    { 1359, 1764 },
+    { 1357, 1761 },
+    { 1355, 1759 },
+    { 1352, 1757 },
+    { 1350, 1755 },
+    { 1348, 1753 },
+    { 1346, 1750 },
+    { 1345, 1748 },
+    { 1343, 1745 },
+    { 1341, 1743 },
+    { 1339, 1741 },
+    { 1337, 1739 },
+    { 1336, 1736 },
+    { 1335, 1733 },
+    { 1335, 1730 },
+    { 1333, 1728 },
+    { 1332, 1725 },
+    { 1331, 1723 },
+    { 1329, 1721 },
+    { 1329, 1718 },
+    { 1328, 1715 },
+    { 1328, 1712 },
+    { 1327, 1709 },
+    { 1327, 1706 },
+    { 1326, 1703 },
+    { 1326, 1700 },
+    { 1326, 1697 },
+    { 1325, 1694 },
+    { 1325, 1691 },
+    { 1325, 1687 },
+    { 1325, 1684 },
+    { 1325, 1681 },
+    { 1325, 1678 },
+    { 1326, 1675 },
+    { 1326, 1672 },
+    { 1326, 1668 },
+    { 1327, 1665 },
+    { 1327, 1662 },
+    { 1327, 1659 },
+    { 1327, 1655 },
+    { 1327, 1652 },
+    { 1329, 1648 },
+    { 1330, 1645 },
+    { 1330, 1646 },
+    { 1329, 1649 },
+    { 1327, 1653 },
+    { 1327, 1656 },
+    { 1327, 1659 },
+    { 1327, 1662 },
+    { 1327, 1666 },
+    { 1326, 1669 },
+    { 1326, 1672 },
+    { 1326, 1675 },
+    { 1325, 1679 },
+    { 1325, 1682 },
+    { 1325, 1685 },
+    { 1325, 1688 },
+    { 1325, 1691 },
+    { 1325, 1694 },
+    { 1326, 1697 },
+    { 1326, 1700 },
+    { 1326, 1703 },
+    { 1327, 1706 },
+    { 1327, 1709 },
+    { 1328, 1712 },
+    { 1328, 1715 },
+    { 1329, 1718 },
+    { 1329, 1721 },
+    { 1331, 1723 },
+    { 1332, 1726 },
+    { 1333, 1729 },
+    { 1335, 1731 },
+    { 1336, 1734 },
+    { 1337, 1736 },
+    { 1338, 1739 },
+    { 1339, 1742 },
+    { 1341, 1744 },
+    { 1343, 1746 },
+    { 1345, 1748 },
+    { 1347, 1751 },
+    { 1348, 1753 },
+    { 1350, 1756 },
+    { 1353, 1758 },
+    { 1356, 1759 },
+    { 1357, 1762 },
+    { 1359, 1764 },
+    { 1362, 1766 },
+    { 1365, 1767 },
+    { 1368, 1769 },
+    { 1370, 1771 },
+    { 1374, 1773 },
+    { 1377, 1774 },
+    { 1380, 1776 },
+    { 1383, 1778 },
+    { 1387, 1779 },
+    { 1390, 1781 },
+    { 1394, 1781 },
+    { 1398, 1783 },
+    { 1402, 1784 },
+    { 1405, 1785 },
+    { 1409, 1787 },
+    { 1414, 1787 },
+    { 1418, 1788 },
+    { 1422, 1789 },
+    { 1427, 1789 },
+    { 1431, 1790 },
+    { 1436, 1790 },
+    { 1441, 1790 },
+    { 1445, 1791 },
+    { 1450, 1792 },
+    { 1455, 1792 },
+    { 1460, 1792 },
+    { 1465, 1792 },
+    { 1470, 1792 },
+    { 1475, 1791 },
+    { 1480, 1791 },
+    { 1485, 1791 },
+    { 1490, 1790 },
+    { 1495, 1789 },
+    { 1500, 1788 },
+    { 1505, 1788 },
+    { 1511, 1786 },
+    { 1516, 1785 },
+    { 1521, 1783 },
+    { 1526, 1782 },
+    { 1531, 1780 },
+    { 1535, 1778 },
+    { 1540, 1776 },
+    { 1545, 1774 },
+    { 1549, 1771 },
+    { 1553, 1769 },
+    { 1557, 1766 },
+    { 1560, 1763 },
+    { 1564, 1760 },
+    { 1568, 1757 },
+    { 1571, 1754 },
+    { 1574, 1751 },
+    { 1577, 1748 },
+    { 1580, 1745 },
+    { 1583, 1741 },
+    { 1585, 1738 },
+    { 1587, 1734 },
+    { 1589, 1731 },
+    { 1592, 1727 },
+    { 1593, 1724 },
+    { 1594, 1720 },
+    { 1596, 1717 },
+    { 1598, 1713 },
+    { 1600, 1710 },
+    { 1600, 1707 },
+    { 1602, 1703 },
+    { 1603, 1700 },
+    { 1604, 1696 },
+    { 1605, 1693 },
+    { 1604, 1690 },
+    { 1603, 1688 },
+    { 1599, 1687 },
+    { 1597, 1687 },
+    { 1593, 1687 },
+    { 1589, 1689 },
+    { 1585, 1690 },
+    { 1582, 1693 },
+    { 1579, 1696 },
+    { 1577, 1699 },
+    { 1576, 1703 },
+    { 1574, 1706 },
+    { 1571, 1710 },
+    { 1569, 1713 },
+    { 1567, 1717 },
+    { 1566, 1720 },
+    { 1563, 1724 },
+    { 1561, 1727 },
+    { 1558, 1730 },
+    { 1556, 1734 },
+    { 1553, 1737 },
+    { 1549, 1740 },
+    { 1546, 1743 },
+    { 1542, 1746 },
+    { 1538, 1749 },
+    { 1534, 1751 },
+    { 1529, 1753 },
+    { 1525, 1755 },
+    { 1520, 1756 },
+    { 1516, 1758 },
+    { 1511, 1759 },
+    { 1506, 1760 },
+    { 1502, 1761 },
+    { 1497, 1762 },
+    { 1493, 1762 },
+    { 1488, 1763 },
+    { 1484, 1763 },
+    { 1479, 1763 },
+    { 1475, 1763 },
+    { 1470, 1763 },
+    { 1466, 1763 },
+    { 1462, 1763 },
+    { 1458, 1763 },
+    { 1454, 1762 },
+    { 1450, 1762 },
+    { 1446, 1762 },
+    { 1442, 1760 },
+    { 1438, 1760 },
+    { 1434, 1759 },
+    { 1431, 1758 },
+    { 1427, 1758 },
+    { 1424, 1756 },
+    { 1420, 1756 },
+    { 1417, 1754 },
+    { 1413, 1753 },
+    { 1410, 1752 },
+    { 1408, 1750 },
+    { 1404, 1749 },
+    { 1401, 1748 },
+    { 1399, 1746 },
+    { 1396, 1744 },
+    { 1393, 1743 },
+    { 1391, 1741 },
+    { 1389, 1739 },
+    { 1386, 1738 },
+    { 1384, 1735 },
+    { 1382, 1733 },
+    { 1380, 1731 },
+    { 1378, 1729 },
+    { 1375, 1727 },
+    { 1373, 1725 },
+    { 1372, 1723 },
+    { 1371, 1720 },
+    { 1369, 1718 },
+    { 1368, 1715 },
+    { 1366, 1713 },
+    { 1365, 1711 },
+    { 1364, 1708 },
+    { 1362, 1706 },
+    { 1361, 1704 },
+    { 1360, 1701 },
+    { 1359, 1698 },
+    { 1358, 1695 },
+    { 1357, 1693 },
+    { 1357, 1690 },
+    { 1355, 1688 },
+    { 1354, 1685 },
+    { 1354, 1682 },
+    { 1353, 1680 },
+    { 1353, 1677 },
+    { 1353, 1674 },
+    { 1352, 1671 },
+    { 1352, 1668 },
+    { 1352, 1665 },
+    { 1351, 1661 },
+    { 1351, 1658 },
+    { 1351, 1655 },
+    { 1351, 1652 },
+    { 1351, 1649 },
+    { 1351, 1646 },
+    { 1351, 1643 },
+    { 1351, 1640 },
+    { 1351, 1636 },
+    { 1351, 1633 },
+    { 1351, 1630 },
+    { 1351, 1627 },
+    { 1352, 1623 },
+};
+
+const int CLOVER_DUTY_POINTS = sizeof(clover_duty)/sizeof(clover_duty[0]);
+
+const unsigned short clover_elbow_flips[] = { 3223 };
@@ -0,0 +1,13 @@
+#ifndef CLOVER_DUTY_H
+#define CLOVER_DUTY_H
+
+// Pre-solved { shoulder, elbow } PWM duty pairs in microseconds
+extern const unsigned short clover_duty[][2];
+extern const int CLOVER_DUTY_POINTS;
+
+// Elbow branch (HALO_ELBOW_DOWN/UP) from pair 0, flipped at each index
+// in clover_elbow_flips; the list ends with CLOVER_DUTY_POINTS
+#define CLOVER_ELBOW_START 0
+extern const unsigned short clover_elbow_flips[];
+
+#endif // CLOVER_DUTY_H
@@ -0,0 +1,2455 @@
+#include "clover_lod.h"
+#include "clover_duty.h"
+
+// ----------------------------
+// Generated clover levels of detail (do not edit)
+// ----------------------------
+
+static const unsigned short clover_duty_lod1[][2] = {
+    { 1339, 1634 },
+    { 1339, 1639 },
+    { 1338, 1646 },
+    { 1338, 1652 },
+    { 1338, 1659 },
+    { 1337, 1665 },
+    { 1336, 1672 },
+    { 1337, 1678 },
+    { 1336, 1684 },
+    { 1337, 1690 },
+    { 1337, 1696 },
+    { 1338, 1702 },
+    { 1340, 1707 },
+    { 1342, 1713 },
+    { 1344, 1718 },
+    { 1346, 1723 },
+    { 1349, 1729 },
+    { 1351, 1734 },
+    { 1354, 1739 },
+    { 1359, 1743 },
+    { 1362, 1748 },
+    { 1367, 1751 },
+    { 1371, 1756 },
+    { 1377, 1759 },
+    { 1382, 1763 },
+    { 1389, 1766 },
+    { 1395, 1769 },
+    { 1401, 1772 },
+    { 1409, 1774 },
+    { 1416, 1776 },
+    { 1425, 1777 },
+    { 1432, 1779 },
+    { 1441, 1780 },
+    { 1451, 1780 },
+    { 1459, 1781 },
+    { 1469, 1781 },
+    { 1478, 1781 },
+    { 1488, 1780 },
+    { 1498, 1779 },
+    { 1508, 1777 },
+    { 1517, 1774 },
+    { 1527, 1771 },
+    { 1536, 1767 },
+    { 1545, 1763 },
+    { 1553, 1757 },
+    { 1560, 1751 },
+    { 1566, 1745 },
+    { 1572, 1738 },
+    { 1578, 1732 },
+    { 1581, 1725 },
+    { 1584, 1718 },
+    { 1588, 1711 },
+    { 1590, 1705 },
+    { 1592, 1698 },
+    { 1586, 1702 },
+    { 1582, 1709 },
+    { 1579, 1716 },
+    { 1575, 1723 },
+    { 1570, 1730 },
+    { 1565, 1737 },
+    { 1559, 1744 },
+    { 1552, 1750 },
+    { 1545, 1755 },
+    { 1536, 1760 },
+    { 1527, 1764 },
+    { 1518, 1767 },
+    { 1508, 1770 },
+    { 1498, 1772 },
+    { 1489, 1773 },
+    { 1479, 1773 },
+    { 1470, 1774 },
+    { 1462, 1773 },
+    { 1453, 1773 },
+    { 1444, 1772 },
+    { 1436, 1771 },
+    { 1428, 1769 },
+    { 1420, 1768 },
+    { 1412, 1766 },
+    { 1406, 1763 },
+    { 1399, 1761 },
+    { 1393, 1758 },
+    { 1388, 1754 },
+    { 1382, 1751 },
+    { 1377, 1747 },
+    { 1372, 1744 },
+    { 1369, 1739 },
+    { 1364, 1735 },
+    { 1361, 1730 },
+    { 1358, 1726 },
+    { 1355, 1721 },
+    { 1352, 1716 },
+    { 1350, 1711 },
+    { 1348, 1705 },
+    { 1346, 1700 },
+    { 1344, 1695 },
+    { 1343, 1689 },
+    { 1342, 1684 },
+    { 1341, 1678 },
+    { 1341, 1671 },
+    { 1340, 1665 },
+    { 1340, 1659 },
+    { 1340, 1653 },
+    { 1341, 1646 },
+    { 1341, 1639 },
+    { 1341, 1633 },
+    { 1341, 1638 },
+    { 1341, 1645 },
+    { 1340, 1651 },
+    { 1340, 1658 },
+    { 1340, 1664 },
+    { 1341, 1670 },
+    { 1341, 1677 },
+    { 1341, 1683 },
+    { 1343, 1688 },
+    { 1344, 1694 },
+    { 1346, 1699 },
+    { 1348, 1704 },
+    { 1349, 1710 },
+    { 1351, 1715 },
+    { 1354, 1720 },
+    { 1358, 1725 },
+    { 1360, 1730 },
+    { 1363, 1734 },
+    { 1368, 1738 },
+    { 1371, 1743 },
+    { 1377, 1746 },
+    { 1381, 1751 },
+    { 1387, 1754 },
+    { 1392, 1758 },
+    { 1398, 1760 },
+    { 1405, 1763 },
+    { 1411, 1766 },
+    { 1419, 1767 },
+    { 1426, 1769 },
+    { 1435, 1770 },
+    { 1443, 1772 },
+    { 1451, 1773 },
+    { 1460, 1773 },
+    { 1469, 1773 },
+    { 1478, 1773 },
+    { 1488, 1772 },
+    { 1497, 1771 },
+    { 1507, 1770 },
+    { 1516, 1767 },
+    { 1526, 1764 },
+    { 1535, 1760 },
+    { 1543, 1756 },
+    { 1551, 1750 },
+    { 1558, 1744 },
+    { 1564, 1738 },
+    { 1569, 1731 },
+    { 1574, 1724 },
+    { 1579, 1717 },
+    { 1582, 1710 },
+    { 1586, 1703 },
+    { 1591, 1697 },
+    { 1591, 1703 },
+    { 1588, 1710 },
+    { 1585, 1717 },
+    { 1582, 1724 },
+    { 1577, 1730 },
+    { 1573, 1737 },
+    { 1568, 1744 },
+    { 1562, 1750 },
+    { 1555, 1756 },
+    { 1547, 1762 },
+    { 1538, 1767 },
+    { 1529, 1771 },
+    { 1520, 1774 },
+    { 1510, 1777 },
+    { 1500, 1779 },
+    { 1490, 1780 },
+    { 1480, 1781 },
+    { 1471, 1781 },
+    { 1461, 1782 },
+    { 1452, 1781 },
+    { 1443, 1781 },
+    { 1435, 1779 },
+    { 1426, 1778 },
+    { 1419, 1776 },
+    { 1411, 1774 },
+    { 1403, 1772 },
+    { 1396, 1770 },
+    { 1390, 1766 },
+    { 1383, 1764 },
+    { 1378, 1760 },
+    { 1372, 1757 },
+    { 1368, 1752 },
+    { 1363, 1748 },
+    { 1359, 1744 },
+    { 1355, 1739 },
+    { 1352, 1735 },
+    { 1349, 1730 },
+    { 1347, 1724 },
+    { 1345, 1719 },
+    { 1342, 1714 },
+    { 1341, 1709 },
+    { 1338, 1704 },
+    { 1337, 1698 },
+    { 1337, 1692 },
+    { 1336, 1686 },
+    { 1337, 1679 },
+    { 1336, 1673 },
+    { 1337, 1667 },
+    { 1338, 1660 },
+    { 1338, 1654 },
+    { 1338, 1647 },
+    { 1339, 1640 },
+    { 1339, 1635 },
+    { 1332, 1641 },
+    { 1327, 1647 },
+    { 1325, 1654 },
+    { 1321, 1662 },
+    { 1318, 1669 },
+    { 1315, 1676 },
+    { 1311, 1684 },
+    { 1308, 1691 },
+    { 1305, 1698 },
+    { 1302, 1704 },
+    { 1299, 1711 },
+    { 1296, 1718 },
+    { 1292, 1725 },
+    { 1289, 1732 },
+    { 1285, 1739 },
+    { 1282, 1746 },
+    { 1278, 1753 },
+    { 1274, 1760 },
+    { 1270, 1767 },
+    { 1266, 1774 },
+    { 1262, 1780 },
+    { 1257, 1787 },
+    { 1251, 1793 },
+    { 1246, 1800 },
+    { 1240, 1806 },
+    { 1232, 1812 },
+    { 1223, 1818 },
+    { 1214, 1823 },
+    { 1203, 1827 },
+    { 1191, 1831 },
+    { 1179, 1834 },
+    { 1166, 1836 },
+    { 1153, 1838 },
+    { 1140, 1839 },
+    { 1128, 1838 },
+    { 1116, 1838 },
+    { 1104, 1837 },
+    { 1093, 1835 },
+    { 1082, 1833 },
+    { 1074, 1830 },
+    { 1066, 1826 },
+    { 1058, 1822 },
+    { 1053, 1817 },
+    { 1048, 1812 },
+    { 1046, 1806 },
+    { 1044, 1800 },
+    { 1043, 1794 },
+    { 1045, 1788 },
+    { 1048, 1781 },
+    { 1052, 1775 },
+    { 1055, 1768 },
+    { 1060, 1761 },
+    { 1066, 1755 },
+    { 1072, 1749 },
+    { 1077, 1742 },
+    { 1083, 1736 },
+    { 1090, 1730 },
+    { 1096, 1724 },
+    { 1103, 1718 },
+    { 1106, 1715 },
+    { 1103, 1711 },
+    { 1099, 1707 },
+    { 1096, 1702 },
+    { 1093, 1697 },
+    { 1091, 1692 },
+    { 1090, 1686 },
+    { 1090, 1679 },
+    { 1091, 1673 },
+    { 1093, 1666 },
+    { 1095, 1659 },
+    { 1098, 1651 },
+    { 1101, 1644 },
+    { 1106, 1636 },
+    { 1111, 1629 },
+    { 1116, 1622 },
+    { 1121, 1614 },
+    { 1126, 1607 },
+    { 1132, 1600 },
+    { 1138, 1593 },
+    { 1144, 1586 },
+    { 1151, 1580 },
+    { 1157, 1574 },
+    { 1163, 1568 },
+    { 1170, 1563 },
+    { 1176, 1558 },
+    { 1183, 1554 },
+    { 1189, 1550 },
+    { 1195, 1547 },
+    { 1201, 1545 },
+    { 1206, 1543 },
+    { 1211, 1542 },
+    { 1217, 1541 },
+    { 1222, 1541 },
+    { 1226, 1542 },
+    { 1230, 1543 },
+    { 1234, 1543 },
+    { 1238, 1545 },
+    { 1243, 1546 },
+    { 1246, 1548 },
+    { 1250, 1549 },
+    { 1254, 1550 },
+    { 1258, 1552 },
+    { 1262, 1553 },
+    { 1266, 1556 },
+    { 1270, 1557 },
+    { 1274, 1558 },
+    { 1279, 1559 },
+    { 1282, 1561 },
+    { 1287, 1562 },
+    { 1291, 1565 },
+    { 1295, 1565 },
+    { 1299, 1567 },
+    { 1303, 1569 },
+    { 1305, 1567 },
+    { 1302, 1564 },
+    { 1299, 1561 },
+    { 1297, 1557 },
+    { 1295, 1552 },
+    { 1293, 1548 },
+    { 1291, 1543 },
+    { 1289, 1539 },
+    { 1288, 1534 },
+    { 1286, 1529 },
+    { 1285, 1523 },
+    { 1285, 1518 },
+    { 1284, 1512 },
+    { 1284, 1505 },
+    { 1285, 1499 },
+    { 1285, 1492 },
+    { 1285, 1485 },
+    { 1286, 1478 },
+    { 1288, 1470 },
+    { 1290, 1462 },
+    { 1292, 1453 },
+    { 1296, 1444 },
+    { 1300, 1434 },
+    { 1304, 1424 },
+    { 1309, 1414 },
+    { 1315, 1403 },
+    { 1320, 1393 },
+    { 1327, 1382 },
+    { 1333, 1371 },
+    { 1340, 1360 },
+    { 1347, 1349 },
+    { 1354, 1338 },
+    { 1361, 1328 },
+    { 1368, 1318 },
+    { 1376, 1309 },
+    { 1383, 1300 },
+    { 1390, 1291 },
+    { 1397, 1283 },
+    { 1404, 1275 },
+    { 1410, 1268 },
+    { 1417, 1260 },
+    { 1423, 1256 },
+    { 1429, 1250 },
+    { 1435, 1245 },
+    { 1440, 1241 },
+    { 1445, 1238 },
+    { 1448, 1237 },
+    { 1452, 1237 },
+    { 1455, 1237 },
+    { 1457, 1240 },
+    { 1459, 1244 },
+    { 1459, 1249 },
+    { 1460, 1254 },
+    { 1459, 1261 },
+    { 1458, 1269 },
+    { 1464, 1261 },
+    { 1473, 1247 },
+    { 1482, 1233 },
+    { 1491, 1218 },
+    { 1501, 1203 },
+    { 1510, 1190 },
+    { 1520, 1176 },
+    { 1530, 1161 },
+    { 1540, 1147 },
+    { 1550, 1131 },
+    { 1560, 1117 },
+    { 1570, 1104 },
+    { 1581, 1088 },
+    { 1587, 1083 },
+    { 1599, 1064 },
+    { 1606, 1056 },
+    { 1614, 1046 },
+    { 1618, 1045 },
+    { 1620, 1047 },
+    { 1618, 1058 },
+    { 1613, 1073 },
+    { 1609, 1088 },
+    { 1605, 1101 },
+    { 1599, 1120 },
+    { 1594, 1135 },
+    { 1588, 1152 },
+    { 1582, 1168 },
+    { 1576, 1185 },
+    { 1570, 1201 },
+    { 1565, 1215 },
+    { 1559, 1231 },
+    { 1553, 1246 },
+    { 1548, 1260 },
+    { 1541, 1275 },
+    { 1536, 1288 },
+    { 1529, 1302 },
+    { 1524, 1315 },
+    { 1518, 1328 },
+    { 1512, 1340 },
+    { 1506, 1353 },
+    { 1500, 1365 },
+    { 1494, 1376 },
+    { 1488, 1387 },
+    { 1482, 1398 },
+    { 1477, 1409 },
+    { 1471, 1419 },
+    { 1465, 1429 },
+    { 1459, 1439 },
+    { 1453, 1449 },
+    { 1447, 1458 },
+    { 1442, 1467 },
+    { 1436, 1477 },
+    { 1430, 1486 },
+    { 1425, 1494 },
+    { 1419, 1503 },
+    { 1413, 1511 },
+    { 1407, 1519 },
+    { 1401, 1527 },
+    { 1395, 1534 },
+    { 1397, 1534 },
+    { 1394, 1536 },
+    { 1399, 1529 },
+    { 1405, 1521 },
+    { 1411, 1513 },
+    { 1417, 1505 },
+    { 1422, 1496 },
+    { 1428, 1488 },
+    { 1434, 1479 },
+    { 1440, 1470 },
+    { 1445, 1461 },
+    { 1451, 1451 },
+    { 1457, 1442 },
+    { 1462, 1432 },
+    { 1468, 1422 },
+    { 1474, 1412 },
+    { 1480, 1401 },
+    { 1486, 1390 },
+    { 1492, 1379 },
+    { 1498, 1368 },
+    { 1504, 1356 },
+    { 1510, 1344 },
+    { 1516, 1331 },
+    { 1522, 1319 },
+    { 1528, 1306 },
+    { 1534, 1292 },
+    { 1540, 1278 },
+    { 1546, 1263 },
+    { 1552, 1249 },
+    { 1558, 1235 },
+    { 1564, 1219 },
+    { 1569, 1205 },
+    { 1575, 1188 },
+    { 1580, 1173 },
+    { 1586, 1156 },
+    { 1592, 1140 },
+    { 1597, 1124 },
+    { 1603, 1106 },
+    { 1606, 1094 },
+    { 1610, 1080 },
+    { 1615, 1064 },
+    { 1617, 1053 },
+    { 1615, 1051 },
+    { 1613, 1049 },
+    { 1607, 1055 },
+    { 1600, 1063 },
+    { 1587, 1081 },
+    { 1582, 1086 },
+    { 1571, 1103 },
+    { 1561, 1116 },
+    { 1551, 1131 },
+    { 1541, 1145 },
+    { 1531, 1160 },
+    { 1521, 1175 },
+    { 1511, 1189 },
+    { 1501, 1204 },
+    { 1492, 1218 },
+    { 1483, 1232 },
+    { 1474, 1246 },
+    { 1465, 1261 },
+    { 1457, 1272 },
+    { 1458, 1264 },
+    { 1458, 1257 },
+    { 1459, 1251 },
+    { 1457, 1246 },
+    { 1456, 1242 },
+    { 1455, 1238 },
+    { 1453, 1236 },
+    { 1449, 1237 },
+    { 1445, 1238 },
+    { 1440, 1241 },
+    { 1435, 1244 },
+    { 1429, 1250 },
+    { 1424, 1255 },
+    { 1418, 1260 },
+    { 1411, 1268 },
+    { 1405, 1274 },
+    { 1397, 1283 },
+    { 1390, 1291 },
+    { 1383, 1300 },
+    { 1376, 1309 },
+    { 1369, 1319 },
+    { 1361, 1329 },
+    { 1354, 1339 },
+    { 1347, 1350 },
+    { 1340, 1360 },
+    { 1333, 1371 },
+    { 1327, 1381 },
+    { 1321, 1392 },
+    { 1315, 1403 },
+    { 1310, 1413 },
+    { 1305, 1424 },
+    { 1300, 1434 },
+    { 1296, 1443 },
+    { 1293, 1453 },
+    { 1290, 1461 },
+    { 1288, 1470 },
+    { 1287, 1477 },
+    { 1286, 1485 },
+    { 1285, 1492 },
+    { 1285, 1498 },
+    { 1285, 1505 },
+    { 1285, 1511 },
+    { 1286, 1517 },
+    { 1286, 1523 },
+    { 1287, 1528 },
+    { 1288, 1533 },
+    { 1290, 1538 },
+    { 1292, 1543 },
+    { 1293, 1547 },
+    { 1295, 1552 },
+    { 1297, 1556 },
+    { 1299, 1560 },
+    { 1302, 1564 },
+    { 1306, 1566 },
+    { 1304, 1569 },
+    { 1300, 1567 },
+    { 1296, 1566 },
+    { 1291, 1565 },
+    { 1287, 1563 },
+    { 1283, 1562 },
+    { 1279, 1560 },
+    { 1275, 1558 },
+    { 1271, 1557 },
+    { 1267, 1555 },
+    { 1263, 1554 },
+    { 1259, 1552 },
+    { 1255, 1550 },
+    { 1251, 1549 },
+    { 1246, 1548 },
+    { 1243, 1546 },
+    { 1238, 1545 },
+    { 1235, 1543 },
+    { 1230, 1543 },
+    { 1226, 1542 },
+    { 1222, 1541 },
+    { 1217, 1541 },
+    { 1212, 1542 },
+    { 1207, 1543 },
+    { 1201, 1545 },
+    { 1195, 1547 },
+    { 1189, 1550 },
+    { 1183, 1554 },
+    { 1176, 1559 },
+    { 1170, 1564 },
+    { 1163, 1569 },
+    { 1157, 1574 },
+    { 1150, 1580 },
+    { 1144, 1587 },
+    { 1138, 1593 },
+    { 1132, 1600 },
+    { 1126, 1607 },
+    { 1121, 1614 },
+    { 1116, 1622 },
+    { 1111, 1629 },
+    { 1106, 1637 },
+    { 1101, 1644 },
+    { 1098, 1652 },
+    { 1095, 1659 },
+    { 1093, 1666 },
+    { 1092, 1673 },
+    { 1091, 1680 },
+    { 1091, 1686 },
+    { 1092, 1692 },
+    { 1094, 1697 },
+    { 1096, 1702 },
+    { 1099, 1707 },
+    { 1103, 1711 },
+    { 1106, 1715 },
+    { 1100, 1721 },
+    { 1093, 1727 },
+    { 1086, 1733 },
+    { 1080, 1739 },
+    { 1074, 1746 },
+    { 1069, 1752 },
+    { 1063, 1758 },
+    { 1058, 1765 },
+    { 1054, 1771 },
+    { 1050, 1778 },
+    { 1046, 1785 },
+    { 1044, 1791 },
+    { 1045, 1797 },
+    { 1045, 1804 },
+    { 1048, 1809 },
+    { 1052, 1815 },
+    { 1057, 1820 },
+    { 1064, 1824 },
+    { 1071, 1828 },
+    { 1080, 1831 },
+    { 1090, 1834 },
+    { 1100, 1837 },
+    { 1112, 1837 },
+    { 1123, 1839 },
+    { 1136, 1839 },
+    { 1148, 1838 },
+    { 1161, 1837 },
+    { 1174, 1835 },
+    { 1186, 1832 },
+    { 1199, 1829 },
+    { 1210, 1824 },
+    { 1220, 1820 },
+    { 1229, 1814 },
+    { 1237, 1808 },
+    { 1243, 1802 },
+    { 1249, 1795 },
+    { 1254, 1789 },
+    { 1260, 1782 },
+    { 1264, 1775 },
+    { 1268, 1769 },
+    { 1272, 1762 },
+    { 1276, 1755 },
+    { 1280, 1748 },
+    { 1284, 1741 },
+    { 1287, 1734 },
+    { 1290, 1727 },
+    { 1294, 1720 },
+    { 1297, 1713 },
+    { 1301, 1706 },
+    { 1304, 1699 },
+    { 1307, 1692 },
+    { 1310, 1685 },
+    { 1313, 1678 },
+    { 1317, 1671 },
+    { 1320, 1664 },
+    { 1323, 1657 },
+    { 1326, 1650 },
+    { 1328, 1643 },
+    { 1329, 1636 },
+    { 1331, 1629 },
+    { 1332, 1622 },
+    { 1333, 1614 },
+    { 1333, 1612 },
+    { 1331, 1615 },
+    { 1333, 1614 },
+    { 1329, 1622 },
+    { 1325, 1630 },
+    { 1322, 1637 },
+    { 1319, 1645 },
+    { 1315, 1652 },
+    { 1311, 1659 },
+    { 1308, 1667 },
+    { 1305, 1674 },
+    { 1301, 1681 },
+    { 1298, 1688 },
+    { 1294, 1695 },
+    { 1291, 1702 },
+    { 1288, 1709 },
+    { 1284, 1716 },
+    { 1280, 1723 },
+    { 1276, 1730 },
+    { 1273, 1737 },
+    { 1269, 1744 },
+    { 1265, 1751 },
+    { 1260, 1758 },
+    { 1256, 1765 },
+    { 1251, 1771 },
+    { 1247, 1778 },
+    { 1242, 1785 },
+    { 1236, 1791 },
+    { 1229, 1797 },
+    { 1222, 1804 },
+    { 1215, 1810 },
+    { 1204, 1814 },
+    { 1194, 1818 },
+    { 1183, 1822 },
+    { 1171, 1824 },
+    { 1159, 1826 },
+    { 1147, 1827 },
+    { 1135, 1828 },
+    { 1124, 1827 },
+    { 1113, 1826 },
+    { 1103, 1824 },
+    { 1093, 1821 },
+    { 1084, 1818 },
+    { 1077, 1814 },
+    { 1072, 1810 },
+    { 1068, 1805 },
+    { 1064, 1799 },
+    { 1062, 1794 },
+    { 1062, 1787 },
+    { 1065, 1781 },
+    { 1068, 1774 },
+    { 1072, 1767 },
+    { 1077, 1761 },
+    { 1081, 1754 },
+    { 1087, 1748 },
+    { 1094, 1741 },
+    { 1100, 1735 },
+    { 1106, 1728 },
+    { 1113, 1722 },
+    { 1120, 1717 },
+    { 1125, 1710 },
+    { 1123, 1706 },
+    { 1118, 1703 },
+    { 1113, 1699 },
+    { 1109, 1695 },
+    { 1107, 1691 },
+    { 1104, 1686 },
+    { 1103, 1680 },
+    { 1103, 1674 },
+    { 1104, 1667 },
+    { 1106, 1660 },
+    { 1108, 1653 },
+    { 1111, 1645 },
+    { 1115, 1638 },
+    { 1119, 1630 },
+    { 1124, 1623 },
+    { 1130, 1616 },
+    { 1135, 1608 },
+    { 1141, 1602 },
+    { 1147, 1595 },
+    { 1153, 1589 },
+    { 1159, 1583 },
+    { 1166, 1577 },
+    { 1172, 1572 },
+    { 1179, 1567 },
+    { 1185, 1563 },
+    { 1192, 1560 },
+    { 1197, 1558 },
+    { 1203, 1557 },
+    { 1208, 1556 },
+    { 1213, 1556 },
+    { 1218, 1556 },
+    { 1223, 1556 },
+    { 1227, 1558 },
+    { 1231, 1559 },
+    { 1235, 1561 },
+    { 1239, 1562 },
+    { 1243, 1563 },
+    { 1247, 1566 },
+    { 1251, 1567 },
+    { 1255, 1568 },
+    { 1259, 1571 },
+    { 1263, 1572 },
+    { 1268, 1573 },
+    { 1273, 1574 },
+    { 1276, 1576 },
+    { 1281, 1577 },
+    { 1285, 1579 },
+    { 1290, 1580 },
+    { 1294, 1581 },
+    { 1299, 1583 },
+    { 1303, 1584 },
+    { 1308, 1585 },
+    { 1312, 1587 },
+    { 1317, 1588 },
+    { 1321, 1589 },
+    { 1326, 1591 },
+    { 1330, 1592 },
+    { 1334, 1594 },
+    { 1335, 1599 },
+    { 1328, 1605 },
+    { 1322, 1611 },
+    { 1316, 1616 },
+    { 1309, 1622 },
+    { 1303, 1627 },
+    { 1296, 1633 },
+    { 1289, 1638 },
+    { 1282, 1643 },
+    { 1275, 1648 },
+    { 1268, 1652 },
+    { 1261, 1657 },
+    { 1254, 1661 },
+    { 1246, 1665 },
+    { 1239, 1668 },
+    { 1232, 1672 },
+    { 1225, 1675 },
+    { 1217, 1678 },
+    { 1210, 1681 },
+    { 1203, 1684 },
+    { 1200, 1691 },
+    { 1205, 1693 },
+    { 1213, 1691 },
+    { 1220, 1687 },
+    { 1228, 1685 },
+    { 1235, 1682 },
+    { 1243, 1677 },
+    { 1250, 1674 },
+    { 1257, 1670 },
+    { 1264, 1665 },
+    { 1271, 1661 },
+    { 1279, 1656 },
+    { 1286, 1651 },
+    { 1293, 1646 },
+    { 1299, 1641 },
+    { 1306, 1636 },
+    { 1313, 1630 },
+    { 1319, 1624 },
+    { 1326, 1618 },
+    { 1332, 1613 },
+    { 1337, 1606 },
+    { 1342, 1598 },
+    { 1347, 1590 },
+    { 1351, 1582 },
+    { 1356, 1574 },
+    { 1361, 1566 },
+    { 1367, 1559 },
+    { 1373, 1552 },
+    { 1379, 1544 },
+    { 1385, 1537 },
+    { 1391, 1529 },
+    { 1397, 1521 },
+    { 1403, 1513 },
+    { 1409, 1505 },
+    { 1414, 1497 },
+    { 1420, 1488 },
+    { 1426, 1479 },
+    { 1432, 1471 },
+    { 1438, 1462 },
+    { 1444, 1452 },
+    { 1449, 1443 },
+    { 1455, 1433 },
+    { 1461, 1423 },
+    { 1467, 1413 },
+    { 1473, 1403 },
+    { 1479, 1392 },
+    { 1485, 1381 },
+    { 1491, 1369 },
+    { 1497, 1358 },
+    { 1503, 1345 },
+    { 1509, 1333 },
+    { 1515, 1320 },
+    { 1521, 1307 },
+    { 1527, 1294 },
+    { 1533, 1279 },
+    { 1539, 1266 },
+    { 1544, 1252 },
+    { 1549, 1237 },
+    { 1555, 1222 },
+    { 1561, 1207 },
+    { 1565, 1193 },
+    { 1570, 1179 },
+    { 1574, 1166 },
+    { 1577, 1153 },
+    { 1579, 1144 },
+    { 1580, 1135 },
+    { 1579, 1131 },
+    { 1577, 1128 },
+    { 1574, 1127 },
+    { 1569, 1131 },
+    { 1564, 1135 },
+    { 1557, 1142 },
+    { 1549, 1153 },
+    { 1543, 1160 },
+    { 1534, 1170 },
+    { 1527, 1180 },
+    { 1518, 1193 },
+    { 1509, 1205 },
+    { 1500, 1218 },
+    { 1491, 1231 },
+    { 1482, 1244 },
+    { 1473, 1258 },
+    { 1465, 1271 },
+    { 1456, 1285 },
+    { 1448, 1299 },
+    { 1442, 1305 },
+    { 1443, 1297 },
+    { 1444, 1290 },
+    { 1445, 1283 },
+    { 1445, 1276 },
+    { 1443, 1272 },
+    { 1442, 1267 },
+    { 1440, 1266 },
+    { 1436, 1265 },
+    { 1432, 1267 },
+    { 1428, 1269 },
+    { 1423, 1272 },
+    { 1418, 1276 },
+    { 1412, 1281 },
+    { 1405, 1288 },
+    { 1399, 1294 },
+    { 1392, 1301 },
+    { 1385, 1309 },
+    { 1379, 1317 },
+    { 1371, 1326 },
+    { 1364, 1335 },
+    { 1357, 1345 },
+    { 1350, 1355 },
+    { 1343, 1366 },
+    { 1336, 1377 },
+    { 1330, 1388 },
+    { 1324, 1398 },
+    { 1319, 1409 },
+    { 1314, 1420 },
+    { 1310, 1429 },
+    { 1305, 1439 },
+    { 1303, 1448 },
+    { 1299, 1457 },
+    { 1298, 1465 },
+    { 1296, 1473 },
+    { 1296, 1480 },
+    { 1296, 1486 },
+    { 1295, 1493 },
+    { 1296, 1499 },
+    { 1296, 1505 },
+    { 1296, 1511 },
+    { 1298, 1516 },
+    { 1299, 1521 },
+    { 1300, 1526 },
+    { 1302, 1531 },
+    { 1303, 1535 },
+    { 1305, 1540 },
+    { 1307, 1544 },
+    { 1309, 1549 },
+    { 1312, 1552 },
+    { 1315, 1556 },
+    { 1317, 1559 },
+    { 1320, 1562 },
+    { 1324, 1565 },
+    { 1327, 1568 },
+    { 1331, 1570 },
+    { 1335, 1572 },
+    { 1339, 1574 },
+    { 1343, 1576 },
+    { 1346, 1575 },
+    { 1348, 1568 },
+    { 1349, 1560 },
+    { 1351, 1553 },
+    { 1353, 1545 },
+    { 1355, 1537 },
+    { 1357, 1529 },
+    { 1359, 1521 },
+    { 1361, 1513 },
+    { 1363, 1506 },
+    { 1366, 1497 },
+    { 1368, 1489 },
+    { 1371, 1480 },
+    { 1374, 1471 },
+    { 1378, 1462 },
+    { 1381, 1453 },
+    { 1384, 1444 },
+    { 1388, 1434 },
+    { 1391, 1424 },
+    { 1396, 1414 },
+    { 1402, 1404 },
+    { 1406, 1401 },
+    { 1405, 1408 },
+    { 1402, 1418 },
+    { 1398, 1428 },
+    { 1394, 1437 },
+    { 1391, 1446 },
+    { 1387, 1456 },
+    { 1384, 1465 },
+    { 1382, 1473 },
+    { 1379, 1482 },
+    { 1376, 1491 },
+    { 1374, 1499 },
+    { 1371, 1507 },
+    { 1369, 1515 },
+    { 1367, 1523 },
+    { 1365, 1531 },
+    { 1363, 1539 },
+    { 1362, 1546 },
+    { 1360, 1554 },
+    { 1359, 1561 },
+    { 1358, 1568 },
+    { 1359, 1572 },
+    { 1359, 1578 },
+    { 1360, 1585 },
+    { 1364, 1586 },
+    { 1369, 1585 },
+    { 1375, 1584 },
+    { 1381, 1583 },
+    { 1386, 1582 },
+    { 1392, 1581 },
+    { 1398, 1580 },
+    { 1404, 1578 },
+    { 1410, 1576 },
+    { 1416, 1574 },
+    { 1422, 1572 },
+    { 1428, 1568 },
+    { 1434, 1566 },
+    { 1440, 1563 },
+    { 1446, 1560 },
+    { 1453, 1556 },
+    { 1459, 1553 },
+    { 1464, 1550 },
+    { 1471, 1545 },
+    { 1476, 1544 },
+    { 1475, 1551 },
+    { 1470, 1557 },
+    { 1463, 1562 },
+    { 1457, 1566 },
+    { 1451, 1568 },
+    { 1445, 1572 },
+    { 1439, 1575 },
+    { 1433, 1578 },
+    { 1427, 1581 },
+    { 1420, 1583 },
+    { 1414, 1586 },
+    { 1408, 1588 },
+    { 1402, 1590 },
+    { 1396, 1592 },
+    { 1390, 1594 },
+    { 1384, 1595 },
+    { 1378, 1596 },
+    { 1372, 1598 },
+    { 1367, 1598 },
+    { 1362, 1598 },
+    { 1359, 1600 },
+    { 1360, 1604 },
+    { 1362, 1609 },
+    { 1364, 1613 },
+    { 1367, 1617 },
+    { 1370, 1621 },
+    { 1372, 1625 },
+    { 1376, 1629 },
+    { 1379, 1632 },
+    { 1381, 1636 },
+    { 1385, 1640 },
+    { 1389, 1643 },
+    { 1392, 1646 },
+    { 1395, 1650 },
+    { 1400, 1653 },
+    { 1404, 1656 },
+    { 1408, 1659 },
+    { 1412, 1661 },
+    { 1416, 1665 },
+    { 1421, 1667 },
+    { 1426, 1669 },
+    { 1432, 1670 },
+    { 1438, 1671 },
+    { 1444, 1671 },
+    { 1451, 1671 },
+    { 1458, 1670 },
+    { 1465, 1669 },
+    { 1472, 1667 },
+    { 1479, 1664 },
+    { 1486, 1661 },
+    { 1493, 1657 },
+    { 1501, 1653 },
+    { 1508, 1648 },
+    { 1514, 1642 },
+    { 1521, 1637 },
+    { 1527, 1630 },
+    { 1533, 1624 },
+    { 1538, 1617 },
+    { 1543, 1609 },
+    { 1547, 1601 },
+    { 1551, 1593 },
+    { 1554, 1586 },
+    { 1557, 1578 },
+    { 1559, 1570 },
+    { 1561, 1562 },
+    { 1563, 1555 },
+    { 1564, 1548 },
+    { 1564, 1541 },
+    { 1564, 1535 },
+    { 1563, 1530 },
+    { 1561, 1525 },
+    { 1560, 1521 },
+    { 1558, 1517 },
+    { 1555, 1514 },
+    { 1552, 1511 },
+    { 1549, 1509 },
+    { 1545, 1507 },
+    { 1541, 1507 },
+    { 1537, 1506 },
+    { 1534, 1503 },
+    { 1538, 1495 },
+    { 1543, 1487 },
+    { 1549, 1478 },
+    { 1555, 1469 },
+    { 1561, 1460 },
+    { 1566, 1450 },
+    { 1571, 1441 },
+    { 1577, 1430 },
+    { 1581, 1420 },
+    { 1585, 1410 },
+    { 1589, 1400 },
+    { 1592, 1391 },
+    { 1595, 1382 },
+    { 1596, 1373 },
+    { 1598, 1365 },
+    { 1599, 1357 },
+    { 1599, 1352 },
+    { 1600, 1344 },
+    { 1599, 1339 },
+    { 1598, 1334 },
+    { 1596, 1330 },
+    { 1594, 1327 },
+    { 1591, 1327 },
+    { 1587, 1327 },
+    { 1583, 1328 },
+    { 1579, 1330 },
+    { 1573, 1333 },
+    { 1568, 1337 },
+    { 1562, 1341 },
+    { 1556, 1347 },
+    { 1550, 1354 },
+    { 1544, 1360 },
+    { 1537, 1367 },
+    { 1530, 1375 },
+    { 1524, 1382 },
+    { 1518, 1390 },
+    { 1511, 1398 },
+    { 1504, 1407 },
+    { 1498, 1416 },
+    { 1491, 1424 },
+    { 1485, 1433 },
+    { 1479, 1442 },
+    { 1472, 1450 },
+    { 1466, 1458 },
+    { 1460, 1467 },
+    { 1454, 1475 },
+    { 1448, 1482 },
+    { 1442, 1490 },
+    { 1435, 1498 },
+    { 1429, 1506 },
+    { 1423, 1513 },
+    { 1417, 1520 },
+    { 1411, 1527 },
+    { 1405, 1535 },
+    { 1399, 1542 },
+    { 1393, 1549 },
+    { 1387, 1556 },
+    { 1381, 1562 },
+    { 1375, 1569 },
+    { 1369, 1575 },
+    { 1363, 1581 },
+    { 1359, 1587 },
+    { 1358, 1594 },
+    { 1357, 1601 },
+    { 1355, 1608 },
+    { 1354, 1615 },
+    { 1354, 1622 },
+    { 1356, 1627 },
+    { 1358, 1631 },
+    { 1361, 1635 },
+    { 1364, 1639 },
+    { 1366, 1643 },
+    { 1370, 1646 },
+    { 1373, 1650 },
+    { 1377, 1654 },
+    { 1381, 1657 },
+    { 1384, 1660 },
+    { 1388, 1663 },
+    { 1392, 1666 },
+    { 1396, 1670 },
+    { 1401, 1672 },
+    { 1405, 1676 },
+    { 1410, 1678 },
+    { 1415, 1680 },
+    { 1420, 1682 },
+    { 1426, 1683 },
+    { 1433, 1684 },
+    { 1439, 1684 },
+    { 1446, 1684 },
+    { 1453, 1683 },
+    { 1461, 1681 },
+    { 1468, 1679 },
+    { 1475, 1677 },
+    { 1483, 1674 },
+    { 1490, 1670 },
+    { 1497, 1666 },
+    { 1505, 1662 },
+    { 1511, 1656 },
+    { 1518, 1651 },
+    { 1524, 1645 },
+    { 1531, 1639 },
+    { 1537, 1632 },
+    { 1542, 1625 },
+    { 1547, 1618 },
+    { 1552, 1611 },
+    { 1556, 1603 },
+    { 1559, 1595 },
+    { 1563, 1587 },
+    { 1565, 1580 },
+    { 1568, 1572 },
+    { 1570, 1564 },
+    { 1572, 1556 },
+    { 1574, 1549 },
+    { 1574, 1542 },
+    { 1575, 1535 },
+    { 1575, 1529 },
+    { 1575, 1523 },
+    { 1574, 1518 },
+    { 1573, 1513 },
+    { 1571, 1508 },
+    { 1569, 1505 },
+    { 1567, 1501 },
+    { 1564, 1498 },
+    { 1561, 1495 },
+    { 1558, 1494 },
+    { 1554, 1492 },
+    { 1550, 1491 },
+    { 1553, 1485 },
+    { 1558, 1476 },
+    { 1564, 1467 },
+    { 1569, 1458 },
+    { 1574, 1449 },
+    { 1580, 1439 },
+    { 1585, 1429 },
+    { 1589, 1419 },
+    { 1593, 1408 },
+    { 1597, 1398 },
+    { 1600, 1389 },
+    { 1604, 1379 },
+    { 1606, 1369 },
+    { 1608, 1360 },
+    { 1609, 1353 },
+    { 1610, 1345 },
+    { 1611, 1337 },
+    { 1612, 1330 },
+    { 1611, 1324 },
+    { 1611, 1318 },
+    { 1610, 1313 },
+    { 1609, 1309 },
+    { 1607, 1306 },
+    { 1605, 1304 },
+    { 1601, 1304 },
+    { 1597, 1304 },
+    { 1593, 1305 },
+    { 1589, 1307 },
+    { 1584, 1310 },
+    { 1578, 1314 },
+    { 1572, 1319 },
+    { 1566, 1325 },
+    { 1560, 1331 },
+    { 1554, 1336 },
+    { 1547, 1344 },
+    { 1541, 1350 },
+    { 1535, 1359 },
+    { 1528, 1366 },
+    { 1521, 1375 },
+    { 1515, 1382 },
+    { 1508, 1391 },
+    { 1501, 1400 },
+    { 1495, 1408 },
+    { 1488, 1417 },
+    { 1482, 1426 },
+    { 1475, 1434 },
+    { 1469, 1443 },
+    { 1463, 1452 },
+    { 1457, 1459 },
+    { 1451, 1467 },
+    { 1445, 1475 },
+    { 1439, 1483 },
+    { 1432, 1490 },
+    { 1427, 1498 },
+    { 1421, 1505 },
+    { 1414, 1513 },
+    { 1408, 1520 },
+    { 1402, 1527 },
+    { 1400, 1530 },
+    { 1406, 1523 },
+    { 1412, 1515 },
+    { 1419, 1508 },
+    { 1425, 1500 },
+    { 1431, 1493 },
+    { 1437, 1485 },
+    { 1443, 1478 },
+    { 1449, 1469 },
+    { 1456, 1461 },
+    { 1462, 1453 },
+    { 1468, 1445 },
+    { 1474, 1437 },
+    { 1481, 1428 },
+    { 1487, 1419 },
+    { 1494, 1410 },
+    { 1500, 1401 },
+    { 1507, 1393 },
+    { 1513, 1384 },
+    { 1520, 1377 },
+    { 1527, 1367 },
+    { 1533, 1360 },
+    { 1540, 1352 },
+    { 1546, 1346 },
+    { 1553, 1338 },
+    { 1559, 1333 },
+    { 1565, 1326 },
+    { 1571, 1320 },
+    { 1576, 1317 },
+    { 1582, 1312 },
+    { 1587, 1310 },
+    { 1592, 1307 },
+    { 1596, 1305 },
+    { 1600, 1305 },
+    { 1603, 1305 },
+    { 1606, 1307 },
+    { 1609, 1309 },
+    { 1610, 1313 },
+    { 1611, 1317 },
+    { 1611, 1323 },
+    { 1612, 1329 },
+    { 1611, 1336 },
+    { 1610, 1344 },
+    { 1609, 1351 },
+    { 1609, 1359 },
+    { 1606, 1368 },
+    { 1604, 1377 },
+    { 1601, 1387 },
+    { 1597, 1397 },
+    { 1593, 1407 },
+    { 1589, 1418 },
+    { 1585, 1428 },
+    { 1580, 1438 },
+    { 1575, 1448 },
+    { 1569, 1458 },
+    { 1564, 1467 },
+    { 1559, 1476 },
+    { 1553, 1484 },
+    { 1550, 1492 },
+    { 1554, 1493 },
+    { 1558, 1493 },
+    { 1561, 1496 },
+    { 1564, 1498 },
+    { 1566, 1501 },
+    { 1569, 1505 },
+    { 1571, 1508 },
+    { 1573, 1512 },
+    { 1574, 1517 },
+    { 1574, 1523 },
+    { 1575, 1529 },
+    { 1575, 1535 },
+    { 1574, 1543 },
+    { 1573, 1550 },
+    { 1571, 1557 },
+    { 1569, 1565 },
+    { 1567, 1573 },
+    { 1565, 1580 },
+    { 1562, 1588 },
+    { 1559, 1596 },
+    { 1555, 1604 },
+    { 1551, 1611 },
+    { 1547, 1619 },
+    { 1541, 1626 },
+    { 1536, 1633 },
+    { 1530, 1640 },
+    { 1524, 1646 },
+    { 1517, 1652 },
+    { 1510, 1657 },
+    { 1504, 1662 },
+    { 1496, 1667 },
+    { 1489, 1671 },
+    { 1481, 1674 },
+    { 1474, 1677 },
+    { 1467, 1679 },
+    { 1459, 1681 },
+    { 1452, 1682 },
+    { 1445, 1683 },
+    { 1438, 1683 },
+    { 1432, 1683 },
+    { 1425, 1682 },
+    { 1420, 1681 },
+    { 1414, 1679 },
+    { 1409, 1677 },
+    { 1404, 1675 },
+    { 1400, 1672 },
+    { 1395, 1669 },
+    { 1392, 1666 },
+    { 1388, 1662 },
+    { 1383, 1659 },
+    { 1380, 1656 },
+    { 1376, 1652 },
+    { 1372, 1649 },
+    { 1370, 1645 },
+    { 1366, 1641 },
+    { 1363, 1638 },
+    { 1360, 1634 },
+    { 1357, 1630 },
+    { 1355, 1625 },
+    { 1352, 1623 },
+    { 1351, 1627 },
+    { 1351, 1634 },
+    { 1351, 1640 },
+    { 1351, 1647 },
+    { 1351, 1653 },
+    { 1351, 1659 },
+    { 1352, 1665 },
+    { 1352, 1671 },
+    { 1353, 1677 },
+    { 1354, 1683 },
+    { 1356, 1689 },
+    { 1357, 1694 },
+    { 1360, 1699 },
+    { 1361, 1704 },
+    { 1364, 1709 },
+    { 1367, 1713 },
+    { 1369, 1718 },
+    { 1372, 1723 },
+    { 1376, 1728 },
+    { 1380, 1731 },
+    { 1384, 1736 },
+    { 1390, 1739 },
+    { 1394, 1743 },
+    { 1399, 1746 },
+    { 1405, 1749 },
+    { 1411, 1753 },
+    { 1417, 1755 },
+    { 1424, 1757 },
+    { 1432, 1758 },
+    { 1439, 1760 },
+    { 1447, 1761 },
+    { 1455, 1763 },
+    { 1463, 1763 },
+    { 1472, 1763 },
+    { 1480, 1764 },
+    { 1489, 1763 },
+    { 1498, 1762 },
+    { 1507, 1761 },
+    { 1517, 1758 },
+    { 1526, 1754 },
+    { 1535, 1751 },
+    { 1543, 1746 },
+    { 1549, 1740 },
+    { 1556, 1734 },
+    { 1561, 1727 },
+    { 1566, 1720 },
+    { 1570, 1713 },
+    { 1573, 1707 },
+    { 1577, 1700 },
+    { 1582, 1693 },
+    { 1589, 1689 },
+    { 1597, 1687 },
+    { 1602, 1688 },
+    { 1604, 1694 },
+    { 1602, 1701 },
+    { 1600, 1708 },
+    { 1597, 1714 },
+    { 1594, 1721 },
+    { 1591, 1728 },
+    { 1587, 1735 },
+    { 1582, 1742 },
+    { 1576, 1748 },
+    { 1570, 1755 },
+    { 1563, 1761 },
+    { 1556, 1766 },
+    { 1548, 1771 },
+    { 1539, 1776 },
+    { 1529, 1780 },
+    { 1519, 1783 },
+    { 1509, 1786 },
+    { 1499, 1788 },
+    { 1489, 1790 },
+    { 1478, 1791 },
+    { 1468, 1791 },
+    { 1458, 1791 },
+    { 1449, 1791 },
+    { 1440, 1790 },
+    { 1430, 1790 },
+    { 1422, 1788 },
+    { 1413, 1787 },
+    { 1404, 1785 },
+    { 1397, 1782 },
+    { 1389, 1780 },
+    { 1383, 1777 },
+    { 1376, 1774 },
+    { 1370, 1771 },
+    { 1365, 1767 },
+    { 1359, 1764 },
+    { 1355, 1759 },
+    { 1350, 1755 },
+    { 1346, 1750 },
+    { 1343, 1745 },
+    { 1339, 1741 },
+    { 1336, 1736 },
+    { 1335, 1730 },
+    { 1332, 1725 },
+    { 1329, 1721 },
+    { 1328, 1715 },
+    { 1327, 1709 },
+    { 1326, 1703 },
+    { 1326, 1697 },
+    { 1325, 1691 },
+    { 1325, 1684 },
+    { 1325, 1678 },
+    { 1326, 1672 },
+    { 1327, 1665 },
+    { 1327, 1659 },
+    { 1327, 1652 },
+    { 1330, 1645 },
+    { 1329, 1649 },
+    { 1327, 1656 },
+    { 1327, 1662 },
+    { 1326, 1669 },
+    { 1326, 1675 },
+    { 1325, 1682 },
+    { 1325, 1688 },
+    { 1325, 1694 },
+    { 1326, 1700 },
+    { 1327, 1706 },
+    { 1328, 1712 },
+    { 1329, 1718 },
+    { 1331, 1723 },
+    { 1333, 1729 },
+    { 1336, 1734 },
+    { 1338, 1739 },
+    { 1341, 1744 },
+    { 1345, 1748 },
+    { 1348, 1753 },
+    { 1353, 1758 },
+    { 1357, 1762 },
+    { 1362, 1766 },
+    { 1368, 1769 },
+    { 1374, 1773 },
+    { 1380, 1776 },
+    { 1387, 1779 },
+    { 1394, 1781 },
+    { 1402, 1784 },
+    { 1409, 1787 },
+    { 1418, 1788 },
+    { 1427, 1789 },
+    { 1436, 1790 },
+    { 1445, 1791 },
+    { 1455, 1792 },
+    { 1465, 1792 },
+    { 1475, 1791 },
+    { 1485, 1791 },
+    { 1495, 1789 },
+    { 1505, 1788 },
+    { 1516, 1785 },
+    { 1526, 1782 },
+    { 1535, 1778 },
+    { 1545, 1774 },
+    { 1553, 1769 },
+    { 1560, 1763 },
+    { 1568, 1757 },
+    { 1574, 1751 },
+    { 1580, 1745 },
+    { 1585, 1738 },
+    { 1589, 1731 },
+    { 1593, 1724 },
+    { 1596, 1717 },
+    { 1600, 1710 },
+    { 1602, 1703 },
+    { 1604, 1696 },
+    { 1604, 1690 },
+    { 1599, 1687 },
+    { 1593, 1687 },
+    { 1585, 1690 },
+    { 1579, 1696 },
+    { 1576, 1703 },
+    { 1571, 1710 },
+    { 1567, 1717 },
+    { 1563, 1724 },
+    { 1558, 1730 },
+    { 1553, 1737 },
+    { 1546, 1743 },
+    { 1538, 1749 },
+    { 1529, 1753 },
+    { 1520, 1756 },
+    { 1511, 1759 },
+    { 1502, 1761 },
+    { 1493, 1762 },
+    { 1484, 1763 },
+    { 1475, 1763 },
+    { 1466, 1763 },
+    { 1458, 1763 },
+    { 1450, 1762 },
+    { 1442, 1760 },
+    { 1434, 1759 },
+    { 1427, 1758 },
+    { 1420, 1756 },
+    { 1413, 1753 },
+    { 1408, 1750 },
+    { 1401, 1748 },
+    { 1396, 1744 },
+    { 1391, 1741 },
+    { 1386, 1738 },
+    { 1382, 1733 },
+    { 1378, 1729 },
+    { 1373, 1725 },
+    { 1371, 1720 },
+    { 1368, 1715 },
+    { 1365, 1711 },
+    { 1362, 1706 },
+    { 1360, 1701 },
+    { 1358, 1695 },
+    { 1357, 1690 },
+    { 1354, 1685 },
+    { 1353, 1680 },
+    { 1353, 1674 },
+    { 1352, 1668 },
+    { 1351, 1661 },
+    { 1351, 1655 },
+    { 1351, 1649 },
+    { 1351, 1643 },
+    { 1351, 1636 },
+    { 1351, 1630 },
+    { 1352, 1623 },
+};
+
+static const unsigned short clover_duty_lod2[][2] = {
+    { 1339, 1634 },
+    { 1338, 1646 },
+    { 1338, 1659 },
+    { 1336, 1672 },
+    { 1336, 1684 },
+    { 1337, 1696 },
+    { 1340, 1707 },
+    { 1344, 1718 },
+    { 1349, 1729 },
+    { 1354, 1739 },
+    { 1362, 1748 },
+    { 1371, 1756 },
+    { 1382, 1763 },
+    { 1395, 1769 },
+    { 1409, 1774 },
+    { 1425, 1777 },
+    { 1441, 1780 },
+    { 1459, 1781 },
+    { 1478, 1781 },
+    { 1498, 1779 },
+    { 1517, 1774 },
+    { 1536, 1767 },
+    { 1553, 1757 },
+    { 1566, 1745 },
+    { 1578, 1732 },
+    { 1584, 1718 },
+    { 1590, 1705 },
+    { 1592, 1698 },
+    { 1586, 1702 },
+    { 1579, 1716 },
+    { 1570, 1730 },
+    { 1559, 1744 },
+    { 1545, 1755 },
+    { 1527, 1764 },
+    { 1508, 1770 },
+    { 1489, 1773 },
+    { 1470, 1774 },
+    { 1453, 1773 },
+    { 1436, 1771 },
+    { 1420, 1768 },
+    { 1406, 1763 },
+    { 1393, 1758 },
+    { 1382, 1751 },
+    { 1372, 1744 },
+    { 1364, 1735 },
+    { 1358, 1726 },
+    { 1352, 1716 },
+    { 1348, 1705 },
+    { 1344, 1695 },
+    { 1342, 1684 },
+    { 1341, 1671 },
+    { 1340, 1659 },
+    { 1341, 1646 },
+    { 1341, 1633 },
+    { 1341, 1645 },
+    { 1340, 1658 },
+    { 1341, 1670 },
+    { 1341, 1683 },
+    { 1344, 1694 },
+    { 1348, 1704 },
+    { 1351, 1715 },
+    { 1358, 1725 },
+    { 1363, 1734 },
+    { 1371, 1743 },
+    { 1381, 1751 },
+    { 1392, 1758 },
+    { 1405, 1763 },
+    { 1419, 1767 },
+    { 1435, 1770 },
+    { 1451, 1773 },
+    { 1469, 1773 },
+    { 1488, 1772 },
+    { 1507, 1770 },
+    { 1526, 1764 },
+    { 1543, 1756 },
+    { 1558, 1744 },
+    { 1569, 1731 },
+    { 1579, 1717 },
+    { 1586, 1703 },
+    { 1591, 1697 },
+    { 1591, 1703 },
+    { 1585, 1717 },
+    { 1577, 1730 },
+    { 1568, 1744 },
+    { 1555, 1756 },
+    { 1538, 1767 },
+    { 1520, 1774 },
+    { 1500, 1779 },
+    { 1480, 1781 },
+    { 1461, 1782 },
+    { 1443, 1781 },
+    { 1426, 1778 },
+    { 1411, 1774 },
+    { 1396, 1770 },
+    { 1383, 1764 },
+    { 1372, 1757 },
+    { 1363, 1748 },
+    { 1355, 1739 },
+    { 1349, 1730 },
+    { 1345, 1719 },
+    { 1341, 1709 },
+    { 1337, 1698 },
+    { 1336, 1686 },
+    { 1336, 1673 },
+    { 1338, 1660 },
+    { 1338, 1647 },
+    { 1339, 1635 },
+    { 1327, 1647 },
+    { 1321, 1662 },
+    { 1315, 1676 },
+    { 1308, 1691 },
+    { 1302, 1704 },
+    { 1296, 1718 },
+    { 1289, 1732 },
+    { 1282, 1746 },
+    { 1274, 1760 },
+    { 1266, 1774 },
+    { 1257, 1787 },
+    { 1246, 1800 },
+    { 1232, 1812 },
+    { 1214, 1823 },
+    { 1191, 1831 },
+    { 1166, 1836 },
+    { 1140, 1839 },
+    { 1116, 1838 },
+    { 1093, 1835 },
+    { 1074, 1830 },
+    { 1058, 1822 },
+    { 1048, 1812 },
+    { 1044, 1800 },
+    { 1045, 1788 },
+    { 1052, 1775 },
+    { 1060, 1761 },
+    { 1072, 1749 },
+    { 1083, 1736 },
+    { 1096, 1724 },
+    { 1106, 1715 },
+    { 1099, 1707 },
+    { 1093, 1697 },
+    { 1090, 1686 },
+    { 1091, 1673 },
+    { 1095, 1659 },
+    { 1101, 1644 },
+    { 1111, 1629 },
+    { 1121, 1614 },
+    { 1132, 1600 },
+    { 1144, 1586 },
+    { 1157, 1574 },
+    { 1170, 1563 },
+    { 1183, 1554 },
+    { 1195, 1547 },
+    { 1206, 1543 },
+    { 1217, 1541 },
+    { 1226, 1542 },
+    { 1234, 1543 },
+    { 1243, 1546 },
+    { 1250, 1549 },
+    { 1258, 1552 },
+    { 1266, 1556 },
+    { 1274, 1558 },
+    { 1282, 1561 },
+    { 1291, 1565 },
+    { 1299, 1567 },
+    { 1305, 1567 },
+    { 1299, 1561 },
+    { 1295, 1552 },
+    { 1291, 1543 },
+    { 1288, 1534 },
+    { 1285, 1523 },
+    { 1284, 1512 },
+    { 1285, 1499 },
+    { 1285, 1485 },
+    { 1288, 1470 },
+    { 1292, 1453 },
+    { 1300, 1434 },
+    { 1309, 1414 },
+    { 1320, 1393 },
+    { 1333, 1371 },
+    { 1347, 1349 },
+    { 1361, 1328 },
+    { 1376, 1309 },
+    { 1390, 1291 },
+    { 1404, 1275 },
+    { 1417, 1260 },
+    { 1429, 1250 },
+    { 1440, 1241 },
+    { 1448, 1237 },
+    { 1455, 1237 },
+    { 1459, 1244 },
+    { 1460, 1254 },
+    { 1458, 1269 },
+    { 1473, 1247 },
+    { 1491, 1218 },
+    { 1510, 1190 },
+    { 1530, 1161 },
+    { 1550, 1131 },
+    { 1570, 1104 },
+    { 1587, 1083 },
+    { 1606, 1056 },
+    { 1618, 1045 },
+    { 1618, 1058 },
+    { 1609, 1088 },
+    { 1599, 1120 },
+    { 1588, 1152 },
+    { 1576, 1185 },
+    { 1565, 1215 },
+    { 1553, 1246 },
+    { 1541, 1275 },
+    { 1529, 1302 },
+    { 1518, 1328 },
+    { 1506, 1353 },
+    { 1494, 1376 },
+    { 1482, 1398 },
+    { 1471, 1419 },
+    { 1459, 1439 },
+    { 1447, 1458 },
+    { 1436, 1477 },
+    { 1425, 1494 },
+    { 1413, 1511 },
+    { 1401, 1527 },
+    { 1395, 1534 },
+    { 1397, 1534 },
+    { 1394, 1536 },
+    { 1405, 1521 },
+    { 1417, 1505 },
+    { 1428, 1488 },
+    { 1440, 1470 },
+    { 1451, 1451 },
+    { 1462, 1432 },
+    { 1474, 1412 },
+    { 1486, 1390 },
+    { 1498, 1368 },
+    { 1510, 1344 },
+    { 1522, 1319 },
+    { 1534, 1292 },
+    { 1546, 1263 },
+    { 1558, 1235 },
+    { 1569, 1205 },
+    { 1580, 1173 },
+    { 1592, 1140 },
+    { 1603, 1106 },
+    { 1610, 1080 },
+    { 1617, 1053 },
+    { 1613, 1049 },
+    { 1600, 1063 },
+    { 1582, 1086 },
+    { 1561, 1116 },
+    { 1541, 1145 },
+    { 1521, 1175 },
+    { 1501, 1204 },
+    { 1483, 1232 },
+    { 1465, 1261 },
+    { 1457, 1272 },
+    { 1458, 1257 },
+    { 1457, 1246 },
+    { 1455, 1238 },
+    { 1449, 1237 },
+    { 1440, 1241 },
+    { 1429, 1250 },
+    { 1418, 1260 },
+    { 1405, 1274 },
+    { 1390, 1291 },
+    { 1376, 1309 },
+    { 1361, 1329 },
+    { 1347, 1350 },
+    { 1333, 1371 },
+    { 1321, 1392 },
+    { 1310, 1413 },
+    { 1300, 1434 },
+    { 1293, 1453 },
+    { 1288, 1470 },
+    { 1286, 1485 },
+    { 1285, 1498 },
+    { 1285, 1511 },
+    { 1286, 1523 },
+    { 1288, 1533 },
+    { 1292, 1543 },
+    { 1295, 1552 },
+    { 1299, 1560 },
+    { 1306, 1566 },
+    { 1304, 1569 },
+    { 1296, 1566 },
+    { 1287, 1563 },
+    { 1279, 1560 },
+    { 1271, 1557 },
+    { 1263, 1554 },
+    { 1255, 1550 },
+    { 1246, 1548 },
+    { 1238, 1545 },
+    { 1230, 1543 },
+    { 1222, 1541 },
+    { 1212, 1542 },
+    { 1201, 1545 },
+    { 1189, 1550 },
+    { 1176, 1559 },
+    { 1163, 1569 },
+    { 1150, 1580 },
+    { 1138, 1593 },
+    { 1126, 1607 },
+    { 1116, 1622 },
+    { 1106, 1637 },
+    { 1098, 1652 },
+    { 1093, 1666 },
+    { 1091, 1680 },
+    { 1092, 1692 },
+    { 1096, 1702 },
+    { 1103, 1711 },
+    { 1106, 1715 },
+    { 1093, 1727 },
+    { 1080, 1739 },
+    { 1069, 1752 },
+    { 1058, 1765 },
+    { 1050, 1778 },
+    { 1044, 1791 },
+    { 1045, 1804 },
+    { 1052, 1815 },
+    { 1064, 1824 },
+    { 1080, 1831 },
+    { 1100, 1837 },
+    { 1123, 1839 },
+    { 1148, 1838 },
+    { 1174, 1835 },
+    { 1199, 1829 },
+    { 1220, 1820 },
+    { 1237, 1808 },
+    { 1249, 1795 },
+    { 1260, 1782 },
+    { 1268, 1769 },
+    { 1276, 1755 },
+    { 1284, 1741 },
+    { 1290, 1727 },
+    { 1297, 1713 },
+    { 1304, 1699 },
+    { 1310, 1685 },
+    { 1317, 1671 },
+    { 1323, 1657 },
+    { 1328, 1643 },
+    { 1331, 1629 },
+    { 1333, 1614 },
+    { 1333, 1612 },
+    { 1329, 1622 },
+    { 1322, 1637 },
+    { 1315, 1652 },
+    { 1308, 1667 },
+    { 1301, 1681 },
+    { 1294, 1695 },
+    { 1288, 1709 },
+    { 1280, 1723 },
+    { 1273, 1737 },
+    { 1265, 1751 },
+    { 1256, 1765 },
+    { 1247, 1778 },
+    { 1236, 1791 },
+    { 1222, 1804 },
+    { 1204, 1814 },
+    { 1183, 1822 },
+    { 1159, 1826 },
+    { 1135, 1828 },
+    { 1113, 1826 },
+    { 1093, 1821 },
+    { 1077, 1814 },
+    { 1068, 1805 },
+    { 1062, 1794 },
+    { 1065, 1781 },
+    { 1072, 1767 },
+    { 1081, 1754 },
+    { 1094, 1741 },
+    { 1106, 1728 },
+    { 1120, 1717 },
+    { 1125, 1710 },
+    { 1118, 1703 },
+    { 1109, 1695 },
+    { 1104, 1686 },
+    { 1103, 1674 },
+    { 1106, 1660 },
+    { 1111, 1645 },
+    { 1119, 1630 },
+    { 1130, 1616 },
+    { 1141, 1602 },
+    { 1153, 1589 },
+    { 1166, 1577 },
+    { 1179, 1567 },
+    { 1192, 1560 },
+    { 1203, 1557 },
+    { 1213, 1556 },
+    { 1223, 1556 },
+    { 1231, 1559 },
+    { 1239, 1562 },
+    { 1247, 1566 },
+    { 1255, 1568 },
+    { 1263, 1572 },
+    { 1273, 1574 },
+    { 1281, 1577 },
+    { 1290, 1580 },
+    { 1299, 1583 },
+    { 1308, 1585 },
+    { 1317, 1588 },
+    { 1326, 1591 },
+    { 1334, 1594 },
+    { 1335, 1599 },
+    { 1322, 1611 },
+    { 1309, 1622 },
+    { 1296, 1633 },
+    { 1282, 1643 },
+    { 1268, 1652 },
+    { 1254, 1661 },
+    { 1239, 1668 },
+    { 1225, 1675 },
+    { 1210, 1681 },
+    { 1200, 1687 },
+    { 1205, 1693 },
+    { 1220, 1687 },
+    { 1235, 1682 },
+    { 1250, 1674 },
+    { 1264, 1665 },
+    { 1279, 1656 },
+    { 1293, 1646 },
+    { 1306, 1636 },
+    { 1319, 1624 },
+    { 1332, 1613 },
+    { 1342, 1598 },
+    { 1351, 1582 },
+    { 1361, 1566 },
+    { 1373, 1552 },
+    { 1385, 1537 },
+    { 1397, 1521 },
+    { 1409, 1505 },
+    { 1420, 1488 },
+    { 1432, 1471 },
+    { 1444, 1452 },
+    { 1455, 1433 },
+    { 1467, 1413 },
+    { 1479, 1392 },
+    { 1491, 1369 },
+    { 1503, 1345 },
+    { 1515, 1320 },
+    { 1527, 1294 },
+    { 1539, 1266 },
+    { 1549, 1237 },
+    { 1561, 1207 },
+    { 1570, 1179 },
+    { 1577, 1153 },
+    { 1580, 1135 },
+    { 1577, 1128 },
+    { 1569, 1131 },
+    { 1557, 1142 },
+    { 1543, 1160 },
+    { 1527, 1180 },
+    { 1509, 1205 },
+    { 1491, 1231 },
+    { 1473, 1258 },
+    { 1456, 1285 },
+    { 1445, 1303 },
+    { 1443, 1302 },
+    { 1444, 1286 },
+    { 1444, 1274 },
+    { 1441, 1267 },
+    { 1434, 1266 },
+    { 1425, 1270 },
+    { 1415, 1277 },
+    { 1402, 1291 },
+    { 1389, 1305 },
+    { 1375, 1321 },
+    { 1361, 1340 },
+    { 1346, 1361 },
+    { 1333, 1382 },
+    { 1321, 1404 },
+    { 1311, 1425 },
+    { 1304, 1443 },
+    { 1298, 1461 },
+    { 1296, 1476 },
+    { 1296, 1489 },
+    { 1296, 1502 },
+    { 1297, 1513 },
+    { 1300, 1524 },
+    { 1303, 1533 },
+    { 1306, 1542 },
+    { 1311, 1550 },
+    { 1316, 1557 },
+    { 1322, 1564 },
+    { 1329, 1569 },
+    { 1337, 1573 },
+    { 1346, 1575 },
+    { 1349, 1560 },
+    { 1353, 1545 },
+    { 1357, 1529 },
+    { 1361, 1513 },
+    { 1366, 1497 },
+    { 1371, 1480 },
+    { 1378, 1462 },
+    { 1384, 1444 },
+    { 1391, 1424 },
+    { 1402, 1404 },
+    { 1406, 1401 },
+    { 1403, 1413 },
+    { 1396, 1432 },
+    { 1389, 1451 },
+    { 1383, 1469 },
+    { 1378, 1486 },
+    { 1373, 1503 },
+    { 1368, 1519 },
+    { 1364, 1535 },
+    { 1361, 1550 },
+    { 1359, 1564 },
+    { 1359, 1575 },
+    { 1361, 1586 },
+    { 1372, 1585 },
+    { 1384, 1583 },
+    { 1395, 1581 },
+    { 1407, 1577 },
+    { 1419, 1573 },
+    { 1431, 1568 },
+    { 1443, 1561 },
+    { 1455, 1555 },
+    { 1468, 1548 },
+    { 1476, 1544 },
+    { 1475, 1551 },
+    { 1463, 1562 },
+    { 1451, 1568 },
+    { 1439, 1575 },
+    { 1427, 1581 },
+    { 1414, 1586 },
+    { 1402, 1590 },
+    { 1390, 1594 },
+    { 1378, 1596 },
+    { 1367, 1598 },
+    { 1359, 1600 },
+    { 1362, 1609 },
+    { 1367, 1617 },
+    { 1372, 1625 },
+    { 1379, 1632 },
+    { 1385, 1640 },
+    { 1392, 1646 },
+    { 1400, 1653 },
+    { 1408, 1659 },
+    { 1416, 1665 },
+    { 1426, 1669 },
+    { 1438, 1671 },
+    { 1451, 1671 },
+    { 1465, 1669 },
+    { 1479, 1664 },
+    { 1493, 1657 },
+    { 1508, 1648 },
+    { 1521, 1637 },
+    { 1533, 1624 },
+    { 1543, 1609 },
+    { 1551, 1593 },
+    { 1557, 1578 },
+    { 1561, 1562 },
+    { 1564, 1548 },
+    { 1564, 1535 },
+    { 1561, 1525 },
+    { 1558, 1517 },
+    { 1552, 1511 },
+    { 1545, 1507 },
+    { 1537, 1506 },
+    { 1534, 1503 },
+    { 1540, 1490 },
+    { 1552, 1474 },
+    { 1564, 1455 },
+    { 1574, 1436 },
+    { 1583, 1415 },
+    { 1590, 1396 },
+    { 1596, 1377 },
+    { 1599, 1361 },
+    { 1599, 1348 },
+    { 1598, 1337 },
+    { 1595, 1329 },
+    { 1589, 1327 },
+    { 1581, 1329 },
+    { 1571, 1335 },
+    { 1559, 1345 },
+    { 1547, 1356 },
+    { 1534, 1371 },
+    { 1521, 1386 },
+    { 1508, 1402 },
+    { 1494, 1420 },
+    { 1481, 1437 },
+    { 1469, 1454 },
+    { 1457, 1470 },
+    { 1445, 1486 },
+    { 1432, 1502 },
+    { 1420, 1517 },
+    { 1408, 1531 },
+    { 1396, 1545 },
+    { 1384, 1559 },
+    { 1372, 1572 },
+    { 1360, 1584 },
+    { 1357, 1598 },
+    { 1355, 1612 },
+    { 1354, 1625 },
+    { 1359, 1633 },
+    { 1365, 1640 },
+    { 1372, 1648 },
+    { 1378, 1656 },
+    { 1386, 1662 },
+    { 1394, 1668 },
+    { 1403, 1674 },
+    { 1412, 1679 },
+    { 1423, 1683 },
+    { 1436, 1684 },
+    { 1450, 1683 },
+    { 1464, 1680 },
+    { 1479, 1675 },
+    { 1494, 1668 },
+    { 1508, 1659 },
+    { 1521, 1648 },
+    { 1534, 1636 },
+    { 1544, 1622 },
+    { 1554, 1607 },
+    { 1561, 1591 },
+    { 1567, 1576 },
+    { 1571, 1560 },
+    { 1574, 1545 },
+    { 1575, 1532 },
+    { 1575, 1520 },
+    { 1572, 1510 },
+    { 1568, 1502 },
+    { 1562, 1498 },
+    { 1556, 1493 },
+    { 1550, 1490 },
+    { 1561, 1472 },
+    { 1572, 1453 },
+    { 1582, 1434 },
+    { 1591, 1413 },
+    { 1599, 1393 },
+    { 1605, 1374 },
+    { 1609, 1356 },
+    { 1611, 1341 },
+    { 1611, 1327 },
+    { 1611, 1316 },
+    { 1608, 1307 },
+    { 1603, 1304 },
+    { 1596, 1304 },
+    { 1586, 1309 },
+    { 1575, 1316 },
+    { 1563, 1327 },
+    { 1551, 1340 },
+    { 1538, 1354 },
+    { 1525, 1370 },
+    { 1511, 1387 },
+    { 1498, 1404 },
+    { 1485, 1422 },
+    { 1472, 1439 },
+    { 1460, 1455 },
+    { 1448, 1471 },
+    { 1435, 1487 },
+    { 1424, 1501 },
+    { 1411, 1516 },
+    { 1400, 1530 },
+    { 1412, 1515 },
+    { 1425, 1500 },
+    { 1437, 1485 },
+    { 1449, 1469 },
+    { 1462, 1453 },
+    { 1474, 1437 },
+    { 1487, 1419 },
+    { 1500, 1401 },
+    { 1513, 1384 },
+    { 1527, 1367 },
+    { 1540, 1352 },
+    { 1553, 1338 },
+    { 1565, 1326 },
+    { 1576, 1317 },
+    { 1587, 1310 },
+    { 1596, 1305 },
+    { 1603, 1305 },
+    { 1609, 1309 },
+    { 1611, 1317 },
+    { 1612, 1329 },
+    { 1610, 1344 },
+    { 1609, 1359 },
+    { 1604, 1377 },
+    { 1597, 1397 },
+    { 1589, 1418 },
+    { 1580, 1438 },
+    { 1569, 1458 },
+    { 1559, 1476 },
+    { 1550, 1489 },
+    { 1556, 1493 },
+    { 1562, 1497 },
+    { 1568, 1502 },
+    { 1572, 1510 },
+    { 1574, 1520 },
+    { 1575, 1532 },
+    { 1573, 1546 },
+    { 1570, 1561 },
+    { 1566, 1577 },
+    { 1560, 1592 },
+    { 1553, 1608 },
+    { 1544, 1622 },
+    { 1533, 1637 },
+    { 1520, 1649 },
+    { 1507, 1660 },
+    { 1493, 1669 },
+    { 1478, 1675 },
+    { 1463, 1680 },
+    { 1449, 1683 },
+    { 1435, 1683 },
+    { 1422, 1682 },
+    { 1411, 1679 },
+    { 1402, 1673 },
+    { 1393, 1667 },
+    { 1385, 1661 },
+    { 1378, 1654 },
+    { 1371, 1647 },
+    { 1364, 1640 },
+    { 1359, 1631 },
+    { 1354, 1623 },
+    { 1352, 1624 },
+    { 1351, 1637 },
+    { 1351, 1650 },
+    { 1352, 1662 },
+    { 1353, 1674 },
+    { 1355, 1686 },
+    { 1359, 1696 },
+    { 1362, 1707 },
+    { 1368, 1716 },
+    { 1374, 1726 },
+    { 1382, 1734 },
+    { 1392, 1741 },
+    { 1402, 1748 },
+    { 1414, 1753 },
+    { 1428, 1758 },
+    { 1443, 1761 },
+    { 1459, 1763 },
+    { 1476, 1764 },
+    { 1494, 1763 },
+    { 1512, 1759 },
+    { 1530, 1753 },
+    { 1546, 1743 },
+    { 1558, 1730 },
+    { 1567, 1717 },
+    { 1576, 1703 },
+    { 1582, 1693 },
+    { 1597, 1687 },
+    { 1603, 1691 },
+    { 1601, 1704 },
+    { 1595, 1718 },
+    { 1589, 1732 },
+    { 1579, 1745 },
+    { 1567, 1758 },
+    { 1552, 1769 },
+    { 1534, 1778 },
+    { 1514, 1785 },
+    { 1494, 1789 },
+    { 1473, 1791 },
+    { 1454, 1791 },
+    { 1435, 1790 },
+    { 1417, 1787 },
+    { 1400, 1784 },
+    { 1386, 1778 },
+    { 1373, 1772 },
+    { 1362, 1765 },
+    { 1352, 1757 },
+    { 1345, 1748 },
+    { 1337, 1739 },
+    { 1333, 1728 },
+    { 1329, 1718 },
+    { 1327, 1706 },
+    { 1325, 1694 },
+    { 1325, 1681 },
+    { 1326, 1668 },
+    { 1327, 1655 },
+    { 1330, 1646 },
+    { 1327, 1659 },
+    { 1326, 1672 },
+    { 1325, 1685 },
+    { 1326, 1697 },
+    { 1327, 1709 },
+    { 1329, 1721 },
+    { 1335, 1731 },
+    { 1339, 1742 },
+    { 1347, 1751 },
+    { 1356, 1759 },
+    { 1365, 1767 },
+    { 1377, 1774 },
+    { 1390, 1781 },
+    { 1405, 1785 },
+    { 1422, 1789 },
+    { 1441, 1790 },
+    { 1460, 1792 },
+    { 1480, 1791 },
+    { 1500, 1788 },
+    { 1521, 1783 },
+    { 1540, 1776 },
+    { 1557, 1766 },
+    { 1571, 1754 },
+    { 1583, 1741 },
+    { 1592, 1727 },
+    { 1598, 1713 },
+    { 1603, 1700 },
+    { 1604, 1690 },
+    { 1597, 1687 },
+    { 1582, 1693 },
+    { 1574, 1706 },
+    { 1566, 1720 },
+    { 1556, 1734 },
+    { 1542, 1746 },
+    { 1525, 1755 },
+    { 1506, 1760 },
+    { 1488, 1763 },
+    { 1470, 1763 },
+    { 1454, 1762 },
+    { 1438, 1760 },
+    { 1424, 1756 },
+    { 1410, 1752 },
+    { 1399, 1746 },
+    { 1389, 1739 },
+    { 1380, 1731 },
+    { 1372, 1723 },
+    { 1366, 1713 },
+    { 1361, 1704 },
+    { 1357, 1693 },
+    { 1354, 1682 },
+    { 1352, 1671 },
+    { 1351, 1658 },
+    { 1351, 1646 },
+    { 1351, 1633 },
+    { 1352, 1623 },
+};
+
+const halo_traj_lod_t clover_lods[CLOVER_LOD_COUNT] = {
+    { clover_duty, 3223, 0.0991f },
+    { clover_duty_lod1, 1617, 0.1968f },
+    { clover_duty_lod2, 820, 0.3873f },
+};
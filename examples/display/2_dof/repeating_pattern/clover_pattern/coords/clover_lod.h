@@ -0,0 +1,11 @@
+#ifndef CLOVER_LOD_H
+#define CLOVER_LOD_H
+
+#include "halo_trajectory.h"
+
+#define CLOVER_LOD_COUNT 3
+
+// clover_duty and coarser copies, finest first
+extern const halo_traj_lod_t clover_lods[CLOVER_LOD_COUNT];
+
+#endif // CLOVER_LOD_H
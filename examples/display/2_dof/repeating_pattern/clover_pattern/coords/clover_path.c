@@ -0,0 +1,413 @@
+#include "clover_path.h"
+
+// ----------------------------
+// Generated clover path (do not edit)
+// ----------------------------
+
+static const signed char clover_path_data[] = {
+       0,   -5,    1,  -10,    0,  -10,    0,  -10,    0,  -10,    1,  -10,    0,  -10,    0,  -10,
+       0,  -10,    1,  -10,    0,   -9,    2,  -10,    1,   -9,    0,  -10,    0,  -10,    3,   -9,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -3,   -9,
+       0,  -10,    0,  -10,   -1,   -9,   -2,  -10,   -1,  -10,    0,  -10,    0,  -10,   -1,  -10,
+       0,  -10,    0,  -10,   -1,  -10,   -1,   -9,   -4,  -10,    0,  -10,    0,  -10,   -1,  -10,
+      -4,   -9,   -2,  -10,   -1,  -10,    0,  -10,   -2,   -9,   -4,   -9,   -1,  -10,   -1,  -10,
+      -3,   -9,   -4,  -10,    0,  -10,   -3,   -9,   -3,   -9,   -2,  -10,   -3,   -9,   -3,   -9,
+      -2,  -10,   -3,  -10,   -3,   -9,   -5,   -9,   -4,   -9,   -2,  -10,   -3,   -9,   -5,   -9,
+      -4,   -9,   -5,   -9,   -2,   -9,   -4,   -9,   -5,   -9,   -4,   -9,   -6,   -8,   -3,   -9,
+      -5,   -9,   -5,   -8,   -6,   -9,   -5,   -8,   -5,   -9,   -6,   -8,   -6,   -8,   -7,   -7,
+      -7,   -7,   -7,   -7,   -7,   -7,   -8,   -6,   -9,   -6,   -8,   -5,   -8,   -5,  -10,   -4,
+      -9,   -3,  -10,   -3,   -9,   -2,  -10,   -1,  -10,   -1,  -10,   -1,  -10,   -1,  -10,   -2,
+      -9,    3,  -10,    0,   -9,    3,  -10,    1,  -10,    1,  -10,    1,   -8,    5,  -10,    2,
+      -9,    3,   -8,    6,    4,    7,   10,    0,   10,    0,   10,   -3,    9,   -3,   10,   -2,
+      10,   -1,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    1,
+       9,    3,   10,    4,    9,    3,   10,    3,    8,    5,    8,    6,    9,    5,    7,    7,
+       7,    8,    6,    7,    7,    7,    7,    8,    6,    7,    6,    9,    5,    8,    5,    9,
+       5,    8,    5,    9,    4,    9,    5,    9,    4,    9,    2,   10,    6,    7,    4,   10,
+       3,    9,    4,    9,    3,   10,    4,    9,    3,    9,    4,   10,    3,    9,    4,    9,
+       3,   10,    4,    9,    3,   10,    1,    9,    4,   10,    3,    9,    1,   10,    3,    9,
+       3,    9,    0,   10,    4,    9,    2,   10,    1,   10,    1,   10,    2,    9,    4,   10,
+       0,   10,    0,   10,    3,    9,    1,    9,    1,   10,    1,   10,    2,    9,    0,   10,
+       0,   10,    3,   10,    3,    9,    0,   10,    1,   10,    0,   10,    0,   10,    1,   10,
+       0,   10,    0,   10,    1,   10,    3,    9,    0,   10,    0,   10,    2,    9,    1,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   -7,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,   -3,   -8,    0,  -10,    0,  -10,   -3,   -9,   -1,  -10,    0,  -10,    0,  -10,
+      -1,  -10,    0,  -10,    0,  -10,   -1,  -10,    0,  -10,   -2,  -10,   -3,   -9,   -1,  -10,
+       0,  -10,    0,  -10,   -3,   -9,    0,  -10,   -2,  -10,   -3,   -9,    0,  -10,    0,  -10,
+      -3,  -10,   -3,   -9,   -1,  -10,   -1,  -10,   -1,  -10,   -5,   -9,    0,  -10,   -1,   -9,
+      -5,   -9,    0,  -10,   -3,   -9,   -4,  -10,   -2,   -9,   -2,  -10,   -4,   -9,   -4,   -9,
+      -4,  -10,   -2,   -9,   -3,  -10,   -4,   -9,   -5,   -9,   -2,   -9,   -3,  -10,   -5,   -9,
+      -4,   -9,   -5,   -9,   -4,   -8,   -3,  -10,   -6,   -7,   -4,   -9,   -5,   -9,   -5,   -9,
+      -4,   -9,   -5,   -9,   -5,   -8,   -6,   -8,   -6,   -8,   -7,   -7,   -7,   -7,   -7,   -7,
+      -7,   -7,   -8,   -6,   -9,   -6,   -8,   -6,   -9,   -4,   -9,   -3,  -10,   -3,   -9,   -4,
+     -10,   -2,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,    3,   -9,    2,  -10,    3,  -10,    1,  -10,    0,   -7,   -4,    4,   -8,   10,   -2,
+       9,   -2,    9,   -4,   10,   -3,   10,    0,    9,   -3,   10,   -3,   10,    0,   10,    0,
+       9,   -2,   10,    1,    9,    1,   10,    1,   10,    1,   10,    2,   10,    3,    9,    2,
+      10,    4,    8,    5,    9,    5,    9,    5,    8,    5,    8,    6,    7,    7,    7,    7,
+       7,    7,    7,    8,    5,    8,    6,    8,    5,    9,    5,    8,    6,    9,    5,    8,
+       3,   10,    4,    9,    5,    8,    5,    9,    5,    9,    2,    9,    4,    9,    5,    9,
+       3,    9,    3,   10,    4,    9,    4,    9,    5,    9,    0,   10,    4,    9,    3,   10,
+       3,    9,    3,   10,    3,    9,    3,   10,    3,    9,    1,   10,    2,   10,    4,    9,
+       2,   10,    0,   10,    3,    9,    3,    9,    1,   10,    1,   10,    1,   10,    3,    9,
+       3,   10,    0,   10,    0,   10,    2,   10,    3,    9,    1,   10,    0,   10,    0,   10,
+       1,   10,    0,   10,    0,   10,    1,   10,    0,   10,    3,    9,    0,   10,    0,   10,
+       3,    9,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+      -1,    9,   -2,    9,    0,   10,    0,   10,   -3,    9,    0,   10,   -1,   10,    0,   10,
+       0,   10,    0,   10,   -1,   10,    0,   10,    0,   10,    0,   10,   -1,   10,    2,    8,
+       9,   -4,    9,   -4,    9,   -4,    4,   -8,    3,  -10,    3,   -9,    4,  -10,    4,   -9,
+       4,   -9,    5,   -9,    4,   -9,    4,   -9,    5,   -9,    4,   -9,    4,   -9,    4,   -9,
+       2,   -9,    5,   -8,    6,   -8,    2,  -10,    4,   -8,    5,   -9,    4,   -9,    5,   -9,
+       4,   -9,    5,   -9,    5,   -9,    4,   -9,    5,   -9,    4,   -8,    5,   -9,    4,   -9,
+       6,   -9,    5,   -8,    5,   -9,    6,   -8,    5,   -9,    5,   -8,    5,   -9,    6,   -8,
+       5,   -9,    5,   -8,    6,   -8,    6,   -8,    7,   -8,    6,   -7,    7,   -8,    6,   -8,
+       6,   -7,    7,   -8,    8,   -6,    8,   -6,    8,   -6,    8,   -5,    9,   -4,    9,   -5,
+      10,   -4,    9,   -3,   10,   -3,   10,   -1,    9,   -1,    9,   -4,   10,    0,   10,    0,
+      10,    0,   10,    0,   10,    0,   10,    0,   10,    4,    9,    2,   10,    0,    9,    4,
+      10,    3,   10,    2,    8,    4,   10,    3,    9,    3,   10,    3,    8,    5,    9,    5,
+       8,    6,    9,    5,    8,    5,    9,    6,    8,    5,    7,    7,    8,    7,    7,    7,
+       6,    7,    6,    8,    6,    9,    5,    8,    6,    8,    6,    8,    2,   10,    3,    9,
+       4,    9,    2,    9,    0,   10,    1,   10,    2,    9,    3,   10,    0,   10,    0,   10,
+      -3,    9,    0,   10,   -2,    9,   -1,   10,    0,   10,   -2,    9,   -4,   10,   -1,   10,
+      -2,    9,   -5,    9,   -2,    9,   -4,   10,   -4,    9,   -5,    9,   -2,    9,    7,    5,
+       9,    5,    9,    4,    9,    4,    9,    4,    8,    6,    8,    6,    9,    6,    8,    6,
+       8,    6,    7,    7,    7,    7,    7,    7,    6,    8,    6,    8,    6,    8,    5,    8,
+       5,    9,    4,    9,    4,    9,    3,   10,    3,    9,    3,   10,    3,    9,    3,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+      -2,    9,   -4,   10,   -1,   10,   -2,   10,   -4,    8,   -4,   10,   -2,    9,   -4,    9,
+      -5,    9,   -5,    9,   -5,    9,   -6,    8,   -5,    8,   -7,    7,   -7,    7,   -7,    7,
+      -7,    7,   -8,    7,   -8,    6,   -8,    6,   -8,    5,  -10,    3,   -8,    5,   -9,    5,
+     -10,    2,   -9,    3,  -10,    3,   -9,    3,  -10,    0,  -10,    1,   -9,    3,  -10,    2,
+     -10,    0,  -10,    0,   -9,   -3,  -10,    0,   -9,   -2,  -10,   -1,  -10,    0,   -9,   -1,
+     -10,   -4,   -9,   -1,  -10,   -2,  -10,   -1,   -9,   -5,  -10,    0,   -9,   -3,  -10,   -4,
+      -9,   -2,   -9,   -4,   -9,   -2,  -10,   -2,  -10,   -3,   -9,   -4,   -9,   -4,  -10,   -3,
+      -9,   -3,  -10,   -2,   -9,   -5,   -9,   -3,   -9,   -3,   -9,   -5,   -9,   -3,  -10,   -3,
+      -9,   -4,   -9,   -4,   -9,   -5,  -10,   -2,   -8,   -5,   -9,   -2,   -8,   -6,   -9,   -5,
+      -9,   -5,   -5,    3,    8,    6,    8,    6,    8,    5,    8,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,    8,    7,    7,    7,    7,
+       7,    7,    7,    7,    8,    7,    7,    7,    7,    7,    6,    8,    7,    7,    6,    8,
+       7,    7,    6,    8,    6,    8,    6,    8,    6,    8,    6,    8,    6,    8,    6,    8,
+       5,    9,    6,    8,    6,    8,    6,    8,    5,    9,    4,    9,    4,    9,    4,    9,
+       4,    9,    4,    9,    0,   10,    3,   10,    2,    9,    3,   10,    1,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,   -1,   10,   -4,    9,   -3,   10,   -1,   10,
+      -3,    9,   -4,    9,   -3,    9,   -3,    9,   -6,    9,   -5,    8,   -5,    9,   -5,    8,
+      -7,    8,   -6,    8,   -7,    7,   -8,    6,   -7,    7,   -8,    7,   -8,    5,   -8,    6,
+      -9,    5,   -8,    6,   -9,    4,   -9,    4,   -9,    5,   -9,    4,   -9,    4,  -10,    2,
+      -9,    3,   -9,    5,  -10,    1,   -9,    1,   -9,    4,  -10,    0,   -9,    3,  -10,    0,
+     -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,   -9,   -3,  -10,    0,   -9,   -4,
+     -10,   -1,   -9,   -4,   -9,   -3,   -9,   -4,  -10,   -4,   -8,   -5,   -9,   -6,   -8,   -5,
+      -8,   -6,   -8,   -6,   -8,   -6,   -7,   -7,   -8,   -7,   -6,   -8,   -7,    0,   -7,    7,
+      -7,    7,   -8,    7,   -7,    6,   -8,    6,   -8,    6,   -9,    5,   -8,    6,   -9,    5,
+      -9,    4,   -9,    3,  -10,    3,   -9,    4,   -9,    3,  -10,    3,   -9,    4,  -10,    0,
+     -10,    1,   -9,    3,  -10,    2,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,   -2,   -9,   -4,  -10,    0,  -10,   -1,   -9,   -3,  -10,   -3,   -9,   -3,  -10,   -3,
+      -9,   -4,   -9,   -4,   -9,   -5,   -9,   -4,   -8,   -6,   -8,   -5,   -8,   -7,   -7,   -7,
+      -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -6,   -9,   -5,   -8,   -5,   -9,   -5,   -8,
+      -2,   -9,   -6,   -9,   -2,   -9,   -4,   -9,   -2,  -10,   -2,   -9,   -3,  -10,    0,   -9,
+      -2,  -10,   -1,   -9,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    3,   -9,    0,  -10,
+       1,  -10,    3,   -9,    1,  -10,    4,   -9,    4,   -9,    3,   -9,    3,  -10,    3,   -9,
+       4,  -10,    6,   -8,    2,   -9,    6,   -8,    5,   -9,    5,   -8,    6,   -9,    5,   -8,
+       6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    7,   -8,    6,   -7,
+       7,   -8,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    8,   -7,    7,   -7,
+       7,   -7,    7,   -7,    7,   -7,    7,   -7,    8,   -7,    7,   -7,    7,   -7,    7,   -6,
+       8,   -7,    8,   -6,    7,   -6,    8,   -7,    8,   -6,    8,   -6,    7,   -7,    8,   -5,
+       9,   -6,    9,   -5,    8,   -5,    9,   -5,   -8,   -4,    7,    1,    3,   -2,   -5,    8,
+      -9,    4,   -8,    6,   -8,    5,   -8,    6,   -8,    6,   -8,    6,   -8,    7,   -7,    6,
+      -8,    7,   -8,    6,   -7,    7,   -8,    6,   -7,    7,   -8,    6,   -8,    7,   -7,    7,
+      -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    8,   -7,    7,   -7,    7,
+      -7,    7,   -6,    7,   -7,    7,   -7,    8,   -7,    7,   -7,    7,   -6,    8,   -6,    8,
+      -6,    8,   -6,    8,   -6,    8,   -6,    8,   -5,    9,   -6,    8,   -5,    9,   -5,    8,
+      -5,    9,   -4,    8,   -5,    9,   -4,    9,   -4,    9,   -4,    9,   -3,   10,   -3,    9,
+      -2,   10,   -3,    9,   -2,   10,    0,   10,   -3,    9,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    3,    9,    0,   10,    1,    9,    3,   10,    3,   10,    3,    9,
+       3,   10,    3,    9,    5,    9,    5,    8,    5,    9,    6,    9,    5,    8,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    8,    7,    6,    8,    6,    9,    6,    8,    5,
+       9,    4,    9,    5,    9,    4,    9,    4,   10,    3,    9,    3,   10,    3,   10,    1,
+      10,    0,    9,    4,    9,    2,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,
+      10,   -2,    9,   -2,   10,   -1,   10,   -1,    9,   -4,    9,   -4,   10,   -2,   10,   -2,
+       9,   -4,    9,   -5,    8,   -5,    9,   -4,    9,   -5,    9,   -5,    8,   -6,    8,   -6,
+       8,   -6,    7,   -7,    7,   -7,    7,   -7,    9,   -3,    6,    7,    7,    8,    7,    6,
+       8,    7,    8,    6,    7,    6,    9,    6,    9,    4,    8,    5,    9,    5,    9,    4,
+       9,    5,    9,    4,   10,    3,    9,    3,   10,    0,    9,    3,   10,    0,   10,    0,
+      10,    0,   10,    0,   10,    0,   10,    0,    9,   -3,   10,    0,    9,   -3,    9,   -2,
+      10,   -2,    9,   -4,   10,   -3,    9,   -1,    9,   -5,    9,   -4,    9,   -5,    9,   -4,
+       9,   -5,    8,   -5,    9,   -6,    8,   -5,    8,   -6,    8,   -7,    7,   -6,    8,   -7,
+       6,   -7,    7,   -8,    7,   -7,    5,   -8,    5,   -9,    6,   -9,    5,   -8,    5,   -9,
+       2,   -9,    5,   -9,    3,   -9,    1,  -10,    3,   -9,    3,  -10,    2,   -9,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,   -2,  -10,   -3,  -10,   -3,   -9,
+       0,  -10,   -5,   -9,   -2,   -9,   -4,   -9,   -5,   -9,   -6,   -8,   -5,   -9,   -5,   -8,
+      -5,   -9,   -6,   -8,   -5,   -9,   -6,   -8,   -6,   -8,   -6,   -7,   -7,   -8,   -6,   -8,
+      -6,   -8,   -7,   -7,   -6,   -8,   -7,   -8,   -6,   -7,   -6,   -8,   -7,   -7,   -7,   -7,
+      -8,   -7,   -7,   -7,   -7,   -7,   -7,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,
+      -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -9,   -6,   -8,   -5,
+      -8,   -6,    3,   -6,    8,    4,    9,    5,    9,    5,    9,    4,    9,    5,    9,    1,
+       9,    4,   10,    4,    9,    4,    9,    4,    9,    4,    9,    4,   10,    4,    9,    4,
+       9,    3,   10,    3,    9,    3,   10,    4,    9,    3,   10,    3,    9,    3,   10,    3,
+       9,    3,   10,    4,    9,    3,   10,    3,    9,    3,   10,    0,    9,    4,   10,    2,
+      10,    1,    9,    2,   10,    3,    9,    2,   10,    0,   10,    0,    9,    3,   10,    0,
+       9,    3,   10,    0,   10,    0,   10,   -1,    9,   -4,   10,   -1,   10,    0,   10,   -2,
+       9,   -4,   10,   -2,    9,   -3,    9,   -4,    9,   -5,    8,   -5,    9,   -6,    8,   -5,
+       8,   -6,    7,   -7,    7,   -8,    7,   -7,    7,   -7,    6,   -7,    7,   -8,    6,   -8,
+       5,   -8,    5,   -9,    5,   -9,    4,   -9,    4,   -9,    4,   -9,    4,  -10,    0,   -9,
+       3,  -10,    3,   -9,    2,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,   -3,  -10,   -4,   -9,   -3,   -9,   -3,  -10,   -4,   -9,
+      -3,  -10,   -4,   -9,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -7,   -7,
+      -7,   -7,   -7,   -7,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -5,   -9,   -5,
+      -9,   -5,   -9,   -4,   -9,   -4,   -5,   -5,    1,  -10,    4,   -9,    5,   -9,    4,   -9,
+       4,   -9,    4,   -9,    2,  -10,    1,  -10,    4,   -9,    2,  -10,    0,  -10,    1,   -9,
+       2,   -9,    0,  -10,    3,   -9,    0,  -10,    0,  -10,   -3,  -10,   -2,  -10,   -1,   -9,
+       0,  -10,   -3,  -10,   -4,   -9,   -2,   -9,   -5,   -9,   -5,   -8,   -5,   -9,   -6,   -9,
+      -6,   -7,   -6,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -8,   -6,   -8,   -6,   -8,   -6,
+      -8,   -6,   -9,   -6,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -5,   -9,   -4,   -9,   -4,
+      -9,   -2,  -10,   -3,   -9,   -3,  -10,   -3,  -10,    0,   -9,   -3,  -10,   -3,  -10,    0,
+     -10,    0,  -10,    0,  -10,    0,  -10,    0,   -9,    2,  -10,    3,  -10,    1,   -9,    1,
+     -10,    4,   -9,    3,  -10,    4,   -8,    5,   -9,    5,   -8,    5,   -8,    6,   -8,    6,
+      -7,    7,   -6,    8,   -7,    8,   -6,    7,   -7,    8,   -6,    7,   -7,    8,   -6,    8,
+      -6,    8,   -5,    9,   -5,    8,   -5,    9,   -6,    8,   -5,    9,   -5,    8,   -6,    9,
+      -5,    8,   -5,    9,   -5,    8,   -5,    9,   -4,    9,   -5,    9,   -4,    9,   -5,    9,
+      -4,    9,   -5,    9,   -4,    9,   -5,    9,   -4,    8,   -5,    8,   -4,    9,   -5,    9,
+      -4,    9,   -4,    9,   -3,    9,   -5,    9,   -5,    9,   -2,    9,   -6,    8,   -3,    9,
+      -3,   10,   -6,    8,   -3,    9,   -4,    9,   -5,    8,   -2,   10,   -3,    9,   -2,   10,
+       0,   10,   -1,   10,   -1,   10,    0,   10,   -1,   10,    0,   10,   -1,   10,   -1,   10,
+       1,    8,    7,   -5,   -5,   -2,    5,   -8,    4,   -9,    2,  -10,    5,   -8,    5,   -9,
+       3,  -10,    3,   -9,    3,  -10,    4,   -9,    5,   -9,    4,   -9,    5,   -9,    4,   -9,
+       3,   -9,    3,  -10,    4,   -9,    5,   -9,    5,   -8,    2,  -10,    5,   -9,    5,   -8,
+       5,   -9,    2,  -10,    5,   -7,    3,  -10,    5,   -8,    4,   -9,    5,   -9,    4,   -9,
+       5,   -9,    5,   -9,    4,   -9,    5,   -9,    4,   -9,    5,   -8,    4,   -9,    5,   -9,
+       6,   -8,    5,   -9,    5,   -8,    6,   -9,    5,   -8,    5,   -9,    6,   -8,    5,   -9,
+       5,   -8,    6,   -9,    6,   -8,    6,   -8,    6,   -7,    7,   -7,    7,   -7,    8,   -7,
+       7,   -7,    7,   -7,    8,   -6,    9,   -5,    9,   -4,    9,   -4,    9,   -2,   10,   -2,
+       9,   -4,   10,    0,   10,   -1,   10,   -1,   10,    0,    9,    1,    9,    1,   10,    0,
+      10,    0,    9,    5,   10,    2,   10,    1,    9,    3,   10,    4,    9,    4,    9,    4,
+       9,    4,    9,    4,    9,    4,    8,    6,    9,    6,    8,    5,    7,    8,    6,    7,
+       7,    7,    7,    7,    7,    8,    7,    7,    5,    9,    4,    9,    5,    9,    1,    9,
+       2,   10,    4,    9,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,   -4,    9,   -1,   10,   -1,   10,   -4,    9,   -3,    9,   -2,   10,   -2,   10,
+      -5,    9,   -4,    9,   -4,    9,   -4,    9,   -6,    8,   -6,    8,    0,   10,    7,    7,
+       8,    6,    9,    3,   10,    3,    9,    3,    9,    4,    9,    5,    9,    4,    8,    6,
+       9,    6,    8,    6,    8,    5,    7,    7,    8,    7,    7,    7,    6,    8,    6,    8,
+       6,    8,    4,    9,    5,    9,    4,    9,    3,    9,    4,   10,    2,    9,    0,   10,
+       2,   10,    4,    9,    0,   10,    0,   10,    0,   10,   -2,   10,   -3,    9,   -1,   10,
+       0,   10,   -6,    9,    0,    9,   -3,   10,   -3,    9,   -5,    9,   -6,    8,   -2,   10,
+      -6,    8,   -6,    8,   -5,    8,   -8,    7,   -7,    7,   -7,    6,   -8,    7,   -7,    7,
+      -9,    5,   -9,    5,   -8,    5,  -10,    2,   -9,    3,  -10,    3,  -10,    3,   -9,    3,
+     -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -3,
+      -9,   -3,  -10,    0,  -10,   -1,   -9,   -5,  -10,   -1,  -10,   -1,   -9,   -3,   -9,   -3,
+     -10,   -1,   -9,   -4,   -9,   -4,  -10,   -1,   -9,   -4,   -9,   -2,   -9,   -4,  -10,   -4,
+      -9,   -4,  -10,   -1,   -8,   -5,  -10,   -3,   -9,   -3,  -10,   -3,   -9,   -3,   -9,   -5,
+      -9,   -4,  -10,   -2,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -5,   -9,   -4,
+      -9,   -4,   -9,   -4,   -9,   -4,   -9,   -5,   -9,   -4,  -10,   -4,   -9,   -4,   -7,   -7,
+      -9,   -4,   -9,   -4,   -9,   -5,   -9,   -5,   -8,   -5,   -9,   -5,   -8,   -5,   -8,   -6,
+      -9,   -6,   -8,   -6,   -8,   -6,   -6,   -6,    2,   -9,    9,   -4,    9,   -5,    9,   -4,
+       8,   -5,    8,   -5,    9,   -2,    9,   -6,    8,   -5,   10,   -2,    8,   -5,    9,   -4,
+       9,   -5,    9,   -4,    9,   -4,   10,   -2,    9,   -4,    9,   -5,    9,   -4,   10,   -3,
+       9,   -3,   10,   -4,    9,   -3,    9,   -3,   10,   -3,    9,   -3,   10,   -4,    9,   -3,
+      10,   -2,    9,   -1,    9,   -5,   10,    0,   10,   -3,    9,   -4,   10,   -1,    9,   -1,
+       9,   -5,   10,    0,    8,   -7,    5,   -8,   -4,   -9,   -7,   -7,   -9,   -2,  -10,    1,
+     -10,    1,  -10,    3,   -9,    3,  -10,    2,   -9,    1,   -9,    5,  -10,    0,  -10,    3,
+      -9,    4,  -10,    2,   -8,    4,  -10,    3,  -10,    1,   -8,    6,  -10,    3,   -9,    2,
+     -10,    3,   -9,    4,   -9,    4,   -9,    4,   -9,    4,  -10,    3,   -9,    3,   -8,    5,
+      -9,    4,  -10,    4,   -9,    3,   -9,    4,   -9,    5,   -9,    4,   -9,    5,   -9,    4,
+      -9,    5,   -8,    6,   -9,    2,   -8,    5,   -5,    9,   -6,    8,   -5,    9,   -6,    8,
+      -5,    8,   -6,    9,   -5,    8,   -6,    8,   -5,    9,   -6,    8,   -7,    7,   -8,    6,
+      -8,    6,   -8,    5,   -8,    6,   -8,    6,   -9,    6,   -8,    6,   -8,    5,   -8,    6,
+      -8,    6,   -8,    6,   -8,    6,   -9,    5,   -8,    6,   -7,    7,   -8,    6,   -8,    7,
+      -7,    6,   -8,    7,   -7,    6,   -8,    6,   -8,    7,   -7,    6,   -8,    7,   -8,    6,
+      -7,    7,   -7,    7,   -8,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,
+      -7,    7,   -7,    7,   -7,    7,   -7,    8,   -6,    7,   -7,    8,   -6,    8,   -6,    7,
+      -6,    9,   -6,    8,   -6,    8,   -5,    8,   -6,    8,   -6,    9,   -5,    8,   -4,    9,
+      -4,    9,   -5,    9,   -5,    8,   -4,    9,   -3,   10,   -3,    9,   -3,   10,   -3,    9,
+      -3,   10,   -2,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,    9,    2,    9,    2,   10,    4,    9,    3,   10,    3,    9,    5,    9,
+       5,    9,    5,    8,    6,    9,    6,    7,    7,    7,    7,    7,    7,    7,    8,    6,
+       9,    5,    8,    6,    9,    5,    9,    5,    9,    4,    9,    3,   10,    3,    9,    3,
+      10,    3,    9,    3,   10,    0,   10,    0,   10,    0,    9,    2,   10,    0,   10,   -1,
+      10,    0,   10,   -1,   10,    0,    8,   -6,   10,    0,   10,   -2,    9,   -3,   10,   -4,
+       9,   -3,    9,   -5,    9,   -5,    8,   -5,    9,   -4,    8,   -7,    8,   -6,    8,   -6,
+       7,   -7,    6,   -8,    7,   -7,    6,   -8,    7,   -7,    8,   -4,   10,    0,    7,    7,
+       6,    8,    6,    8,    7,    7,    7,    7,    7,    7,    7,    7,    8,    6,    8,    5,
+       9,    6,    9,    5,    8,    5,   10,    3,    9,    4,    9,    3,   10,    1,   10,    1,
+      10,    1,    9,    3,   10,   -1,   10,    0,   10,   -1,   10,    0,   10,    0,   10,   -1,
+       9,   -3,   10,   -3,   10,   -3,    9,   -3,   10,   -3,    9,   -3,    9,   -4,    9,   -5,
+       9,   -5,    8,   -5,    9,   -5,    8,   -5,    8,   -7,    8,   -6,    7,   -6,    8,   -7,
+       6,   -8,    6,   -8,    5,   -8,    6,   -9,    6,   -8,    5,   -9,    3,   -9,    3,   -9,
+       3,  -10,    3,   -9,    1,  -10,    1,  -10,    0,  -10,    1,  -10,    0,  -10,    0,  -10,
+      -2,   -9,    0,  -10,   -1,  -10,   -4,   -9,   -4,   -9,   -2,  -10,   -2,  -10,   -5,   -9,
+      -5,   -8,   -4,   -9,   -5,   -9,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -7,   -8,
+      -6,   -7,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -7,   -7,   -7,   -7,
+      -7,   -7,   -7,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,
+      -7,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -8,   -7,
+      -7,   -6,   -8,   -7,   -7,   -7,   -8,   -6,   -7,   -7,   -8,   -6,   -7,   -7,   -8,   -7,
+      -8,   -6,   -8,   -6,   -8,   -6,   -8,   -5,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,
+      -8,   -6,   -8,   -6,   -8,   -6,  -10,   -2,    0,   10,    0,   10,    0,   10,    0,   10,
+       1,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    1,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    3,    8,    0,   10,    0,   10,    0,   10,
+      -1,   10,    0,   10,    0,   10,   -1,   10,    0,   10,    0,   10,    0,   10,   -1,   10,
+       0,   10,    0,   10,   -1,   10,    0,   10,    0,   10,    0,   10,   -1,   10,    0,   10,
+      -3,    9,   -1,   10,   -2,   10,   -7,    7,   -8,    4,   -8,   -3,   -8,   -7,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    3,   -9,    0,  -10,    0,  -10,    0,  -10,    2,   -9,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -2,   -8,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,   -3,   -9,    0,  -10,   -6,   -7,   -2,   -9,
+      -2,  -10,   -2,  -10,   -2,  -10,   -2,  -10,   -7,   -6,   -9,   -4,   -9,   -4,   -9,   -5,
+      -9,   -4,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -4,  -10,   -5,   -9,   -4,
+      -9,   -4,   -9,   -4,   -9,   -4,  -10,   -2,   -9,   -3,   -9,   -4,  -10,   -4,   -9,   -4,
+      -9,   -4,   -9,   -3,  -10,   -3,  -10,   -2,   -9,   -5,   -9,   -2,   -9,   -3,  -10,   -3,
+      -9,   -4,   -9,   -3,  -10,   -4,  -10,    0,   -8,   -6,  -10,    0,   -9,   -4,   -9,   -3,
+     -10,   -2,  -10,   -2,   -8,   -6,   -7,   -6,   -2,   -9,    6,   -8,    7,   -5,   10,    1,
+      10,    1,   10,    1,    9,    5,   10,    0,    8,    4,   10,    4,   10,    0,    8,    6,
+      10,    1,    9,    4,    9,    4,    9,    1,    9,    4,   10,    2,    8,    5,   10,    3,
+      10,    3,    9,    2,    9,    5,    9,    4,    9,    4,   10,    3,    9,    3,   10,    4,
+       9,    3,    9,    4,    9,    5,    9,    4,    9,    3,    9,    4,    9,    5,    9,    3,
+       9,    4,    9,    4,    9,    5,    8,    6,    9,    0,   -1,  -10,   -6,   -8,   -3,   -9,
+      -4,   -8,   -4,   -9,   -5,   -9,   -5,   -9,   -4,   -8,   -5,   -9,   -3,   -9,   -3,   -9,
+      -5,   -9,   -5,   -8,   -4,   -9,   -3,   -9,   -6,   -8,   -2,   -9,   -5,   -9,   -4,   -9,
+      -4,   -9,   -5,   -9,   -4,   -9,   -5,   -9,   -4,   -9,   -3,  -10,   -3,   -9,   -6,   -8,
+      -3,   -9,   -4,  -10,   -4,   -8,   -5,   -9,   -3,   -9,   -3,  -10,   -7,   -7,   -3,  -10,
+      -3,   -9,   -4,  -10,   -4,   -8,   -5,   -9,   -5,   -9,   -4,   -9,   -6,   -8,   -6,   -8,
+      -6,   -9,   -5,   -8,   -7,   -7,   -7,   -7,   -7,   -8,   -6,   -7,   -7,   -7,   -7,   -8,
+      -7,   -6,   -9,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -5,   -9,   -4,
+     -10,   -4,   -9,   -4,   -9,   -4,   -9,   -4,  -10,   -3,  -10,    0,   -9,   -3,  -10,   -2,
+     -10,   -3,  -10,    0,  -10,    0,  -10,    0,   -8,    3,  -10,    0,   -9,    3,  -10,    2,
+     -10,    2,   -9,    5,   -9,    4,   -9,    4,   -8,    5,   -8,    6,   -8,    6,   -8,    6,
+      -8,    6,   -7,    7,   -7,    7,   -7,    8,   -6,    8,   -6,    8,   -6,    8,   -5,    8,
+      -4,    9,   -5,    9,   -3,    9,   -2,   10,   -4,    9,   -3,   10,    0,   10,    0,   10,
+      -1,    9,    1,    9,    0,   10,    0,   10,    0,   10,    3,    9,    3,   10,    3,    9,
+       1,   10,    5,    9,    4,    9,    2,    9,    4,   10,    6,    8,    5,    8,    6,    8,
+       5,    9,    5,    9,    2,    9,   -5,    8,   -8,    6,   -9,    5,  -10,    0,   -9,    3,
+     -10,    3,   -9,    3,   -9,    4,  -10,    4,   -9,    4,   -9,    4,   -9,    4,   -8,    6,
+      -8,    6,   -9,    5,   -8,    6,   -7,    7,   -7,    7,   -7,    7,   -6,    9,   -5,    8,
+      -6,    8,   -3,    9,   -5,    9,   -2,    9,   -4,    9,   -3,    9,    0,   10,   -1,   10,
+      -2,    9,   -2,   10,    0,   10,    3,   10,    2,    9,    1,   10,    0,   10,    4,    9,
+       2,    9,    2,   10,    4,    9,    3,   10,    5,    8,    5,    9,    5,    9,    7,    7,
+       7,    7,    7,    8,    6,    7,    7,    7,    8,    6,    8,    6,    9,    6,    8,    5,
+       9,    4,    9,    4,    9,    4,   10,    4,    9,    4,   10,    1,    9,    3,    9,    3,
+      10,    0,    9,    3,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,
+      10,   -1,    9,   -2,   10,    0,    9,   -5,    9,   -1,   10,   -1,   10,   -3,    9,   -4,
+       9,   -3,   10,   -3,    9,   -4,   10,   -3,    9,   -3,   10,   -4,    7,   -6,   10,   -2,
+       8,   -5,    9,   -5,    9,   -4,    9,   -5,    9,   -5,    9,   -2,    8,   -6,    9,   -3,
+       9,   -4,    9,   -4,    9,   -5,    9,   -5,    9,   -4,    9,   -5,    9,   -4,    8,   -4,
+       9,   -4,    9,   -4,    9,   -4,    8,   -4,    9,   -4,    9,   -5,    9,   -5,    9,   -4,
+       9,   -5,    9,   -4,    9,   -5,    8,   -5,   10,   -3,    9,   -4,    8,   -5,    8,   -5,
+       9,   -3,    9,   -3,    8,   -6,    9,   -3,    8,   -6,    8,   -3,    1,   -8,    0,  -10,
+       1,  -10,    1,  -10,    0,   -9,    1,  -10,    0,  -10,    1,  -10,    0,  -10,    1,  -10,
+       0,  -10,   -2,  -10,   -5,   -8,   -3,   -9,   -4,   -9,   -4,   -9,   -5,   -8,   -5,   -9,
+      -3,   -9,   -5,   -8,   -2,   -9,   -5,   -9,   -5,   -9,   -5,   -9,   -2,   -9,   -6,   -8,
+      -3,   -9,   -3,  -10,   -6,   -8,   -2,   -9,   -5,   -9,   -4,   -9,   -5,   -9,   -4,   -9,
+      -4,   -9,   -3,   -9,   -3,  -10,   -6,   -8,   -4,   -9,   -3,   -9,   -3,  -10,   -6,   -8,
+      -3,   -9,   -5,   -9,   -4,   -8,   -5,   -9,   -5,   -9,   -5,   -9,   -6,   -8,   -6,   -8,
+      -6,   -8,   -6,   -8,   -6,   -7,   -6,   -8,   -7,   -7,   -7,   -7,   -7,   -8,   -7,   -7,
+      -8,   -6,   -8,   -7,   -7,   -6,   -8,   -6,   -8,   -6,   -9,   -5,   -8,   -6,   -9,   -5,
+      -9,   -4,   -9,   -3,   -9,   -5,   -8,   -5,  -10,   -3,   -9,   -3,  -10,   -1,   -9,   -5,
+     -10,   -1,   -9,    0,  -10,   -1,   -9,   -3,  -10,    0,  -10,    0,  -10,    0,   -9,    3,
+     -10,    1,  -10,    1,  -10,    1,   -8,    5,  -10,    1,   -9,    3,  -10,    4,   -9,    5,
+      -8,    5,   -9,    5,   -8,    5,   -8,    6,   -7,    7,   -8,    7,   -7,    7,   -7,    6,
+      -8,    7,   -7,    7,   -5,    8,   -6,    9,   -6,    8,   -6,    8,   -4,    9,   -5,    9,
+      -4,    9,   -2,    9,   -4,    9,   -2,   10,   -3,    9,   -3,    9,    0,   10,   -3,    9,
+       0,   10,    0,   10,    0,   10,    0,   10,    3,    9,    0,   10,    3,   10,    3,    9,
+       0,   10,    6,    8,    0,   10,    4,    9,    4,    9,    5,    9,    4,   10,    4,    9,
+       5,    8,    1,    6,   -8,    4,   -9,    5,  -10,    3,   -9,    3,  -10,    3,   -8,    6,
+      -9,    2,   -9,    5,   -9,    5,   -8,    4,   -8,    6,   -8,    6,   -8,    6,   -7,    8,
+      -7,    7,   -7,    7,   -6,    8,   -7,    7,   -6,    8,   -5,    9,   -3,    9,   -6,    8,
+      -3,   10,   -2,    9,   -3,   10,   -3,    9,   -3,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    1,   10,    4,    9,    2,   10,    1,   10,
+       2,    9,    4,   10,    4,    9,    4,    9,    4,    9,    4,    9,    6,    9,    5,    8,
+       6,    8,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,    8,    6,    8,    6,
+       9,    6,    8,    5,    9,    4,    9,    5,    9,    4,    9,    5,   10,    2,    9,    2,
+      10,    3,    9,    4,   10,    0,    9,    3,   10,    3,   10,    0,   10,    0,   10,    0,
+       8,    3,   10,   -2,    9,   -1,   10,    0,   10,    0,   10,   -1,    9,   -3,   10,   -2,
+      10,    0,    9,   -4,   10,   -2,   10,   -2,    9,   -4,    9,   -3,    9,   -2,   10,   -3,
+       9,   -5,    9,   -4,    9,   -3,   10,   -3,    9,   -5,    8,   -4,    9,   -5,    9,   -5,
+       9,   -4,    9,   -3,    8,   -4,    8,   -6,    9,   -2,    9,   -5,    9,   -4,    9,   -5,
+       9,   -5,    9,   -4,    9,   -3,    8,   -3,    8,   -6,    9,   -3,    9,   -5,    9,   -4,
+       9,   -5,    8,   -5,    9,   -5,    9,   -4,    9,   -5,    5,   -4,   -9,    4,   -8,    6,
+      -9,    5,   -9,    5,   -9,    4,   -9,    5,   -8,    4,   -9,    5,   -9,    4,  -10,    4,
+      -8,    3,   -9,    6,   -9,    2,   -9,    5,   -9,    4,   -9,    5,   -8,    5,   -9,    4,
+      -9,    5,   -9,    3,   -8,    5,  -10,    2,   -9,    5,   -9,    4,   -9,    4,   -9,    5,
+      -9,    4,   -9,    4,   -9,    5,   -9,    4,  -10,    1,   -9,    4,   -9,    5,   -9,    1,
+     -10,    2,   -9,    4,  -10,    1,  -10,    0,   -9,    4,  -10,    2,  -10,    0,  -10,    0,
+     -10,    0,   -9,    3,   -9,   -2,   -9,   -1,  -10,    0,  -10,    0,  -10,   -1,   -9,   -4,
+     -10,   -1,  -10,   -2,   -9,   -4,   -9,   -1,   -9,   -5,   -9,   -4,  -10,   -2,   -8,   -6,
+      -9,   -5,   -8,   -5,   -9,   -6,   -8,   -5,   -8,   -5,   -8,   -7,   -7,   -7,   -7,   -7,
+      -7,   -7,   -7,   -7,   -6,   -8,   -6,   -8,   -6,   -9,   -5,   -8,   -4,   -9,   -4,   -9,
+      -4,   -9,   -4,  -10,   -4,   -9,   -1,  -10,   -1,  -10,   -4,   -9,   -2,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    2,   -9,    3,  -10,
+       3,   -9,    3,  -10,    3,   -9,    5,   -9,    5,   -8,    6,   -9,    5,   -8,    5,   -9,
+       6,   -8,    8,   -7,    7,   -7,    7,   -7,    7,   -6,    9,   -6,    8,   -6,    8,   -5,
+       8,   -6,    9,   -4,    9,   -5,    9,   -4,    9,   -3,    8,   -5,   10,   -3,   10,   -2,
+       9,   -4,    2,   -8,   -5,   -8,   -5,   -9,   -5,   -9,   -5,   -8,   -3,  -10,   -3,   -9,
+      -3,  -10,   -5,   -8,   -1,  -10,   -3,  -10,   -3,   -9,    0,  -10,   -3,   -9,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    1,  -10,    3,   -9,    2,  -10,    3,  -10,    3,   -9,
+       3,  -10,    2,   -9,    6,   -9,    5,   -9,    5,   -8,    5,   -9,    5,   -8,    7,   -7,
+       7,   -8,    7,   -7,    7,   -7,    6,   -8,    7,   -7,    8,   -7,    8,   -5,    8,   -6,
+       8,   -6,    9,   -5,    8,   -6,    9,   -3,    8,   -5,   10,   -3,    9,   -2,    9,   -5,
+      10,    0,   10,   -2,    9,   -2,   10,   -1,   10,    0,   10,    0,   10,    0,    9,    3,
+      10,    1,   10,    1,   10,    1,    8,    5,   10,    2,   10,    2,    9,    5,    9,    4,
+       9,    4,    9,    4,    8,    5,    9,    6,    8,    5,    9,    5,    8,    7,    7,    6,
+       8,    6,    8,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,    6,    8,
+       6,    8,    6,    8,    6,    8,    6,    8,    7,    8,    4,    9,    5,    8,    4,    9,
+       7,    8,    2,    9,    5,    9,    4,    9,    3,    9,    4,    9,    5,    9,    4,    9,
+       4,    9,    3,   10,    4,    9,    4,    9,    5,    9,    4,    9,    4,    9,    5,    9,
+       4,    9,    4,    9,    5,    9,    3,    9,    4,    8,    3,    9,    5,    9,    4,    9,
+       5,    9,    5,    9,    3,    9,    5,    8,    3,    9,    4,    9,    5,    9,    4,    9,
+       3,    9,    5,    4,    2,   -3,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,    0,  -10,   -1,  -10,
+      -2,   -9,    0,  -10,   -2,   -9,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -3,   -9,
+       0,  -10,   -3,   -9,   -1,  -10,    0,  -10,   -1,  -10,    0,  -10,   -1,   -9,   -2,  -10,
+      -4,   -9,   -1,  -10,    0,  -10,   -1,  -10,   -2,  -10,   -4,   -9,    0,  -10,   -1,  -10,
+      -4,   -9,   -1,  -10,   -1,  -10,   -4,   -9,   -3,   -9,    0,  -10,   -4,   -9,   -2,  -10,
+      -3,  -10,   -3,   -9,   -3,   -9,   -5,   -9,   -1,   -9,   -6,   -9,   -3,   -9,   -3,  -10,
+      -4,   -9,   -3,  -10,   -3,   -9,   -5,   -9,   -4,   -9,   -5,   -7,   -2,  -10,   -5,   -9,
+      -4,   -9,   -5,   -8,   -6,   -9,   -5,   -8,   -5,   -9,   -6,   -8,   -6,   -8,   -7,   -7,
+      -8,   -7,   -7,   -6,   -7,   -7,   -8,   -7,   -9,   -4,   -9,   -5,   -9,   -2,  -10,   -2,
+      -9,   -2,  -10,   -1,  -10,    0,  -10,    0,  -10,    0,  -10,    0,   -9,    2,  -10,    0,
+      -8,    4,  -10,    1,  -10,    1,  -10,    3,   -9,    3,   -9,   -4,   -7,   -6,   -8,   -7,
+      -6,   -7,   -3,   -9,    0,  -10,    1,  -10,    6,   -8,    7,   -7,    8,   -6,   10,   -2,
+      10,   -2,    9,   -4,    9,   -4,   10,   -1,   10,   -1,    9,   -1,   10,   -4,    9,   -1,
+      10,    0,   10,    0,   10,    0,   10,    0,   10,    1,   10,    3,    9,    2,   10,    1,
+      10,    2,    8,    5,   10,    2,    8,    5,    9,    3,    9,    6,    8,    6,    8,    5,
+       8,    6,    7,    7,    7,    7,    7,    8,    7,    7,    7,    7,    6,    8,    5,    8,
+       5,    9,    6,    8,    5,    9,    5,    8,    5,    9,    4,    9,    4,   10,    6,    8,
+       4,    8,    4,   10,    3,    9,    4,    9,    3,   10,    6,    7,    3,   10,    2,   10,
+       4,    9,    4,    9,    4,    9,    4,   10,    3,    9,    1,   10,    3,    9,    4,    9,
+       0,   10,    4,    9,    3,   10,    1,   10,    3,    9,    3,    9,    0,   10,    2,   10,
+       3,    9,    3,   10,    0,   10,    0,   10,    5,    9,    1,   10,    1,   10,    1,   10,
+       0,   10,    1,    9,    3,   10,    3,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       2,    9,    0,   10,    0,   10,    3,    8,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,   -3,    9,    0,   10,   -1,    9,   -1,   10,    0,   10,    0,   10,
+       0,   10,   -1,   10,   -4,    9,   -1,   10,    0,   -3,    2,   -9,    4,   -9,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    2,   -9,    0,  -10,    0,  -10,    3,   -9,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -3,   -9,    0,  -10,    0,   -9,
+      -2,   -9,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,   -3,  -10,   -2,  -10,   -1,  -10,
+       0,  -10,   -1,  -10,   -1,   -9,   -2,  -10,   -4,   -9,    0,  -10,    0,  -10,   -3,  -10,
+      -3,   -9,   -2,  -10,    0,  -10,   -4,   -9,   -3,   -9,   -1,  -10,   -2,  -10,   -4,   -9,
+       0,  -10,   -5,   -9,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -5,   -9,   -2,   -9,
+      -4,  -10,   -4,   -9,   -4,   -9,   -4,   -9,   -5,   -9,   -3,  -10,   -2,   -9,   -4,   -9,
+      -5,   -9,   -4,   -9,   -5,   -9,   -4,   -9,   -5,   -9,   -5,   -8,   -5,   -9,   -6,   -8,
+      -5,   -9,   -5,   -8,   -7,   -8,   -6,   -7,   -7,   -8,   -7,   -7,   -7,   -7,   -8,   -7,
+      -8,   -5,   -8,   -6,   -8,   -6,   -9,   -4,   -9,   -3,   -9,   -4,   -9,   -4,  -10,   -4,
+     -10,   -1,  -10,   -1,   -9,   -3,   -9,   -3,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,    0,  -10,    2,   -9,    4,  -10,    1,  -10,    1,  -10,    0,   -8,    6,  -10,    0,
+      -9,    5,  -10,    2,   -8,    4,   -7,    8,   -5,    8,    0,   10,    0,   10,    3,    9,
+       6,    8,    6,    8,    8,    5,   10,    3,    9,   -3,    9,   -3,   10,   -1,   10,   -2,
+      10,   -1,   10,   -1,    9,   -3,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,
+       9,    3,   10,    3,    9,    3,   10,    4,    8,    5,    8,    6,    7,    7,    7,    8,
+       7,    7,    7,    7,    6,    8,    6,    8,    5,    8,    6,    9,    4,    8,    5,    9,
+       5,    9,    4,    9,    5,    9,    3,    9,    5,    8,    4,    9,    2,   10,    5,    9,
+       5,    8,    2,   10,    4,    9,    3,    9,    3,   10,    4,    8,    2,   10,    5,    9,
+       1,   10,    4,    9,    3,    9,    0,   10,    4,    9,    3,   10,    1,   10,    2,    9,
+       4,    9,    0,   10,    1,   10,    4,    9,    1,   10,    1,   10,    1,   10,    1,   10,
+       4,    9,    1,   10,    1,   10,    0,   10,    1,   10,    0,   10,    2,    9,    2,   10,
+       0,    9,    3,    9,    0,   10,    0,   10,    0,   10,    0,   10,    2,    9,    0,   10,
+       3,    9,    0,   10,    1,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    1,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    1,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+};
+
+const halo_path_t clover_path = { clover_path_data, 3223, -515, 956 };
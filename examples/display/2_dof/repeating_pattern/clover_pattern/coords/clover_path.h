@@ -0,0 +1,9 @@
+#ifndef CLOVER_PATH_H
+#define CLOVER_PATH_H
+
+#include "halo_path.h"
+
+// Delta-encoded clover outline, 0.01 cm fixed point
+extern const halo_path_t clover_path;
+
+#endif // CLOVER_PATH_H
@@ -0,0 +1,750 @@
+"""
+@file    halo_pattern.py
+@brief   Shared build-time stages for the repeating pattern generators.
+
+@author  Adithya
+@date    2026-10-17
+
+@details
+- Mirrors the firmware arm model (L1, L2, elbow-down IK, 0-180 deg servos)
+- Fits a pattern into the workspace: the largest scale and the placement
+  that keep every point reachable inside the servo window, and rejects
+  tables with any point outside it
+- Orders contours to shorten the travel between them (nearest neighbour
+  + 2-opt), reversing open contours and re-entering closed ones anywhere
+- Simplifies contour polylines to a deviation tolerance (Douglas-Peucker)
+- Resamples the outline by arc length, so a player that emits one point
+  per servo period moves the tool at constant speed
+- Plans the elbow branch of every path point for the least joint travel
+  (dynamic programming over the loop) inside the joint limits
+- Pre-solves a coordinate path into PWM duty pairs for the trajectory player
+- Decimates the path into coarser levels of detail for faster playback,
+  keeping points where the outline bends
+- Encodes coordinate paths in the compact halo_path format (lib/halo_path)
+- Fits cubic Bezier segments to the outline to a tolerance and emits them
+  in the halo_curve format (lib/halo_curve)
+- Emits C tables as const data so they are placed in flash
+"""
+
+import os
+import numpy as np
+
+# --- Arm model (must match the firmware) ---
+L1 = 10.0
+L2 = 10.0
+SERVO_MIN_US = 1000
+SERVO_MAX_US = 2000
+SERVO_RANGE_DEG = 180.0
+SERVO_PERIOD_S = 0.02           # one point per PWM period (halo_traj_stream)
+SERVO_MAX_SPEED_DEG_S = 600.0   # HALO_PROFILE_SERVO_LIMITS v_max
+JOINT_LIMITS_DEG = ((0.0, SERVO_RANGE_DEG),   # shoulder, as angle_to_duty_us()
+                    (0.0, SERVO_RANGE_DEG))   # elbow
+
+# --- halo_path format (must match lib/halo_path/halo_path.h) ---
+PATH_UNITS_PER_CM = 100
+PATH_ESCAPE = -128
+
+# --- halo_curve format (must match lib/halo_curve/halo_curve.h) ---
+CURVE_UNITS_PER_CM = 100
+
+
+def contour_runs(contours):
+    """Splits OpenCV contours into a list of float (N, 2) pixel polylines."""
+    return [c.reshape(-1, 2).astype(np.float64) for c in contours if len(c) > 0]
+
+
+def _oriented(run, closed, entry, rev):
+    """The run as drawn: closed runs start and end at entry, open ones may be reversed."""
+    if closed:
+        r = np.roll(run, -entry, axis=0)
+        if rev:
+            r = np.concatenate([r[:1], r[:0:-1]])
+        return np.concatenate([r, r[:1]])
+    return run[::-1] if rev else run
+
+
+def _travel(ends):
+    """Looping travel over [(entry, exit), ...]: exit of each to entry of the next."""
+    return sum(float(np.linalg.norm(ends[k - 1][1] - ends[k][0])) for k in range(len(ends)))
+
+
+def order_runs(runs, closed_tol):
+    """
+    Orders runs to shorten the non-drawing travel between them: nearest
+    neighbour from the first run, then 2-opt over the sequence. Open runs
+    may be reversed; closed runs (ends within closed_tol) are entered at
+    the point nearest their neighbours and drawn all the way round. The
+    pattern loops, so travel includes the jump back to the start.
+    Returns (ordered runs, travel before, travel after).
+    """
+    n = len(runs)
+    closed = [len(r) > 2 and np.linalg.norm(r[0] - r[-1]) <= closed_tol for r in runs]
+    before = _travel([(r[0], r[-1]) for r in runs])
+    if n < 2:
+        return list(runs), before, before
+
+    # Nearest neighbour: each step enters the closest unvisited run
+    seq = [[0, 0, False]]                   # [run, entry index, reversed]
+    pos = runs[0][-1] if not closed[0] else runs[0][0]
+    left = set(range(1, n))
+    while left:
+        best = None
+        for k in left:
+            if closed[k]:
+                d = np.linalg.norm(runs[k] - pos, axis=1)
+                e = int(np.argmin(d))
+                cand = (float(d[e]), k, e, False)
+            else:
+                d0 = float(np.linalg.norm(runs[k][0] - pos))
+                d1 = float(np.linalg.norm(runs[k][-1] - pos))
+                cand = (d0, k, 0, False) if d0 <= d1 else (d1, k, 0, True)
+            if best is None or cand[0] < best[0]:
+                best = cand
+        _, k, e, rev = best
+        seq.append([k, e, rev])
+        left.remove(k)
+        pos = runs[k][e] if closed[k] else (runs[k][0] if rev else runs[k][-1])
+
+    def ends(item):
+        k, e, rev = item
+        if closed[k]:
+            return runs[k][e], runs[k][e]
+        return (runs[k][-1], runs[k][0]) if rev else (runs[k][0], runs[k][-1])
+
+    def dist(a, b):
+        return float(np.linalg.norm(a - b))
+
+    # 2-opt: reverse seq[i..j] (each run flips direction) while it pays off
+    improved = True
+    while improved:
+        improved = False
+        for i in range(1, n - 1):
+            for j in range(i + 1, n):
+                prev_exit = ends(seq[i - 1])[1]
+                next_entry = ends(seq[(j + 1) % n])[0]
+                ei, xj = ends(seq[i])[0], ends(seq[j])[1]
+                delta = (dist(prev_exit, xj) + dist(ei, next_entry)
+                         - dist(prev_exit, ei) - dist(xj, next_entry))
+                if delta < -1e-9:
+                    seq[i:j + 1] = [[k, e, not rev] for k, e, rev in reversed(seq[i:j + 1])]
+                    improved = True
+
+    # Closed runs: re-pick the entry between their final neighbours
+    for _ in range(2):
+        for p in range(n):
+            k = seq[p][0]
+            if closed[k]:
+                a = ends(seq[p - 1])[1]
+                b = ends(seq[(p + 1) % n])[0]
+                cost = np.linalg.norm(runs[k] - a, axis=1) + np.linalg.norm(runs[k] - b, axis=1)
+                seq[p][1] = int(np.argmin(cost))
+
+    after = _travel([ends(item) for item in seq])
+    return [_oriented(runs[k], closed[k], e, rev) for k, e, rev in seq], before, after
+
+
+def _segment_distance(pts, a, b):
+    """Distance of each point in pts (N, 2) from the segment a-b."""
+    ab = b - a
+    den = float(ab @ ab)
+    if den == 0.0:
+        return np.linalg.norm(pts - a, axis=1)
+    t = np.clip(((pts - a) @ ab) / den, 0.0, 1.0)
+    return np.linalg.norm(pts - (a + t[:, None] * ab), axis=1)
+
+
+def simplify_dp(xy, tol):
+    """
+    Douglas-Peucker on an open polyline: keeps the fewest vertices such that
+    every input point lies within tol of the simplified polyline.
+    Returns (kept indices, max deviation).
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    n = len(xy)
+    if n <= 2:
+        return np.arange(n), 0.0
+
+    keep = np.zeros(n, dtype=bool)
+    keep[0] = keep[-1] = True
+    max_dev = 0.0
+    stack = [(0, n - 1)]
+    while stack:
+        i, j = stack.pop()
+        if j - i < 2:
+            continue
+        d = _segment_distance(xy[i + 1:j], xy[i], xy[j])
+        k = int(np.argmax(d))
+        if d[k] > tol:
+            keep[i + 1 + k] = True
+            stack += [(i, i + 1 + k), (i + 1 + k, j)]
+        else:
+            max_dev = max(max_dev, float(d[k]))
+
+    return np.flatnonzero(keep), max_dev
+
+
+def simplify_runs(runs, tol):
+    """Simplifies each run to tol. Returns (list of runs, max deviation)."""
+    out = []
+    max_dev = 0.0
+    for run in runs:
+        idx, dev = simplify_dp(run, tol)
+        out.append(run[idx])
+        max_dev = max(max_dev, dev)
+    return out, max_dev
+
+
+def resample_arc_length(xy, spacing):
+    """
+    Resamples a polyline to points equally spaced along its length. The step
+    is the largest <= spacing that divides the length exactly, so the first
+    and last points are kept.
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    seg = np.linalg.norm(np.diff(xy, axis=0), axis=1)
+    s = np.concatenate([[0.0], np.cumsum(seg)])
+    n = max(1, int(np.ceil(s[-1] / spacing)))
+    t = np.linspace(0.0, s[-1], n + 1)
+    return np.stack([np.interp(t, s, xy[:, 0]), np.interp(t, s, xy[:, 1])], axis=1)
+
+
+def polyline_deviation(pts, poly, chunk=1024):
+    """Max distance of pts (N, 2) from the polyline poly (M, 2)."""
+    pts = np.asarray(pts, dtype=np.float64)
+    a = poly[:-1][None, :, :]
+    ab = np.diff(poly, axis=0)[None, :, :]
+    den = np.maximum(np.sum(ab * ab, axis=2), 1e-24)
+    max_dev = 0.0
+    for i in range(0, len(pts), chunk):
+        p = pts[i:i + chunk][:, None, :]
+        t = np.clip(np.sum((p - a) * ab, axis=2) / den, 0.0, 1.0)
+        d = np.linalg.norm(p - (a + t[:, :, None] * ab), axis=2)
+        max_dev = max(max_dev, float(np.max(np.min(d, axis=1))))
+    return max_dev
+
+
+def max_joint_speed(xy, period_s=SERVO_PERIOD_S, elbow_up=False):
+    """Peak joint speed (deg/s) when xy is played one point per period."""
+    theta, _ = solve_ik(np.asarray(xy, dtype=np.float64), elbow_up)
+    step = np.abs(np.diff(np.unwrap(np.radians(theta), axis=0), axis=0))
+    return float(np.degrees(np.max(step))) / period_s
+
+
+def _bezier(ctrl, t):
+    """Points of the cubic ctrl (4, 2) at parameters t (N,)."""
+    t = t[:, None]
+    mt = 1.0 - t
+    return (mt ** 3 * ctrl[0] + 3 * mt * mt * t * ctrl[1]
+            + 3 * mt * t * t * ctrl[2] + t ** 3 * ctrl[3])
+
+
+def _fit_one(pts, u, t0, t1):
+    """Least-squares cubic through pts[0], pts[-1] with fixed end tangents."""
+    p0, p3 = pts[0], pts[-1]
+    b = np.stack([3 * (1 - u) ** 2 * u, 3 * (1 - u) * u * u], axis=1)
+    a1 = b[:, :1] * t0
+    a2 = b[:, 1:] * t1
+    c = np.array([[np.sum(a1 * a1), np.sum(a1 * a2)],
+                  [np.sum(a1 * a2), np.sum(a2 * a2)]])
+    rest = pts - _bezier(np.array([p0, p0, p3, p3]), u)
+    x = np.array([np.sum(a1 * rest), np.sum(a2 * rest)])
+
+    chord = float(np.linalg.norm(p3 - p0))
+    det = np.linalg.det(c)
+    alpha = np.linalg.solve(c, x) if abs(det) > 1e-12 else np.zeros(2)
+    if alpha[0] < 1e-3 * chord or alpha[1] < 1e-3 * chord:
+        alpha = np.array([chord / 3.0, chord / 3.0])   # fall back to a flat curve
+    return np.array([p0, p0 + alpha[0] * t0, p3 + alpha[1] * t1, p3])
+
+
+def _reparameterize(ctrl, pts, u):
+    """One Newton step of every u towards the closest point on the curve."""
+    d1 = 3 * np.diff(ctrl, axis=0)
+    d2 = 2 * np.diff(d1, axis=0)
+    q = _bezier(ctrl, u) - pts
+    tu = u[:, None]
+    q1 = (1 - tu) ** 2 * d1[0] + 2 * (1 - tu) * tu * d1[1] + tu * tu * d1[2]
+    q2 = (1 - tu) * d2[0] + tu * d2[1]
+    num = np.sum(q * q1, axis=1)
+    den = np.sum(q1 * q1, axis=1) + np.sum(q * q2, axis=1)
+    step = np.where(np.abs(den) > 1e-12, num / np.where(den == 0, 1, den), 0.0)
+    return np.clip(u - step, 0.0, 1.0)
+
+
+def _unit(v):
+    n = float(np.linalg.norm(v))
+    return v / n if n > 0 else v
+
+
+def fit_cubics(pts, tol, reach=4):
+    """
+    Fits a chain of cubic Beziers to a polyline so that every point lies
+    within tol of the curve (least squares with end tangents, Newton
+    reparameterisation, split at the worst point). Tangents are taken
+    reach points away, which smooths pixel staircases.
+    Returns a list of (4, 2) control arrays.
+    """
+    pts = np.asarray(pts, dtype=np.float64)
+
+    def tangent(i, direction):
+        j = int(np.clip(i + direction * reach, 0, len(pts) - 1))
+        return _unit(pts[j] - pts[i])
+
+    def fit(lo, hi, t0, t1):
+        seg = pts[lo:hi + 1]
+        if len(seg) <= 3 or np.linalg.norm(seg[-1] - seg[0]) == 0.0 and len(seg) <= 4:
+            chord = seg[-1] - seg[0]
+            return [np.array([seg[0], seg[0] + chord / 3, seg[0] + 2 * chord / 3, seg[-1]])]
+
+        d = np.concatenate([[0.0], np.cumsum(np.linalg.norm(np.diff(seg, axis=0), axis=1))])
+        u = d / d[-1] if d[-1] > 0 else np.linspace(0.0, 1.0, len(seg))
+
+        for _ in range(8):
+            ctrl = _fit_one(seg, u, t0, t1)
+            err = np.linalg.norm(_bezier(ctrl, u) - seg, axis=1)
+            if float(np.max(err)) <= tol:
+                return [ctrl]
+            if float(np.max(err)) > 4 * tol:
+                break
+            u = _reparameterize(ctrl, seg, u)
+
+        k = int(np.argmax(err[1:-1])) + 1
+        mid = _unit(seg[k - 1] - seg[k + 1]) if k + 1 < len(seg) else -t1
+        return fit(lo, lo + k, t0, mid) + fit(lo + k, hi, -mid, t1)
+
+    return fit(0, len(pts) - 1, tangent(0, 1), tangent(len(pts) - 1, -1))
+
+
+def curve_chain(runs, tol):
+    """
+    Fits every run and joins them into one continuous chain; the travel
+    between runs becomes a straight cubic. Returns a list of (4, 2) controls.
+    """
+    chain = []
+    for run in runs:
+        if chain and np.linalg.norm(chain[-1][3] - run[0]) > 0.0:
+            a, b = chain[-1][3], run[0]
+            chain.append(np.array([a, a + (b - a) / 3, a + 2 * (b - a) / 3, b]))
+        chain += fit_cubics(run, tol)
+    return chain
+
+
+def sample_chain(chain, per_segment=32):
+    """Dense polyline through a chain, for deviation checks and plots."""
+    t = np.linspace(0.0, 1.0, per_segment + 1)
+    return np.concatenate([chain[0][:1]] + [_bezier(c, t)[1:] for c in chain])
+
+
+def plan_curve_branches(chain, per_segment=32):
+    """
+    plan_branches() over a chain sampled per_segment times per segment,
+    flipping only between segments, since the firmware evaluates the points
+    at a run-time spacing. The start point belongs to segment 0. Returns
+    (elbow_up[segments] bool, travel_deg).
+    """
+    pts = sample_chain(chain, per_segment)
+    seg = np.concatenate([[0], np.repeat(np.arange(len(chain)), per_segment)])
+    _, elbow_up, travel = plan_branches(pts, groups=seg)
+    return elbow_up[np.searchsorted(seg, np.arange(len(chain)))], travel
+
+
+def write_curve_table(out_dir, name, chain, elbow_up):
+    """
+    Writes <name>_curve.c / <name>_curve.h as a const halo_curve_t: the start
+    point, then { x1, y1, x2, y2, x3, y3 } per segment in 0.01 cm (each
+    segment starts where the previous one ends), and the elbow branch of
+    each segment stored as the segment indices where it flips. Returns
+    bytes used.
+    """
+    q = [np.round(np.asarray(c) * CURVE_UNITS_PER_CM).astype(np.int64) for c in chain]
+    if any(np.any(np.abs(c) > 32767) for c in q):
+        raise ValueError("curve does not fit in int16 0.01 cm units")
+    guard = f"{name.upper()}_CURVE_H"
+    flips = np.flatnonzero(np.diff(np.asarray(elbow_up, dtype=np.int64))) + 1
+
+    with open(os.path.join(out_dir, f"{name}_curve.h"), "w") as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("#include \"halo_curve.h\"\n\n")
+        f.write(f"// Cubic Bezier {name} outline, 0.01 cm fixed point\n")
+        f.write(f"extern const halo_curve_t {name}_curve;\n\n")
+        f.write(f"// Elbow branch (HALO_ELBOW_DOWN/UP) from segment 0, flipped at each\n")
+        f.write(f"// segment index in {name}_curve_elbow_flips; the list ends with the\n")
+        f.write(f"// segment count\n")
+        f.write(f"#define {name.upper()}_CURVE_ELBOW_START {int(elbow_up[0])}\n")
+        f.write(f"extern const unsigned short {name}_curve_elbow_flips[];\n\n")
+        f.write(f"#endif // {guard}\n")
+
+    with open(os.path.join(out_dir, f"{name}_curve.c"), "w") as f:
+        f.write(f"#include \"{name}_curve.h\"\n\n")
+        f.write("// ----------------------------\n")
+        f.write(f"// Generated {name} curve (do not edit)\n")
+        f.write("// ----------------------------\n\n")
+        f.write(f"static const short {name}_curve_ctrl[][6] = {{\n")
+        for c in q:
+            f.write("    { " + ", ".join(f"{int(v):6d}" for v in c[1:].reshape(-1)) + " },\n")
+        f.write("};\n\n")
+        f.write(f"const halo_curve_t {name}_curve = {{ {name}_curve_ctrl, {len(q)}, "
+                f"{int(q[0][0][0])}, {int(q[0][0][1])} }};\n\n")
+        f.write(f"const unsigned short {name}_curve_elbow_flips[] = {{ "
+                + "".join(f"{int(i)}, " for i in flips) + f"{len(q)} }};\n")
+
+    return len(q) * 12 + 8 + (len(flips) + 1) * 2
+
+
+def decimate_lod(xy, factor, tol):
+    """
+    Keeps about every factor-th point of xy, but shortens a step wherever
+    the chord would pass further than tol from the points it skips, so
+    tight curves keep their density. Returns the kept indices; the first
+    and last points are always kept.
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    keep = [0]
+    i = 0
+    while i < len(xy) - 1:
+        j = min(i + factor, len(xy) - 1)
+        while j > i + 1 and np.max(_segment_distance(xy[i + 1:j], xy[i], xy[j])) > tol:
+            j -= 1
+        keep.append(j)
+        i = j
+    return np.array(keep)
+
+
+def mean_spacing(xy):
+    """Mean distance between consecutive points of xy."""
+    return float(np.mean(np.linalg.norm(np.diff(xy, axis=0), axis=1)))
+
+
+def angle_to_duty_us(angle_deg):
+    """Same mapping and truncation as angle_to_duty_us() in the firmware."""
+    a = np.clip(angle_deg, 0.0, SERVO_RANGE_DEG)
+    return SERVO_MIN_US + ((a * (SERVO_MAX_US - SERVO_MIN_US)) / SERVO_RANGE_DEG).astype(np.int64)
+
+
+def solve_ik(xy, elbow_up=False):
+    """Vectorised closed-form IK. Returns (theta_deg[N,2], reachable[N])."""
+    x = xy[:, 0]
+    y = xy[:, 1]
+    r2 = x * x + y * y
+    reachable = (r2 <= (L1 + L2) ** 2) & (r2 >= (L1 - L2) ** 2)
+
+    c2 = np.clip((r2 - L1 * L1 - L2 * L2) / (2.0 * L1 * L2), -1.0, 1.0)
+    ang2 = np.arccos(c2)
+    if elbow_up:
+        ang2 = -ang2
+    ang1 = np.arctan2(y, x) - np.arctan2(L2 * np.sin(ang2), L1 + L2 * c2)
+
+    return np.degrees(np.stack([ang1, ang2], axis=1)), reachable
+
+
+def workspace_slack(xy, elbow_up=False):
+    """
+    Per-point distance (deg) of the joints from the servo window; negative
+    outside it. Points out of reach score below any reachable point, in
+    proportion to how far out they are, so a search can walk them back in.
+    The shoulder angle comes from atan2, which wraps on the negative x axis
+    (just below it the firmware sees a shoulder angle near -180), so the
+    angle from that axis counts as slack too.
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    theta, _ = solve_ik(xy, elbow_up)
+    slack = np.min(np.minimum(theta, SERVO_RANGE_DEG - theta), axis=1)
+    polar = np.degrees(np.arctan2(xy[:, 1], xy[:, 0]))
+    slack = np.minimum(slack, np.where(polar >= 0.0, 180.0 - polar, polar))
+    r = np.linalg.norm(xy, axis=1)
+    out = np.maximum(r - (L1 + L2), 0.0) + np.maximum(abs(L1 - L2) - r, 0.0)
+    return slack - SERVO_RANGE_DEG * out
+
+
+def _best_offset(pts, scale, elbow_up, grid, start=None):
+    """
+    Offset that maximises the worst slack of pts * scale + offset: best
+    cell of grid, or start if given, then a compass search.
+    """
+    if start is None:
+        best, offset = -np.inf, None
+        for ox in grid:
+            for oy in grid:
+                v = np.min(workspace_slack(pts * scale + [ox, oy], elbow_up))
+                if v > best:
+                    best, offset = v, np.array([ox, oy])
+    else:
+        offset = np.asarray(start, dtype=np.float64)
+        best = np.min(workspace_slack(pts * scale + offset, elbow_up))
+
+    step = grid[1] - grid[0]
+    while step > 1e-3:
+        moved = False
+        for d in ((1, 0), (-1, 0), (0, 1), (0, -1)):
+            o = offset + step * np.array(d)
+            v = np.min(workspace_slack(pts * scale + o, elbow_up))
+            if v > best:
+                best, offset, moved = v, o, True
+        if not moved:
+            step *= 0.5
+    return best, offset
+
+
+def fit_workspace(xy, margin_deg, elbow_up=False, samples=400):
+    """
+    Largest scale, and the offset for it, such that xy * scale + offset
+    keeps every joint at least margin_deg inside the servo window. The
+    search runs on about `samples` points of xy, then the scale is refined
+    against every point; validate_workspace() checks the final tables.
+    Returns (scale, offset[2]).
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    pts = xy[::max(1, len(xy) // samples)]
+    grid = np.arange(-(L1 + L2), L1 + L2 + 1e-9, 1.0)
+
+    lo, hi = 0.0, 2.0 * (L1 + L2) / max(float(np.max(np.ptp(pts, axis=0))), 1e-9)
+    offset = None
+    for _ in range(24):
+        scale = 0.5 * (lo + hi)
+        v, o = _best_offset(pts, scale, elbow_up, grid)
+        if v >= margin_deg:
+            lo, offset = scale, o
+        else:
+            hi = scale
+    if offset is None:
+        raise ValueError(f"pattern does not fit the workspace with {margin_deg} deg margin")
+
+    # Points the sampling skipped may bind first: shrink until all fit
+    v, o = _best_offset(xy, lo, elbow_up, grid, offset)
+    if v < margin_deg:
+        hi = lo
+        lo *= 0.8
+        for _ in range(12):
+            scale = 0.5 * (lo + hi)
+            v, o = _best_offset(xy, scale, elbow_up, grid, offset)
+            if v >= margin_deg:
+                lo, offset = scale, o
+            else:
+                hi = scale
+    else:
+        offset = o
+    return lo, offset
+
+
+def validate_workspace(xy, what, elbow_up=False):
+    """Raises ValueError if any point of xy is unreachable or outside the servo window."""
+    slack = workspace_slack(xy, elbow_up)
+    bad = np.flatnonzero(slack < 0.0)
+    if len(bad):
+        raise ValueError(f"{what}: {len(bad)} of {len(slack)} points outside the workspace "
+                         f"(first at index {bad[0]}, {np.asarray(xy)[bad[0]].round(2).tolist()})")
+    return float(np.min(slack))
+
+
+def _branch_candidates(xy):
+    """Both IK branches per point: (theta_deg[N, 2 branches, 2], valid[N, 2])."""
+    down, reachable = solve_ik(xy, False)
+    up, _ = solve_ik(xy, True)
+    theta = np.stack([down, up], axis=1)
+    lo = np.array([lim[0] for lim in JOINT_LIMITS_DEG])
+    hi = np.array([lim[1] for lim in JOINT_LIMITS_DEG])
+    valid = reachable[:, None] & np.all((theta >= lo) & (theta <= hi), axis=2)
+    return theta, valid
+
+
+def _travel_deg(a, b):
+    """Joint travel |d theta1| + |d theta2| between every branch of a and of b (2, 2)."""
+    return np.sum(np.abs(a[:, None, :] - b[None, :, :]), axis=2)
+
+
+def plan_branches(xy, closed=True, groups=None):
+    """
+    Chooses elbow-down or elbow-up for every point of a path so that the
+    total joint travel (sum of |d theta1| + |d theta2| between points) is
+    the least possible, using only solutions inside JOINT_LIMITS_DEG. A
+    branch flip is a large swing of both joints, so the plan only flips
+    where a branch runs out. With closed=True the move from the last point
+    back to the first counts too, since the patterns loop. With groups
+    (one id per point), the branch only flips where the id changes.
+
+    Returns (theta_deg[N, 2], elbow_up[N] bool, travel_deg). Raises
+    ValueError if a point has no solution on either branch.
+    """
+    xy = np.asarray(xy, dtype=np.float64)
+    theta, valid = _branch_candidates(xy)
+    bad = np.flatnonzero(~np.any(valid, axis=1))
+    if len(bad):
+        raise ValueError(f"{len(bad)} of {len(xy)} points have no IK solution inside the "
+                         f"joint limits (first at index {bad[0]}, {xy[bad[0]].round(2).tolist()})")
+
+    # A loop must end where it started: one pass per start branch
+    starts = [k for k in range(2) if valid[0, k]] if closed else [None]
+    best, plan = np.inf, None
+    for start in starts:
+        cost = np.where(valid[0], 0.0, np.inf)
+        if start is not None:
+            cost[1 - start] = np.inf
+        back = np.zeros((len(xy), 2), dtype=np.int64)
+        for i in range(1, len(xy)):
+            c = cost[:, None] + _travel_deg(theta[i - 1], theta[i])
+            if groups is not None and groups[i] == groups[i - 1]:
+                c[[0, 1], [1, 0]] = np.inf
+            back[i] = np.argmin(c, axis=0)
+            cost = np.where(valid[i], c[back[i], [0, 1]], np.inf)
+        if start is not None:
+            cost = cost + _travel_deg(theta[-1], theta[0])[:, start]
+
+        k = int(np.argmin(cost))
+        if cost[k] < best:
+            best = float(cost[k])
+            plan = np.zeros(len(xy), dtype=np.int64)
+            plan[-1] = k
+            for i in range(len(xy) - 1, 0, -1):
+                plan[i - 1] = back[i][plan[i]]
+
+    return theta[np.arange(len(xy)), plan], plan.astype(bool), best
+
+
+def greedy_branch_travel(xy, closed=True):
+    """
+    Joint travel of the per-point choice computeIK() makes: elbow-down if
+    it fits the joint limits, else elbow-up. For comparison with
+    plan_branches(). Returns (travel_deg, flips).
+    """
+    theta, valid = _branch_candidates(np.asarray(xy, dtype=np.float64))
+    pick = np.where(valid[:, 0], 0, 1)
+    t = theta[np.arange(len(theta)), pick]
+    if closed:
+        t = np.concatenate([t, t[:1]])
+        pick = np.concatenate([pick, pick[:1]])
+    return float(np.sum(np.abs(np.diff(t, axis=0)))), int(np.count_nonzero(np.diff(pick)))
+
+
+def solve_duty_table(xy):
+    """
+    Pre-solves a looping path into { shoulder, elbow } duty pairs on the
+    branches chosen by plan_branches(). Returns (duty[N,2] uint16,
+    elbow_up[N] bool, joint travel per loop in degrees).
+    """
+    theta, elbow_up, travel = plan_branches(xy)
+    return angle_to_duty_us(theta).astype(np.uint16), elbow_up, travel
+
+
+def write_duty_table(out_dir, name, duty, elbow_up):
+    """
+    Writes <name>_duty.c / <name>_duty.h with a const uint16 duty table and
+    the elbow branch of each pair, stored as the indices where it flips.
+    """
+    guard = f"{name.upper()}_DUTY_H"
+    count = f"{name.upper()}_DUTY_POINTS"
+    flips = np.flatnonzero(np.diff(elbow_up.astype(np.int64))) + 1
+
+    with open(os.path.join(out_dir, f"{name}_duty.h"), "w") as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write(f"// Pre-solved {{ shoulder, elbow }} PWM duty pairs in microseconds\n")
+        f.write(f"extern const unsigned short {name}_duty[][2];\n")
+        f.write(f"extern const int {count};\n\n")
+        f.write(f"// Elbow branch (HALO_ELBOW_DOWN/UP) from pair 0, flipped at each index\n")
+        f.write(f"// in {name}_elbow_flips; the list ends with {count}\n")
+        f.write(f"#define {name.upper()}_ELBOW_START {int(elbow_up[0])}\n")
+        f.write(f"extern const unsigned short {name}_elbow_flips[];\n\n")
+        f.write(f"#endif // {guard}\n")
+
+    with open(os.path.join(out_dir, f"{name}_duty.c"), "w") as f:
+        f.write(f"#include \"{name}_duty.h\"\n\n")
+        f.write("// ----------------------------\n")
+        f.write(f"// Generated {name} duty table (do not edit)\n")
+        f.write("// ----------------------------\n\n")
+        f.write(f"const unsigned short {name}_duty[][2] = {{\n")
+        for (d1, d2) in duty:
+            f.write(f"    {{ {d1}, {d2} }},\n")
+        f.write("};\n\n")
+        f.write(f"const int {count} = sizeof({name}_duty)/sizeof({name}_duty[0]);\n\n")
+        f.write(f"const unsigned short {name}_elbow_flips[] = {{ "
+                + "".join(f"{int(i)}, " for i in flips) + f"{len(duty)} }};\n")
+
+
+def write_lod_table(out_dir, name, full_points, levels, spacings):
+    """
+    Writes <name>_lod.c / <name>_lod.h: the coarser duty tables in levels
+    and a const halo_traj_lod_t list from the full <name>_duty table
+    (full_points pairs) down. spacings[k] is the mean tool travel per pair
+    of level k, level 0 being <name>_duty. Returns the extra bytes used.
+    """
+    guard = f"{name.upper()}_LOD_H"
+    count = f"{name.upper()}_LOD_COUNT"
+
+    with open(os.path.join(out_dir, f"{name}_lod.h"), "w") as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("#include \"halo_trajectory.h\"\n\n")
+        f.write(f"#define {count} {len(levels) + 1}\n\n")
+        f.write(f"// {name}_duty and coarser copies, finest first\n")
+        f.write(f"extern const halo_traj_lod_t {name}_lods[{count}];\n\n")
+        f.write(f"#endif // {guard}\n")
+
+    with open(os.path.join(out_dir, f"{name}_lod.c"), "w") as f:
+        f.write(f"#include \"{name}_lod.h\"\n")
+        f.write(f"#include \"{name}_duty.h\"\n\n")
+        f.write("// ----------------------------\n")
+        f.write(f"// Generated {name} levels of detail (do not edit)\n")
+        f.write("// ----------------------------\n\n")
+        for k, duty in enumerate(levels, 1):
+            f.write(f"static const unsigned short {name}_duty_lod{k}[][2] = {{\n")
+            for (d1, d2) in duty:
+                f.write(f"    {{ {d1}, {d2} }},\n")
+            f.write("};\n\n")
+        f.write(f"const halo_traj_lod_t {name}_lods[{count}] = {{\n")
+        f.write(f"    {{ {name}_duty, {full_points}, {spacings[0]:.4f}f }},\n")
+        for k, duty in enumerate(levels, 1):
+            f.write(f"    {{ {name}_duty_lod{k}, {len(duty)}, {spacings[k]:.4f}f }},\n")
+        f.write("};\n")
+
+    return sum(len(d) for d in levels) * 4 + (len(levels) + 1) * 12
+
+
+def encode_path(xy):
+    """
+    Encodes a path as int16 0.01 cm points: the first point goes in the
+    header, the rest as int8 deltas, with an escape + absolute int16 pair
+    for any jump that does not fit in a byte.
+    Returns (x0, y0, data bytes as signed ints).
+    """
+    pts = np.round(np.asarray(xy, dtype=np.float64) * PATH_UNITS_PER_CM).astype(np.int64)
+    if np.any(np.abs(pts) > 32767):
+        raise ValueError("path does not fit in int16 0.01 cm units")
+
+    def s8(b):
+        return b - 256 if b > 127 else b
+
+    data = []
+    for (px, py), (x, y) in zip(pts[:-1], pts[1:]):
+        dx, dy = x - px, y - py
+        if -127 <= dx <= 127 and -127 <= dy <= 127:
+            data += [int(dx), int(dy)]
+        else:
+            data.append(PATH_ESCAPE)
+            for v in (int(x) & 0xFFFF, int(y) & 0xFFFF):
+                data += [s8(v & 0xFF), s8(v >> 8)]
+
+    return int(pts[0][0]), int(pts[0][1]), data
+
+
+def write_path_table(out_dir, name, xy):
+    """Writes <name>_path.c / <name>_path.h as a const halo_path_t. Returns bytes used."""
+    x0, y0, data = encode_path(xy)
+    guard = f"{name.upper()}_PATH_H"
+
+    with open(os.path.join(out_dir, f"{name}_path.h"), "w") as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("#include \"halo_path.h\"\n\n")
+        f.write(f"// Delta-encoded {name} outline, 0.01 cm fixed point\n")
+        f.write(f"extern const halo_path_t {name}_path;\n\n")
+        f.write(f"#endif // {guard}\n")
+
+    with open(os.path.join(out_dir, f"{name}_path.c"), "w") as f:
+        f.write(f"#include \"{name}_path.h\"\n\n")
+        f.write("// ----------------------------\n")
+        f.write(f"// Generated {name} path (do not edit)\n")
+        f.write("// ----------------------------\n\n")
+        f.write(f"static const signed char {name}_path_data[] = {{\n")
+        for i in range(0, len(data), 16):
+            f.write("    " + ", ".join(f"{b:4d}" for b in data[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write(f"const halo_path_t {name}_path = {{ {name}_path_data, {len(xy)}, {x0}, {y0} }};\n")
+
+    return len(data) + 8
@@ -9,8 +9,12 @@
  * 
  * @details
  * - Arm model: 2-link planar arm with lengths L1 and L2
- * - Path: Precomputed flower coordinates
- * - Inverse kinematics: Computes joint angles from (x,y)
+ * - Path: Precomputed flower duty table (default) with coarser levels for
+ *   faster playback, compact path (live IK) or cubic curve evaluated at a
+ *   run-time tool speed
+ * - Inverse kinematics: Looks up blocks of (x,y) points in the workspace IK
+ *   table (halo_iklut), exact solve where the table has no cell, on the
+ *   elbow branch the generator planned for each point
  * - PWM: Outputs duty cycles to control servos
  * 
  * @note
@@ -20,14 +24,25 @@
  */
 
 #include "flower_pattern.h"
-#include "flower_coords.h"
+#include "flower_path.h"
+#include "flower_duty.h"
+#include "flower_lod.h"
+#include "flower_curve.h"
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_iklut_2dof.h"
+#include "halo_loop.h"
+#include "halo_pwm.h"
+#include "halo_trajectory.h"
 #include <stdio.h>
-#include <math.h>
 
 #define L1 10.0f
 #define L2 10.0f
 
+#define IK_BLOCK 32   // points solved per batch IK call
+
+static const halo_arm_t arm = { L1, L2 };
+
 
 // ----------------------------
 // Clamp helper
@@ -46,72 +61,179 @@ unsigned int angle_to_duty_us(float angle) {
 }
 
 // ----------------------------
-// Inverse kinematics
+// Move arm to solved joint pair
 // ----------------------------
-int computeIK(float x, float y, float *theta1_deg, float *theta2_deg) {
-    float r2 = x*x + y*y;
-    float r  = sqrtf(r2);
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0; // unreachable
+void move_to_joints(float t1, float t2) {
+    if (t1 < 0 || t1 > 180 || t2 < 0 || t2 > 180)
+        return; // skip if outside servo range
 
-    float c2 = (r2 - L1*L1 - L2*L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
+    unsigned int duty1 = angle_to_duty_us(t1);
+    unsigned int duty2 = angle_to_duty_us(t2);
 
-    float ang2 = acosf(c2);         // elbow-down
-    float s2   = sinf(ang2);
-    float k1   = L1 + L2 * c2;
-    float k2   = L2 * s2;
-    float ang1 = atan2f(y, x) - atan2f(k2, k1);
+    unsigned int pwm_duty[2] = { duty1, duty2 }; // shoulder, elbow
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
+}
 
-    *theta1_deg = ang1 * 180.0f / M_PI;
-    *theta2_deg = ang2 * 180.0f / M_PI;
+// ----------------------------
+// Table player: pre-solved duty pairs streamed to the PWM FIFOs,
+// one point per 20 ms servo period with no CPU timing in the loop
+// ----------------------------
+void flower_pattern_gen(void) {
+    halo_traj_init();
+    halo_traj_stream_begin(flower_duty[0]);
 
-    return (*theta1_deg >= 0 && *theta1_deg <= 180 &&
-            *theta2_deg >= 0 && *theta2_deg <= 180);
+    // Loop through path forever
+    while (1) {
+        halo_traj_stream(flower_duty, FLOWER_DUTY_POINTS);
+    }
 }
 
 // ----------------------------
-// Move arm to (x,y)
+// CPU-timed table player (no streaming)
 // ----------------------------
-void move_to(float x, float y) {
-    float t1, t2;
-    if (!computeIK(x, y, &t1, &t2))
-        return; // skip if unreachable
+void flower_pattern_gen_cpu(void) {
+    halo_traj_init();
 
-    unsigned int duty1 = angle_to_duty_us(t1);
-    unsigned int duty2 = angle_to_duty_us(t2);
+    // Loop through path forever
+    while (1) {
+        halo_traj_play(flower_duty, FLOWER_DUTY_POINTS, HALO_SERVO_PERIOD_US); // one point per servo period (20 ms)
+    }
+}
 
-    WRITE_REGISTER(0x40004004, duty1); // shoulder
-    WRITE_REGISTER(0x40004044, duty2); // elbow
+// ----------------------------
+// Speed player: the duty table level whose pairs the servos can follow
+// at tool_speed_cm_s (coarser tables above ~5 cm/s)
+// ----------------------------
+void flower_pattern_gen_speed(float tool_speed_cm_s) {
+    halo_traj_init();
+
+    // Loop through path forever
+    while (1) {
+        halo_traj_play_speed(flower_lods, FLOWER_LOD_COUNT, tool_speed_cm_s);
+    }
 }
 
 // ----------------------------
-// Main firmware
+// Live IK player: solves the coordinates on every pass
 // ----------------------------
-void flower_pattern_gen(void) {
+void flower_pattern_gen_ik(void) {
     // Setup PWM channels
     WRITE_REGISTER(0x40004000, 20000);
     WRITE_REGISTER(0x40004008, 0x01);
     WRITE_REGISTER(0x40004040, 20000);
     WRITE_REGISTER(0x40004048, 0x01);
 
+    halo_path_reader_t reader;
+    float xy[IK_BLOCK][2];
+    float theta[IK_BLOCK][2];
+    unsigned char ok[IK_BLOCK];
+
     // Loop through path forever
     while (1) {
-        for (int i = 0; i < NUM_POINTS; i++) {
-            // Apply any extra offset if needed
-            float x = flower_coords[i][0]*0.5f+3.0f;
-            float y = flower_coords[i][1]*0.5f+10.0f;
-
-            move_to(x, y);
-            delay_us(5); // adjust drawing speed (5 ms per point here)
-        }
+        halo_path_begin(&reader, &flower_path);
+
+        // Elbow branch planned by the generator (see flower_duty.h)
+        const unsigned short* flip = flower_elbow_flips;
+        int elbow = FLOWER_ELBOW_START;
+        int index = 0;
+
+        int n;
+        do {
+            // Decode the next block, up to the next branch flip
+            // (already placed in arm cm by the generator)
+            float x, y;
+            for (n = 0; n < IK_BLOCK && index < *flip && halo_path_next(&reader, &x, &y); n++, index++) {
+                xy[n][0] = x;
+                xy[n][1] = y;
+            }
+
+            // Look up the whole block (table falls back to exact IK)
+            halo_iklut_solve_batch(&halo_iklut_2dof, &arm, xy, theta, ok, n, elbow);
+
+            for (int i = 0; i < n; i++) {
+                if (ok[i])
+                    move_to_joints(theta[i][0], theta[i][1]); // generator checked reach
+                delay_us(HALO_SERVO_PERIOD_US); // one point per servo period (20 ms)
+            }
+
+            if (index == *flip && index < flower_path.count) {
+                elbow = !elbow;
+                flip++;
+            }
+        } while (n > 0);
+    }
+}
+
+// ----------------------------
+// Curve player: evaluates the cubic segments at one point per servo
+// period, spaced for the requested tool speed, on the elbow branch the
+// generator planned for each segment
+// ----------------------------
+void flower_pattern_gen_curve(float tool_speed_cm_s) {
+    // Setup PWM channels
+    WRITE_REGISTER(0x40004000, 20000);
+    WRITE_REGISTER(0x40004008, 0x01);
+    WRITE_REGISTER(0x40004040, 20000);
+    WRITE_REGISTER(0x40004048, 0x01);
+
+    float spacing = tool_speed_cm_s * (HALO_SERVO_PERIOD_US * 1e-6f);
+
+    halo_curve_reader_t reader;
+    float xy[IK_BLOCK][2];
+    float theta[IK_BLOCK][2];
+    unsigned char ok[IK_BLOCK];
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    // Loop through curve forever
+    while (1) {
+        halo_curve_begin(&reader, &flower_curve, spacing);
+
+        // Elbow branch planned by the generator (see flower_curve.h)
+        const unsigned short* flip = flower_curve_elbow_flips;
+        int elbow = FLOWER_CURVE_ELBOW_START;
+        int carry = 0;  // first point past a flip, starts the next block
+
+        int n;
+        do {
+            // Evaluate the next block, up to the next branch flip
+            float x, y;
+            n = 0;
+            if (carry) {
+                n = 1;  // xy[0] already holds it
+                carry = 0;
+            }
+            while (n < IK_BLOCK && halo_curve_next(&reader, &x, &y)) {
+                if (halo_curve_segment(&reader) >= *flip) {
+                    carry = 1;
+                    break;
+                }
+                xy[n][0] = x;
+                xy[n][1] = y;
+                n++;
+            }
+
+            halo_iklut_solve_batch(&halo_iklut_2dof, &arm, xy, theta, ok, n, elbow);
+
+            for (int i = 0; i < n; i++) {
+                halo_loop_wait(&loop);
+                if (ok[i])
+                    move_to_joints(theta[i][0], theta[i][1]); // skip if unreachable
+            }
+
+            if (carry) {
+                xy[0][0] = x;
+                xy[0][1] = y;
+                elbow = !elbow;
+                flip++;
+            }
+        } while (n == IK_BLOCK || carry);
     }
 }
 
 void fw_main(void)
 {
-    flower_pattern_gen();
+  flower_pattern_gen();
 }
 
-
-
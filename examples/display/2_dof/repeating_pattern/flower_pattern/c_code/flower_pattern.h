@@ -4,12 +4,42 @@
 /**
  * @brief Starts the flower pattern trajectory for a 2-DOF robotic arm.
  * 
- * This function loops infinitely, tracing the precomputed flower
- * path by computing inverse kinematics and generating PWM signals
- * for the servos.
+ * This function loops infinitely, streaming the pre-solved flower
+ * duty table through the PWM FIFOs at one point per 20 ms period.
+ * No floating point and no delay_us timing run in the loop.
  */
 void flower_pattern_gen(void);
 
+/**
+ * @brief Same table, paced by delay_us instead of PWM streaming.
+ */
+void flower_pattern_gen_cpu(void);
+
+/**
+ * @brief Plays the table at a tool speed, CPU-timed.
+ *
+ * Above the speed of one full-density pair per servo period the player
+ * switches to the 1/2 or 1/4 density level from flower_lod.c, so it writes
+ * no more pairs than the servos can follow.
+ */
+void flower_pattern_gen_speed(float tool_speed_cm_s);
+
+/**
+ * @brief Same trajectory, but decodes flower_path and solves IK at run time.
+ *
+ * Use this while tuning the path placement; the default player streams the
+ * pre-solved flower_duty table generated by generate_flower_coords.py.
+ */
+void flower_pattern_gen_ik(void);
+
+/**
+ * @brief Evaluates the cubic flower_curve at run time instead of a point table.
+ *
+ * Points are spaced so the tool moves at tool_speed_cm_s with one point per
+ * servo period (the point tables are generated for 5 cm/s).
+ */
+void flower_pattern_gen_curve(float tool_speed_cm_s);
+
 #endif // FLOWER_PATTERN_H
 
 
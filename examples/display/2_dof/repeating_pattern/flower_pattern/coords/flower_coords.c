@@ -1,1988 +0,0 @@
-#include "flower_coords.h"
-
-// ----------------------------
-// Generated flower coordinates
-// ----------------------------
-
-float flower_coords[][2] = {
-    { -9.16, -3.40 },
-    { -9.23, -3.51 },
-    { -9.31, -3.62 },
-    { -9.38, -3.73 },
-    { -9.44, -3.84 },
-    { -9.51, -3.95 },
-    { -9.57, -4.06 },
-    { -9.66, -4.16 },
-    { -9.73, -4.27 },
-    { -9.79, -4.38 },
-    { -9.86, -4.49 },
-    { -9.92, -4.60 },
-    { -9.99, -4.71 },
-    { -10.03, -4.82 },
-    { -10.10, -4.93 },
-    { -10.16, -5.04 },
-    { -10.23, -5.14 },
-    { -10.29, -5.25 },
-    { -10.34, -5.36 },
-    { -10.40, -5.47 },
-    { -10.44, -5.58 },
-    { -10.49, -5.69 },
-    { -10.55, -5.80 },
-    { -10.60, -5.91 },
-    { -10.62, -6.02 },
-    { -10.66, -6.12 },
-    { -10.71, -6.23 },
-    { -10.75, -6.34 },
-    { -10.77, -6.45 },
-    { -10.79, -6.56 },
-    { -10.81, -6.67 },
-    { -10.81, -6.78 },
-    { -10.81, -6.89 },
-    { -10.81, -7.00 },
-    { -10.77, -7.10 },
-    { -10.75, -7.21 },
-    { -10.71, -7.32 },
-    { -10.66, -7.43 },
-    { -10.58, -7.54 },
-    { -10.49, -7.63 },
-    { -10.42, -7.69 },
-    { -10.31, -7.80 },
-    { -10.21, -7.87 },
-    { -10.10, -7.93 },
-    { -9.99, -8.00 },
-    { -9.88, -8.04 },
-    { -9.77, -8.11 },
-    { -9.66, -8.15 },
-    { -9.55, -8.17 },
-    { -9.44, -8.19 },
-    { -9.33, -8.24 },
-    { -9.23, -8.26 },
-    { -9.12, -8.30 },
-    { -9.01, -8.30 },
-    { -8.90, -8.32 },
-    { -8.79, -8.34 },
-    { -8.68, -8.34 },
-    { -8.57, -8.37 },
-    { -8.46, -8.37 },
-    { -8.35, -8.37 },
-    { -8.25, -8.37 },
-    { -8.14, -8.34 },
-    { -8.03, -8.34 },
-    { -7.92, -8.34 },
-    { -7.81, -8.32 },
-    { -7.70, -8.30 },
-    { -7.59, -8.28 },
-    { -7.48, -8.24 },
-    { -7.37, -8.21 },
-    { -7.27, -8.19 },
-    { -7.16, -8.15 },
-    { -7.05, -8.11 },
-    { -6.94, -8.04 },
-    { -6.83, -7.97 },
-    { -6.72, -7.91 },
-    { -6.61, -7.84 },
-    { -6.50, -7.74 },
-    { -6.42, -7.65 },
-    { -6.33, -7.56 },
-    { -6.26, -7.45 },
-    { -6.18, -7.34 },
-    { -6.13, -7.23 },
-    { -6.09, -7.13 },
-    { -6.05, -7.02 },
-    { -6.02, -6.91 },
-    { -6.00, -6.80 },
-    { -5.98, -6.69 },
-    { -5.98, -6.58 },
-    { -5.96, -6.47 },
-    { -5.98, -6.36 },
-    { -5.98, -6.25 },
-    { -6.00, -6.15 },
-    { -6.00, -6.04 },
-    { -6.05, -5.93 },
-    { -6.05, -5.82 },
-    { -6.09, -5.71 },
-    { -6.13, -5.60 },
-    { -6.16, -5.49 },
-    { -6.18, -5.38 },
-    { -6.22, -5.28 },
-    { -6.26, -5.17 },
-    { -6.33, -5.06 },
-    { -6.37, -4.95 },
-    { -6.44, -4.84 },
-    { -6.48, -4.73 },
-    { -6.55, -4.62 },
-    { -6.61, -4.51 },
-    { -6.68, -4.40 },
-    { -6.77, -4.30 },
-    { -6.83, -4.19 },
-    { -6.90, -4.08 },
-    { -6.98, -3.97 },
-    { -7.07, -3.86 },
-    { -7.16, -3.75 },
-    { -7.27, -3.64 },
-    { -7.33, -3.56 },
-    { -7.44, -3.49 },
-    { -7.55, -3.53 },
-    { -7.66, -3.56 },
-    { -7.77, -3.58 },
-    { -7.88, -3.60 },
-    { -7.98, -3.62 },
-    { -8.09, -3.62 },
-    { -8.20, -3.62 },
-    { -8.31, -3.62 },
-    { -8.42, -3.62 },
-    { -8.53, -3.58 },
-    { -8.64, -3.58 },
-    { -8.75, -3.53 },
-    { -8.86, -3.51 },
-    { -8.96, -3.47 },
-    { -9.07, -3.42 },
-    { -5.89, -1.73 },
-    { -5.92, -1.84 },
-    { -5.94, -1.94 },
-    { -5.98, -2.05 },
-    { -6.02, -2.16 },
-    { -6.07, -2.27 },
-    { -6.13, -2.38 },
-    { -6.18, -2.49 },
-    { -6.26, -2.60 },
-    { -6.35, -2.71 },
-    { -6.42, -2.81 },
-    { -6.53, -2.92 },
-    { -6.63, -3.03 },
-    { -6.66, -3.12 },
-    { -6.59, -3.23 },
-    { -6.53, -3.34 },
-    { -6.44, -3.45 },
-    { -6.37, -3.56 },
-    { -6.31, -3.66 },
-    { -6.22, -3.77 },
-    { -6.13, -3.88 },
-    { -6.07, -3.99 },
-    { -5.98, -4.10 },
-    { -5.89, -4.21 },
-    { -5.81, -4.32 },
-    { -5.72, -4.43 },
-    { -5.63, -4.53 },
-    { -5.57, -4.62 },
-    { -5.46, -4.73 },
-    { -5.37, -4.84 },
-    { -5.26, -4.95 },
-    { -5.20, -5.01 },
-    { -5.11, -5.12 },
-    { -5.00, -5.21 },
-    { -4.89, -5.32 },
-    { -4.81, -5.38 },
-    { -4.70, -5.47 },
-    { -4.59, -5.56 },
-    { -4.48, -5.62 },
-    { -4.37, -5.69 },
-    { -4.26, -5.75 },
-    { -4.15, -5.80 },
-    { -4.04, -5.84 },
-    { -3.93, -5.84 },
-    { -3.83, -5.88 },
-    { -3.72, -5.88 },
-    { -3.61, -5.84 },
-    { -3.50, -5.84 },
-    { -3.39, -5.80 },
-    { -3.28, -5.75 },
-    { -3.17, -5.69 },
-    { -3.06, -5.62 },
-    { -2.96, -5.54 },
-    { -2.85, -5.45 },
-    { -2.76, -5.36 },
-    { -2.67, -5.30 },
-    { -2.58, -5.19 },
-    { -2.48, -5.08 },
-    { -2.39, -4.97 },
-    { -2.30, -4.86 },
-    { -2.24, -4.75 },
-    { -2.15, -4.64 },
-    { -2.08, -4.53 },
-    { -2.02, -4.43 },
-    { -1.95, -4.32 },
-    { -1.91, -4.21 },
-    { -1.84, -4.10 },
-    { -1.80, -3.99 },
-    { -1.76, -3.88 },
-    { -1.71, -3.77 },
-    { -1.67, -3.66 },
-    { -1.65, -3.56 },
-    { -1.63, -3.45 },
-    { -1.61, -3.34 },
-    { -1.58, -3.23 },
-    { -1.58, -3.12 },
-    { -1.61, -3.01 },
-    { -1.63, -2.90 },
-    { -1.67, -2.79 },
-    { -1.74, -2.68 },
-    { -1.80, -2.58 },
-    { -1.91, -2.47 },
-    { -2.02, -2.40 },
-    { -2.13, -2.31 },
-    { -2.24, -2.27 },
-    { -2.35, -2.21 },
-    { -2.45, -2.16 },
-    { -2.56, -2.12 },
-    { -2.67, -2.07 },
-    { -2.78, -2.05 },
-    { -2.89, -2.03 },
-    { -3.00, -1.99 },
-    { -3.11, -1.97 },
-    { -3.22, -1.94 },
-    { -3.33, -1.90 },
-    { -3.43, -1.90 },
-    { -3.54, -1.88 },
-    { -3.65, -1.86 },
-    { -3.76, -1.84 },
-    { -3.87, -1.81 },
-    { -3.98, -1.79 },
-    { -4.09, -1.79 },
-    { -4.20, -1.77 },
-    { -4.30, -1.75 },
-    { -4.41, -1.75 },
-    { -4.52, -1.75 },
-    { -4.63, -1.70 },
-    { -4.74, -1.70 },
-    { -4.85, -1.70 },
-    { -4.96, -1.70 },
-    { -5.07, -1.70 },
-    { -5.18, -1.70 },
-    { -5.28, -1.70 },
-    { -5.39, -1.70 },
-    { -5.50, -1.70 },
-    { -5.61, -1.70 },
-    { -5.72, -1.70 },
-    { -5.83, -1.70 },
-    { -11.16, -1.07 },
-    { -11.27, -1.07 },
-    { -11.38, -1.07 },
-    { -11.49, -1.07 },
-    { -11.60, -1.07 },
-    { -11.71, -1.07 },
-    { -11.82, -1.09 },
-    { -11.93, -1.12 },
-    { -12.03, -1.12 },
-    { -12.14, -1.12 },
-    { -12.25, -1.12 },
-    { -12.36, -1.16 },
-    { -12.47, -1.16 },
-    { -12.58, -1.16 },
-    { -12.69, -1.20 },
-    { -12.80, -1.20 },
-    { -12.90, -1.23 },
-    { -13.01, -1.25 },
-    { -13.12, -1.27 },
-    { -13.23, -1.29 },
-    { -13.34, -1.31 },
-    { -13.45, -1.36 },
-    { -13.56, -1.38 },
-    { -13.67, -1.40 },
-    { -13.78, -1.44 },
-    { -13.88, -1.49 },
-    { -13.99, -1.53 },
-    { -14.10, -1.57 },
-    { -14.21, -1.62 },
-    { -14.32, -1.68 },
-    { -14.43, -1.75 },
-    { -14.54, -1.84 },
-    { -14.65, -1.92 },
-    { -14.76, -2.03 },
-    { -14.82, -2.14 },
-    { -14.86, -2.25 },
-    { -14.91, -2.36 },
-    { -14.93, -2.47 },
-    { -14.93, -2.58 },
-    { -14.95, -2.68 },
-    { -14.93, -2.79 },
-    { -14.93, -2.90 },
-    { -14.91, -3.01 },
-    { -14.89, -3.12 },
-    { -14.84, -3.23 },
-    { -14.80, -3.34 },
-    { -14.78, -3.45 },
-    { -14.73, -3.56 },
-    { -14.69, -3.66 },
-    { -14.62, -3.77 },
-    { -14.58, -3.88 },
-    { -14.52, -3.99 },
-    { -14.45, -4.10 },
-    { -14.39, -4.21 },
-    { -14.30, -4.32 },
-    { -14.23, -4.43 },
-    { -14.15, -4.53 },
-    { -14.06, -4.64 },
-    { -13.95, -4.75 },
-    { -13.84, -4.86 },
-    { -13.73, -4.95 },
-    { -13.62, -5.04 },
-    { -13.51, -5.10 },
-    { -13.41, -5.14 },
-    { -13.30, -5.19 },
-    { -13.19, -5.21 },
-    { -13.08, -5.25 },
-    { -12.97, -5.25 },
-    { -12.86, -5.25 },
-    { -12.75, -5.21 },
-    { -12.64, -5.21 },
-    { -12.53, -5.17 },
-    { -12.43, -5.12 },
-    { -12.32, -5.08 },
-    { -12.21, -5.04 },
-    { -12.10, -4.99 },
-    { -11.99, -4.93 },
-    { -11.88, -4.86 },
-    { -11.77, -4.80 },
-    { -11.66, -4.71 },
-    { -11.56, -4.64 },
-    { -11.45, -4.56 },
-    { -11.34, -4.47 },
-    { -11.23, -4.38 },
-    { -11.12, -4.30 },
-    { -11.01, -4.21 },
-    { -10.90, -4.10 },
-    { -10.79, -4.01 },
-    { -10.68, -3.90 },
-    { -10.58, -3.79 },
-    { -10.47, -3.69 },
-    { -10.36, -3.58 },
-    { -10.25, -3.47 },
-    { -10.16, -3.36 },
-    { -10.07, -3.27 },
-    { -9.97, -3.16 },
-    { -9.88, -3.05 },
-    { -9.81, -2.95 },
-    { -9.88, -2.84 },
-    { -9.99, -2.73 },
-    { -10.05, -2.62 },
-    { -10.12, -2.51 },
-    { -10.18, -2.40 },
-    { -10.25, -2.29 },
-    { -10.29, -2.18 },
-    { -10.34, -2.07 },
-    { -10.36, -1.97 },
-    { -10.40, -1.86 },
-    { -10.44, -1.75 },
-    { -10.44, -1.64 },
-    { -10.44, -1.53 },
-    { -10.44, -1.42 },
-    { -10.44, -1.31 },
-    { -10.44, -1.20 },
-    { -10.44, -1.09 },
-    { -10.49, -1.03 },
-    { -10.60, -1.03 },
-    { -10.71, -1.03 },
-    { -10.81, -1.03 },
-    { -10.92, -1.03 },
-    { -11.03, -1.03 },
-    { -11.82, -0.53 },
-    { -11.95, -0.51 },
-    { -12.06, -0.53 },
-    { -12.16, -0.53 },
-    { -12.27, -0.53 },
-    { -12.38, -0.55 },
-    { -12.49, -0.57 },
-    { -12.60, -0.57 },
-    { -12.71, -0.57 },
-    { -12.82, -0.62 },
-    { -12.93, -0.62 },
-    { -13.04, -0.66 },
-    { -13.14, -0.66 },
-    { -13.25, -0.68 },
-    { -13.36, -0.70 },
-    { -13.47, -0.75 },
-    { -13.58, -0.75 },
-    { -13.69, -0.79 },
-    { -13.80, -0.81 },
-    { -13.91, -0.86 },
-    { -14.02, -0.90 },
-    { -14.12, -0.94 },
-    { -14.23, -0.96 },
-    { -14.34, -1.03 },
-    { -14.45, -1.07 },
-    { -14.56, -1.12 },
-    { -14.67, -1.18 },
-    { -14.78, -1.25 },
-    { -14.89, -1.33 },
-    { -14.99, -1.42 },
-    { -15.10, -1.53 },
-    { -15.21, -1.64 },
-    { -15.28, -1.75 },
-    { -15.34, -1.86 },
-    { -15.41, -1.97 },
-    { -15.43, -2.07 },
-    { -15.47, -2.18 },
-    { -15.52, -2.29 },
-    { -15.52, -2.40 },
-    { -15.54, -2.51 },
-    { -15.54, -2.62 },
-    { -15.54, -2.73 },
-    { -15.54, -2.84 },
-    { -15.52, -2.95 },
-    { -15.52, -3.05 },
-    { -15.50, -3.16 },
-    { -15.47, -3.27 },
-    { -15.43, -3.38 },
-    { -15.39, -3.49 },
-    { -15.37, -3.60 },
-    { -15.32, -3.71 },
-    { -15.28, -3.82 },
-    { -15.21, -3.93 },
-    { -15.17, -4.03 },
-    { -15.13, -4.14 },
-    { -15.06, -4.25 },
-    { -14.99, -4.36 },
-    { -14.93, -4.47 },
-    { -14.84, -4.58 },
-    { -14.78, -4.69 },
-    { -14.71, -4.80 },
-    { -14.62, -4.90 },
-    { -14.54, -5.01 },
-    { -14.43, -5.12 },
-    { -14.32, -5.23 },
-    { -14.21, -5.34 },
-    { -14.10, -5.43 },
-    { -13.99, -5.51 },
-    { -13.88, -5.58 },
-    { -13.78, -5.65 },
-    { -13.67, -5.69 },
-    { -13.56, -5.73 },
-    { -13.45, -5.75 },
-    { -13.34, -5.80 },
-    { -13.23, -5.84 },
-    { -13.12, -5.84 },
-    { -13.01, -5.84 },
-    { -12.90, -5.84 },
-    { -12.80, -5.84 },
-    { -12.69, -5.82 },
-    { -12.58, -5.80 },
-    { -12.47, -5.78 },
-    { -12.36, -5.75 },
-    { -12.25, -5.71 },
-    { -12.14, -5.67 },
-    { -12.03, -5.62 },
-    { -11.93, -5.56 },
-    { -11.82, -5.51 },
-    { -11.71, -5.45 },
-    { -11.60, -5.38 },
-    { -11.49, -5.32 },
-    { -11.38, -5.25 },
-    { -11.27, -5.17 },
-    { -11.16, -5.10 },
-    { -11.05, -5.01 },
-    { -10.95, -4.93 },
-    { -10.84, -4.84 },
-    { -10.73, -4.77 },
-    { -10.75, -4.86 },
-    { -10.81, -4.97 },
-    { -10.86, -5.08 },
-    { -10.92, -5.19 },
-    { -10.99, -5.30 },
-    { -11.03, -5.41 },
-    { -11.08, -5.51 },
-    { -11.12, -5.62 },
-    { -11.16, -5.73 },
-    { -11.21, -5.84 },
-    { -11.25, -5.95 },
-    { -11.27, -6.06 },
-    { -11.32, -6.17 },
-    { -11.34, -6.28 },
-    { -11.36, -6.39 },
-    { -11.40, -6.49 },
-    { -11.40, -6.60 },
-    { -11.40, -6.71 },
-    { -11.40, -6.82 },
-    { -11.40, -6.93 },
-    { -11.40, -7.04 },
-    { -11.40, -7.15 },
-    { -11.36, -7.26 },
-    { -11.34, -7.37 },
-    { -11.29, -7.47 },
-    { -11.25, -7.58 },
-    { -11.18, -7.69 },
-    { -11.12, -7.80 },
-    { -11.03, -7.91 },
-    { -10.95, -8.02 },
-    { -10.86, -8.11 },
-    { -10.75, -8.21 },
-    { -10.64, -8.30 },
-    { -10.53, -8.37 },
-    { -10.42, -8.43 },
-    { -10.31, -8.50 },
-    { -10.21, -8.56 },
-    { -10.10, -8.61 },
-    { -9.99, -8.65 },
-    { -9.88, -8.69 },
-    { -9.77, -8.74 },
-    { -9.66, -8.78 },
-    { -9.55, -8.80 },
-    { -9.44, -8.82 },
-    { -9.33, -8.85 },
-    { -9.23, -8.89 },
-    { -9.12, -8.89 },
-    { -9.01, -8.93 },
-    { -8.90, -8.93 },
-    { -8.79, -8.93 },
-    { -8.68, -8.95 },
-    { -8.57, -8.98 },
-    { -8.46, -8.98 },
-    { -8.35, -8.98 },
-    { -8.25, -8.98 },
-    { -8.14, -8.98 },
-    { -8.03, -8.95 },
-    { -7.92, -8.93 },
-    { -7.81, -8.93 },
-    { -7.70, -8.91 },
-    { -7.59, -8.89 },
-    { -7.48, -8.87 },
-    { -7.37, -8.85 },
-    { -7.27, -8.80 },
-    { -7.16, -8.78 },
-    { -7.05, -8.74 },
-    { -6.94, -8.69 },
-    { -6.83, -8.65 },
-    { -6.72, -8.61 },
-    { -6.61, -8.56 },
-    { -6.50, -8.48 },
-    { -6.40, -8.41 },
-    { -6.29, -8.34 },
-    { -6.18, -8.26 },
-    { -6.07, -8.15 },
-    { -5.98, -8.06 },
-    { -5.89, -7.97 },
-    { -5.81, -7.87 },
-    { -5.72, -7.76 },
-    { -5.68, -7.65 },
-    { -5.61, -7.54 },
-    { -5.57, -7.43 },
-    { -5.52, -7.32 },
-    { -5.48, -7.21 },
-    { -5.46, -7.10 },
-    { -5.42, -7.00 },
-    { -5.42, -6.89 },
-    { -5.39, -6.78 },
-    { -5.37, -6.67 },
-    { -5.37, -6.56 },
-    { -5.37, -6.45 },
-    { -5.37, -6.34 },
-    { -5.37, -6.23 },
-    { -5.39, -6.12 },
-    { -5.42, -6.02 },
-    { -5.42, -5.91 },
-    { -5.44, -5.80 },
-    { -5.48, -5.69 },
-    { -5.44, -5.62 },
-    { -5.37, -5.69 },
-    { -5.26, -5.80 },
-    { -5.15, -5.88 },
-    { -5.05, -5.97 },
-    { -4.94, -6.04 },
-    { -4.83, -6.12 },
-    { -4.72, -6.19 },
-    { -4.61, -6.25 },
-    { -4.50, -6.30 },
-    { -4.39, -6.34 },
-    { -4.28, -6.39 },
-    { -4.17, -6.43 },
-    { -4.07, -6.43 },
-    { -3.96, -6.45 },
-    { -3.85, -6.47 },
-    { -3.74, -6.47 },
-    { -3.63, -6.47 },
-    { -3.52, -6.43 },
-    { -3.41, -6.43 },
-    { -3.30, -6.39 },
-    { -3.19, -6.34 },
-    { -3.09, -6.32 },
-    { -2.98, -6.25 },
-    { -2.87, -6.21 },
-    { -2.76, -6.15 },
-    { -2.65, -6.06 },
-    { -2.54, -5.97 },
-    { -2.43, -5.88 },
-    { -2.32, -5.80 },
-    { -2.24, -5.71 },
-    { -2.15, -5.60 },
-    { -2.04, -5.49 },
-    { -1.95, -5.38 },
-    { -1.87, -5.28 },
-    { -1.78, -5.17 },
-    { -1.71, -5.06 },
-    { -1.63, -4.95 },
-    { -1.56, -4.84 },
-    { -1.50, -4.73 },
-    { -1.45, -4.62 },
-    { -1.39, -4.51 },
-    { -1.32, -4.40 },
-    { -1.28, -4.30 },
-    { -1.24, -4.19 },
-    { -1.19, -4.08 },
-    { -1.15, -3.97 },
-    { -1.10, -3.86 },
-    { -1.08, -3.75 },
-    { -1.04, -3.64 },
-    { -1.04, -3.53 },
-    { -1.00, -3.42 },
-    { -1.00, -3.32 },
-    { -1.00, -3.21 },
-    { -1.00, -3.10 },
-    { -1.00, -2.99 },
-    { -1.02, -2.88 },
-    { -1.04, -2.77 },
-    { -1.08, -2.66 },
-    { -1.13, -2.55 },
-    { -1.17, -2.44 },
-    { -1.24, -2.34 },
-    { -1.32, -2.23 },
-    { -1.41, -2.12 },
-    { -1.50, -2.03 },
-    { -1.61, -1.94 },
-    { -1.71, -1.88 },
-    { -1.82, -1.81 },
-    { -1.93, -1.75 },
-    { -2.04, -1.68 },
-    { -2.15, -1.64 },
-    { -2.26, -1.60 },
-    { -2.37, -1.55 },
-    { -2.48, -1.53 },
-    { -2.58, -1.49 },
-    { -2.69, -1.44 },
-    { -2.80, -1.42 },
-    { -2.91, -1.40 },
-    { -3.02, -1.36 },
-    { -3.13, -1.33 },
-    { -3.24, -1.31 },
-    { -3.35, -1.29 },
-    { -3.46, -1.29 },
-    { -3.56, -1.25 },
-    { -3.59, -1.27 },
-    { -3.48, -1.27 },
-    { -3.37, -1.29 },
-    { -3.26, -1.31 },
-    { -3.15, -1.33 },
-    { -3.04, -1.36 },
-    { -2.93, -1.40 },
-    { -2.82, -1.42 },
-    { -2.72, -1.44 },
-    { -2.61, -1.49 },
-    { -2.50, -1.53 },
-    { -2.39, -1.55 },
-    { -2.28, -1.60 },
-    { -2.17, -1.64 },
-    { -2.06, -1.68 },
-    { -1.95, -1.75 },
-    { -1.84, -1.81 },
-    { -1.74, -1.88 },
-    { -1.63, -1.94 },
-    { -1.52, -2.03 },
-    { -1.43, -2.12 },
-    { -1.34, -2.23 },
-    { -1.26, -2.34 },
-    { -1.19, -2.44 },
-    { -1.13, -2.55 },
-    { -1.08, -2.66 },
-    { -1.04, -2.77 },
-    { -1.02, -2.88 },
-    { -1.00, -2.99 },
-    { -1.00, -3.10 },
-    { -1.00, -3.21 },
-    { -1.00, -3.32 },
-    { -1.00, -3.42 },
-    { -1.04, -3.53 },
-    { -1.04, -3.64 },
-    { -1.08, -3.75 },
-    { -1.10, -3.86 },
-    { -1.15, -3.97 },
-    { -1.19, -4.08 },
-    { -1.24, -4.19 },
-    { -1.28, -4.30 },
-    { -1.34, -4.40 },
-    { -1.39, -4.51 },
-    { -1.45, -4.62 },
-    { -1.52, -4.73 },
-    { -1.58, -4.84 },
-    { -1.65, -4.95 },
-    { -1.74, -5.06 },
-    { -1.80, -5.17 },
-    { -1.89, -5.28 },
-    { -1.98, -5.38 },
-    { -2.06, -5.49 },
-    { -2.17, -5.60 },
-    { -2.26, -5.71 },
-    { -2.35, -5.80 },
-    { -2.45, -5.88 },
-    { -2.56, -5.97 },
-    { -2.67, -6.06 },
-    { -2.78, -6.15 },
-    { -2.89, -6.21 },
-    { -3.00, -6.25 },
-    { -3.11, -6.32 },
-    { -3.22, -6.36 },
-    { -3.33, -6.39 },
-    { -3.43, -6.43 },
-    { -3.54, -6.43 },
-    { -3.65, -6.47 },
-    { -3.76, -6.47 },
-    { -3.87, -6.47 },
-    { -3.98, -6.43 },
-    { -4.09, -6.43 },
-    { -4.20, -6.41 },
-    { -4.30, -6.39 },
-    { -4.41, -6.34 },
-    { -4.52, -6.28 },
-    { -4.63, -6.21 },
-    { -4.74, -6.17 },
-    { -4.85, -6.10 },
-    { -4.96, -6.02 },
-    { -5.07, -5.93 },
-    { -5.18, -5.84 },
-    { -5.28, -5.75 },
-    { -5.39, -5.65 },
-    { -5.48, -5.60 },
-    { -5.46, -5.71 },
-    { -5.44, -5.82 },
-    { -5.42, -5.93 },
-    { -5.39, -6.04 },
-    { -5.39, -6.15 },
-    { -5.37, -6.25 },
-    { -5.37, -6.36 },
-    { -5.37, -6.47 },
-    { -5.37, -6.58 },
-    { -5.39, -6.69 },
-    { -5.39, -6.80 },
-    { -5.42, -6.91 },
-    { -5.44, -7.02 },
-    { -5.46, -7.13 },
-    { -5.50, -7.23 },
-    { -5.52, -7.34 },
-    { -5.59, -7.45 },
-    { -5.63, -7.56 },
-    { -5.70, -7.67 },
-    { -5.76, -7.78 },
-    { -5.85, -7.89 },
-    { -5.94, -8.00 },
-    { -6.00, -8.08 },
-    { -6.11, -8.17 },
-    { -6.22, -8.26 },
-    { -6.33, -8.37 },
-    { -6.44, -8.43 },
-    { -6.55, -8.50 },
-    { -6.66, -8.56 },
-    { -6.77, -8.61 },
-    { -6.87, -8.67 },
-    { -6.98, -8.71 },
-    { -7.09, -8.76 },
-    { -7.20, -8.78 },
-    { -7.31, -8.82 },
-    { -7.42, -8.85 },
-    { -7.53, -8.89 },
-    { -7.64, -8.89 },
-    { -7.74, -8.93 },
-    { -7.85, -8.93 },
-    { -7.96, -8.93 },
-    { -8.07, -8.95 },
-    { -8.18, -8.98 },
-    { -8.29, -8.98 },
-    { -8.40, -8.98 },
-    { -8.51, -8.98 },
-    { -8.62, -8.98 },
-    { -8.72, -8.95 },
-    { -8.83, -8.93 },
-    { -8.94, -8.93 },
-    { -9.05, -8.91 },
-    { -9.16, -8.89 },
-    { -9.27, -8.87 },
-    { -9.38, -8.85 },
-    { -9.49, -8.82 },
-    { -9.60, -8.78 },
-    { -9.70, -8.76 },
-    { -9.81, -8.71 },
-    { -9.92, -8.67 },
-    { -10.03, -8.63 },
-    { -10.14, -8.56 },
-    { -10.25, -8.52 },
-    { -10.36, -8.48 },
-    { -10.47, -8.39 },
-    { -10.58, -8.32 },
-    { -10.68, -8.24 },
-    { -10.79, -8.15 },
-    { -10.90, -8.06 },
-    { -10.99, -7.95 },
-    { -11.08, -7.84 },
-    { -11.16, -7.74 },
-    { -11.21, -7.63 },
-    { -11.27, -7.52 },
-    { -11.32, -7.41 },
-    { -11.36, -7.30 },
-    { -11.38, -7.19 },
-    { -11.40, -7.08 },
-    { -11.40, -6.97 },
-    { -11.40, -6.86 },
-    { -11.40, -6.76 },
-    { -11.40, -6.65 },
-    { -11.40, -6.54 },
-    { -11.38, -6.43 },
-    { -11.36, -6.32 },
-    { -11.32, -6.21 },
-    { -11.29, -6.10 },
-    { -11.25, -5.99 },
-    { -11.23, -5.88 },
-    { -11.18, -5.78 },
-    { -11.14, -5.67 },
-    { -11.08, -5.56 },
-    { -11.03, -5.45 },
-    { -10.99, -5.34 },
-    { -10.95, -5.23 },
-    { -10.88, -5.12 },
-    { -10.81, -5.01 },
-    { -10.77, -4.90 },
-    { -10.68, -4.80 },
-    { -10.71, -4.69 },
-    { -10.77, -4.75 },
-    { -10.88, -4.86 },
-    { -10.99, -4.95 },
-    { -11.10, -5.04 },
-    { -11.21, -5.10 },
-    { -11.32, -5.19 },
-    { -11.42, -5.25 },
-    { -11.53, -5.34 },
-    { -11.64, -5.41 },
-    { -11.75, -5.47 },
-    { -11.86, -5.51 },
-    { -11.97, -5.58 },
-    { -12.08, -5.62 },
-    { -12.19, -5.67 },
-    { -12.30, -5.71 },
-    { -12.40, -5.75 },
-    { -12.51, -5.80 },
-    { -12.62, -5.80 },
-    { -12.73, -5.84 },
-    { -12.84, -5.84 },
-    { -12.95, -5.84 },
-    { -13.06, -5.84 },
-    { -13.17, -5.84 },
-    { -13.28, -5.80 },
-    { -13.38, -5.80 },
-    { -13.49, -5.75 },
-    { -13.60, -5.71 },
-    { -13.71, -5.67 },
-    { -13.82, -5.60 },
-    { -13.93, -5.54 },
-    { -14.04, -5.45 },
-    { -14.15, -5.36 },
-    { -14.25, -5.28 },
-    { -14.36, -5.17 },
-    { -14.47, -5.06 },
-    { -14.56, -4.95 },
-    { -14.65, -4.84 },
-    { -14.73, -4.73 },
-    { -14.80, -4.62 },
-    { -14.89, -4.51 },
-    { -14.95, -4.40 },
-    { -15.02, -4.30 },
-    { -15.08, -4.19 },
-    { -15.13, -4.08 },
-    { -15.19, -3.97 },
-    { -15.26, -3.86 },
-    { -15.30, -3.75 },
-    { -15.34, -3.64 },
-    { -15.39, -3.53 },
-    { -15.43, -3.42 },
-    { -15.45, -3.32 },
-    { -15.47, -3.21 },
-    { -15.50, -3.10 },
-    { -15.52, -2.99 },
-    { -15.54, -2.88 },
-    { -15.54, -2.77 },
-    { -15.54, -2.66 },
-    { -15.54, -2.55 },
-    { -15.54, -2.44 },
-    { -15.52, -2.34 },
-    { -15.50, -2.23 },
-    { -15.45, -2.12 },
-    { -15.41, -2.01 },
-    { -15.37, -1.90 },
-    { -15.30, -1.79 },
-    { -15.21, -1.68 },
-    { -15.13, -1.57 },
-    { -15.02, -1.46 },
-    { -14.91, -1.36 },
-    { -14.80, -1.29 },
-    { -14.69, -1.20 },
-    { -14.58, -1.16 },
-    { -14.47, -1.09 },
-    { -14.36, -1.03 },
-    { -14.25, -0.99 },
-    { -14.15, -0.94 },
-    { -14.04, -0.90 },
-    { -13.93, -0.86 },
-    { -13.82, -0.83 },
-    { -13.71, -0.79 },
-    { -13.60, -0.77 },
-    { -13.49, -0.75 },
-    { -13.38, -0.70 },
-    { -13.28, -0.70 },
-    { -13.17, -0.66 },
-    { -13.06, -0.66 },
-    { -12.95, -0.62 },
-    { -12.84, -0.62 },
-    { -12.73, -0.59 },
-    { -12.62, -0.57 },
-    { -12.51, -0.57 },
-    { -12.40, -0.57 },
-    { -12.30, -0.53 },
-    { -12.19, -0.53 },
-    { -12.08, -0.53 },
-    { -11.97, -0.53 },
-    { -11.86, -0.49 },
-    { -8.33, 0.43 },
-    { -8.44, 0.39 },
-    { -8.55, 0.39 },
-    { -8.66, 0.34 },
-    { -8.77, 0.30 },
-    { -8.88, 0.26 },
-    { -8.99, 0.19 },
-    { -9.09, 0.12 },
-    { -9.20, 0.06 },
-    { -9.31, -0.03 },
-    { -9.38, -0.12 },
-    { -9.44, -0.18 },
-    { -9.53, -0.29 },
-    { -9.62, -0.40 },
-    { -9.66, -0.51 },
-    { -9.73, -0.62 },
-    { -9.77, -0.72 },
-    { -9.81, -0.83 },
-    { -9.81, -0.94 },
-    { -9.86, -1.05 },
-    { -9.86, -1.16 },
-    { -9.86, -1.27 },
-    { -9.86, -1.38 },
-    { -9.86, -1.49 },
-    { -9.86, -1.60 },
-    { -9.81, -1.70 },
-    { -9.79, -1.81 },
-    { -9.75, -1.92 },
-    { -9.70, -2.03 },
-    { -9.66, -2.14 },
-    { -9.60, -2.25 },
-    { -9.53, -2.36 },
-    { -9.44, -2.47 },
-    { -9.33, -2.58 },
-    { -9.23, -2.66 },
-    { -9.12, -2.75 },
-    { -9.01, -2.79 },
-    { -8.90, -2.86 },
-    { -8.79, -2.90 },
-    { -8.68, -2.95 },
-    { -8.57, -2.97 },
-    { -8.46, -2.99 },
-    { -8.35, -3.01 },
-    { -8.25, -3.03 },
-    { -8.14, -3.03 },
-    { -8.03, -3.01 },
-    { -7.92, -2.99 },
-    { -7.81, -2.99 },
-    { -7.70, -2.95 },
-    { -7.59, -2.92 },
-    { -7.48, -2.88 },
-    { -7.37, -2.84 },
-    { -7.27, -2.77 },
-    { -7.16, -2.71 },
-    { -7.05, -2.62 },
-    { -6.94, -2.51 },
-    { -6.85, -2.40 },
-    { -6.77, -2.29 },
-    { -6.68, -2.18 },
-    { -6.63, -2.07 },
-    { -6.59, -1.97 },
-    { -6.55, -1.86 },
-    { -6.50, -1.75 },
-    { -6.48, -1.64 },
-    { -6.46, -1.53 },
-    { -6.44, -1.42 },
-    { -6.44, -1.31 },
-    { -6.44, -1.20 },
-    { -6.46, -1.09 },
-    { -6.46, -0.99 },
-    { -6.48, -0.88 },
-    { -6.53, -0.77 },
-    { -6.55, -0.66 },
-    { -6.59, -0.55 },
-    { -6.66, -0.44 },
-    { -6.72, -0.33 },
-    { -6.81, -0.22 },
-    { -6.90, -0.12 },
-    { -7.00, -0.01 },
-    { -7.11, 0.08 },
-    { -7.22, 0.17 },
-    { -7.33, 0.23 },
-    { -7.44, 0.28 },
-    { -7.55, 0.32 },
-    { -7.66, 0.34 },
-    { -7.77, 0.39 },
-    { -7.88, 0.39 },
-    { -7.98, 0.43 },
-    { -8.09, 0.43 },
-    { -8.20, 0.43 },
-    { -8.31, 0.43 },
-    { -3.48, 3.06 },
-    { -3.59, 3.02 },
-    { -3.70, 2.98 },
-    { -3.80, 2.93 },
-    { -3.91, 2.87 },
-    { -4.02, 2.82 },
-    { -4.13, 2.74 },
-    { -4.24, 2.67 },
-    { -4.35, 2.58 },
-    { -4.46, 2.50 },
-    { -4.57, 2.41 },
-    { -4.68, 2.32 },
-    { -4.78, 2.24 },
-    { -4.89, 2.13 },
-    { -5.00, 2.04 },
-    { -5.11, 1.93 },
-    { -5.22, 1.82 },
-    { -5.33, 1.71 },
-    { -5.39, 1.63 },
-    { -5.48, 1.56 },
-    { -5.57, 1.45 },
-    { -5.68, 1.34 },
-    { -5.76, 1.23 },
-    { -5.85, 1.13 },
-    { -5.94, 1.02 },
-    { -6.05, 0.91 },
-    { -6.13, 0.80 },
-    { -6.20, 0.69 },
-    { -6.29, 0.58 },
-    { -6.35, 0.47 },
-    { -6.44, 0.36 },
-    { -6.44, 0.26 },
-    { -6.35, 0.15 },
-    { -6.26, 0.04 },
-    { -6.20, -0.07 },
-    { -6.13, -0.18 },
-    { -6.07, -0.29 },
-    { -6.02, -0.40 },
-    { -5.98, -0.51 },
-    { -5.94, -0.62 },
-    { -5.92, -0.72 },
-    { -5.89, -0.83 },
-    { -5.85, -0.94 },
-    { -5.76, -0.94 },
-    { -5.65, -0.94 },
-    { -5.55, -0.92 },
-    { -5.44, -0.90 },
-    { -5.33, -0.90 },
-    { -5.22, -0.88 },
-    { -5.11, -0.86 },
-    { -5.00, -0.86 },
-    { -4.89, -0.83 },
-    { -4.78, -0.81 },
-    { -4.68, -0.79 },
-    { -4.57, -0.79 },
-    { -4.46, -0.77 },
-    { -4.35, -0.75 },
-    { -4.24, -0.72 },
-    { -4.13, -0.70 },
-    { -4.02, -0.70 },
-    { -3.91, -0.66 },
-    { -3.80, -0.66 },
-    { -3.70, -0.62 },
-    { -3.59, -0.62 },
-    { -3.48, -0.57 },
-    { -3.37, -0.57 },
-    { -3.26, -0.53 },
-    { -3.15, -0.51 },
-    { -3.04, -0.49 },
-    { -2.93, -0.44 },
-    { -2.82, -0.40 },
-    { -2.72, -0.38 },
-    { -2.61, -0.33 },
-    { -2.50, -0.29 },
-    { -2.39, -0.25 },
-    { -2.28, -0.20 },
-    { -2.17, -0.14 },
-    { -2.06, -0.07 },
-    { -1.95, 0.02 },
-    { -1.84, 0.12 },
-    { -1.76, 0.23 },
-    { -1.69, 0.34 },
-    { -1.65, 0.45 },
-    { -1.63, 0.56 },
-    { -1.61, 0.67 },
-    { -1.61, 0.78 },
-    { -1.63, 0.89 },
-    { -1.63, 1.00 },
-    { -1.65, 1.10 },
-    { -1.67, 1.21 },
-    { -1.71, 1.32 },
-    { -1.74, 1.43 },
-    { -1.78, 1.54 },
-    { -1.82, 1.65 },
-    { -1.87, 1.76 },
-    { -1.91, 1.87 },
-    { -1.95, 1.98 },
-    { -2.00, 2.08 },
-    { -2.06, 2.19 },
-    { -2.13, 2.30 },
-    { -2.19, 2.41 },
-    { -2.28, 2.52 },
-    { -2.35, 2.63 },
-    { -2.43, 2.74 },
-    { -2.54, 2.85 },
-    { -2.65, 2.93 },
-    { -2.76, 3.02 },
-    { -2.87, 3.06 },
-    { -2.98, 3.11 },
-    { -3.09, 3.11 },
-    { -3.19, 3.11 },
-    { -3.30, 3.11 },
-    { -11.58, 4.33 },
-    { -11.69, 4.33 },
-    { -11.79, 4.33 },
-    { -11.90, 4.28 },
-    { -12.01, 4.24 },
-    { -12.12, 4.17 },
-    { -12.23, 4.11 },
-    { -12.34, 4.07 },
-    { -12.45, 3.98 },
-    { -12.56, 3.91 },
-    { -12.67, 3.83 },
-    { -12.77, 3.74 },
-    { -12.88, 3.65 },
-    { -12.99, 3.54 },
-    { -13.10, 3.46 },
-    { -13.21, 3.35 },
-    { -13.30, 3.24 },
-    { -13.41, 3.13 },
-    { -13.49, 3.02 },
-    { -13.58, 2.91 },
-    { -13.67, 2.80 },
-    { -13.73, 2.69 },
-    { -13.80, 2.58 },
-    { -13.84, 2.48 },
-    { -13.88, 2.37 },
-    { -13.93, 2.26 },
-    { -13.95, 2.15 },
-    { -13.97, 2.04 },
-    { -13.97, 1.93 },
-    { -13.95, 1.82 },
-    { -13.93, 1.71 },
-    { -13.88, 1.60 },
-    { -13.84, 1.50 },
-    { -13.75, 1.39 },
-    { -13.67, 1.28 },
-    { -13.56, 1.17 },
-    { -13.45, 1.08 },
-    { -13.34, 1.00 },
-    { -13.23, 0.91 },
-    { -13.12, 0.84 },
-    { -13.01, 0.78 },
-    { -12.90, 0.69 },
-    { -12.80, 0.65 },
-    { -12.69, 0.58 },
-    { -12.58, 0.52 },
-    { -12.47, 0.47 },
-    { -12.36, 0.43 },
-    { -12.25, 0.36 },
-    { -12.14, 0.32 },
-    { -12.03, 0.28 },
-    { -11.93, 0.21 },
-    { -11.82, 0.17 },
-    { -11.71, 0.12 },
-    { -11.60, 0.10 },
-    { -11.49, 0.06 },
-    { -11.38, 0.02 },
-    { -11.27, -0.03 },
-    { -11.16, -0.07 },
-    { -11.05, -0.12 },
-    { -10.95, -0.14 },
-    { -10.84, -0.16 },
-    { -10.73, -0.20 },
-    { -10.62, -0.25 },
-    { -10.51, -0.27 },
-    { -10.40, -0.31 },
-    { -10.29, -0.33 },
-    { -10.21, -0.27 },
-    { -10.14, -0.16 },
-    { -10.07, -0.05 },
-    { -10.01, 0.06 },
-    { -9.92, 0.17 },
-    { -9.84, 0.28 },
-    { -9.75, 0.36 },
-    { -9.64, 0.45 },
-    { -9.53, 0.54 },
-    { -9.42, 0.63 },
-    { -9.31, 0.69 },
-    { -9.20, 0.76 },
-    { -9.09, 0.80 },
-    { -8.99, 0.84 },
-    { -8.94, 0.95 },
-    { -8.99, 1.06 },
-    { -9.05, 1.17 },
-    { -9.12, 1.28 },
-    { -9.18, 1.39 },
-    { -9.23, 1.50 },
-    { -9.29, 1.60 },
-    { -9.36, 1.71 },
-    { -9.40, 1.82 },
-    { -9.46, 1.93 },
-    { -9.53, 2.04 },
-    { -9.57, 2.15 },
-    { -9.64, 2.26 },
-    { -9.70, 2.37 },
-    { -9.77, 2.48 },
-    { -9.81, 2.58 },
-    { -9.90, 2.69 },
-    { -9.94, 2.80 },
-    { -10.03, 2.91 },
-    { -10.07, 3.02 },
-    { -10.16, 3.13 },
-    { -10.23, 3.24 },
-    { -10.29, 3.35 },
-    { -10.38, 3.46 },
-    { -10.44, 3.56 },
-    { -10.53, 3.67 },
-    { -10.62, 3.78 },
-    { -10.71, 3.89 },
-    { -10.81, 4.00 },
-    { -10.92, 4.09 },
-    { -11.03, 4.17 },
-    { -11.14, 4.24 },
-    { -11.25, 4.30 },
-    { -11.36, 4.33 },
-    { -11.47, 4.33 },
-    { -7.35, 5.39 },
-    { -7.46, 5.37 },
-    { -7.57, 5.35 },
-    { -7.68, 5.31 },
-    { -7.79, 5.26 },
-    { -7.90, 5.20 },
-    { -8.01, 5.09 },
-    { -8.09, 4.98 },
-    { -8.16, 4.87 },
-    { -8.20, 4.76 },
-    { -8.27, 4.65 },
-    { -8.31, 4.54 },
-    { -8.31, 4.44 },
-    { -8.35, 4.33 },
-    { -8.40, 4.22 },
-    { -8.40, 4.11 },
-    { -8.40, 4.00 },
-    { -8.44, 3.89 },
-    { -8.44, 3.78 },
-    { -8.44, 3.67 },
-    { -8.44, 3.56 },
-    { -8.44, 3.46 },
-    { -8.44, 3.35 },
-    { -8.44, 3.24 },
-    { -8.44, 3.13 },
-    { -8.44, 3.02 },
-    { -8.44, 2.91 },
-    { -8.44, 2.80 },
-    { -8.44, 2.69 },
-    { -8.44, 2.58 },
-    { -8.40, 2.48 },
-    { -8.40, 2.37 },
-    { -8.40, 2.26 },
-    { -8.40, 2.15 },
-    { -8.35, 2.04 },
-    { -8.35, 1.93 },
-    { -8.35, 1.87 },
-    { -8.35, 1.98 },
-    { -8.35, 2.08 },
-    { -8.40, 2.19 },
-    { -8.40, 2.30 },
-    { -8.40, 2.41 },
-    { -8.44, 2.52 },
-    { -8.44, 2.63 },
-    { -8.44, 2.74 },
-    { -8.44, 2.85 },
-    { -8.44, 2.95 },
-    { -8.44, 3.06 },
-    { -8.44, 3.17 },
-    { -8.44, 3.28 },
-    { -8.44, 3.39 },
-    { -8.44, 3.50 },
-    { -8.44, 3.61 },
-    { -8.44, 3.72 },
-    { -8.44, 3.83 },
-    { -8.44, 3.93 },
-    { -8.40, 4.04 },
-    { -8.40, 4.15 },
-    { -8.35, 4.26 },
-    { -8.35, 4.37 },
-    { -8.31, 4.48 },
-    { -8.27, 4.59 },
-    { -8.22, 4.70 },
-    { -8.18, 4.81 },
-    { -8.12, 4.91 },
-    { -8.03, 5.02 },
-    { -7.94, 5.13 },
-    { -7.83, 5.22 },
-    { -7.72, 5.28 },
-    { -7.61, 5.33 },
-    { -7.51, 5.37 },
-    { -7.40, 5.37 },
-    { -7.29, 5.41 },
-    { -7.18, 5.41 },
-    { -7.07, 5.41 },
-    { -6.96, 5.37 },
-    { -6.85, 5.37 },
-    { -6.74, 5.37 },
-    { -6.63, 5.33 },
-    { -6.53, 5.31 },
-    { -6.42, 5.28 },
-    { -6.31, 5.24 },
-    { -6.20, 5.20 },
-    { -6.09, 5.13 },
-    { -5.98, 5.09 },
-    { -5.87, 5.02 },
-    { -5.76, 4.96 },
-    { -5.65, 4.87 },
-    { -5.55, 4.78 },
-    { -5.44, 4.67 },
-    { -5.35, 4.57 },
-    { -5.28, 4.46 },
-    { -5.22, 4.35 },
-    { -5.22, 4.24 },
-    { -5.18, 4.13 },
-    { -5.20, 4.02 },
-    { -5.22, 3.91 },
-    { -5.22, 3.80 },
-    { -5.26, 3.70 },
-    { -5.31, 3.59 },
-    { -5.35, 3.48 },
-    { -5.39, 3.37 },
-    { -5.44, 3.26 },
-    { -5.50, 3.15 },
-    { -5.55, 3.04 },
-    { -5.63, 2.93 },
-    { -5.68, 2.82 },
-    { -5.74, 2.72 },
-    { -5.81, 2.61 },
-    { -5.87, 2.50 },
-    { -5.94, 2.39 },
-    { -6.00, 2.28 },
-    { -6.07, 2.17 },
-    { -6.13, 2.06 },
-    { -6.22, 1.95 },
-    { -6.29, 1.84 },
-    { -6.35, 1.74 },
-    { -6.44, 1.63 },
-    { -6.50, 1.52 },
-    { -6.59, 1.41 },
-    { -6.66, 1.30 },
-    { -6.72, 1.19 },
-    { -6.81, 1.08 },
-    { -6.90, 0.97 },
-    { -6.96, 0.86 },
-    { -7.05, 0.76 },
-    { -7.16, 0.80 },
-    { -7.27, 0.84 },
-    { -7.37, 0.89 },
-    { -7.48, 0.93 },
-    { -7.59, 0.95 },
-    { -7.70, 0.97 },
-    { -7.81, 1.02 },
-    { -7.92, 1.02 },
-    { -8.03, 1.02 },
-    { -8.14, 1.04 },
-    { -8.18, 1.15 },
-    { -8.22, 1.26 },
-    { -8.22, 1.37 },
-    { -8.27, 1.47 },
-    { -8.27, 1.58 },
-    { -8.31, 1.69 },
-    { -8.31, 1.80 },
-    { -8.31, 1.74 },
-    { -8.31, 1.63 },
-    { -8.27, 1.52 },
-    { -8.25, 1.41 },
-    { -8.22, 1.30 },
-    { -8.18, 1.19 },
-    { -8.16, 1.08 },
-    { -8.09, 1.02 },
-    { -7.98, 1.02 },
-    { -7.88, 1.02 },
-    { -7.77, 0.97 },
-    { -7.66, 0.97 },
-    { -7.55, 0.93 },
-    { -7.44, 0.91 },
-    { -7.33, 0.89 },
-    { -7.22, 0.82 },
-    { -7.11, 0.78 },
-    { -7.00, 0.78 },
-    { -6.94, 0.89 },
-    { -6.85, 1.00 },
-    { -6.79, 1.10 },
-    { -6.70, 1.21 },
-    { -6.63, 1.32 },
-    { -6.55, 1.43 },
-    { -6.48, 1.54 },
-    { -6.40, 1.65 },
-    { -6.33, 1.76 },
-    { -6.26, 1.87 },
-    { -6.18, 1.98 },
-    { -6.11, 2.08 },
-    { -6.05, 2.19 },
-    { -5.98, 2.30 },
-    { -5.92, 2.41 },
-    { -5.85, 2.52 },
-    { -5.79, 2.63 },
-    { -5.72, 2.74 },
-    { -5.65, 2.85 },
-    { -5.59, 2.95 },
-    { -5.55, 3.06 },
-    { -5.48, 3.17 },
-    { -5.44, 3.28 },
-    { -5.37, 3.39 },
-    { -5.33, 3.50 },
-    { -5.31, 3.61 },
-    { -5.26, 3.72 },
-    { -5.22, 3.83 },
-    { -5.22, 3.93 },
-    { -5.18, 4.04 },
-    { -5.18, 4.15 },
-    { -5.22, 4.26 },
-    { -5.24, 4.37 },
-    { -5.28, 4.48 },
-    { -5.35, 4.59 },
-    { -5.44, 4.70 },
-    { -5.55, 4.81 },
-    { -5.65, 4.89 },
-    { -5.76, 4.96 },
-    { -5.87, 5.04 },
-    { -5.98, 5.09 },
-    { -6.09, 5.15 },
-    { -6.20, 5.20 },
-    { -6.31, 5.24 },
-    { -6.42, 5.28 },
-    { -6.53, 5.31 },
-    { -6.63, 5.33 },
-    { -6.74, 5.37 },
-    { -6.85, 5.37 },
-    { -6.96, 5.37 },
-    { -7.07, 5.41 },
-    { -7.18, 5.41 },
-    { -7.29, 5.41 },
-    { -6.33, 5.87 },
-    { -6.22, 5.83 },
-    { -6.11, 5.79 },
-    { -6.00, 5.74 },
-    { -5.89, 5.70 },
-    { -5.79, 5.65 },
-    { -5.68, 5.61 },
-    { -5.57, 5.55 },
-    { -5.46, 5.46 },
-    { -5.35, 5.39 },
-    { -5.24, 5.33 },
-    { -5.15, 5.24 },
-    { -5.05, 5.13 },
-    { -4.94, 5.02 },
-    { -4.85, 4.91 },
-    { -4.78, 4.81 },
-    { -4.72, 4.70 },
-    { -4.68, 4.59 },
-    { -4.63, 4.48 },
-    { -4.63, 4.37 },
-    { -4.59, 4.26 },
-    { -4.59, 4.15 },
-    { -4.59, 4.04 },
-    { -4.59, 3.93 },
-    { -4.63, 3.83 },
-    { -4.63, 3.72 },
-    { -4.68, 3.61 },
-    { -4.70, 3.50 },
-    { -4.74, 3.39 },
-    { -4.78, 3.28 },
-    { -4.83, 3.17 },
-    { -4.87, 3.06 },
-    { -4.94, 2.95 },
-    { -4.91, 2.89 },
-    { -4.81, 2.98 },
-    { -4.70, 3.06 },
-    { -4.59, 3.15 },
-    { -4.48, 3.22 },
-    { -4.37, 3.28 },
-    { -4.26, 3.35 },
-    { -4.15, 3.41 },
-    { -4.04, 3.48 },
-    { -3.93, 3.52 },
-    { -3.83, 3.56 },
-    { -3.72, 3.61 },
-    { -3.61, 3.65 },
-    { -3.50, 3.70 },
-    { -3.39, 3.70 },
-    { -3.28, 3.70 },
-    { -3.17, 3.74 },
-    { -3.06, 3.70 },
-    { -2.96, 3.70 },
-    { -2.85, 3.70 },
-    { -2.74, 3.65 },
-    { -2.63, 3.61 },
-    { -2.52, 3.56 },
-    { -2.41, 3.48 },
-    { -2.30, 3.41 },
-    { -2.19, 3.32 },
-    { -2.08, 3.22 },
-    { -2.00, 3.11 },
-    { -1.91, 3.02 },
-    { -1.82, 2.91 },
-    { -1.76, 2.80 },
-    { -1.67, 2.69 },
-    { -1.61, 2.58 },
-    { -1.54, 2.48 },
-    { -1.50, 2.37 },
-    { -1.43, 2.26 },
-    { -1.39, 2.15 },
-    { -1.32, 2.04 },
-    { -1.28, 1.93 },
-    { -1.24, 1.82 },
-    { -1.19, 1.71 },
-    { -1.17, 1.60 },
-    { -1.13, 1.50 },
-    { -1.10, 1.39 },
-    { -1.08, 1.28 },
-    { -1.04, 1.17 },
-    { -1.04, 1.06 },
-    { -1.02, 0.95 },
-    { -1.00, 0.84 },
-    { -1.00, 0.73 },
-    { -1.00, 0.63 },
-    { -1.04, 0.52 },
-    { -1.04, 0.41 },
-    { -1.08, 0.30 },
-    { -1.10, 0.19 },
-    { -1.17, 0.08 },
-    { -1.24, -0.03 },
-    { -1.30, -0.14 },
-    { -1.39, -0.25 },
-    { -1.50, -0.35 },
-    { -1.61, -0.46 },
-    { -1.71, -0.53 },
-    { -1.82, -0.62 },
-    { -1.93, -0.68 },
-    { -2.04, -0.72 },
-    { -2.15, -0.79 },
-    { -2.26, -0.83 },
-    { -2.37, -0.88 },
-    { -2.48, -0.92 },
-    { -2.58, -0.96 },
-    { -2.69, -0.99 },
-    { -2.80, -1.03 },
-    { -2.91, -1.07 },
-    { -3.02, -1.07 },
-    { -3.13, -1.12 },
-    { -3.24, -1.16 },
-    { -3.35, -1.16 },
-    { -3.46, -1.20 },
-    { -3.56, -1.20 },
-    { -3.59, -1.20 },
-    { -3.48, -1.20 },
-    { -3.37, -1.16 },
-    { -3.26, -1.16 },
-    { -3.15, -1.12 },
-    { -3.04, -1.09 },
-    { -2.93, -1.07 },
-    { -2.82, -1.03 },
-    { -2.72, -1.01 },
-    { -2.61, -0.99 },
-    { -2.50, -0.94 },
-    { -2.39, -0.90 },
-    { -2.28, -0.86 },
-    { -2.17, -0.81 },
-    { -2.06, -0.75 },
-    { -1.95, -0.70 },
-    { -1.84, -0.64 },
-    { -1.74, -0.57 },
-    { -1.63, -0.49 },
-    { -1.52, -0.40 },
-    { -1.41, -0.29 },
-    { -1.32, -0.18 },
-    { -1.24, -0.07 },
-    { -1.17, 0.04 },
-    { -1.13, 0.15 },
-    { -1.08, 0.26 },
-    { -1.04, 0.36 },
-    { -1.04, 0.47 },
-    { -1.02, 0.58 },
-    { -1.00, 0.69 },
-    { -1.00, 0.80 },
-    { -1.00, 0.91 },
-    { -1.04, 1.02 },
-    { -1.04, 1.13 },
-    { -1.06, 1.23 },
-    { -1.08, 1.34 },
-    { -1.13, 1.45 },
-    { -1.15, 1.56 },
-    { -1.19, 1.67 },
-    { -1.24, 1.78 },
-    { -1.28, 1.89 },
-    { -1.32, 2.00 },
-    { -1.37, 2.11 },
-    { -1.41, 2.21 },
-    { -1.45, 2.32 },
-    { -1.52, 2.43 },
-    { -1.58, 2.54 },
-    { -1.65, 2.65 },
-    { -1.71, 2.76 },
-    { -1.78, 2.87 },
-    { -1.87, 2.98 },
-    { -1.95, 3.09 },
-    { -2.02, 3.17 },
-    { -2.13, 3.28 },
-    { -2.24, 3.37 },
-    { -2.35, 3.46 },
-    { -2.45, 3.52 },
-    { -2.56, 3.59 },
-    { -2.67, 3.63 },
-    { -2.78, 3.65 },
-    { -2.89, 3.70 },
-    { -3.00, 3.70 },
-    { -3.11, 3.74 },
-    { -3.22, 3.74 },
-    { -3.33, 3.70 },
-    { -3.43, 3.70 },
-    { -3.54, 3.67 },
-    { -3.65, 3.65 },
-    { -3.76, 3.61 },
-    { -3.87, 3.56 },
-    { -3.98, 3.52 },
-    { -4.09, 3.46 },
-    { -4.20, 3.41 },
-    { -4.30, 3.35 },
-    { -4.41, 3.28 },
-    { -4.52, 3.19 },
-    { -4.63, 3.13 },
-    { -4.74, 3.04 },
-    { -4.85, 2.95 },
-    { -4.96, 2.91 },
-    { -4.89, 3.02 },
-    { -4.85, 3.13 },
-    { -4.78, 3.24 },
-    { -4.76, 3.35 },
-    { -4.72, 3.46 },
-    { -4.68, 3.56 },
-    { -4.65, 3.67 },
-    { -4.63, 3.78 },
-    { -4.63, 3.89 },
-    { -4.59, 4.00 },
-    { -4.59, 4.11 },
-    { -4.59, 4.22 },
-    { -4.63, 4.33 },
-    { -4.63, 4.44 },
-    { -4.68, 4.54 },
-    { -4.70, 4.65 },
-    { -4.76, 4.76 },
-    { -4.81, 4.87 },
-    { -4.89, 4.98 },
-    { -4.98, 5.09 },
-    { -5.09, 5.20 },
-    { -5.20, 5.28 },
-    { -5.28, 5.37 },
-    { -5.39, 5.44 },
-    { -5.50, 5.50 },
-    { -5.61, 5.57 },
-    { -5.72, 5.63 },
-    { -5.83, 5.68 },
-    { -5.94, 5.74 },
-    { -6.05, 5.79 },
-    { -6.16, 5.83 },
-    { -6.26, 5.85 },
-    { -6.37, 5.87 },
-    { -7.53, 5.96 },
-    { -7.64, 5.96 },
-    { -7.74, 5.92 },
-    { -7.85, 5.89 },
-    { -7.96, 5.85 },
-    { -8.07, 5.79 },
-    { -8.18, 5.72 },
-    { -8.29, 5.63 },
-    { -8.38, 5.57 },
-    { -8.46, 5.46 },
-    { -8.55, 5.35 },
-    { -8.64, 5.24 },
-    { -8.70, 5.13 },
-    { -8.75, 5.02 },
-    { -8.81, 4.91 },
-    { -8.86, 4.81 },
-    { -8.88, 4.70 },
-    { -8.90, 4.59 },
-    { -8.94, 4.48 },
-    { -8.94, 4.37 },
-    { -8.99, 4.26 },
-    { -8.99, 4.15 },
-    { -9.03, 4.04 },
-    { -9.03, 3.93 },
-    { -9.03, 3.83 },
-    { -9.03, 3.72 },
-    { -9.05, 3.61 },
-    { -9.05, 3.50 },
-    { -9.07, 3.39 },
-    { -9.07, 3.28 },
-    { -9.07, 3.17 },
-    { -9.07, 3.06 },
-    { -9.05, 2.95 },
-    { -9.03, 2.85 },
-    { -9.03, 2.74 },
-    { -9.03, 2.63 },
-    { -9.03, 2.52 },
-    { -9.05, 2.41 },
-    { -9.09, 2.52 },
-    { -9.16, 2.63 },
-    { -9.23, 2.74 },
-    { -9.29, 2.85 },
-    { -9.36, 2.95 },
-    { -9.40, 3.06 },
-    { -9.49, 3.17 },
-    { -9.53, 3.28 },
-    { -9.62, 3.39 },
-    { -9.68, 3.50 },
-    { -9.75, 3.61 },
-    { -9.84, 3.72 },
-    { -9.90, 3.83 },
-    { -9.99, 3.93 },
-    { -10.05, 4.04 },
-    { -10.14, 4.15 },
-    { -10.25, 4.26 },
-    { -10.34, 4.37 },
-    { -10.44, 4.48 },
-    { -10.55, 4.57 },
-    { -10.66, 4.65 },
-    { -10.77, 4.72 },
-    { -10.88, 4.78 },
-    { -10.99, 4.83 },
-    { -11.10, 4.87 },
-    { -11.21, 4.91 },
-    { -11.32, 4.91 },
-    { -11.42, 4.96 },
-    { -11.53, 4.96 },
-    { -11.64, 4.96 },
-    { -11.75, 4.91 },
-    { -11.86, 4.91 },
-    { -11.97, 4.87 },
-    { -12.08, 4.85 },
-    { -12.19, 4.81 },
-    { -12.30, 4.76 },
-    { -12.40, 4.70 },
-    { -12.51, 4.65 },
-    { -12.62, 4.59 },
-    { -12.73, 4.52 },
-    { -12.84, 4.44 },
-    { -12.95, 4.37 },
-    { -13.06, 4.28 },
-    { -13.17, 4.20 },
-    { -13.28, 4.11 },
-    { -13.38, 4.00 },
-    { -13.49, 3.91 },
-    { -13.60, 3.80 },
-    { -13.69, 3.70 },
-    { -13.75, 3.63 },
-    { -13.86, 3.52 },
-    { -13.95, 3.41 },
-    { -14.04, 3.30 },
-    { -14.12, 3.19 },
-    { -14.19, 3.09 },
-    { -14.25, 2.98 },
-    { -14.32, 2.87 },
-    { -14.39, 2.76 },
-    { -14.43, 2.65 },
-    { -14.45, 2.54 },
-    { -14.49, 2.43 },
-    { -14.54, 2.32 },
-    { -14.54, 2.21 },
-    { -14.56, 2.11 },
-    { -14.58, 2.00 },
-    { -14.58, 1.89 },
-    { -14.56, 1.78 },
-    { -14.54, 1.67 },
-    { -14.52, 1.56 },
-    { -14.47, 1.45 },
-    { -14.43, 1.34 },
-    { -14.39, 1.23 },
-    { -14.30, 1.13 },
-    { -14.23, 1.02 },
-    { -14.15, 0.91 },
-    { -14.04, 0.80 },
-    { -13.93, 0.69 },
-    { -13.82, 0.60 },
-    { -13.71, 0.52 },
-    { -13.60, 0.43 },
-    { -13.49, 0.36 },
-    { -13.38, 0.30 },
-    { -13.28, 0.23 },
-    { -13.17, 0.15 },
-    { -13.06, 0.10 },
-    { -12.95, 0.04 },
-    { -12.84, -0.03 },
-    { -12.73, -0.07 },
-    { -12.62, -0.12 },
-    { -12.51, -0.18 },
-    { -12.40, -0.22 },
-    { -12.30, -0.27 },
-    { -12.19, -0.31 },
-    { -12.08, -0.35 },
-    { -11.97, -0.40 },
-    { -11.86, -0.44 },
-    { -11.82, -0.44 },
-    { -11.93, -0.42 },
-    { -12.03, -0.38 },
-    { -12.14, -0.33 },
-    { -12.25, -0.29 },
-    { -12.36, -0.22 },
-    { -12.47, -0.18 },
-    { -12.58, -0.14 },
-    { -12.69, -0.07 },
-    { -12.80, -0.03 },
-    { -12.90, 0.02 },
-    { -13.01, 0.08 },
-    { -13.12, 0.15 },
-    { -13.23, 0.21 },
-    { -13.34, 0.28 },
-    { -13.45, 0.34 },
-    { -13.56, 0.43 },
-    { -13.67, 0.49 },
-    { -13.78, 0.58 },
-    { -13.88, 0.67 },
-    { -13.99, 0.78 },
-    { -14.10, 0.89 },
-    { -14.19, 1.00 },
-    { -14.28, 1.10 },
-    { -14.34, 1.21 },
-    { -14.41, 1.32 },
-    { -14.45, 1.43 },
-    { -14.49, 1.54 },
-    { -14.54, 1.65 },
-    { -14.56, 1.76 },
-    { -14.58, 1.87 },
-    { -14.58, 1.98 },
-    { -14.58, 2.08 },
-    { -14.54, 2.19 },
-    { -14.54, 2.30 },
-    { -14.49, 2.41 },
-    { -14.47, 2.52 },
-    { -14.43, 2.63 },
-    { -14.39, 2.74 },
-    { -14.32, 2.85 },
-    { -14.25, 2.95 },
-    { -14.19, 3.06 },
-    { -14.12, 3.17 },
-    { -14.04, 3.28 },
-    { -13.95, 3.39 },
-    { -13.86, 3.50 },
-    { -13.75, 3.61 },
-    { -13.69, 3.70 },
-    { -13.60, 3.78 },
-    { -13.49, 3.89 },
-    { -13.38, 3.98 },
-    { -13.28, 4.09 },
-    { -13.17, 4.17 },
-    { -13.06, 4.26 },
-    { -12.95, 4.35 },
-    { -12.84, 4.41 },
-    { -12.73, 4.50 },
-    { -12.62, 4.57 },
-    { -12.51, 4.63 },
-    { -12.40, 4.70 },
-    { -12.30, 4.74 },
-    { -12.19, 4.81 },
-    { -12.08, 4.85 },
-    { -11.97, 4.87 },
-    { -11.86, 4.91 },
-    { -11.75, 4.91 },
-    { -11.64, 4.96 },
-    { -11.53, 4.96 },
-    { -11.42, 4.96 },
-    { -11.32, 4.91 },
-    { -11.21, 4.91 },
-    { -11.10, 4.87 },
-    { -10.99, 4.83 },
-    { -10.88, 4.78 },
-    { -10.77, 4.72 },
-    { -10.66, 4.63 },
-    { -10.55, 4.54 },
-    { -10.44, 4.46 },
-    { -10.34, 4.35 },
-    { -10.25, 4.24 },
-    { -10.14, 4.13 },
-    { -10.05, 4.02 },
-    { -9.99, 3.91 },
-    { -9.90, 3.80 },
-    { -9.84, 3.70 },
-    { -9.75, 3.59 },
-    { -9.68, 3.48 },
-    { -9.62, 3.37 },
-    { -9.53, 3.26 },
-    { -9.49, 3.15 },
-    { -9.40, 3.04 },
-    { -9.36, 2.93 },
-    { -9.29, 2.82 },
-    { -9.23, 2.72 },
-    { -9.16, 2.61 },
-    { -9.09, 2.50 },
-    { -9.05, 2.39 },
-    { -8.99, 2.41 },
-    { -9.01, 2.39 },
-    { -9.03, 2.45 },
-    { -9.03, 2.56 },
-    { -9.03, 2.67 },
-    { -9.03, 2.78 },
-    { -9.05, 2.89 },
-    { -9.05, 3.00 },
-    { -9.07, 3.11 },
-    { -9.07, 3.22 },
-    { -9.07, 3.32 },
-    { -9.07, 3.43 },
-    { -9.05, 3.54 },
-    { -9.03, 3.65 },
-    { -9.03, 3.76 },
-    { -9.03, 3.87 },
-    { -9.03, 3.98 },
-    { -9.01, 4.09 },
-    { -8.99, 4.20 },
-    { -8.99, 4.30 },
-    { -8.94, 4.41 },
-    { -8.94, 4.52 },
-    { -8.90, 4.63 },
-    { -8.86, 4.74 },
-    { -8.81, 4.85 },
-    { -8.77, 4.96 },
-    { -8.72, 5.07 },
-    { -8.66, 5.18 },
-    { -8.59, 5.28 },
-    { -8.51, 5.39 },
-    { -8.42, 5.50 },
-    { -8.31, 5.61 },
-    { -8.20, 5.70 },
-    { -8.09, 5.76 },
-    { -7.98, 5.83 },
-    { -7.88, 5.87 },
-    { -7.77, 5.92 },
-    { -7.66, 5.96 },
-    { -7.55, 5.96 },
-    { -7.44, 6.00 },
-    { -7.33, 6.00 },
-    { -7.22, 6.00 },
-    { -7.11, 6.00 },
-    { -7.00, 6.00 },
-    { -6.90, 6.00 },
-    { -6.79, 5.96 },
-    { -6.68, 5.96 },
-    { -6.57, 5.92 },
-    { -6.46, 5.92 },
-    { -6.48, 5.92 },
-    { -6.59, 5.94 },
-    { -6.70, 5.96 },
-    { -6.81, 5.96 },
-    { -6.92, 6.00 },
-    { -7.03, 6.00 },
-    { -7.14, 6.00 },
-    { -7.24, 6.00 },
-    { -7.35, 6.00 },
-};
-
-const int NUM_POINTS = sizeof(flower_coords)/sizeof(flower_coords[0]);
-
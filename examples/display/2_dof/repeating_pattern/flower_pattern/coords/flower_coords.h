@@ -1,9 +0,0 @@
-#ifndef FLOWER_COORDS_H
-#define FLOWER_COORDS_H
-
-extern float flower_coords[][2];
-extern const int NUM_POINTS;
-
-#endif // FLOWER_COORDS_H
-
-
@@ -0,0 +1,303 @@
+#include "flower_curve.h"
+
+// ----------------------------
+// Generated flower curve (do not edit)
+// ----------------------------
+
+static const short flower_curve_ctrl[][6] = {
+    {   -770,    720,   -824,    622,   -846,    578 },
+    {   -865,    539,   -947,    394,   -924,    349 },
+    {   -909,    318,   -909,    299,   -883,    273 },
+    {   -778,    169,   -478,    168,   -405,    312 },
+    {   -364,    395,   -386,    495,   -425,    573 },
+    {   -451,    626,   -483,    684,   -527,    729 },
+    {   -528,    730,   -539,    743,   -542,    743 },
+    {   -553,    743,   -585,    735,   -598,    729 },
+    {   -624,    716,   -716,    743,   -737,    753 },
+    {   -655,    786,   -573,    820,   -491,    853 },
+    {   -470,    873,   -463,    893,   -452,    916 },
+    {   -363,   1094,   -603,   1284,   -771,   1116 },
+    {   -792,   1095,   -800,   1065,   -812,   1041 },
+    {   -814,   1037,   -810,   1030,   -812,   1026 },
+    {   -828,    995,   -816,    941,   -802,    914 },
+    {   -793,    895,   -780,    877,   -771,    858 },
+    {   -762,    841,   -736,    828,   -722,    821 },
+    {   -645,    783,   -555,    789,   -491,    853 },
+    {   -456,    867,   -421,    881,   -386,    894 },
+    {   -399,    868,   -419,    845,   -432,    819 },
+    {   -435,    814,   -467,    790,   -461,    785 },
+    {   -447,    770,   -430,    744,   -420,    724 },
+    {   -400,    683,   -277,    540,   -240,    522 },
+    {   -219,    511,   -202,    495,   -181,    485 },
+    {   -172,    480,   -157,    485,   -147,    480 },
+    {   -143,    478,   -137,    472,   -130,    475 },
+    {   -112,    485,    -90,    486,    -72,    495 },
+    {     -7,    527,     51,    616,     82,    678 },
+    {     92,    697,     94,    721,    104,    741 },
+    {    106,    745,    102,    752,    104,    756 },
+    {    125,    798,     85,    856,     48,    875 },
+    {    -28,    913,   -165,    943,   -257,    943 },
+    {   -274,    943,   -362,    948,   -371,    943 },
+    {   -372,    941,   -373,    940,   -374,    938 },
+    {   -374,    923,   -382,    909,   -386,    894 },
+    {   -297,    929,   -209,    964,   -120,    999 },
+    {    -85,    999,    -31,   1013,     -1,   1028 },
+    {     11,   1034,     26,   1035,     38,   1041 },
+    {     61,   1052,     83,   1068,    106,   1080 },
+    {    116,   1085,    133,   1104,    138,   1114 },
+    {    141,   1121,    149,   1126,    152,   1133 },
+    {    159,   1147,    163,   1161,    169,   1175 },
+    {    172,   1180,    167,   1189,    169,   1194 },
+    {    187,   1230,    149,   1342,    133,   1374 },
+    {    105,   1430,     67,   1502,      6,   1533 },
+    {     -4,   1537,    -16,   1538,    -25,   1542 },
+    {    -40,   1549,    -66,   1554,    -79,   1547 },
+    {    -92,   1541,   -112,   1549,   -125,   1542 },
+    {   -161,   1524,   -195,   1504,   -230,   1486 },
+    {   -236,   1484,   -265,   1456,   -267,   1457 },
+    {   -267,   1459,   -268,   1460,   -269,   1462 },
+    {   -260,   1480,   -251,   1498,   -242,   1516 },
+    {   -227,   1546,   -222,   1618,   -237,   1649 },
+    {   -263,   1701,   -306,   1741,   -357,   1766 },
+    {   -368,   1772,   -408,   1781,   -415,   1788 },
+    {   -419,   1792,   -430,   1791,   -430,   1791 },
+    {   -430,   1791,   -419,   1792,   -415,   1788 },
+    {   -411,   1784,   -369,   1771,   -359,   1766 },
+    {   -314,   1744,   -266,   1706,   -242,   1659 },
+    {   -224,   1623,   -224,   1551,   -242,   1516 },
+    {   -251,   1499,   -258,   1481,   -267,   1464 },
+    {   -267,   1463,   -271,   1459,   -269,   1457 },
+    {   -267,   1457,   -266,   1457,   -264,   1457 },
+    {   -258,   1457,   -223,   1491,   -213,   1496 },
+    {   -187,   1509,   -163,   1525,   -138,   1537 },
+    {   -128,   1542,   -118,   1543,   -108,   1547 },
+    {   -101,   1551,    -87,   1543,    -79,   1547 },
+    {    -65,   1554,    -66,   1547,    -52,   1547 },
+    {     33,   1547,     95,   1450,    128,   1384 },
+    {    145,   1349,    189,   1233,    169,   1194 },
+    {    167,   1189,    172,   1180,    169,   1175 },
+    {    159,   1154,    148,   1134,    138,   1114 },
+    {    109,   1056,    -61,    999,   -120,    999 },
+    {   -151,   1016,   -181,   1033,   -211,   1050 },
+    {   -247,   1041,   -335,   1026,   -369,   1026 },
+    {   -372,   1026,   -375,   1054,   -376,   1058 },
+    {   -386,   1076,   -391,   1097,   -401,   1116 },
+    {   -409,   1133,   -437,   1156,   -437,   1172 },
+    {   -437,   1185,   -373,   1247,   -364,   1265 },
+    {   -345,   1303,   -205,   1429,   -164,   1450 },
+    {   -141,   1461,   -117,   1470,    -94,   1481 },
+    {    -87,   1485,    -72,   1481,    -64,   1481 },
+    {      4,   1481,     46,   1398,     72,   1347 },
+    {     81,   1329,     82,   1307,     91,   1289 },
+    {     97,   1278,    112,   1221,    106,   1209 },
+    {    103,   1203,    106,   1195,    104,   1189 },
+    {     98,   1178,     92,   1167,     87,   1155 },
+    {     59,   1101,   -151,   1050,   -211,   1050 },
+    {   -310,   1106,   -409,   1162,   -508,   1218 },
+    {   -536,   1232,   -565,   1236,   -588,   1248 },
+    {   -596,   1251,   -619,   1242,   -625,   1248 },
+    {   -628,   1251,   -644,   1313,   -644,   1321 },
+    {   -644,   1326,   -644,   1338,   -644,   1338 },
+    {   -644,   1338,   -644,   1326,   -644,   1321 },
+    {   -644,   1309,   -630,   1261,   -625,   1250 },
+    {   -624,   1248,   -572,   1246,   -566,   1243 },
+    {   -548,   1233,   -526,   1230,   -508,   1221 },
+    {   -506,   1220,   -505,   1219,   -503,   1218 },
+    {   -496,   1222,   -447,   1296,   -442,   1306 },
+    {   -434,   1322,   -418,   1334,   -410,   1350 },
+    {   -389,   1393,   -356,   1431,   -335,   1474 },
+    {   -321,   1502,   -312,   1532,   -298,   1559 },
+    {   -295,   1565,   -301,   1575,   -298,   1581 },
+    {   -293,   1591,   -293,   1610,   -298,   1620 },
+    {   -340,   1704,   -489,   1768,   -576,   1725 },
+    {   -587,   1719,   -606,   1712,   -613,   1698 },
+    {   -622,   1679,   -635,   1661,   -644,   1642 },
+    {   -646,   1639,   -643,   1633,   -644,   1630 },
+    {   -666,   1586,   -659,   1522,   -659,   1469 },
+    {   -659,   1439,   -654,   1413,   -654,   1384 },
+    {   -654,   1372,   -649,   1363,   -649,   1350 },
+    {   -649,   1347,   -649,   1340,   -649,   1340 },
+    {   -649,   1340,   -649,   1353,   -649,   1360 },
+    {   -649,   1386,   -659,   1413,   -659,   1440 },
+    {   -659,   1498,   -668,   1582,   -644,   1630 },
+    {   -643,   1633,   -646,   1639,   -644,   1642 },
+    {   -620,   1691,   -609,   1710,   -559,   1735 },
+    {   -554,   1737,   -545,   1732,   -539,   1735 },
+    {   -525,   1742,   -507,   1742,   -493,   1735 },
+    {   -486,   1731,   -473,   1738,   -466,   1735 },
+    {   -447,   1725,   -424,   1725,   -405,   1715 },
+    {   -384,   1704,   -364,   1690,   -342,   1679 },
+    {   -333,   1674,   -319,   1657,   -315,   1649 },
+    {   -307,   1633,   -301,   1617,   -293,   1601 },
+    {   -290,   1593,   -304,   1545,   -308,   1537 },
+    {   -318,   1517,   -324,   1493,   -335,   1472 },
+    {   -356,   1429,   -389,   1393,   -410,   1350 },
+    {   -422,   1327,   -489,   1223,   -508,   1218 },
+    {   -645,   1183,   -782,   1147,   -919,   1111 },
+    {   -938,   1121,   -962,   1121,   -980,   1131 },
+    {  -1032,   1157,  -1089,   1175,  -1141,   1201 },
+    {  -1167,   1214,  -1202,   1247,  -1221,   1257 },
+    {  -1230,   1262,  -1248,   1277,  -1253,   1287 },
+    {  -1260,   1301,  -1268,   1316,  -1275,   1330 },
+    {  -1290,   1361,  -1265,   1404,  -1253,   1428 },
+    {  -1216,   1503,  -1055,   1658,   -966,   1613 },
+    {   -879,   1570,   -758,   1329,   -715,   1243 },
+    {   -709,   1232,   -763,   1207,   -773,   1201 },
+    {   -795,   1190,   -836,   1145,   -846,   1123 },
+    {   -850,   1117,   -853,   1104,   -859,   1099 },
+    {   -863,   1094,   -910,   1109,   -919,   1111 },
+    {   -958,   1101,   -996,   1092,  -1034,   1082 },
+    {  -1073,   1092,  -1110,   1113,  -1146,   1131 },
+    {  -1263,   1189,  -1397,   1288,  -1324,   1435 },
+    {  -1305,   1472,  -1285,   1511,  -1253,   1542 },
+    {  -1205,   1590,  -1147,   1639,  -1087,   1669 },
+    {  -1077,   1674,  -1062,   1673,  -1051,   1679 },
+    {  -1040,   1684,  -1004,   1696,   -990,   1688 },
+    {   -978,   1682,   -961,   1685,   -949,   1679 },
+    {   -936,   1672,   -925,   1663,   -912,   1657 },
+    {   -895,   1648,   -855,   1614,   -846,   1596 },
+    {   -839,   1582,   -824,   1571,   -817,   1557 },
+    {   -798,   1520,   -770,   1487,   -751,   1450 },
+    {   -744,   1436,   -736,   1422,   -729,   1408 },
+    {   -729,   1407,   -728,   1405,   -727,   1403 },
+    {   -723,   1403,   -725,   1416,   -725,   1418 },
+    {   -725,   1452,   -729,   1481,   -729,   1516 },
+    {   -729,   1581,   -713,   1658,   -686,   1713 },
+    {   -661,   1762,   -617,   1779,   -574,   1800 },
+    {   -568,   1803,   -559,   1798,   -554,   1800 },
+    {   -549,   1803,   -548,   1805,   -542,   1805 },
+    {   -524,   1805,   -461,   1807,   -452,   1798 },
+    {   -447,   1793,   -432,   1796,   -432,   1796 },
+    {   -432,   1796,   -442,   1796,   -447,   1796 },
+    {   -458,   1796,   -485,   1805,   -505,   1805 },
+    {   -550,   1805,   -638,   1789,   -659,   1747 },
+    {   -663,   1738,   -674,   1732,   -678,   1723 },
+    {   -687,   1705,   -696,   1689,   -705,   1671 },
+    {   -716,   1650,   -739,   1495,   -727,   1472 },
+    {   -725,   1468,   -722,   1411,   -725,   1406 },
+    {   -725,   1405,   -731,   1399,   -725,   1399 },
+    {   -723,   1400,   -721,   1402,   -720,   1403 },
+    {   -714,   1414,   -723,   1395,   -727,   1399 },
+    {   -728,   1400,   -763,   1462,   -766,   1469 },
+    {   -787,   1511,   -859,   1629,   -905,   1652 },
+    {   -921,   1660,   -935,   1671,   -951,   1679 },
+    {   -959,   1683,   -972,   1680,   -980,   1684 },
+    {  -1027,   1707,  -1105,   1654,  -1143,   1635 },
+    {  -1163,   1625,  -1175,   1603,  -1195,   1593 },
+    {  -1207,   1588,  -1249,   1549,  -1253,   1540 },
+    {  -1269,   1508,  -1303,   1482,  -1319,   1450 },
+    {  -1332,   1424,  -1336,   1385,  -1346,   1367 },
+    {  -1359,   1340,  -1324,   1283,  -1314,   1262 },
+    {  -1274,   1183,  -1108,   1107,  -1034,   1082 },
+    {  -1035,   1080,  -1036,   1077,  -1036,   1075 },
+    {  -1038,   1075,  -1040,   1075,  -1041,   1075 },
+    {  -1041,   1075,  -1038,   1075,  -1036,   1075 },
+    {  -1037,   1076,  -1038,   1078,  -1039,   1080 },
+    {  -1047,   1080,  -1047,   1078,  -1053,   1075 },
+    {  -1070,   1066,  -1119,   1078,  -1136,   1070 },
+    {  -1152,   1062,  -1180,   1066,  -1192,   1060 },
+    {  -1225,   1044,  -1276,   1041,  -1312,   1023 },
+    {  -1336,   1011,  -1358,    994,  -1382,    982 },
+    {  -1399,    974,  -1419,    946,  -1426,    931 },
+    {  -1474,    835,  -1451,    763,  -1407,    673 },
+    {  -1397,    653,  -1380,    637,  -1370,    617 },
+    {  -1361,    598,  -1322,    547,  -1302,    536 },
+    {  -1288,    529,  -1277,    514,  -1263,    507 },
+    {  -1184,    468,  -1120,    476,  -1044,    514 },
+    {  -1013,    530,   -987,    555,   -956,    570 },
+    {   -943,    577,   -930,    592,   -919,    602 },
+    {   -917,    605,   -912,    612,   -912,    612 },
+    {   -912,    612,   -907,    606,   -907,    602 },
+    {   -907,    601,   -938,    545,   -944,    534 },
+    {   -971,    479,   -990,    428,   -990,    361 },
+    {   -990,    354,   -993,    340,   -990,    334 },
+    {   -978,    311,   -970,    285,   -958,    261 },
+    {   -936,    216,   -874,    186,   -834,    166 },
+    {   -817,    157,   -796,    155,   -778,    147 },
+    {   -762,    138,   -739,    143,   -722,    134 },
+    {   -711,    129,   -623,    128,   -610,    134 },
+    {   -602,    138,   -589,    131,   -581,    134 },
+    {   -556,    147,   -525,    144,   -500,    156 },
+    {   -392,    211,   -379,    225,   -325,    332 },
+    {   -318,    345,   -310,    443,   -318,    458 },
+    {   -324,    471,   -321,    487,   -328,    500 },
+    {   -328,    501,   -329,    503,   -330,    505 },
+    {   -329,    505,   -328,    506,   -328,    507 },
+    {   -322,    510,   -279,    465,   -267,    458 },
+    {   -246,    448,   -228,    434,   -208,    424 },
+    {   -192,    416,   -171,    418,   -155,    410 },
+    {   -131,    398,    -68,    425,    -50,    434 },
+    {     38,    478,    101,    570,    143,    653 },
+    {    151,    671,    156,    691,    165,    709 },
+    {    169,    719,    165,    734,    169,    743 },
+    {    178,    760,    178,    797,    169,    814 },
+    {    166,    821,    168,    831,    165,    838 },
+    {    134,    899,     86,    929,     28,    958 },
+    {     14,    965,    -52,    985,    -67,    985 },
+    {    -81,    985,    -96,    992,   -111,    992 },
+    {   -114,    992,   -120,    994,   -120,    994 },
+    {   -120,    994,   -114,    993,   -111,    992 },
+    {    -98,    985,    -78,    991,    -64,    985 },
+    {    -32,    968,     10,    969,     43,    953 },
+    {     93,    928,    136,    898,    162,    846 },
+    {    167,    836,    165,    823,    169,    814 },
+    {    178,    797,    178,    760,    169,    743 },
+    {    165,    734,    169,    719,    165,    709 },
+    {    155,    691,    152,    669,    143,    651 },
+    {    101,    567,     36,    473,    -52,    429 },
+    {    -58,    426,    -66,    427,    -72,    424 },
+    {    -94,    413,   -134,    402,   -159,    415 },
+    {   -165,    417,   -176,    412,   -181,    415 },
+    {   -204,    426,   -229,    435,   -252,    446 },
+    {   -265,    453,   -275,    466,   -289,    473 },
+    {   -301,    479,   -320,    502,   -323,    505 },
+    {   -323,    505,   -324,    506,   -325,    507 },
+    {   -327,    505,   -328,    504,   -330,    502 },
+    {   -330,    490,   -315,    454,   -315,    434 },
+    {   -315,    378,   -322,    329,   -345,    283 },
+    {   -370,    232,   -424,    191,   -474,    166 },
+    {   -493,    156,   -517,    154,   -537,    144 },
+    {   -553,    136,   -598,    141,   -610,    134 },
+    {   -618,    130,   -673,    125,   -683,    130 },
+    {   -709,    143,   -766,    137,   -795,    151 },
+    {   -864,    186,   -933,    203,   -973,    283 },
+    {   -981,    299,   -982,    318,   -990,    334 },
+    {  -1007,    369,   -963,    503,   -949,    531 },
+    {   -943,    543,   -911,    596,   -915,    600 },
+    {   -915,    600,   -916,    601,   -917,    602 },
+    {   -919,    600,   -920,    599,   -922,    597 },
+    {   -946,    573,   -980,    546,  -1010,    531 },
+    {  -1099,    487,  -1167,    458,  -1265,    507 },
+    {  -1333,    541,  -1390,    638,  -1421,    700 },
+    {  -1431,    718,  -1431,    742,  -1441,    760 },
+    {  -1447,    774,  -1461,    843,  -1453,    860 },
+    {  -1446,    875,  -1448,    894,  -1441,    909 },
+    {  -1434,    923,  -1423,    936,  -1416,    950 },
+    {  -1400,    982,  -1355,   1001,  -1329,   1014 },
+    {  -1290,   1033,  -1247,   1038,  -1214,   1055 },
+    {  -1202,   1061,  -1182,   1058,  -1168,   1065 },
+    {  -1150,   1074,  -1120,   1061,  -1102,   1070 },
+    {  -1093,   1074,  -1049,   1080,  -1039,   1080 },
+    {  -1018,   1058,   -998,   1036,   -978,   1014 },
+    {   -968,   1014,   -889,   1025,   -883,   1019 },
+    {   -883,   1017,   -883,   1015,   -883,   1014 },
+    {   -883,    978,   -888,    934,   -873,    904 },
+    {   -865,    889,   -859,    873,   -851,    858 },
+    {   -843,    842,   -812,    819,   -812,    802 },
+    {   -812,    801,   -812,    800,   -812,    799 },
+    {   -827,    769,   -972,    634,  -1002,    619 },
+    {  -1031,    605,  -1054,    582,  -1083,    568 },
+    {  -1097,    561,  -1112,    558,  -1126,    551 },
+    {  -1131,    549,  -1139,    553,  -1143,    551 },
+    {  -1151,    547,  -1170,    541,  -1180,    546 },
+    {  -1196,    554,  -1215,    557,  -1231,    566 },
+    {  -1296,    598,  -1337,    682,  -1365,    739 },
+    {  -1371,    750,  -1376,    787,  -1380,    795 },
+    {  -1397,    829,  -1381,    910,  -1343,    928 },
+    {  -1327,    937,  -1313,    950,  -1297,    958 },
+    {  -1217,    998,  -1075,   1014,   -978,   1014 },
+};
+
+const halo_curve_t flower_curve = { flower_curve_ctrl, 291, -737, 753 };
+
+const unsigned short flower_curve_elbow_flips[] = { 291 };
@@ -0,0 +1,15 @@
+#ifndef FLOWER_CURVE_H
+#define FLOWER_CURVE_H
+
+#include "halo_curve.h"
+
+// Cubic Bezier flower outline, 0.01 cm fixed point
+extern const halo_curve_t flower_curve;
+
+// Elbow branch (HALO_ELBOW_DOWN/UP) from segment 0, flipped at each
+// segment index in flower_curve_elbow_flips; the list ends with the
+// segment count
+#define FLOWER_CURVE_ELBOW_START 0
+extern const unsigned short flower_curve_elbow_flips[];
+
+#endif // FLOWER_CURVE_H
@@ -0,0 +1,2906 @@
+#include "flower_duty.h"
+
+// ----------------------------
+// Generated flower duty table (do not edit)
+// ----------------------------
+
+const unsigned short flower_duty[][2] = {
+    { 1423, 1646 },
+    { 1426, 1646 },
+    { 1428, 1647 },
+    { 1431, 1647 },
+    { 1434, 1648 },
+    { 1436, 1649 },
+    { 1439, 1650 },
+    { 1441, 1650 },
+    { 1444, 1651 },
+    { 1447, 1651 },
+    { 1450, 1652 },
+    { 1452, 1652 },
+    { 1455, 1653 },
+    { 1458, 1653 },
+    { 1461, 1654 },
+    { 1464, 1654 },
+    { 1467, 1655 },
+    { 1469, 1655 },
+    { 1472, 1656 },
+    { 1475, 1656 },
+    { 1478, 1657 },
+    { 1481, 1657 },
+    { 1484, 1657 },
+    { 1487, 1658 },
+    { 1490, 1658 },
+    { 1493, 1658 },
+    { 1496, 1658 },
+    { 1499, 1659 },
+    { 1502, 1659 },
+    { 1505, 1659 },
+    { 1508, 1659 },
+    { 1511, 1659 },
+    { 1514, 1660 },
+    { 1517, 1660 },
+    { 1519, 1661 },
+    { 1522, 1661 },
+    { 1525, 1661 },
+    { 1527, 1662 },
+    { 1530, 1663 },
+    { 1533, 1663 },
+    { 1536, 1664 },
+    { 1538, 1665 },
+    { 1541, 1666 },
+    { 1543, 1667 },
+    { 1545, 1669 },
+    { 1548, 1670 },
+    { 1549, 1672 },
+    { 1551, 1674 },
+    { 1553, 1676 },
+    { 1554, 1678 },
+    { 1555, 1681 },
+    { 1556, 1683 },
+    { 1556, 1686 },
+    { 1557, 1689 },
+    { 1557, 1693 },
+    { 1556, 1696 },
+    { 1556, 1699 },
+    { 1556, 1703 },
+    { 1555, 1706 },
+    { 1554, 1709 },
+    { 1553, 1713 },
+    { 1552, 1716 },
+    { 1551, 1720 },
+    { 1550, 1723 },
+    { 1549, 1727 },
+    { 1547, 1730 },
+    { 1546, 1733 },
+    { 1544, 1737 },
+    { 1543, 1740 },
+    { 1541, 1743 },
+    { 1539, 1747 },
+    { 1537, 1750 },
+    { 1535, 1754 },
+    { 1533, 1757 },
+    { 1531, 1760 },
+    { 1528, 1764 },
+    { 1525, 1767 },
+    { 1522, 1770 },
+    { 1521, 1773 },
+    { 1518, 1777 },
+    { 1515, 1780 },
+    { 1511, 1783 },
+    { 1508, 1786 },
+    { 1505, 1789 },
+    { 1502, 1792 },
+    { 1498, 1796 },
+    { 1494, 1798 },
+    { 1490, 1801 },
+    { 1486, 1804 },
+    { 1482, 1807 },
+    { 1477, 1809 },
+    { 1473, 1812 },
+    { 1468, 1814 },
+    { 1463, 1816 },
+    { 1458, 1819 },
+    { 1454, 1822 },
+    { 1448, 1824 },
+    { 1442, 1825 },
+    { 1436, 1827 },
+    { 1430, 1829 },
+    { 1424, 1830 },
+    { 1418, 1831 },
+    { 1412, 1833 },
+    { 1405, 1834 },
+    { 1399, 1835 },
+    { 1393, 1835 },
+    { 1386, 1835 },
+    { 1380, 1835 },
+    { 1374, 1835 },
+    { 1369, 1834 },
+    { 1363, 1833 },
+    { 1358, 1832 },
+    { 1353, 1831 },
+    { 1349, 1829 },
+    { 1344, 1828 },
+    { 1341, 1826 },
+    { 1337, 1824 },
+    { 1333, 1822 },
+    { 1330, 1820 },
+    { 1327, 1817 },
+    { 1325, 1815 },
+    { 1323, 1812 },
+    { 1321, 1809 },
+    { 1320, 1807 },
+    { 1318, 1804 },
+    { 1318, 1801 },
+    { 1316, 1798 },
+    { 1317, 1795 },
+    { 1316, 1792 },
+    { 1317, 1789 },
+    { 1316, 1786 },
+    { 1316, 1783 },
+    { 1316, 1780 },
+    { 1316, 1777 },
+    { 1317, 1774 },
+    { 1317, 1771 },
+    { 1318, 1767 },
+    { 1319, 1764 },
+    { 1320, 1760 },
+    { 1321, 1757 },
+    { 1322, 1754 },
+    { 1324, 1750 },
+    { 1325, 1747 },
+    { 1327, 1743 },
+    { 1328, 1740 },
+    { 1330, 1736 },
+    { 1331, 1733 },
+    { 1333, 1729 },
+    { 1334, 1726 },
+    { 1336, 1722 },
+    { 1338, 1719 },
+    { 1340, 1715 },
+    { 1342, 1712 },
+    { 1345, 1708 },
+    { 1347, 1705 },
+    { 1349, 1701 },
+    { 1351, 1698 },
+    { 1353, 1695 },
+    { 1357, 1694 },
+    { 1361, 1692 },
+    { 1365, 1691 },
+    { 1369, 1689 },
+    { 1372, 1688 },
+    { 1376, 1686 },
+    { 1380, 1684 },
+    { 1383, 1681 },
+    { 1387, 1679 },
+    { 1391, 1677 },
+    { 1394, 1674 },
+    { 1398, 1672 },
+    { 1401, 1668 },
+    { 1404, 1666 },
+    { 1407, 1663 },
+    { 1411, 1660 },
+    { 1414, 1657 },
+    { 1417, 1653 },
+    { 1420, 1650 },
+    { 1422, 1647 },
+    { 1419, 1648 },
+    { 1416, 1649 },
+    { 1412, 1650 },
+    { 1409, 1652 },
+    { 1405, 1653 },
+    { 1402, 1654 },
+    { 1398, 1655 },
+    { 1395, 1657 },
+    { 1391, 1658 },
+    { 1388, 1659 },
+    { 1384, 1660 },
+    { 1381, 1661 },
+    { 1377, 1662 },
+    { 1374, 1663 },
+    { 1370, 1664 },
+    { 1366, 1665 },
+    { 1363, 1666 },
+    { 1359, 1666 },
+    { 1356, 1667 },
+    { 1352, 1668 },
+    { 1349, 1669 },
+    { 1345, 1669 },
+    { 1342, 1670 },
+    { 1338, 1671 },
+    { 1335, 1671 },
+    { 1332, 1672 },
+    { 1329, 1671 },
+    { 1326, 1670 },
+    { 1324, 1669 },
+    { 1322, 1667 },
+    { 1320, 1666 },
+    { 1319, 1663 },
+    { 1317, 1662 },
+    { 1316, 1659 },
+    { 1314, 1657 },
+    { 1314, 1654 },
+    { 1313, 1651 },
+    { 1313, 1649 },
+    { 1313, 1646 },
+    { 1312, 1643 },
+    { 1312, 1639 },
+    { 1313, 1636 },
+    { 1314, 1632 },
+    { 1314, 1629 },
+    { 1316, 1625 },
+    { 1317, 1621 },
+    { 1318, 1618 },
+    { 1320, 1614 },
+    { 1322, 1610 },
+    { 1323, 1606 },
+    { 1325, 1602 },
+    { 1327, 1598 },
+    { 1330, 1594 },
+    { 1332, 1590 },
+    { 1335, 1587 },
+    { 1338, 1583 },
+    { 1340, 1579 },
+    { 1343, 1575 },
+    { 1346, 1572 },
+    { 1349, 1568 },
+    { 1352, 1565 },
+    { 1355, 1561 },
+    { 1358, 1558 },
+    { 1362, 1555 },
+    { 1365, 1552 },
+    { 1368, 1549 },
+    { 1371, 1546 },
+    { 1374, 1543 },
+    { 1377, 1541 },
+    { 1380, 1538 },
+    { 1384, 1536 },
+    { 1387, 1534 },
+    { 1390, 1532 },
+    { 1393, 1530 },
+    { 1395, 1529 },
+    { 1398, 1528 },
+    { 1401, 1526 },
+    { 1404, 1525 },
+    { 1407, 1524 },
+    { 1409, 1524 },
+    { 1412, 1523 },
+    { 1415, 1522 },
+    { 1417, 1523 },
+    { 1419, 1523 },
+    { 1421, 1523 },
+    { 1423, 1523 },
+    { 1425, 1524 },
+    { 1427, 1525 },
+    { 1429, 1525 },
+    { 1431, 1527 },
+    { 1432, 1528 },
+    { 1434, 1529 },
+    { 1435, 1531 },
+    { 1436, 1533 },
+    { 1437, 1535 },
+    { 1438, 1537 },
+    { 1439, 1540 },
+    { 1440, 1542 },
+    { 1440, 1545 },
+    { 1441, 1547 },
+    { 1441, 1550 },
+    { 1441, 1553 },
+    { 1441, 1556 },
+    { 1441, 1560 },
+    { 1441, 1563 },
+    { 1441, 1566 },
+    { 1440, 1570 },
+    { 1440, 1573 },
+    { 1439, 1576 },
+    { 1438, 1580 },
+    { 1437, 1584 },
+    { 1436, 1587 },
+    { 1435, 1591 },
+    { 1434, 1595 },
+    { 1432, 1599 },
+    { 1431, 1603 },
+    { 1429, 1607 },
+    { 1427, 1611 },
+    { 1425, 1615 },
+    { 1422, 1618 },
+    { 1420, 1622 },
+    { 1417, 1626 },
+    { 1415, 1630 },
+    { 1412, 1633 },
+    { 1409, 1637 },
+    { 1406, 1640 },
+    { 1403, 1643 },
+    { 1400, 1647 },
+    { 1397, 1650 },
+    { 1393, 1652 },
+    { 1390, 1655 },
+    { 1386, 1658 },
+    { 1383, 1661 },
+    { 1379, 1663 },
+    { 1376, 1665 },
+    { 1372, 1667 },
+    { 1368, 1668 },
+    { 1365, 1670 },
+    { 1361, 1671 },
+    { 1358, 1671 },
+    { 1354, 1672 },
+    { 1350, 1674 },
+    { 1347, 1674 },
+    { 1344, 1674 },
+    { 1340, 1674 },
+    { 1337, 1674 },
+    { 1334, 1673 },
+    { 1332, 1673 },
+    { 1329, 1672 },
+    { 1325, 1673 },
+    { 1322, 1673 },
+    { 1318, 1674 },
+    { 1315, 1674 },
+    { 1311, 1674 },
+    { 1308, 1675 },
+    { 1305, 1675 },
+    { 1301, 1675 },
+    { 1298, 1675 },
+    { 1295, 1676 },
+    { 1291, 1676 },
+    { 1293, 1678 },
+    { 1294, 1680 },
+    { 1296, 1682 },
+    { 1297, 1684 },
+    { 1299, 1686 },
+    { 1301, 1689 },
+    { 1303, 1690 },
+    { 1305, 1692 },
+    { 1308, 1693 },
+    { 1310, 1694 },
+    { 1313, 1695 },
+    { 1316, 1696 },
+    { 1319, 1697 },
+    { 1318, 1700 },
+    { 1315, 1703 },
+    { 1314, 1707 },
+    { 1312, 1711 },
+    { 1310, 1714 },
+    { 1308, 1718 },
+    { 1306, 1721 },
+    { 1304, 1725 },
+    { 1302, 1728 },
+    { 1300, 1732 },
+    { 1298, 1735 },
+    { 1296, 1739 },
+    { 1294, 1742 },
+    { 1291, 1745 },
+    { 1289, 1749 },
+    { 1287, 1752 },
+    { 1284, 1756 },
+    { 1282, 1759 },
+    { 1280, 1762 },
+    { 1277, 1766 },
+    { 1275, 1769 },
+    { 1272, 1772 },
+    { 1269, 1776 },
+    { 1266, 1779 },
+    { 1264, 1782 },
+    { 1261, 1785 },
+    { 1258, 1789 },
+    { 1255, 1792 },
+    { 1252, 1795 },
+    { 1249, 1798 },
+    { 1245, 1802 },
+    { 1242, 1805 },
+    { 1238, 1808 },
+    { 1234, 1811 },
+    { 1231, 1814 },
+    { 1226, 1817 },
+    { 1222, 1819 },
+    { 1218, 1822 },
+    { 1213, 1825 },
+    { 1208, 1828 },
+    { 1203, 1830 },
+    { 1197, 1832 },
+    { 1191, 1834 },
+    { 1186, 1836 },
+    { 1179, 1837 },
+    { 1174, 1839 },
+    { 1168, 1840 },
+    { 1162, 1840 },
+    { 1156, 1840 },
+    { 1149, 1841 },
+    { 1144, 1840 },
+    { 1138, 1841 },
+    { 1133, 1839 },
+    { 1127, 1839 },
+    { 1121, 1837 },
+    { 1117, 1836 },
+    { 1112, 1834 },
+    { 1108, 1833 },
+    { 1104, 1830 },
+    { 1100, 1828 },
+    { 1097, 1826 },
+    { 1093, 1824 },
+    { 1090, 1822 },
+    { 1088, 1819 },
+    { 1086, 1817 },
+    { 1084, 1814 },
+    { 1082, 1811 },
+    { 1080, 1809 },
+    { 1078, 1806 },
+    { 1077, 1803 },
+    { 1076, 1800 },
+    { 1075, 1797 },
+    { 1074, 1794 },
+    { 1073, 1791 },
+    { 1072, 1788 },
+    { 1073, 1785 },
+    { 1073, 1782 },
+    { 1073, 1779 },
+    { 1073, 1776 },
+    { 1074, 1772 },
+    { 1073, 1769 },
+    { 1075, 1766 },
+    { 1075, 1763 },
+    { 1077, 1759 },
+    { 1077, 1756 },
+    { 1079, 1753 },
+    { 1081, 1749 },
+    { 1082, 1746 },
+    { 1084, 1743 },
+    { 1086, 1739 },
+    { 1089, 1736 },
+    { 1092, 1733 },
+    { 1095, 1730 },
+    { 1099, 1726 },
+    { 1102, 1724 },
+    { 1106, 1721 },
+    { 1110, 1719 },
+    { 1114, 1716 },
+    { 1118, 1715 },
+    { 1122, 1713 },
+    { 1126, 1711 },
+    { 1130, 1710 },
+    { 1134, 1708 },
+    { 1138, 1707 },
+    { 1142, 1705 },
+    { 1146, 1704 },
+    { 1150, 1703 },
+    { 1154, 1702 },
+    { 1158, 1701 },
+    { 1161, 1700 },
+    { 1165, 1699 },
+    { 1169, 1697 },
+    { 1173, 1697 },
+    { 1176, 1696 },
+    { 1180, 1694 },
+    { 1184, 1693 },
+    { 1188, 1693 },
+    { 1192, 1691 },
+    { 1195, 1690 },
+    { 1199, 1689 },
+    { 1203, 1688 },
+    { 1207, 1687 },
+    { 1210, 1686 },
+    { 1214, 1685 },
+    { 1217, 1684 },
+    { 1221, 1682 },
+    { 1225, 1681 },
+    { 1229, 1680 },
+    { 1232, 1680 },
+    { 1236, 1678 },
+    { 1239, 1676 },
+    { 1243, 1675 },
+    { 1247, 1674 },
+    { 1250, 1673 },
+    { 1254, 1672 },
+    { 1258, 1671 },
+    { 1261, 1670 },
+    { 1265, 1669 },
+    { 1268, 1668 },
+    { 1272, 1667 },
+    { 1276, 1666 },
+    { 1279, 1664 },
+    { 1283, 1663 },
+    { 1286, 1662 },
+    { 1288, 1663 },
+    { 1289, 1666 },
+    { 1289, 1668 },
+    { 1290, 1671 },
+    { 1291, 1674 },
+    { 1290, 1676 },
+    { 1286, 1676 },
+    { 1283, 1676 },
+    { 1280, 1676 },
+    { 1276, 1676 },
+    { 1273, 1676 },
+    { 1270, 1676 },
+    { 1267, 1675 },
+    { 1264, 1675 },
+    { 1261, 1675 },
+    { 1257, 1675 },
+    { 1254, 1675 },
+    { 1251, 1674 },
+    { 1248, 1674 },
+    { 1245, 1673 },
+    { 1242, 1673 },
+    { 1239, 1672 },
+    { 1236, 1672 },
+    { 1233, 1671 },
+    { 1230, 1671 },
+    { 1228, 1670 },
+    { 1225, 1670 },
+    { 1222, 1669 },
+    { 1219, 1668 },
+    { 1216, 1667 },
+    { 1214, 1667 },
+    { 1211, 1666 },
+    { 1208, 1665 },
+    { 1206, 1664 },
+    { 1202, 1664 },
+    { 1199, 1665 },
+    { 1197, 1663 },
+    { 1194, 1663 },
+    { 1191, 1663 },
+    { 1189, 1662 },
+    { 1186, 1662 },
+    { 1184, 1661 },
+    { 1181, 1661 },
+    { 1179, 1659 },
+    { 1176, 1659 },
+    { 1174, 1657 },
+    { 1172, 1656 },
+    { 1169, 1656 },
+    { 1167, 1654 },
+    { 1165, 1653 },
+    { 1163, 1651 },
+    { 1161, 1650 },
+    { 1159, 1648 },
+    { 1158, 1646 },
+    { 1156, 1644 },
+    { 1154, 1642 },
+    { 1153, 1640 },
+    { 1152, 1637 },
+    { 1151, 1635 },
+    { 1151, 1632 },
+    { 1150, 1629 },
+    { 1150, 1626 },
+    { 1150, 1623 },
+    { 1150, 1620 },
+    { 1150, 1617 },
+    { 1151, 1613 },
+    { 1151, 1609 },
+    { 1152, 1606 },
+    { 1154, 1602 },
+    { 1156, 1598 },
+    { 1157, 1594 },
+    { 1159, 1590 },
+    { 1161, 1587 },
+    { 1162, 1583 },
+    { 1165, 1579 },
+    { 1167, 1575 },
+    { 1169, 1571 },
+    { 1172, 1567 },
+    { 1175, 1563 },
+    { 1177, 1559 },
+    { 1180, 1556 },
+    { 1183, 1552 },
+    { 1186, 1548 },
+    { 1189, 1544 },
+    { 1192, 1540 },
+    { 1194, 1537 },
+    { 1197, 1533 },
+    { 1200, 1529 },
+    { 1203, 1525 },
+    { 1206, 1522 },
+    { 1209, 1518 },
+    { 1212, 1514 },
+    { 1215, 1510 },
+    { 1218, 1507 },
+    { 1221, 1503 },
+    { 1224, 1499 },
+    { 1227, 1495 },
+    { 1230, 1492 },
+    { 1233, 1488 },
+    { 1237, 1485 },
+    { 1240, 1481 },
+    { 1243, 1477 },
+    { 1246, 1474 },
+    { 1249, 1470 },
+    { 1252, 1466 },
+    { 1256, 1463 },
+    { 1259, 1460 },
+    { 1262, 1457 },
+    { 1265, 1454 },
+    { 1268, 1450 },
+    { 1271, 1448 },
+    { 1274, 1445 },
+    { 1278, 1443 },
+    { 1280, 1441 },
+    { 1283, 1439 },
+    { 1286, 1438 },
+    { 1288, 1436 },
+    { 1290, 1436 },
+    { 1293, 1436 },
+    { 1295, 1433 },
+    { 1298, 1433 },
+    { 1298, 1435 },
+    { 1300, 1435 },
+    { 1303, 1435 },
+    { 1304, 1435 },
+    { 1305, 1437 },
+    { 1307, 1437 },
+    { 1308, 1439 },
+    { 1310, 1440 },
+    { 1311, 1441 },
+    { 1312, 1443 },
+    { 1313, 1445 },
+    { 1314, 1447 },
+    { 1315, 1448 },
+    { 1316, 1450 },
+    { 1317, 1452 },
+    { 1318, 1455 },
+    { 1318, 1457 },
+    { 1319, 1459 },
+    { 1320, 1461 },
+    { 1321, 1464 },
+    { 1321, 1466 },
+    { 1322, 1468 },
+    { 1324, 1466 },
+    { 1324, 1463 },
+    { 1325, 1459 },
+    { 1326, 1455 },
+    { 1327, 1451 },
+    { 1328, 1446 },
+    { 1329, 1442 },
+    { 1330, 1438 },
+    { 1332, 1433 },
+    { 1333, 1429 },
+    { 1334, 1424 },
+    { 1337, 1419 },
+    { 1338, 1415 },
+    { 1340, 1410 },
+    { 1342, 1405 },
+    { 1344, 1400 },
+    { 1347, 1394 },
+    { 1350, 1390 },
+    { 1352, 1384 },
+    { 1355, 1379 },
+    { 1358, 1374 },
+    { 1361, 1368 },
+    { 1364, 1363 },
+    { 1368, 1357 },
+    { 1371, 1352 },
+    { 1375, 1346 },
+    { 1379, 1341 },
+    { 1382, 1336 },
+    { 1386, 1330 },
+    { 1390, 1325 },
+    { 1393, 1320 },
+    { 1397, 1315 },
+    { 1400, 1311 },
+    { 1404, 1306 },
+    { 1408, 1301 },
+    { 1411, 1297 },
+    { 1415, 1292 },
+    { 1419, 1287 },
+    { 1423, 1282 },
+    { 1426, 1278 },
+    { 1429, 1274 },
+    { 1433, 1269 },
+    { 1437, 1266 },
+    { 1440, 1263 },
+    { 1444, 1257 },
+    { 1446, 1255 },
+    { 1445, 1256 },
+    { 1441, 1261 },
+    { 1439, 1263 },
+    { 1435, 1268 },
+    { 1431, 1272 },
+    { 1428, 1276 },
+    { 1424, 1281 },
+    { 1421, 1285 },
+    { 1417, 1289 },
+    { 1413, 1294 },
+    { 1410, 1299 },
+    { 1406, 1304 },
+    { 1402, 1308 },
+    { 1399, 1313 },
+    { 1395, 1318 },
+    { 1391, 1323 },
+    { 1388, 1328 },
+    { 1384, 1334 },
+    { 1380, 1339 },
+    { 1377, 1344 },
+    { 1373, 1349 },
+    { 1370, 1355 },
+    { 1366, 1360 },
+    { 1363, 1366 },
+    { 1360, 1371 },
+    { 1357, 1377 },
+    { 1353, 1382 },
+    { 1351, 1387 },
+    { 1348, 1392 },
+    { 1345, 1398 },
+    { 1343, 1403 },
+    { 1341, 1408 },
+    { 1338, 1413 },
+    { 1338, 1417 },
+    { 1335, 1422 },
+    { 1333, 1427 },
+    { 1332, 1431 },
+    { 1330, 1436 },
+    { 1330, 1440 },
+    { 1328, 1444 },
+    { 1327, 1449 },
+    { 1326, 1453 },
+    { 1325, 1457 },
+    { 1325, 1461 },
+    { 1324, 1464 },
+    { 1323, 1468 },
+    { 1321, 1468 },
+    { 1321, 1466 },
+    { 1320, 1463 },
+    { 1320, 1461 },
+    { 1319, 1459 },
+    { 1318, 1457 },
+    { 1317, 1455 },
+    { 1316, 1452 },
+    { 1315, 1450 },
+    { 1314, 1448 },
+    { 1313, 1447 },
+    { 1312, 1445 },
+    { 1311, 1443 },
+    { 1310, 1441 },
+    { 1309, 1440 },
+    { 1308, 1438 },
+    { 1307, 1437 },
+    { 1305, 1437 },
+    { 1304, 1435 },
+    { 1302, 1435 },
+    { 1300, 1435 },
+    { 1298, 1435 },
+    { 1297, 1433 },
+    { 1295, 1434 },
+    { 1292, 1436 },
+    { 1290, 1436 },
+    { 1288, 1436 },
+    { 1285, 1439 },
+    { 1283, 1439 },
+    { 1280, 1441 },
+    { 1277, 1444 },
+    { 1274, 1446 },
+    { 1271, 1449 },
+    { 1268, 1452 },
+    { 1265, 1455 },
+    { 1261, 1458 },
+    { 1258, 1461 },
+    { 1255, 1464 },
+    { 1252, 1468 },
+    { 1249, 1471 },
+    { 1245, 1475 },
+    { 1242, 1478 },
+    { 1239, 1482 },
+    { 1236, 1486 },
+    { 1233, 1489 },
+    { 1230, 1493 },
+    { 1226, 1497 },
+    { 1223, 1500 },
+    { 1220, 1504 },
+    { 1217, 1508 },
+    { 1214, 1511 },
+    { 1211, 1515 },
+    { 1208, 1519 },
+    { 1205, 1522 },
+    { 1202, 1526 },
+    { 1199, 1530 },
+    { 1196, 1534 },
+    { 1194, 1538 },
+    { 1191, 1541 },
+    { 1188, 1545 },
+    { 1185, 1549 },
+    { 1182, 1553 },
+    { 1179, 1557 },
+    { 1177, 1560 },
+    { 1174, 1564 },
+    { 1172, 1568 },
+    { 1169, 1572 },
+    { 1166, 1576 },
+    { 1164, 1580 },
+    { 1162, 1584 },
+    { 1161, 1588 },
+    { 1158, 1591 },
+    { 1156, 1595 },
+    { 1155, 1599 },
+    { 1154, 1603 },
+    { 1152, 1607 },
+    { 1151, 1610 },
+    { 1151, 1614 },
+    { 1150, 1617 },
+    { 1150, 1621 },
+    { 1150, 1624 },
+    { 1151, 1627 },
+    { 1151, 1630 },
+    { 1151, 1633 },
+    { 1152, 1635 },
+    { 1153, 1638 },
+    { 1154, 1640 },
+    { 1156, 1642 },
+    { 1157, 1644 },
+    { 1159, 1646 },
+    { 1160, 1648 },
+    { 1162, 1650 },
+    { 1164, 1652 },
+    { 1166, 1653 },
+    { 1168, 1655 },
+    { 1170, 1656 },
+    { 1172, 1657 },
+    { 1175, 1657 },
+    { 1177, 1659 },
+    { 1180, 1659 },
+    { 1182, 1661 },
+    { 1185, 1661 },
+    { 1187, 1662 },
+    { 1190, 1662 },
+    { 1192, 1664 },
+    { 1195, 1663 },
+    { 1198, 1664 },
+    { 1200, 1664 },
+    { 1204, 1664 },
+    { 1207, 1663 },
+    { 1211, 1661 },
+    { 1214, 1658 },
+    { 1218, 1656 },
+    { 1222, 1654 },
+    { 1225, 1652 },
+    { 1229, 1649 },
+    { 1232, 1647 },
+    { 1236, 1644 },
+    { 1239, 1642 },
+    { 1243, 1640 },
+    { 1246, 1640 },
+    { 1249, 1640 },
+    { 1252, 1640 },
+    { 1255, 1639 },
+    { 1258, 1639 },
+    { 1261, 1639 },
+    { 1264, 1638 },
+    { 1267, 1637 },
+    { 1270, 1637 },
+    { 1273, 1637 },
+    { 1277, 1636 },
+    { 1280, 1635 },
+    { 1283, 1635 },
+    { 1286, 1634 },
+    { 1289, 1633 },
+    { 1292, 1632 },
+    { 1294, 1630 },
+    { 1296, 1626 },
+    { 1297, 1623 },
+    { 1299, 1619 },
+    { 1301, 1615 },
+    { 1303, 1611 },
+    { 1304, 1607 },
+    { 1307, 1603 },
+    { 1309, 1599 },
+    { 1311, 1595 },
+    { 1314, 1592 },
+    { 1316, 1588 },
+    { 1319, 1584 },
+    { 1322, 1580 },
+    { 1324, 1576 },
+    { 1327, 1573 },
+    { 1328, 1569 },
+    { 1327, 1567 },
+    { 1326, 1565 },
+    { 1325, 1562 },
+    { 1324, 1560 },
+    { 1324, 1558 },
+    { 1323, 1555 },
+    { 1322, 1553 },
+    { 1321, 1550 },
+    { 1320, 1548 },
+    { 1319, 1546 },
+    { 1318, 1544 },
+    { 1317, 1541 },
+    { 1317, 1539 },
+    { 1316, 1537 },
+    { 1315, 1534 },
+    { 1314, 1532 },
+    { 1314, 1530 },
+    { 1313, 1527 },
+    { 1312, 1525 },
+    { 1311, 1523 },
+    { 1310, 1520 },
+    { 1309, 1518 },
+    { 1309, 1516 },
+    { 1308, 1513 },
+    { 1307, 1511 },
+    { 1306, 1509 },
+    { 1305, 1506 },
+    { 1305, 1504 },
+    { 1304, 1502 },
+    { 1303, 1500 },
+    { 1302, 1497 },
+    { 1302, 1495 },
+    { 1301, 1493 },
+    { 1300, 1490 },
+    { 1299, 1488 },
+    { 1298, 1486 },
+    { 1297, 1484 },
+    { 1296, 1482 },
+    { 1295, 1480 },
+    { 1295, 1478 },
+    { 1294, 1476 },
+    { 1292, 1474 },
+    { 1291, 1473 },
+    { 1290, 1471 },
+    { 1289, 1469 },
+    { 1287, 1469 },
+    { 1286, 1467 },
+    { 1284, 1467 },
+    { 1281, 1468 },
+    { 1279, 1468 },
+    { 1277, 1468 },
+    { 1275, 1469 },
+    { 1272, 1471 },
+    { 1269, 1472 },
+    { 1266, 1475 },
+    { 1263, 1477 },
+    { 1260, 1480 },
+    { 1256, 1484 },
+    { 1253, 1487 },
+    { 1250, 1490 },
+    { 1247, 1494 },
+    { 1244, 1498 },
+    { 1241, 1501 },
+    { 1237, 1505 },
+    { 1234, 1508 },
+    { 1231, 1512 },
+    { 1228, 1516 },
+    { 1225, 1520 },
+    { 1222, 1524 },
+    { 1219, 1527 },
+    { 1216, 1531 },
+    { 1213, 1535 },
+    { 1210, 1538 },
+    { 1208, 1542 },
+    { 1205, 1546 },
+    { 1202, 1550 },
+    { 1199, 1554 },
+    { 1196, 1558 },
+    { 1193, 1562 },
+    { 1191, 1566 },
+    { 1188, 1570 },
+    { 1186, 1574 },
+    { 1183, 1578 },
+    { 1181, 1582 },
+    { 1179, 1585 },
+    { 1177, 1589 },
+    { 1175, 1593 },
+    { 1174, 1597 },
+    { 1173, 1601 },
+    { 1173, 1604 },
+    { 1172, 1607 },
+    { 1173, 1610 },
+    { 1173, 1613 },
+    { 1174, 1616 },
+    { 1175, 1618 },
+    { 1176, 1621 },
+    { 1177, 1623 },
+    { 1179, 1625 },
+    { 1180, 1626 },
+    { 1182, 1628 },
+    { 1184, 1630 },
+    { 1186, 1630 },
+    { 1189, 1632 },
+    { 1190, 1633 },
+    { 1192, 1634 },
+    { 1195, 1634 },
+    { 1197, 1636 },
+    { 1200, 1636 },
+    { 1201, 1638 },
+    { 1204, 1637 },
+    { 1207, 1638 },
+    { 1209, 1639 },
+    { 1212, 1638 },
+    { 1214, 1640 },
+    { 1217, 1639 },
+    { 1220, 1640 },
+    { 1222, 1640 },
+    { 1225, 1640 },
+    { 1228, 1641 },
+    { 1231, 1640 },
+    { 1234, 1640 },
+    { 1236, 1641 },
+    { 1239, 1640 },
+    { 1243, 1640 },
+    { 1246, 1637 },
+    { 1249, 1635 },
+    { 1253, 1632 },
+    { 1256, 1630 },
+    { 1260, 1627 },
+    { 1263, 1624 },
+    { 1267, 1622 },
+    { 1270, 1619 },
+    { 1273, 1616 },
+    { 1277, 1614 },
+    { 1280, 1611 },
+    { 1283, 1608 },
+    { 1287, 1605 },
+    { 1290, 1603 },
+    { 1293, 1600 },
+    { 1297, 1597 },
+    { 1300, 1594 },
+    { 1303, 1591 },
+    { 1306, 1588 },
+    { 1310, 1585 },
+    { 1313, 1582 },
+    { 1316, 1579 },
+    { 1319, 1576 },
+    { 1322, 1573 },
+    { 1326, 1570 },
+    { 1329, 1567 },
+    { 1332, 1564 },
+    { 1335, 1561 },
+    { 1338, 1557 },
+    { 1342, 1554 },
+    { 1345, 1551 },
+    { 1348, 1548 },
+    { 1351, 1544 },
+    { 1354, 1541 },
+    { 1357, 1538 },
+    { 1361, 1534 },
+    { 1364, 1531 },
+    { 1367, 1528 },
+    { 1370, 1526 },
+    { 1373, 1523 },
+    { 1376, 1520 },
+    { 1379, 1518 },
+    { 1382, 1515 },
+    { 1385, 1513 },
+    { 1388, 1511 },
+    { 1391, 1509 },
+    { 1394, 1506 },
+    { 1396, 1502 },
+    { 1397, 1498 },
+    { 1399, 1493 },
+    { 1400, 1489 },
+    { 1402, 1485 },
+    { 1404, 1481 },
+    { 1406, 1477 },
+    { 1407, 1472 },
+    { 1408, 1468 },
+    { 1408, 1470 },
+    { 1407, 1474 },
+    { 1405, 1478 },
+    { 1403, 1483 },
+    { 1402, 1487 },
+    { 1400, 1491 },
+    { 1399, 1495 },
+    { 1396, 1499 },
+    { 1395, 1504 },
+    { 1393, 1508 },
+    { 1390, 1510 },
+    { 1387, 1512 },
+    { 1384, 1514 },
+    { 1381, 1517 },
+    { 1378, 1519 },
+    { 1375, 1521 },
+    { 1371, 1525 },
+    { 1368, 1527 },
+    { 1365, 1530 },
+    { 1362, 1533 },
+    { 1359, 1536 },
+    { 1356, 1539 },
+    { 1353, 1541 },
+    { 1352, 1539 },
+    { 1351, 1537 },
+    { 1350, 1534 },
+    { 1349, 1532 },
+    { 1348, 1530 },
+    { 1348, 1527 },
+    { 1347, 1525 },
+    { 1346, 1522 },
+    { 1346, 1520 },
+    { 1345, 1517 },
+    { 1345, 1514 },
+    { 1344, 1512 },
+    { 1344, 1509 },
+    { 1343, 1506 },
+    { 1343, 1503 },
+    { 1343, 1501 },
+    { 1342, 1498 },
+    { 1342, 1495 },
+    { 1342, 1492 },
+    { 1342, 1489 },
+    { 1342, 1486 },
+    { 1342, 1482 },
+    { 1342, 1479 },
+    { 1342, 1476 },
+    { 1342, 1473 },
+    { 1342, 1469 },
+    { 1342, 1466 },
+    { 1343, 1462 },
+    { 1344, 1458 },
+    { 1343, 1455 },
+    { 1344, 1452 },
+    { 1344, 1448 },
+    { 1345, 1444 },
+    { 1346, 1440 },
+    { 1347, 1436 },
+    { 1348, 1432 },
+    { 1348, 1428 },
+    { 1349, 1424 },
+    { 1351, 1419 },
+    { 1352, 1415 },
+    { 1354, 1410 },
+    { 1356, 1405 },
+    { 1357, 1401 },
+    { 1359, 1396 },
+    { 1362, 1391 },
+    { 1365, 1385 },
+    { 1368, 1380 },
+    { 1371, 1375 },
+    { 1374, 1369 },
+    { 1378, 1364 },
+    { 1381, 1359 },
+    { 1385, 1354 },
+    { 1388, 1349 },
+    { 1392, 1344 },
+    { 1395, 1340 },
+    { 1399, 1335 },
+    { 1402, 1330 },
+    { 1406, 1326 },
+    { 1409, 1322 },
+    { 1413, 1318 },
+    { 1416, 1314 },
+    { 1420, 1310 },
+    { 1423, 1307 },
+    { 1427, 1302 },
+    { 1429, 1300 },
+    { 1433, 1296 },
+    { 1435, 1294 },
+    { 1439, 1289 },
+    { 1442, 1287 },
+    { 1444, 1285 },
+    { 1448, 1280 },
+    { 1451, 1278 },
+    { 1453, 1276 },
+    { 1456, 1273 },
+    { 1458, 1273 },
+    { 1460, 1273 },
+    { 1462, 1271 },
+    { 1463, 1272 },
+    { 1466, 1271 },
+    { 1467, 1272 },
+    { 1467, 1274 },
+    { 1468, 1276 },
+    { 1468, 1280 },
+    { 1468, 1283 },
+    { 1467, 1287 },
+    { 1467, 1291 },
+    { 1466, 1295 },
+    { 1465, 1300 },
+    { 1464, 1305 },
+    { 1462, 1310 },
+    { 1461, 1314 },
+    { 1459, 1320 },
+    { 1458, 1324 },
+    { 1456, 1330 },
+    { 1456, 1334 },
+    { 1453, 1340 },
+    { 1451, 1345 },
+    { 1451, 1349 },
+    { 1449, 1355 },
+    { 1447, 1360 },
+    { 1445, 1366 },
+    { 1443, 1371 },
+    { 1441, 1376 },
+    { 1439, 1381 },
+    { 1437, 1386 },
+    { 1436, 1392 },
+    { 1434, 1397 },
+    { 1432, 1401 },
+    { 1431, 1406 },
+    { 1429, 1411 },
+    { 1428, 1416 },
+    { 1426, 1421 },
+    { 1424, 1425 },
+    { 1423, 1430 },
+    { 1420, 1435 },
+    { 1419, 1439 },
+    { 1418, 1444 },
+    { 1416, 1448 },
+    { 1414, 1453 },
+    { 1413, 1457 },
+    { 1411, 1462 },
+    { 1411, 1464 },
+    { 1412, 1460 },
+    { 1413, 1455 },
+    { 1415, 1451 },
+    { 1417, 1446 },
+    { 1418, 1442 },
+    { 1420, 1437 },
+    { 1421, 1433 },
+    { 1424, 1428 },
+    { 1425, 1423 },
+    { 1427, 1419 },
+    { 1428, 1414 },
+    { 1430, 1409 },
+    { 1431, 1404 },
+    { 1433, 1399 },
+    { 1435, 1394 },
+    { 1436, 1389 },
+    { 1438, 1384 },
+    { 1440, 1379 },
+    { 1442, 1374 },
+    { 1444, 1368 },
+    { 1446, 1363 },
+    { 1448, 1358 },
+    { 1450, 1352 },
+    { 1451, 1347 },
+    { 1452, 1343 },
+    { 1454, 1337 },
+    { 1456, 1332 },
+    { 1457, 1328 },
+    { 1459, 1321 },
+    { 1460, 1318 },
+    { 1462, 1312 },
+    { 1463, 1308 },
+    { 1465, 1302 },
+    { 1465, 1298 },
+    { 1466, 1293 },
+    { 1468, 1288 },
+    { 1468, 1284 },
+    { 1468, 1281 },
+    { 1469, 1277 },
+    { 1469, 1274 },
+    { 1468, 1272 },
+    { 1467, 1271 },
+    { 1465, 1272 },
+    { 1464, 1271 },
+    { 1461, 1271 },
+    { 1459, 1274 },
+    { 1458, 1272 },
+    { 1455, 1274 },
+    { 1452, 1276 },
+    { 1450, 1279 },
+    { 1446, 1283 },
+    { 1443, 1286 },
+    { 1441, 1288 },
+    { 1438, 1290 },
+    { 1434, 1294 },
+    { 1432, 1296 },
+    { 1428, 1301 },
+    { 1425, 1304 },
+    { 1422, 1307 },
+    { 1419, 1311 },
+    { 1416, 1314 },
+    { 1412, 1318 },
+    { 1409, 1322 },
+    { 1405, 1326 },
+    { 1402, 1331 },
+    { 1398, 1335 },
+    { 1395, 1340 },
+    { 1391, 1344 },
+    { 1388, 1349 },
+    { 1384, 1354 },
+    { 1381, 1359 },
+    { 1377, 1364 },
+    { 1374, 1369 },
+    { 1370, 1375 },
+    { 1367, 1380 },
+    { 1364, 1386 },
+    { 1362, 1391 },
+    { 1359, 1396 },
+    { 1357, 1401 },
+    { 1356, 1405 },
+    { 1354, 1410 },
+    { 1352, 1416 },
+    { 1351, 1419 },
+    { 1349, 1424 },
+    { 1348, 1428 },
+    { 1347, 1433 },
+    { 1346, 1437 },
+    { 1345, 1441 },
+    { 1345, 1445 },
+    { 1344, 1449 },
+    { 1344, 1452 },
+    { 1343, 1456 },
+    { 1343, 1459 },
+    { 1342, 1463 },
+    { 1342, 1466 },
+    { 1342, 1470 },
+    { 1342, 1473 },
+    { 1342, 1476 },
+    { 1341, 1480 },
+    { 1341, 1483 },
+    { 1341, 1486 },
+    { 1341, 1489 },
+    { 1342, 1492 },
+    { 1342, 1495 },
+    { 1342, 1498 },
+    { 1342, 1501 },
+    { 1343, 1504 },
+    { 1343, 1507 },
+    { 1343, 1509 },
+    { 1344, 1512 },
+    { 1344, 1515 },
+    { 1345, 1518 },
+    { 1345, 1520 },
+    { 1346, 1523 },
+    { 1347, 1525 },
+    { 1347, 1528 },
+    { 1348, 1530 },
+    { 1349, 1532 },
+    { 1350, 1535 },
+    { 1350, 1537 },
+    { 1351, 1540 },
+    { 1353, 1541 },
+    { 1355, 1541 },
+    { 1358, 1540 },
+    { 1361, 1539 },
+    { 1363, 1539 },
+    { 1366, 1538 },
+    { 1369, 1537 },
+    { 1372, 1536 },
+    { 1374, 1536 },
+    { 1377, 1535 },
+    { 1380, 1534 },
+    { 1383, 1533 },
+    { 1385, 1532 },
+    { 1388, 1531 },
+    { 1391, 1530 },
+    { 1394, 1529 },
+    { 1397, 1528 },
+    { 1399, 1527 },
+    { 1402, 1526 },
+    { 1405, 1525 },
+    { 1408, 1523 },
+    { 1411, 1522 },
+    { 1414, 1521 },
+    { 1417, 1520 },
+    { 1419, 1518 },
+    { 1422, 1517 },
+    { 1425, 1516 },
+    { 1428, 1514 },
+    { 1431, 1513 },
+    { 1434, 1511 },
+    { 1437, 1510 },
+    { 1440, 1508 },
+    { 1443, 1507 },
+    { 1445, 1505 },
+    { 1448, 1503 },
+    { 1451, 1502 },
+    { 1454, 1500 },
+    { 1457, 1498 },
+    { 1460, 1497 },
+    { 1463, 1495 },
+    { 1466, 1493 },
+    { 1469, 1491 },
+    { 1472, 1489 },
+    { 1475, 1487 },
+    { 1478, 1484 },
+    { 1481, 1481 },
+    { 1484, 1476 },
+    { 1487, 1473 },
+    { 1490, 1469 },
+    { 1492, 1465 },
+    { 1495, 1462 },
+    { 1498, 1458 },
+    { 1501, 1454 },
+    { 1504, 1449 },
+    { 1507, 1445 },
+    { 1510, 1441 },
+    { 1513, 1436 },
+    { 1517, 1432 },
+    { 1520, 1428 },
+    { 1523, 1423 },
+    { 1526, 1419 },
+    { 1529, 1414 },
+    { 1532, 1409 },
+    { 1536, 1404 },
+    { 1539, 1399 },
+    { 1542, 1394 },
+    { 1545, 1389 },
+    { 1548, 1384 },
+    { 1551, 1379 },
+    { 1555, 1374 },
+    { 1558, 1368 },
+    { 1561, 1362 },
+    { 1565, 1357 },
+    { 1568, 1351 },
+    { 1571, 1345 },
+    { 1575, 1339 },
+    { 1578, 1332 },
+    { 1582, 1326 },
+    { 1585, 1320 },
+    { 1588, 1313 },
+    { 1592, 1306 },
+    { 1595, 1299 },
+    { 1599, 1292 },
+    { 1602, 1285 },
+    { 1605, 1278 },
+    { 1609, 1270 },
+    { 1612, 1263 },
+    { 1615, 1256 },
+    { 1618, 1249 },
+    { 1620, 1242 },
+    { 1622, 1236 },
+    { 1624, 1229 },
+    { 1625, 1224 },
+    { 1626, 1219 },
+    { 1627, 1214 },
+    { 1628, 1210 },
+    { 1628, 1207 },
+    { 1628, 1203 },
+    { 1628, 1200 },
+    { 1628, 1197 },
+    { 1628, 1193 },
+    { 1628, 1190 },
+    { 1627, 1188 },
+    { 1627, 1186 },
+    { 1626, 1184 },
+    { 1626, 1182 },
+    { 1625, 1180 },
+    { 1624, 1178 },
+    { 1623, 1177 },
+    { 1622, 1176 },
+    { 1621, 1175 },
+    { 1620, 1174 },
+    { 1619, 1173 },
+    { 1618, 1171 },
+    { 1617, 1170 },
+    { 1615, 1170 },
+    { 1614, 1170 },
+    { 1612, 1170 },
+    { 1611, 1169 },
+    { 1609, 1169 },
+    { 1607, 1169 },
+    { 1606, 1169 },
+    { 1602, 1173 },
+    { 1600, 1173 },
+    { 1598, 1174 },
+    { 1596, 1176 },
+    { 1592, 1180 },
+    { 1590, 1181 },
+    { 1587, 1184 },
+    { 1583, 1190 },
+    { 1579, 1194 },
+    { 1575, 1200 },
+    { 1571, 1206 },
+    { 1567, 1211 },
+    { 1562, 1218 },
+    { 1557, 1226 },
+    { 1553, 1234 },
+    { 1548, 1242 },
+    { 1543, 1250 },
+    { 1539, 1258 },
+    { 1535, 1265 },
+    { 1531, 1273 },
+    { 1527, 1280 },
+    { 1523, 1287 },
+    { 1519, 1295 },
+    { 1515, 1302 },
+    { 1512, 1308 },
+    { 1508, 1315 },
+    { 1504, 1322 },
+    { 1501, 1328 },
+    { 1498, 1335 },
+    { 1494, 1341 },
+    { 1491, 1347 },
+    { 1488, 1353 },
+    { 1485, 1359 },
+    { 1482, 1365 },
+    { 1479, 1371 },
+    { 1476, 1376 },
+    { 1474, 1382 },
+    { 1471, 1387 },
+    { 1469, 1392 },
+    { 1466, 1398 },
+    { 1463, 1403 },
+    { 1460, 1409 },
+    { 1458, 1414 },
+    { 1455, 1419 },
+    { 1452, 1424 },
+    { 1450, 1429 },
+    { 1448, 1434 },
+    { 1445, 1439 },
+    { 1443, 1444 },
+    { 1441, 1449 },
+    { 1438, 1454 },
+    { 1436, 1459 },
+    { 1433, 1464 },
+    { 1431, 1468 },
+    { 1429, 1473 },
+    { 1426, 1478 },
+    { 1424, 1482 },
+    { 1422, 1487 },
+    { 1420, 1491 },
+    { 1420, 1495 },
+    { 1422, 1494 },
+    { 1424, 1494 },
+    { 1427, 1493 },
+    { 1429, 1493 },
+    { 1431, 1493 },
+    { 1433, 1493 },
+    { 1435, 1494 },
+    { 1437, 1494 },
+    { 1439, 1495 },
+    { 1441, 1495 },
+    { 1443, 1496 },
+    { 1445, 1496 },
+    { 1447, 1498 },
+    { 1448, 1499 },
+    { 1450, 1500 },
+    { 1451, 1501 },
+    { 1453, 1503 },
+    { 1454, 1505 },
+    { 1455, 1507 },
+    { 1456, 1508 },
+    { 1459, 1506 },
+    { 1462, 1503 },
+    { 1465, 1499 },
+    { 1469, 1495 },
+    { 1472, 1492 },
+    { 1475, 1488 },
+    { 1478, 1485 },
+    { 1481, 1483 },
+    { 1484, 1481 },
+    { 1487, 1479 },
+    { 1490, 1477 },
+    { 1493, 1475 },
+    { 1496, 1473 },
+    { 1499, 1471 },
+    { 1502, 1469 },
+    { 1505, 1466 },
+    { 1508, 1464 },
+    { 1511, 1462 },
+    { 1514, 1458 },
+    { 1517, 1454 },
+    { 1520, 1449 },
+    { 1523, 1445 },
+    { 1526, 1440 },
+    { 1530, 1435 },
+    { 1533, 1431 },
+    { 1536, 1426 },
+    { 1539, 1421 },
+    { 1542, 1416 },
+    { 1545, 1411 },
+    { 1548, 1406 },
+    { 1551, 1401 },
+    { 1555, 1396 },
+    { 1558, 1391 },
+    { 1561, 1385 },
+    { 1564, 1380 },
+    { 1567, 1374 },
+    { 1571, 1369 },
+    { 1574, 1363 },
+    { 1577, 1357 },
+    { 1580, 1351 },
+    { 1584, 1345 },
+    { 1587, 1339 },
+    { 1590, 1333 },
+    { 1594, 1326 },
+    { 1597, 1320 },
+    { 1600, 1313 },
+    { 1604, 1306 },
+    { 1607, 1300 },
+    { 1611, 1292 },
+    { 1614, 1285 },
+    { 1617, 1278 },
+    { 1621, 1271 },
+    { 1624, 1263 },
+    { 1628, 1255 },
+    { 1631, 1248 },
+    { 1634, 1240 },
+    { 1637, 1232 },
+    { 1640, 1224 },
+    { 1643, 1217 },
+    { 1646, 1209 },
+    { 1649, 1201 },
+    { 1652, 1193 },
+    { 1654, 1185 },
+    { 1656, 1180 },
+    { 1658, 1174 },
+    { 1661, 1165 },
+    { 1662, 1159 },
+    { 1664, 1153 },
+    { 1665, 1147 },
+    { 1667, 1141 },
+    { 1669, 1134 },
+    { 1671, 1127 },
+    { 1672, 1122 },
+    { 1673, 1117 },
+    { 1674, 1112 },
+    { 1675, 1107 },
+    { 1676, 1101 },
+    { 1677, 1097 },
+    { 1677, 1093 },
+    { 1678, 1088 },
+    { 1679, 1084 },
+    { 1679, 1080 },
+    { 1679, 1077 },
+    { 1679, 1073 },
+    { 1679, 1069 },
+    { 1680, 1065 },
+    { 1681, 1061 },
+    { 1681, 1056 },
+    { 1681, 1054 },
+    { 1681, 1051 },
+    { 1681, 1048 },
+    { 1681, 1045 },
+    { 1681, 1041 },
+    { 1679, 1041 },
+    { 1677, 1043 },
+    { 1675, 1044 },
+    { 1673, 1045 },
+    { 1671, 1046 },
+    { 1669, 1046 },
+    { 1667, 1046 },
+    { 1665, 1047 },
+    { 1664, 1046 },
+    { 1657, 1057 },
+    { 1654, 1060 },
+    { 1651, 1063 },
+    { 1648, 1066 },
+    { 1642, 1074 },
+    { 1637, 1081 },
+    { 1634, 1086 },
+    { 1628, 1094 },
+    { 1622, 1104 },
+    { 1619, 1106 },
+    { 1614, 1114 },
+    { 1608, 1123 },
+    { 1602, 1131 },
+    { 1595, 1144 },
+    { 1590, 1151 },
+    { 1585, 1160 },
+    { 1580, 1168 },
+    { 1574, 1177 },
+    { 1569, 1185 },
+    { 1564, 1194 },
+    { 1559, 1203 },
+    { 1553, 1212 },
+    { 1548, 1220 },
+    { 1544, 1229 },
+    { 1539, 1237 },
+    { 1534, 1245 },
+    { 1530, 1253 },
+    { 1525, 1261 },
+    { 1521, 1269 },
+    { 1517, 1276 },
+    { 1513, 1283 },
+    { 1509, 1290 },
+    { 1505, 1298 },
+    { 1502, 1304 },
+    { 1498, 1311 },
+    { 1494, 1318 },
+    { 1491, 1324 },
+    { 1488, 1331 },
+    { 1484, 1337 },
+    { 1481, 1343 },
+    { 1478, 1349 },
+    { 1474, 1355 },
+    { 1471, 1361 },
+    { 1468, 1367 },
+    { 1465, 1373 },
+    { 1462, 1379 },
+    { 1460, 1384 },
+    { 1457, 1390 },
+    { 1454, 1395 },
+    { 1451, 1401 },
+    { 1448, 1406 },
+    { 1446, 1411 },
+    { 1443, 1417 },
+    { 1442, 1418 },
+    { 1443, 1413 },
+    { 1444, 1409 },
+    { 1446, 1404 },
+    { 1447, 1399 },
+    { 1449, 1394 },
+    { 1451, 1389 },
+    { 1454, 1383 },
+    { 1455, 1378 },
+    { 1457, 1373 },
+    { 1459, 1368 },
+    { 1461, 1363 },
+    { 1462, 1358 },
+    { 1463, 1353 },
+    { 1465, 1348 },
+    { 1467, 1342 },
+    { 1469, 1337 },
+    { 1471, 1331 },
+    { 1473, 1325 },
+    { 1474, 1321 },
+    { 1476, 1315 },
+    { 1478, 1309 },
+    { 1479, 1305 },
+    { 1481, 1299 },
+    { 1483, 1294 },
+    { 1484, 1289 },
+    { 1486, 1284 },
+    { 1488, 1278 },
+    { 1488, 1274 },
+    { 1490, 1268 },
+    { 1491, 1263 },
+    { 1493, 1257 },
+    { 1495, 1252 },
+    { 1496, 1247 },
+    { 1497, 1242 },
+    { 1497, 1238 },
+    { 1497, 1234 },
+    { 1498, 1230 },
+    { 1498, 1227 },
+    { 1498, 1223 },
+    { 1499, 1219 },
+    { 1498, 1218 },
+    { 1497, 1216 },
+    { 1496, 1214 },
+    { 1495, 1213 },
+    { 1494, 1212 },
+    { 1491, 1215 },
+    { 1490, 1213 },
+    { 1487, 1216 },
+    { 1485, 1216 },
+    { 1484, 1217 },
+    { 1481, 1219 },
+    { 1478, 1222 },
+    { 1475, 1224 },
+    { 1472, 1227 },
+    { 1469, 1229 },
+    { 1466, 1232 },
+    { 1462, 1238 },
+    { 1459, 1240 },
+    { 1457, 1243 },
+    { 1453, 1248 },
+    { 1450, 1250 },
+    { 1451, 1249 },
+    { 1454, 1247 },
+    { 1458, 1241 },
+    { 1461, 1239 },
+    { 1464, 1236 },
+    { 1468, 1231 },
+    { 1470, 1228 },
+    { 1473, 1226 },
+    { 1476, 1223 },
+    { 1479, 1221 },
+    { 1482, 1218 },
+    { 1485, 1215 },
+    { 1486, 1217 },
+    { 1489, 1215 },
+    { 1491, 1212 },
+    { 1492, 1215 },
+    { 1494, 1214 },
+    { 1495, 1214 },
+    { 1496, 1216 },
+    { 1497, 1218 },
+    { 1498, 1220 },
+    { 1498, 1222 },
+    { 1498, 1226 },
+    { 1498, 1229 },
+    { 1498, 1232 },
+    { 1497, 1237 },
+    { 1496, 1241 },
+    { 1496, 1245 },
+    { 1494, 1250 },
+    { 1493, 1256 },
+    { 1492, 1261 },
+    { 1491, 1266 },
+    { 1489, 1271 },
+    { 1488, 1276 },
+    { 1486, 1282 },
+    { 1485, 1286 },
+    { 1483, 1293 },
+    { 1482, 1297 },
+    { 1480, 1303 },
+    { 1478, 1308 },
+    { 1477, 1313 },
+    { 1474, 1319 },
+    { 1474, 1323 },
+    { 1472, 1329 },
+    { 1470, 1335 },
+    { 1467, 1340 },
+    { 1465, 1346 },
+    { 1464, 1351 },
+    { 1462, 1356 },
+    { 1461, 1361 },
+    { 1459, 1366 },
+    { 1458, 1371 },
+    { 1456, 1377 },
+    { 1454, 1382 },
+    { 1452, 1387 },
+    { 1450, 1392 },
+    { 1448, 1397 },
+    { 1446, 1402 },
+    { 1445, 1407 },
+    { 1443, 1412 },
+    { 1442, 1416 },
+    { 1441, 1420 },
+    { 1440, 1421 },
+    { 1440, 1421 },
+    { 1441, 1422 },
+    { 1443, 1417 },
+    { 1446, 1412 },
+    { 1448, 1406 },
+    { 1451, 1401 },
+    { 1454, 1396 },
+    { 1457, 1390 },
+    { 1460, 1385 },
+    { 1462, 1379 },
+    { 1465, 1373 },
+    { 1468, 1367 },
+    { 1471, 1362 },
+    { 1474, 1356 },
+    { 1478, 1350 },
+    { 1481, 1344 },
+    { 1484, 1337 },
+    { 1488, 1331 },
+    { 1491, 1325 },
+    { 1495, 1318 },
+    { 1498, 1312 },
+    { 1502, 1305 },
+    { 1505, 1298 },
+    { 1509, 1291 },
+    { 1513, 1284 },
+    { 1517, 1276 },
+    { 1521, 1269 },
+    { 1525, 1262 },
+    { 1530, 1254 },
+    { 1534, 1246 },
+    { 1539, 1238 },
+    { 1544, 1229 },
+    { 1548, 1220 },
+    { 1553, 1212 },
+    { 1559, 1203 },
+    { 1564, 1194 },
+    { 1569, 1186 },
+    { 1575, 1177 },
+    { 1580, 1167 },
+    { 1585, 1159 },
+    { 1591, 1150 },
+    { 1596, 1142 },
+    { 1603, 1130 },
+    { 1608, 1122 },
+    { 1614, 1113 },
+    { 1620, 1106 },
+    { 1622, 1103 },
+    { 1629, 1093 },
+    { 1633, 1087 },
+    { 1638, 1080 },
+    { 1642, 1075 },
+    { 1645, 1072 },
+    { 1649, 1067 },
+    { 1654, 1060 },
+    { 1659, 1053 },
+    { 1661, 1052 },
+    { 1663, 1052 },
+    { 1665, 1052 },
+    { 1666, 1052 },
+    { 1668, 1051 },
+    { 1670, 1050 },
+    { 1672, 1049 },
+    { 1675, 1048 },
+    { 1677, 1047 },
+    { 1677, 1049 },
+    { 1677, 1052 },
+    { 1677, 1055 },
+    { 1678, 1058 },
+    { 1678, 1060 },
+    { 1678, 1063 },
+    { 1678, 1067 },
+    { 1677, 1071 },
+    { 1677, 1075 },
+    { 1677, 1079 },
+    { 1677, 1082 },
+    { 1677, 1085 },
+    { 1677, 1088 },
+    { 1676, 1093 },
+    { 1675, 1097 },
+    { 1675, 1101 },
+    { 1675, 1105 },
+    { 1673, 1111 },
+    { 1672, 1116 },
+    { 1672, 1121 },
+    { 1671, 1125 },
+    { 1670, 1131 },
+    { 1668, 1137 },
+    { 1666, 1144 },
+    { 1664, 1150 },
+    { 1663, 1155 },
+    { 1662, 1161 },
+    { 1660, 1168 },
+    { 1657, 1176 },
+    { 1656, 1181 },
+    { 1654, 1188 },
+    { 1651, 1196 },
+    { 1649, 1203 },
+    { 1645, 1212 },
+    { 1642, 1219 },
+    { 1639, 1227 },
+    { 1636, 1234 },
+    { 1633, 1243 },
+    { 1629, 1250 },
+    { 1626, 1258 },
+    { 1623, 1266 },
+    { 1619, 1273 },
+    { 1616, 1281 },
+    { 1613, 1288 },
+    { 1609, 1295 },
+    { 1606, 1302 },
+    { 1602, 1309 },
+    { 1599, 1316 },
+    { 1596, 1322 },
+    { 1592, 1329 },
+    { 1589, 1335 },
+    { 1585, 1341 },
+    { 1582, 1347 },
+    { 1579, 1353 },
+    { 1576, 1359 },
+    { 1572, 1365 },
+    { 1569, 1371 },
+    { 1566, 1376 },
+    { 1563, 1382 },
+    { 1559, 1387 },
+    { 1556, 1393 },
+    { 1553, 1398 },
+    { 1550, 1403 },
+    { 1547, 1408 },
+    { 1544, 1413 },
+    { 1541, 1418 },
+    { 1537, 1423 },
+    { 1534, 1428 },
+    { 1531, 1432 },
+    { 1528, 1437 },
+    { 1525, 1442 },
+    { 1522, 1446 },
+    { 1519, 1450 },
+    { 1516, 1454 },
+    { 1513, 1458 },
+    { 1511, 1462 },
+    { 1513, 1462 },
+    { 1512, 1463 },
+    { 1514, 1459 },
+    { 1517, 1457 },
+    { 1520, 1455 },
+    { 1523, 1451 },
+    { 1526, 1448 },
+    { 1529, 1445 },
+    { 1532, 1442 },
+    { 1535, 1440 },
+    { 1538, 1436 },
+    { 1541, 1433 },
+    { 1544, 1430 },
+    { 1547, 1428 },
+    { 1550, 1424 },
+    { 1554, 1420 },
+    { 1556, 1419 },
+    { 1559, 1415 },
+    { 1563, 1411 },
+    { 1565, 1409 },
+    { 1569, 1405 },
+    { 1571, 1403 },
+    { 1575, 1399 },
+    { 1578, 1396 },
+    { 1581, 1393 },
+    { 1584, 1391 },
+    { 1587, 1388 },
+    { 1590, 1385 },
+    { 1593, 1382 },
+    { 1597, 1379 },
+    { 1600, 1376 },
+    { 1602, 1374 },
+    { 1605, 1371 },
+    { 1608, 1368 },
+    { 1612, 1366 },
+    { 1615, 1363 },
+    { 1617, 1361 },
+    { 1620, 1359 },
+    { 1623, 1357 },
+    { 1626, 1355 },
+    { 1628, 1354 },
+    { 1630, 1353 },
+    { 1633, 1352 },
+    { 1635, 1351 },
+    { 1637, 1350 },
+    { 1639, 1350 },
+    { 1641, 1350 },
+    { 1643, 1351 },
+    { 1644, 1352 },
+    { 1645, 1352 },
+    { 1647, 1353 },
+    { 1647, 1355 },
+    { 1648, 1357 },
+    { 1649, 1359 },
+    { 1649, 1362 },
+    { 1650, 1365 },
+    { 1650, 1368 },
+    { 1650, 1371 },
+    { 1650, 1374 },
+    { 1650, 1377 },
+    { 1650, 1381 },
+    { 1650, 1384 },
+    { 1649, 1388 },
+    { 1648, 1392 },
+    { 1648, 1395 },
+    { 1647, 1399 },
+    { 1647, 1402 },
+    { 1646, 1407 },
+    { 1645, 1410 },
+    { 1645, 1414 },
+    { 1644, 1418 },
+    { 1643, 1422 },
+    { 1643, 1426 },
+    { 1642, 1430 },
+    { 1641, 1434 },
+    { 1640, 1438 },
+    { 1639, 1443 },
+    { 1638, 1447 },
+    { 1637, 1451 },
+    { 1636, 1455 },
+    { 1635, 1459 },
+    { 1635, 1463 },
+    { 1634, 1467 },
+    { 1633, 1471 },
+    { 1632, 1475 },
+    { 1631, 1480 },
+    { 1629, 1484 },
+    { 1628, 1488 },
+    { 1627, 1492 },
+    { 1625, 1497 },
+    { 1624, 1501 },
+    { 1623, 1505 },
+    { 1621, 1509 },
+    { 1620, 1513 },
+    { 1618, 1518 },
+    { 1617, 1522 },
+    { 1614, 1526 },
+    { 1613, 1530 },
+    { 1611, 1535 },
+    { 1609, 1539 },
+    { 1606, 1543 },
+    { 1605, 1547 },
+    { 1602, 1551 },
+    { 1600, 1554 },
+    { 1597, 1558 },
+    { 1595, 1562 },
+    { 1592, 1566 },
+    { 1589, 1570 },
+    { 1586, 1573 },
+    { 1583, 1577 },
+    { 1580, 1579 },
+    { 1577, 1583 },
+    { 1574, 1585 },
+    { 1571, 1589 },
+    { 1568, 1592 },
+    { 1564, 1594 },
+    { 1561, 1597 },
+    { 1558, 1599 },
+    { 1555, 1602 },
+    { 1551, 1604 },
+    { 1548, 1607 },
+    { 1544, 1609 },
+    { 1541, 1611 },
+    { 1538, 1613 },
+    { 1534, 1615 },
+    { 1531, 1617 },
+    { 1528, 1618 },
+    { 1524, 1620 },
+    { 1521, 1622 },
+    { 1517, 1623 },
+    { 1514, 1624 },
+    { 1511, 1626 },
+    { 1507, 1627 },
+    { 1504, 1628 },
+    { 1501, 1629 },
+    { 1498, 1629 },
+    { 1497, 1631 },
+    { 1497, 1633 },
+    { 1501, 1633 },
+    { 1504, 1633 },
+    { 1506, 1633 },
+    { 1509, 1633 },
+    { 1512, 1634 },
+    { 1514, 1634 },
+    { 1517, 1634 },
+    { 1520, 1634 },
+    { 1522, 1634 },
+    { 1525, 1635 },
+    { 1528, 1635 },
+    { 1530, 1636 },
+    { 1533, 1636 },
+    { 1536, 1636 },
+    { 1539, 1637 },
+    { 1542, 1637 },
+    { 1544, 1637 },
+    { 1547, 1638 },
+    { 1549, 1639 },
+    { 1551, 1640 },
+    { 1555, 1640 },
+    { 1557, 1641 },
+    { 1559, 1642 },
+    { 1561, 1644 },
+    { 1563, 1645 },
+    { 1565, 1646 },
+    { 1568, 1648 },
+    { 1570, 1649 },
+    { 1571, 1651 },
+    { 1573, 1653 },
+    { 1574, 1655 },
+    { 1576, 1657 },
+    { 1577, 1659 },
+    { 1578, 1662 },
+    { 1579, 1664 },
+    { 1580, 1667 },
+    { 1580, 1670 },
+    { 1581, 1673 },
+    { 1581, 1676 },
+    { 1581, 1679 },
+    { 1582, 1682 },
+    { 1582, 1685 },
+    { 1581, 1688 },
+    { 1581, 1692 },
+    { 1581, 1695 },
+    { 1580, 1698 },
+    { 1580, 1702 },
+    { 1580, 1705 },
+    { 1579, 1708 },
+    { 1578, 1712 },
+    { 1577, 1715 },
+    { 1577, 1718 },
+    { 1575, 1722 },
+    { 1574, 1725 },
+    { 1573, 1729 },
+    { 1573, 1732 },
+    { 1572, 1735 },
+    { 1570, 1739 },
+    { 1569, 1742 },
+    { 1567, 1746 },
+    { 1565, 1749 },
+    { 1564, 1753 },
+    { 1562, 1756 },
+    { 1561, 1759 },
+    { 1559, 1763 },
+    { 1556, 1766 },
+    { 1554, 1770 },
+    { 1553, 1773 },
+    { 1551, 1776 },
+    { 1548, 1779 },
+    { 1546, 1783 },
+    { 1543, 1786 },
+    { 1541, 1789 },
+    { 1538, 1793 },
+    { 1534, 1796 },
+    { 1530, 1799 },
+    { 1528, 1802 },
+    { 1525, 1805 },
+    { 1521, 1808 },
+    { 1517, 1811 },
+    { 1514, 1814 },
+    { 1509, 1817 },
+    { 1506, 1820 },
+    { 1502, 1823 },
+    { 1497, 1825 },
+    { 1492, 1828 },
+    { 1487, 1831 },
+    { 1482, 1833 },
+    { 1477, 1836 },
+    { 1471, 1838 },
+    { 1466, 1840 },
+    { 1460, 1843 },
+    { 1454, 1844 },
+    { 1447, 1846 },
+    { 1441, 1848 },
+    { 1434, 1850 },
+    { 1427, 1851 },
+    { 1420, 1852 },
+    { 1413, 1853 },
+    { 1406, 1855 },
+    { 1399, 1856 },
+    { 1391, 1856 },
+    { 1384, 1856 },
+    { 1377, 1857 },
+    { 1370, 1857 },
+    { 1363, 1856 },
+    { 1356, 1856 },
+    { 1350, 1855 },
+    { 1344, 1854 },
+    { 1338, 1854 },
+    { 1331, 1853 },
+    { 1327, 1851 },
+    { 1321, 1850 },
+    { 1317, 1848 },
+    { 1311, 1847 },
+    { 1307, 1844 },
+    { 1304, 1842 },
+    { 1301, 1840 },
+    { 1297, 1838 },
+    { 1294, 1835 },
+    { 1291, 1833 },
+    { 1289, 1830 },
+    { 1287, 1828 },
+    { 1286, 1825 },
+    { 1285, 1822 },
+    { 1283, 1819 },
+    { 1282, 1816 },
+    { 1281, 1813 },
+    { 1280, 1810 },
+    { 1281, 1807 },
+    { 1280, 1804 },
+    { 1276, 1806 },
+    { 1273, 1809 },
+    { 1271, 1812 },
+    { 1268, 1816 },
+    { 1264, 1819 },
+    { 1261, 1822 },
+    { 1257, 1825 },
+    { 1253, 1828 },
+    { 1249, 1831 },
+    { 1245, 1834 },
+    { 1240, 1837 },
+    { 1236, 1840 },
+    { 1231, 1842 },
+    { 1226, 1845 },
+    { 1221, 1848 },
+    { 1215, 1850 },
+    { 1209, 1852 },
+    { 1204, 1854 },
+    { 1197, 1855 },
+    { 1190, 1857 },
+    { 1184, 1859 },
+    { 1177, 1860 },
+    { 1169, 1861 },
+    { 1162, 1862 },
+    { 1154, 1863 },
+    { 1148, 1862 },
+    { 1140, 1863 },
+    { 1134, 1862 },
+    { 1127, 1863 },
+    { 1121, 1861 },
+    { 1114, 1861 },
+    { 1107, 1860 },
+    { 1101, 1859 },
+    { 1095, 1857 },
+    { 1090, 1856 },
+    { 1084, 1854 },
+    { 1079, 1853 },
+    { 1075, 1850 },
+    { 1071, 1848 },
+    { 1067, 1846 },
+    { 1063, 1844 },
+    { 1060, 1841 },
+    { 1057, 1839 },
+    { 1055, 1836 },
+    { 1052, 1834 },
+    { 1050, 1831 },
+    { 1047, 1828 },
+    { 1046, 1826 },
+    { 1045, 1823 },
+    { 1043, 1820 },
+    { 1042, 1817 },
+    { 1041, 1814 },
+    { 1040, 1811 },
+    { 1039, 1808 },
+    { 1039, 1805 },
+    { 1038, 1802 },
+    { 1038, 1799 },
+    { 1039, 1795 },
+    { 1038, 1792 },
+    { 1039, 1789 },
+    { 1039, 1786 },
+    { 1040, 1783 },
+    { 1040, 1779 },
+    { 1041, 1776 },
+    { 1042, 1773 },
+    { 1043, 1769 },
+    { 1044, 1766 },
+    { 1045, 1763 },
+    { 1048, 1759 },
+    { 1048, 1756 },
+    { 1051, 1753 },
+    { 1053, 1749 },
+    { 1054, 1746 },
+    { 1057, 1743 },
+    { 1059, 1739 },
+    { 1062, 1736 },
+    { 1064, 1733 },
+    { 1067, 1729 },
+    { 1071, 1726 },
+    { 1073, 1723 },
+    { 1077, 1720 },
+    { 1080, 1717 },
+    { 1084, 1714 },
+    { 1087, 1712 },
+    { 1091, 1709 },
+    { 1095, 1706 },
+    { 1099, 1704 },
+    { 1103, 1702 },
+    { 1106, 1700 },
+    { 1110, 1698 },
+    { 1114, 1696 },
+    { 1118, 1694 },
+    { 1122, 1692 },
+    { 1126, 1690 },
+    { 1130, 1689 },
+    { 1133, 1687 },
+    { 1137, 1686 },
+    { 1141, 1684 },
+    { 1145, 1683 },
+    { 1148, 1682 },
+    { 1152, 1681 },
+    { 1155, 1680 },
+    { 1159, 1679 },
+    { 1162, 1678 },
+    { 1166, 1676 },
+    { 1169, 1676 },
+    { 1173, 1674 },
+    { 1177, 1673 },
+    { 1180, 1673 },
+    { 1184, 1672 },
+    { 1187, 1671 },
+    { 1191, 1669 },
+    { 1195, 1668 },
+    { 1198, 1668 },
+    { 1202, 1667 },
+    { 1204, 1666 },
+    { 1201, 1667 },
+    { 1197, 1668 },
+    { 1194, 1669 },
+    { 1190, 1669 },
+    { 1187, 1671 },
+    { 1183, 1672 },
+    { 1180, 1673 },
+    { 1176, 1674 },
+    { 1172, 1674 },
+    { 1169, 1676 },
+    { 1165, 1677 },
+    { 1162, 1678 },
+    { 1158, 1679 },
+    { 1155, 1680 },
+    { 1151, 1681 },
+    { 1148, 1682 },
+    { 1144, 1683 },
+    { 1141, 1685 },
+    { 1137, 1686 },
+    { 1133, 1687 },
+    { 1129, 1688 },
+    { 1125, 1690 },
+    { 1121, 1692 },
+    { 1118, 1693 },
+    { 1114, 1695 },
+    { 1110, 1697 },
+    { 1106, 1699 },
+    { 1102, 1701 },
+    { 1098, 1704 },
+    { 1095, 1706 },
+    { 1091, 1709 },
+    { 1087, 1711 },
+    { 1083, 1714 },
+    { 1080, 1717 },
+    { 1077, 1720 },
+    { 1073, 1723 },
+    { 1070, 1726 },
+    { 1067, 1730 },
+    { 1064, 1733 },
+    { 1061, 1736 },
+    { 1059, 1740 },
+    { 1056, 1743 },
+    { 1054, 1746 },
+    { 1053, 1750 },
+    { 1051, 1753 },
+    { 1048, 1756 },
+    { 1048, 1760 },
+    { 1045, 1763 },
+    { 1044, 1766 },
+    { 1043, 1770 },
+    { 1042, 1773 },
+    { 1041, 1776 },
+    { 1040, 1780 },
+    { 1039, 1783 },
+    { 1039, 1786 },
+    { 1039, 1790 },
+    { 1039, 1793 },
+    { 1039, 1796 },
+    { 1037, 1799 },
+    { 1038, 1802 },
+    { 1038, 1805 },
+    { 1038, 1809 },
+    { 1039, 1812 },
+    { 1040, 1814 },
+    { 1041, 1817 },
+    { 1043, 1820 },
+    { 1044, 1823 },
+    { 1045, 1826 },
+    { 1047, 1829 },
+    { 1049, 1832 },
+    { 1051, 1834 },
+    { 1054, 1837 },
+    { 1057, 1840 },
+    { 1059, 1842 },
+    { 1063, 1844 },
+    { 1067, 1847 },
+    { 1071, 1849 },
+    { 1075, 1851 },
+    { 1080, 1853 },
+    { 1084, 1855 },
+    { 1089, 1856 },
+    { 1095, 1858 },
+    { 1101, 1859 },
+    { 1107, 1861 },
+    { 1114, 1861 },
+    { 1121, 1861 },
+    { 1127, 1863 },
+    { 1134, 1863 },
+    { 1141, 1863 },
+    { 1148, 1862 },
+    { 1155, 1863 },
+    { 1162, 1862 },
+    { 1170, 1861 },
+    { 1177, 1860 },
+    { 1184, 1859 },
+    { 1190, 1857 },
+    { 1197, 1855 },
+    { 1204, 1854 },
+    { 1209, 1852 },
+    { 1216, 1850 },
+    { 1221, 1847 },
+    { 1227, 1845 },
+    { 1232, 1842 },
+    { 1237, 1839 },
+    { 1242, 1837 },
+    { 1246, 1834 },
+    { 1251, 1831 },
+    { 1254, 1828 },
+    { 1258, 1825 },
+    { 1262, 1822 },
+    { 1265, 1819 },
+    { 1269, 1815 },
+    { 1272, 1812 },
+    { 1275, 1809 },
+    { 1278, 1807 },
+    { 1278, 1805 },
+    { 1281, 1806 },
+    { 1280, 1809 },
+    { 1281, 1813 },
+    { 1281, 1816 },
+    { 1283, 1818 },
+    { 1284, 1821 },
+    { 1286, 1824 },
+    { 1286, 1827 },
+    { 1289, 1830 },
+    { 1291, 1832 },
+    { 1293, 1835 },
+    { 1296, 1838 },
+    { 1299, 1840 },
+    { 1303, 1842 },
+    { 1307, 1844 },
+    { 1311, 1846 },
+    { 1316, 1848 },
+    { 1320, 1850 },
+    { 1326, 1851 },
+    { 1331, 1853 },
+    { 1337, 1854 },
+    { 1343, 1855 },
+    { 1350, 1856 },
+    { 1357, 1856 },
+    { 1364, 1856 },
+    { 1370, 1857 },
+    { 1377, 1857 },
+    { 1384, 1857 },
+    { 1391, 1857 },
+    { 1399, 1856 },
+    { 1406, 1855 },
+    { 1413, 1854 },
+    { 1420, 1853 },
+    { 1427, 1852 },
+    { 1434, 1850 },
+    { 1441, 1849 },
+    { 1447, 1847 },
+    { 1454, 1845 },
+    { 1460, 1843 },
+    { 1465, 1840 },
+    { 1471, 1838 },
+    { 1477, 1836 },
+    { 1481, 1833 },
+    { 1487, 1831 },
+    { 1491, 1828 },
+    { 1495, 1826 },
+    { 1500, 1823 },
+    { 1505, 1820 },
+    { 1509, 1817 },
+    { 1514, 1815 },
+    { 1517, 1811 },
+    { 1520, 1808 },
+    { 1524, 1806 },
+    { 1527, 1802 },
+    { 1530, 1799 },
+    { 1533, 1796 },
+    { 1537, 1793 },
+    { 1540, 1790 },
+    { 1543, 1787 },
+    { 1545, 1783 },
+    { 1548, 1780 },
+    { 1550, 1777 },
+    { 1553, 1773 },
+    { 1553, 1770 },
+    { 1556, 1767 },
+    { 1558, 1763 },
+    { 1561, 1760 },
+    { 1561, 1757 },
+    { 1563, 1753 },
+    { 1565, 1750 },
+    { 1566, 1747 },
+    { 1568, 1743 },
+    { 1570, 1740 },
+    { 1571, 1736 },
+    { 1572, 1733 },
+    { 1573, 1730 },
+    { 1575, 1726 },
+    { 1575, 1723 },
+    { 1576, 1719 },
+    { 1578, 1716 },
+    { 1579, 1713 },
+    { 1579, 1709 },
+    { 1579, 1706 },
+    { 1581, 1702 },
+    { 1581, 1699 },
+    { 1581, 1696 },
+    { 1581, 1693 },
+    { 1582, 1689 },
+    { 1582, 1686 },
+    { 1582, 1683 },
+    { 1582, 1680 },
+    { 1582, 1677 },
+    { 1581, 1674 },
+    { 1581, 1671 },
+    { 1581, 1668 },
+    { 1580, 1665 },
+    { 1579, 1662 },
+    { 1578, 1660 },
+    { 1576, 1658 },
+    { 1575, 1656 },
+    { 1574, 1653 },
+    { 1571, 1652 },
+    { 1571, 1649 },
+    { 1568, 1648 },
+    { 1566, 1647 },
+    { 1564, 1646 },
+    { 1562, 1644 },
+    { 1560, 1643 },
+    { 1558, 1642 },
+    { 1556, 1640 },
+    { 1553, 1640 },
+    { 1550, 1640 },
+    { 1548, 1639 },
+    { 1545, 1638 },
+    { 1543, 1637 },
+    { 1540, 1637 },
+    { 1537, 1636 },
+    { 1534, 1636 },
+    { 1532, 1636 },
+    { 1529, 1635 },
+    { 1526, 1635 },
+    { 1524, 1634 },
+    { 1521, 1634 },
+    { 1518, 1634 },
+    { 1515, 1634 },
+    { 1513, 1633 },
+    { 1511, 1633 },
+    { 1508, 1633 },
+    { 1505, 1632 },
+    { 1502, 1632 },
+    { 1499, 1633 },
+    { 1500, 1630 },
+    { 1503, 1629 },
+    { 1506, 1628 },
+    { 1509, 1627 },
+    { 1513, 1626 },
+    { 1516, 1624 },
+    { 1519, 1622 },
+    { 1523, 1621 },
+    { 1526, 1619 },
+    { 1530, 1618 },
+    { 1533, 1616 },
+    { 1536, 1614 },
+    { 1540, 1612 },
+    { 1543, 1610 },
+    { 1547, 1608 },
+    { 1550, 1605 },
+    { 1553, 1603 },
+    { 1557, 1601 },
+    { 1560, 1598 },
+    { 1563, 1595 },
+    { 1566, 1593 },
+    { 1569, 1590 },
+    { 1573, 1587 },
+    { 1576, 1584 },
+    { 1579, 1581 },
+    { 1582, 1577 },
+    { 1585, 1575 },
+    { 1588, 1571 },
+    { 1591, 1567 },
+    { 1593, 1564 },
+    { 1596, 1560 },
+    { 1599, 1556 },
+    { 1601, 1552 },
+    { 1603, 1548 },
+    { 1606, 1544 },
+    { 1608, 1541 },
+    { 1609, 1537 },
+    { 1612, 1533 },
+    { 1614, 1528 },
+    { 1616, 1524 },
+    { 1618, 1520 },
+    { 1619, 1515 },
+    { 1621, 1511 },
+    { 1622, 1507 },
+    { 1624, 1503 },
+    { 1625, 1498 },
+    { 1626, 1494 },
+    { 1628, 1490 },
+    { 1629, 1486 },
+    { 1630, 1481 },
+    { 1632, 1477 },
+    { 1633, 1473 },
+    { 1634, 1469 },
+    { 1635, 1465 },
+    { 1635, 1461 },
+    { 1636, 1457 },
+    { 1637, 1453 },
+    { 1638, 1449 },
+    { 1639, 1445 },
+    { 1640, 1440 },
+    { 1641, 1436 },
+    { 1642, 1432 },
+    { 1642, 1429 },
+    { 1643, 1424 },
+    { 1644, 1420 },
+    { 1645, 1416 },
+    { 1646, 1412 },
+    { 1646, 1408 },
+    { 1647, 1404 },
+    { 1647, 1401 },
+    { 1648, 1397 },
+    { 1648, 1394 },
+    { 1649, 1390 },
+    { 1649, 1386 },
+    { 1650, 1383 },
+    { 1650, 1379 },
+    { 1650, 1375 },
+    { 1650, 1373 },
+    { 1650, 1370 },
+    { 1649, 1367 },
+    { 1649, 1364 },
+    { 1649, 1362 },
+    { 1648, 1359 },
+    { 1648, 1356 },
+    { 1647, 1355 },
+    { 1646, 1354 },
+    { 1645, 1352 },
+    { 1644, 1350 },
+    { 1642, 1350 },
+    { 1641, 1349 },
+    { 1639, 1349 },
+    { 1637, 1349 },
+    { 1635, 1350 },
+    { 1632, 1351 },
+    { 1630, 1352 },
+    { 1628, 1353 },
+    { 1625, 1355 },
+    { 1622, 1357 },
+    { 1620, 1359 },
+    { 1617, 1361 },
+    { 1614, 1364 },
+    { 1611, 1366 },
+    { 1608, 1368 },
+    { 1605, 1371 },
+    { 1602, 1374 },
+    { 1599, 1377 },
+    { 1596, 1380 },
+    { 1592, 1383 },
+    { 1589, 1386 },
+    { 1586, 1389 },
+    { 1583, 1391 },
+    { 1580, 1394 },
+    { 1577, 1397 },
+    { 1574, 1401 },
+    { 1571, 1404 },
+    { 1568, 1406 },
+    { 1564, 1410 },
+    { 1562, 1412 },
+    { 1559, 1416 },
+    { 1555, 1419 },
+    { 1553, 1421 },
+    { 1549, 1425 },
+    { 1546, 1429 },
+    { 1544, 1430 },
+    { 1540, 1434 },
+    { 1537, 1437 },
+    { 1534, 1441 },
+    { 1532, 1442 },
+    { 1528, 1446 },
+    { 1525, 1449 },
+    { 1522, 1453 },
+    { 1519, 1456 },
+    { 1516, 1457 },
+    { 1513, 1460 },
+    { 1511, 1465 },
+    { 1508, 1470 },
+    { 1506, 1474 },
+    { 1504, 1479 },
+    { 1501, 1484 },
+    { 1499, 1488 },
+    { 1497, 1493 },
+    { 1495, 1497 },
+    { 1493, 1502 },
+    { 1489, 1505 },
+    { 1486, 1507 },
+    { 1484, 1509 },
+    { 1481, 1512 },
+    { 1477, 1515 },
+    { 1474, 1518 },
+    { 1471, 1521 },
+    { 1468, 1524 },
+    { 1465, 1527 },
+    { 1462, 1530 },
+    { 1462, 1533 },
+    { 1462, 1536 },
+    { 1462, 1539 },
+    { 1462, 1542 },
+    { 1462, 1545 },
+    { 1462, 1548 },
+    { 1462, 1552 },
+    { 1462, 1555 },
+    { 1461, 1558 },
+    { 1461, 1561 },
+    { 1460, 1565 },
+    { 1460, 1568 },
+    { 1459, 1572 },
+    { 1458, 1576 },
+    { 1457, 1580 },
+    { 1456, 1584 },
+    { 1454, 1588 },
+    { 1453, 1591 },
+    { 1452, 1595 },
+    { 1450, 1599 },
+    { 1448, 1603 },
+    { 1446, 1607 },
+    { 1445, 1611 },
+    { 1445, 1614 },
+    { 1448, 1614 },
+    { 1451, 1614 },
+    { 1453, 1614 },
+    { 1456, 1614 },
+    { 1459, 1614 },
+    { 1462, 1614 },
+    { 1465, 1614 },
+    { 1468, 1613 },
+    { 1471, 1613 },
+    { 1474, 1613 },
+    { 1477, 1612 },
+    { 1480, 1612 },
+    { 1483, 1611 },
+    { 1486, 1611 },
+    { 1489, 1610 },
+    { 1492, 1609 },
+    { 1495, 1609 },
+    { 1498, 1608 },
+    { 1501, 1607 },
+    { 1504, 1607 },
+    { 1507, 1605 },
+    { 1510, 1604 },
+    { 1514, 1603 },
+    { 1517, 1602 },
+    { 1520, 1601 },
+    { 1523, 1599 },
+    { 1526, 1598 },
+    { 1530, 1596 },
+    { 1533, 1594 },
+    { 1536, 1593 },
+    { 1540, 1591 },
+    { 1543, 1589 },
+    { 1546, 1587 },
+    { 1549, 1585 },
+    { 1553, 1582 },
+    { 1556, 1580 },
+    { 1559, 1577 },
+    { 1563, 1575 },
+    { 1566, 1572 },
+    { 1569, 1569 },
+    { 1572, 1566 },
+    { 1575, 1563 },
+    { 1578, 1560 },
+    { 1581, 1557 },
+    { 1584, 1553 },
+    { 1587, 1549 },
+    { 1588, 1545 },
+    { 1591, 1541 },
+    { 1594, 1537 },
+    { 1596, 1533 },
+    { 1598, 1528 },
+    { 1600, 1524 },
+    { 1602, 1520 },
+    { 1603, 1516 },
+    { 1605, 1511 },
+    { 1606, 1507 },
+    { 1608, 1503 },
+    { 1609, 1499 },
+    { 1610, 1494 },
+    { 1612, 1490 },
+    { 1613, 1486 },
+    { 1614, 1482 },
+    { 1615, 1478 },
+    { 1616, 1474 },
+    { 1617, 1470 },
+    { 1618, 1466 },
+    { 1619, 1462 },
+    { 1620, 1457 },
+    { 1620, 1453 },
+    { 1621, 1450 },
+    { 1622, 1446 },
+    { 1622, 1442 },
+    { 1623, 1438 },
+    { 1624, 1434 },
+    { 1625, 1430 },
+    { 1625, 1427 },
+    { 1626, 1423 },
+    { 1626, 1420 },
+    { 1627, 1416 },
+    { 1626, 1413 },
+    { 1628, 1409 },
+    { 1627, 1406 },
+    { 1627, 1404 },
+    { 1627, 1400 },
+    { 1626, 1399 },
+    { 1626, 1396 },
+    { 1626, 1393 },
+    { 1625, 1392 },
+    { 1623, 1390 },
+    { 1622, 1389 },
+    { 1621, 1388 },
+    { 1619, 1389 },
+    { 1616, 1389 },
+    { 1614, 1391 },
+    { 1611, 1392 },
+    { 1609, 1393 },
+    { 1606, 1395 },
+    { 1603, 1396 },
+    { 1600, 1399 },
+    { 1597, 1401 },
+    { 1594, 1404 },
+    { 1591, 1407 },
+    { 1588, 1409 },
+    { 1585, 1412 },
+    { 1582, 1415 },
+    { 1579, 1418 },
+    { 1576, 1421 },
+    { 1573, 1424 },
+    { 1570, 1427 },
+    { 1566, 1430 },
+    { 1563, 1432 },
+    { 1560, 1436 },
+    { 1557, 1439 },
+    { 1554, 1442 },
+    { 1551, 1446 },
+    { 1548, 1447 },
+    { 1545, 1451 },
+    { 1542, 1455 },
+    { 1539, 1457 },
+    { 1536, 1460 },
+    { 1533, 1463 },
+    { 1529, 1467 },
+    { 1527, 1468 },
+    { 1524, 1472 },
+    { 1520, 1475 },
+    { 1517, 1478 },
+    { 1514, 1482 },
+    { 1511, 1484 },
+    { 1508, 1486 },
+    { 1505, 1489 },
+    { 1502, 1493 },
+    { 1499, 1496 },
+    { 1496, 1499 },
+    { 1492, 1502 },
+};
+
+const int FLOWER_DUTY_POINTS = sizeof(flower_duty)/sizeof(flower_duty[0]);
+
+const unsigned short flower_elbow_flips[] = { 2894 };
@@ -0,0 +1,13 @@
+#ifndef FLOWER_DUTY_H
+#define FLOWER_DUTY_H
+
+// Pre-solved { shoulder, elbow } PWM duty pairs in microseconds
+extern const unsigned short flower_duty[][2];
+extern const int FLOWER_DUTY_POINTS;
+
+// Elbow branch (HALO_ELBOW_DOWN/UP) from pair 0, flipped at each index
+// in flower_elbow_flips; the list ends with FLOWER_DUTY_POINTS
+#define FLOWER_ELBOW_START 0
+extern const unsigned short flower_elbow_flips[];
+
+#endif // FLOWER_DUTY_H
@@ -0,0 +1,2205 @@
+#include "flower_lod.h"
+#include "flower_duty.h"
+
+// ----------------------------
+// Generated flower levels of detail (do not edit)
+// ----------------------------
+
+static const unsigned short flower_duty_lod1[][2] = {
+    { 1423, 1646 },
+    { 1428, 1647 },
+    { 1434, 1648 },
+    { 1439, 1650 },
+    { 1444, 1651 },
+    { 1450, 1652 },
+    { 1455, 1653 },
+    { 1461, 1654 },
+    { 1467, 1655 },
+    { 1472, 1656 },
+    { 1478, 1657 },
+    { 1484, 1657 },
+    { 1490, 1658 },
+    { 1496, 1658 },
+    { 1502, 1659 },
+    { 1508, 1659 },
+    { 1514, 1660 },
+    { 1519, 1661 },
+    { 1525, 1661 },
+    { 1530, 1663 },
+    { 1536, 1664 },
+    { 1541, 1666 },
+    { 1545, 1669 },
+    { 1549, 1672 },
+    { 1553, 1676 },
+    { 1555, 1681 },
+    { 1556, 1686 },
+    { 1557, 1693 },
+    { 1556, 1699 },
+    { 1555, 1706 },
+    { 1553, 1713 },
+    { 1551, 1720 },
+    { 1549, 1727 },
+    { 1546, 1733 },
+    { 1543, 1740 },
+    { 1539, 1747 },
+    { 1535, 1754 },
+    { 1531, 1760 },
+    { 1525, 1767 },
+    { 1521, 1773 },
+    { 1515, 1780 },
+    { 1508, 1786 },
+    { 1502, 1792 },
+    { 1494, 1798 },
+    { 1486, 1804 },
+    { 1477, 1809 },
+    { 1468, 1814 },
+    { 1458, 1819 },
+    { 1448, 1824 },
+    { 1436, 1827 },
+    { 1424, 1830 },
+    { 1412, 1833 },
+    { 1399, 1835 },
+    { 1386, 1835 },
+    { 1374, 1835 },
+    { 1363, 1833 },
+    { 1353, 1831 },
+    { 1344, 1828 },
+    { 1337, 1824 },
+    { 1330, 1820 },
+    { 1325, 1815 },
+    { 1321, 1809 },
+    { 1318, 1804 },
+    { 1316, 1798 },
+    { 1316, 1792 },
+    { 1316, 1786 },
+    { 1316, 1780 },
+    { 1317, 1774 },
+    { 1318, 1767 },
+    { 1320, 1760 },
+    { 1322, 1754 },
+    { 1325, 1747 },
+    { 1328, 1740 },
+    { 1331, 1733 },
+    { 1334, 1726 },
+    { 1338, 1719 },
+    { 1342, 1712 },
+    { 1347, 1705 },
+    { 1351, 1698 },
+    { 1357, 1694 },
+    { 1365, 1691 },
+    { 1372, 1688 },
+    { 1380, 1684 },
+    { 1387, 1679 },
+    { 1394, 1674 },
+    { 1401, 1668 },
+    { 1407, 1663 },
+    { 1414, 1657 },
+    { 1420, 1650 },
+    { 1422, 1647 },
+    { 1416, 1649 },
+    { 1409, 1652 },
+    { 1402, 1654 },
+    { 1395, 1657 },
+    { 1388, 1659 },
+    { 1381, 1661 },
+    { 1374, 1663 },
+    { 1366, 1665 },
+    { 1359, 1666 },
+    { 1352, 1668 },
+    { 1345, 1669 },
+    { 1338, 1671 },
+    { 1332, 1672 },
+    { 1326, 1670 },
+    { 1322, 1667 },
+    { 1319, 1663 },
+    { 1316, 1659 },
+    { 1314, 1654 },
+    { 1313, 1649 },
+    { 1312, 1643 },
+    { 1313, 1636 },
+    { 1314, 1629 },
+    { 1317, 1621 },
+    { 1320, 1614 },
+    { 1323, 1606 },
+    { 1327, 1598 },
+    { 1332, 1590 },
+    { 1338, 1583 },
+    { 1343, 1575 },
+    { 1349, 1568 },
+    { 1355, 1561 },
+    { 1362, 1555 },
+    { 1368, 1549 },
+    { 1374, 1543 },
+    { 1380, 1538 },
+    { 1387, 1534 },
+    { 1393, 1530 },
+    { 1398, 1528 },
+    { 1404, 1525 },
+    { 1409, 1524 },
+    { 1415, 1522 },
+    { 1419, 1523 },
+    { 1423, 1523 },
+    { 1427, 1525 },
+    { 1431, 1527 },
+    { 1434, 1529 },
+    { 1436, 1533 },
+    { 1438, 1537 },
+    { 1440, 1542 },
+    { 1441, 1547 },
+    { 1441, 1553 },
+    { 1441, 1560 },
+    { 1441, 1566 },
+    { 1440, 1573 },
+    { 1438, 1580 },
+    { 1436, 1587 },
+    { 1434, 1595 },
+    { 1431, 1603 },
+    { 1427, 1611 },
+    { 1422, 1618 },
+    { 1417, 1626 },
+    { 1412, 1633 },
+    { 1406, 1640 },
+    { 1400, 1647 },
+    { 1393, 1652 },
+    { 1386, 1658 },
+    { 1379, 1663 },
+    { 1372, 1667 },
+    { 1365, 1670 },
+    { 1358, 1671 },
+    { 1350, 1674 },
+    { 1344, 1674 },
+    { 1337, 1674 },
+    { 1332, 1673 },
+    { 1325, 1673 },
+    { 1318, 1674 },
+    { 1311, 1674 },
+    { 1305, 1675 },
+    { 1298, 1675 },
+    { 1291, 1676 },
+    { 1294, 1680 },
+    { 1297, 1684 },
+    { 1301, 1689 },
+    { 1305, 1692 },
+    { 1310, 1694 },
+    { 1316, 1696 },
+    { 1319, 1697 },
+    { 1315, 1703 },
+    { 1312, 1711 },
+    { 1308, 1718 },
+    { 1304, 1725 },
+    { 1300, 1732 },
+    { 1296, 1739 },
+    { 1291, 1745 },
+    { 1287, 1752 },
+    { 1282, 1759 },
+    { 1277, 1766 },
+    { 1272, 1772 },
+    { 1266, 1779 },
+    { 1261, 1785 },
+    { 1255, 1792 },
+    { 1249, 1798 },
+    { 1242, 1805 },
+    { 1234, 1811 },
+    { 1226, 1817 },
+    { 1218, 1822 },
+    { 1208, 1828 },
+    { 1197, 1832 },
+    { 1186, 1836 },
+    { 1174, 1839 },
+    { 1162, 1840 },
+    { 1149, 1841 },
+    { 1138, 1841 },
+    { 1127, 1839 },
+    { 1117, 1836 },
+    { 1108, 1833 },
+    { 1100, 1828 },
+    { 1093, 1824 },
+    { 1088, 1819 },
+    { 1084, 1814 },
+    { 1080, 1809 },
+    { 1077, 1803 },
+    { 1075, 1797 },
+    { 1073, 1791 },
+    { 1073, 1785 },
+    { 1073, 1779 },
+    { 1074, 1772 },
+    { 1075, 1766 },
+    { 1077, 1759 },
+    { 1079, 1753 },
+    { 1082, 1746 },
+    { 1086, 1739 },
+    { 1092, 1733 },
+    { 1099, 1726 },
+    { 1106, 1721 },
+    { 1114, 1716 },
+    { 1122, 1713 },
+    { 1130, 1710 },
+    { 1138, 1707 },
+    { 1146, 1704 },
+    { 1154, 1702 },
+    { 1161, 1700 },
+    { 1169, 1697 },
+    { 1176, 1696 },
+    { 1184, 1693 },
+    { 1192, 1691 },
+    { 1199, 1689 },
+    { 1207, 1687 },
+    { 1214, 1685 },
+    { 1221, 1682 },
+    { 1229, 1680 },
+    { 1236, 1678 },
+    { 1243, 1675 },
+    { 1250, 1673 },
+    { 1258, 1671 },
+    { 1265, 1669 },
+    { 1272, 1667 },
+    { 1279, 1664 },
+    { 1286, 1662 },
+    { 1289, 1666 },
+    { 1290, 1671 },
+    { 1290, 1676 },
+    { 1283, 1676 },
+    { 1276, 1676 },
+    { 1270, 1676 },
+    { 1264, 1675 },
+    { 1257, 1675 },
+    { 1251, 1674 },
+    { 1245, 1673 },
+    { 1239, 1672 },
+    { 1233, 1671 },
+    { 1228, 1670 },
+    { 1222, 1669 },
+    { 1216, 1667 },
+    { 1211, 1666 },
+    { 1206, 1664 },
+    { 1199, 1665 },
+    { 1194, 1663 },
+    { 1189, 1662 },
+    { 1184, 1661 },
+    { 1179, 1659 },
+    { 1174, 1657 },
+    { 1169, 1656 },
+    { 1165, 1653 },
+    { 1161, 1650 },
+    { 1158, 1646 },
+    { 1154, 1642 },
+    { 1152, 1637 },
+    { 1151, 1632 },
+    { 1150, 1626 },
+    { 1150, 1620 },
+    { 1151, 1613 },
+    { 1152, 1606 },
+    { 1156, 1598 },
+    { 1159, 1590 },
+    { 1162, 1583 },
+    { 1167, 1575 },
+    { 1172, 1567 },
+    { 1177, 1559 },
+    { 1183, 1552 },
+    { 1189, 1544 },
+    { 1194, 1537 },
+    { 1200, 1529 },
+    { 1206, 1522 },
+    { 1212, 1514 },
+    { 1218, 1507 },
+    { 1224, 1499 },
+    { 1230, 1492 },
+    { 1237, 1485 },
+    { 1243, 1477 },
+    { 1249, 1470 },
+    { 1256, 1463 },
+    { 1262, 1457 },
+    { 1268, 1450 },
+    { 1274, 1445 },
+    { 1280, 1441 },
+    { 1286, 1438 },
+    { 1290, 1436 },
+    { 1295, 1433 },
+    { 1298, 1435 },
+    { 1303, 1435 },
+    { 1305, 1437 },
+    { 1308, 1439 },
+    { 1311, 1441 },
+    { 1313, 1445 },
+    { 1315, 1448 },
+    { 1317, 1452 },
+    { 1318, 1457 },
+    { 1320, 1461 },
+    { 1321, 1466 },
+    { 1324, 1466 },
+    { 1325, 1459 },
+    { 1327, 1451 },
+    { 1329, 1442 },
+    { 1332, 1433 },
+    { 1334, 1424 },
+    { 1338, 1415 },
+    { 1342, 1405 },
+    { 1347, 1394 },
+    { 1352, 1384 },
+    { 1358, 1374 },
+    { 1364, 1363 },
+    { 1371, 1352 },
+    { 1379, 1341 },
+    { 1386, 1330 },
+    { 1393, 1320 },
+    { 1400, 1311 },
+    { 1408, 1301 },
+    { 1415, 1292 },
+    { 1423, 1282 },
+    { 1429, 1274 },
+    { 1437, 1266 },
+    { 1444, 1257 },
+    { 1446, 1255 },
+    { 1441, 1261 },
+    { 1435, 1268 },
+    { 1428, 1276 },
+    { 1421, 1285 },
+    { 1413, 1294 },
+    { 1406, 1304 },
+    { 1399, 1313 },
+    { 1391, 1323 },
+    { 1384, 1334 },
+    { 1377, 1344 },
+    { 1370, 1355 },
+    { 1363, 1366 },
+    { 1357, 1377 },
+    { 1351, 1387 },
+    { 1345, 1398 },
+    { 1341, 1408 },
+    { 1338, 1417 },
+    { 1333, 1427 },
+    { 1330, 1436 },
+    { 1328, 1444 },
+    { 1326, 1453 },
+    { 1325, 1461 },
+    { 1323, 1468 },
+    { 1321, 1466 },
+    { 1320, 1461 },
+    { 1318, 1457 },
+    { 1316, 1452 },
+    { 1314, 1448 },
+    { 1312, 1445 },
+    { 1310, 1441 },
+    { 1308, 1438 },
+    { 1305, 1437 },
+    { 1302, 1435 },
+    { 1298, 1435 },
+    { 1295, 1434 },
+    { 1290, 1436 },
+    { 1285, 1439 },
+    { 1280, 1441 },
+    { 1274, 1446 },
+    { 1268, 1452 },
+    { 1261, 1458 },
+    { 1255, 1464 },
+    { 1249, 1471 },
+    { 1242, 1478 },
+    { 1236, 1486 },
+    { 1230, 1493 },
+    { 1223, 1500 },
+    { 1217, 1508 },
+    { 1211, 1515 },
+    { 1205, 1522 },
+    { 1199, 1530 },
+    { 1194, 1538 },
+    { 1188, 1545 },
+    { 1182, 1553 },
+    { 1177, 1560 },
+    { 1172, 1568 },
+    { 1166, 1576 },
+    { 1162, 1584 },
+    { 1158, 1591 },
+    { 1155, 1599 },
+    { 1152, 1607 },
+    { 1151, 1614 },
+    { 1150, 1621 },
+    { 1151, 1627 },
+    { 1151, 1633 },
+    { 1153, 1638 },
+    { 1156, 1642 },
+    { 1159, 1646 },
+    { 1162, 1650 },
+    { 1166, 1653 },
+    { 1170, 1656 },
+    { 1175, 1657 },
+    { 1180, 1659 },
+    { 1185, 1661 },
+    { 1190, 1662 },
+    { 1195, 1663 },
+    { 1200, 1664 },
+    { 1207, 1663 },
+    { 1214, 1658 },
+    { 1222, 1654 },
+    { 1229, 1649 },
+    { 1236, 1644 },
+    { 1243, 1640 },
+    { 1249, 1640 },
+    { 1255, 1639 },
+    { 1261, 1639 },
+    { 1267, 1637 },
+    { 1273, 1637 },
+    { 1280, 1635 },
+    { 1286, 1634 },
+    { 1292, 1632 },
+    { 1296, 1626 },
+    { 1299, 1619 },
+    { 1303, 1611 },
+    { 1307, 1603 },
+    { 1311, 1595 },
+    { 1316, 1588 },
+    { 1322, 1580 },
+    { 1327, 1573 },
+    { 1327, 1567 },
+    { 1325, 1562 },
+    { 1324, 1558 },
+    { 1322, 1553 },
+    { 1320, 1548 },
+    { 1318, 1544 },
+    { 1317, 1539 },
+    { 1315, 1534 },
+    { 1314, 1530 },
+    { 1312, 1525 },
+    { 1310, 1520 },
+    { 1309, 1516 },
+    { 1307, 1511 },
+    { 1305, 1506 },
+    { 1304, 1502 },
+    { 1302, 1497 },
+    { 1301, 1493 },
+    { 1299, 1488 },
+    { 1297, 1484 },
+    { 1295, 1480 },
+    { 1294, 1476 },
+    { 1291, 1473 },
+    { 1289, 1469 },
+    { 1286, 1467 },
+    { 1281, 1468 },
+    { 1277, 1468 },
+    { 1272, 1471 },
+    { 1266, 1475 },
+    { 1260, 1480 },
+    { 1253, 1487 },
+    { 1247, 1494 },
+    { 1241, 1501 },
+    { 1234, 1508 },
+    { 1228, 1516 },
+    { 1222, 1524 },
+    { 1216, 1531 },
+    { 1210, 1538 },
+    { 1205, 1546 },
+    { 1199, 1554 },
+    { 1193, 1562 },
+    { 1188, 1570 },
+    { 1183, 1578 },
+    { 1179, 1585 },
+    { 1175, 1593 },
+    { 1173, 1601 },
+    { 1172, 1607 },
+    { 1173, 1613 },
+    { 1175, 1618 },
+    { 1177, 1623 },
+    { 1180, 1626 },
+    { 1184, 1630 },
+    { 1189, 1632 },
+    { 1192, 1634 },
+    { 1197, 1636 },
+    { 1201, 1638 },
+    { 1207, 1638 },
+    { 1212, 1638 },
+    { 1217, 1639 },
+    { 1222, 1640 },
+    { 1228, 1641 },
+    { 1234, 1640 },
+    { 1239, 1640 },
+    { 1246, 1637 },
+    { 1253, 1632 },
+    { 1260, 1627 },
+    { 1267, 1622 },
+    { 1273, 1616 },
+    { 1280, 1611 },
+    { 1287, 1605 },
+    { 1293, 1600 },
+    { 1300, 1594 },
+    { 1306, 1588 },
+    { 1313, 1582 },
+    { 1319, 1576 },
+    { 1326, 1570 },
+    { 1332, 1564 },
+    { 1338, 1557 },
+    { 1345, 1551 },
+    { 1351, 1544 },
+    { 1357, 1538 },
+    { 1364, 1531 },
+    { 1370, 1526 },
+    { 1376, 1520 },
+    { 1382, 1515 },
+    { 1388, 1511 },
+    { 1394, 1506 },
+    { 1397, 1498 },
+    { 1400, 1489 },
+    { 1404, 1481 },
+    { 1407, 1472 },
+    { 1408, 1470 },
+    { 1405, 1478 },
+    { 1402, 1487 },
+    { 1399, 1495 },
+    { 1395, 1504 },
+    { 1390, 1510 },
+    { 1384, 1514 },
+    { 1378, 1519 },
+    { 1371, 1525 },
+    { 1365, 1530 },
+    { 1359, 1536 },
+    { 1353, 1541 },
+    { 1351, 1537 },
+    { 1349, 1532 },
+    { 1348, 1527 },
+    { 1346, 1522 },
+    { 1345, 1517 },
+    { 1344, 1512 },
+    { 1343, 1506 },
+    { 1343, 1501 },
+    { 1342, 1495 },
+    { 1342, 1489 },
+    { 1342, 1482 },
+    { 1342, 1476 },
+    { 1342, 1469 },
+    { 1343, 1462 },
+    { 1343, 1455 },
+    { 1344, 1448 },
+    { 1346, 1440 },
+    { 1348, 1432 },
+    { 1349, 1424 },
+    { 1352, 1415 },
+    { 1356, 1405 },
+    { 1359, 1396 },
+    { 1365, 1385 },
+    { 1371, 1375 },
+    { 1378, 1364 },
+    { 1385, 1354 },
+    { 1392, 1344 },
+    { 1399, 1335 },
+    { 1406, 1326 },
+    { 1413, 1318 },
+    { 1420, 1310 },
+    { 1427, 1302 },
+    { 1433, 1296 },
+    { 1439, 1289 },
+    { 1444, 1285 },
+    { 1451, 1278 },
+    { 1456, 1273 },
+    { 1460, 1273 },
+    { 1463, 1272 },
+    { 1467, 1272 },
+    { 1468, 1276 },
+    { 1468, 1283 },
+    { 1467, 1291 },
+    { 1465, 1300 },
+    { 1462, 1310 },
+    { 1459, 1320 },
+    { 1456, 1330 },
+    { 1453, 1340 },
+    { 1451, 1349 },
+    { 1447, 1360 },
+    { 1443, 1371 },
+    { 1439, 1381 },
+    { 1436, 1392 },
+    { 1432, 1401 },
+    { 1429, 1411 },
+    { 1426, 1421 },
+    { 1423, 1430 },
+    { 1419, 1439 },
+    { 1416, 1448 },
+    { 1413, 1457 },
+    { 1411, 1464 },
+    { 1413, 1455 },
+    { 1417, 1446 },
+    { 1420, 1437 },
+    { 1424, 1428 },
+    { 1427, 1419 },
+    { 1430, 1409 },
+    { 1433, 1399 },
+    { 1436, 1389 },
+    { 1440, 1379 },
+    { 1444, 1368 },
+    { 1448, 1358 },
+    { 1451, 1347 },
+    { 1454, 1337 },
+    { 1457, 1328 },
+    { 1460, 1318 },
+    { 1463, 1308 },
+    { 1465, 1298 },
+    { 1468, 1288 },
+    { 1468, 1281 },
+    { 1469, 1274 },
+    { 1467, 1271 },
+    { 1464, 1271 },
+    { 1459, 1274 },
+    { 1455, 1274 },
+    { 1450, 1279 },
+    { 1443, 1286 },
+    { 1438, 1290 },
+    { 1432, 1296 },
+    { 1425, 1304 },
+    { 1419, 1311 },
+    { 1412, 1318 },
+    { 1405, 1326 },
+    { 1398, 1335 },
+    { 1391, 1344 },
+    { 1384, 1354 },
+    { 1377, 1364 },
+    { 1370, 1375 },
+    { 1364, 1386 },
+    { 1359, 1396 },
+    { 1356, 1405 },
+    { 1352, 1416 },
+    { 1349, 1424 },
+    { 1347, 1433 },
+    { 1345, 1441 },
+    { 1344, 1449 },
+    { 1343, 1456 },
+    { 1342, 1463 },
+    { 1342, 1470 },
+    { 1342, 1476 },
+    { 1341, 1483 },
+    { 1341, 1489 },
+    { 1342, 1495 },
+    { 1342, 1501 },
+    { 1343, 1507 },
+    { 1344, 1512 },
+    { 1345, 1518 },
+    { 1346, 1523 },
+    { 1347, 1528 },
+    { 1349, 1532 },
+    { 1350, 1537 },
+    { 1353, 1541 },
+    { 1358, 1540 },
+    { 1363, 1539 },
+    { 1369, 1537 },
+    { 1374, 1536 },
+    { 1380, 1534 },
+    { 1385, 1532 },
+    { 1391, 1530 },
+    { 1397, 1528 },
+    { 1402, 1526 },
+    { 1408, 1523 },
+    { 1414, 1521 },
+    { 1419, 1518 },
+    { 1425, 1516 },
+    { 1431, 1513 },
+    { 1437, 1510 },
+    { 1443, 1507 },
+    { 1448, 1503 },
+    { 1454, 1500 },
+    { 1460, 1497 },
+    { 1466, 1493 },
+    { 1472, 1489 },
+    { 1478, 1484 },
+    { 1484, 1476 },
+    { 1490, 1469 },
+    { 1495, 1462 },
+    { 1501, 1454 },
+    { 1507, 1445 },
+    { 1513, 1436 },
+    { 1520, 1428 },
+    { 1526, 1419 },
+    { 1532, 1409 },
+    { 1539, 1399 },
+    { 1545, 1389 },
+    { 1551, 1379 },
+    { 1558, 1368 },
+    { 1565, 1357 },
+    { 1571, 1345 },
+    { 1578, 1332 },
+    { 1585, 1320 },
+    { 1592, 1306 },
+    { 1599, 1292 },
+    { 1605, 1278 },
+    { 1612, 1263 },
+    { 1618, 1249 },
+    { 1622, 1236 },
+    { 1625, 1224 },
+    { 1627, 1214 },
+    { 1628, 1207 },
+    { 1628, 1200 },
+    { 1628, 1193 },
+    { 1627, 1188 },
+    { 1626, 1184 },
+    { 1625, 1180 },
+    { 1623, 1177 },
+    { 1621, 1175 },
+    { 1619, 1173 },
+    { 1617, 1170 },
+    { 1614, 1170 },
+    { 1611, 1169 },
+    { 1607, 1169 },
+    { 1602, 1173 },
+    { 1598, 1174 },
+    { 1592, 1180 },
+    { 1587, 1184 },
+    { 1579, 1194 },
+    { 1571, 1206 },
+    { 1562, 1218 },
+    { 1553, 1234 },
+    { 1543, 1250 },
+    { 1535, 1265 },
+    { 1527, 1280 },
+    { 1519, 1295 },
+    { 1512, 1308 },
+    { 1504, 1322 },
+    { 1498, 1335 },
+    { 1491, 1347 },
+    { 1485, 1359 },
+    { 1479, 1371 },
+    { 1474, 1382 },
+    { 1469, 1392 },
+    { 1463, 1403 },
+    { 1458, 1414 },
+    { 1452, 1424 },
+    { 1448, 1434 },
+    { 1443, 1444 },
+    { 1438, 1454 },
+    { 1433, 1464 },
+    { 1429, 1473 },
+    { 1424, 1482 },
+    { 1420, 1491 },
+    { 1422, 1494 },
+    { 1427, 1493 },
+    { 1431, 1493 },
+    { 1435, 1494 },
+    { 1439, 1495 },
+    { 1443, 1496 },
+    { 1447, 1498 },
+    { 1450, 1500 },
+    { 1453, 1503 },
+    { 1455, 1507 },
+    { 1459, 1506 },
+    { 1465, 1499 },
+    { 1472, 1492 },
+    { 1478, 1485 },
+    { 1484, 1481 },
+    { 1490, 1477 },
+    { 1496, 1473 },
+    { 1502, 1469 },
+    { 1508, 1464 },
+    { 1514, 1458 },
+    { 1520, 1449 },
+    { 1526, 1440 },
+    { 1533, 1431 },
+    { 1539, 1421 },
+    { 1545, 1411 },
+    { 1551, 1401 },
+    { 1558, 1391 },
+    { 1564, 1380 },
+    { 1571, 1369 },
+    { 1577, 1357 },
+    { 1584, 1345 },
+    { 1590, 1333 },
+    { 1597, 1320 },
+    { 1604, 1306 },
+    { 1611, 1292 },
+    { 1617, 1278 },
+    { 1624, 1263 },
+    { 1631, 1248 },
+    { 1637, 1232 },
+    { 1643, 1217 },
+    { 1649, 1201 },
+    { 1654, 1185 },
+    { 1658, 1174 },
+    { 1662, 1159 },
+    { 1665, 1147 },
+    { 1669, 1134 },
+    { 1672, 1122 },
+    { 1674, 1112 },
+    { 1676, 1101 },
+    { 1677, 1093 },
+    { 1679, 1084 },
+    { 1679, 1077 },
+    { 1679, 1069 },
+    { 1681, 1061 },
+    { 1681, 1054 },
+    { 1681, 1048 },
+    { 1681, 1041 },
+    { 1677, 1043 },
+    { 1673, 1045 },
+    { 1669, 1046 },
+    { 1665, 1047 },
+    { 1657, 1057 },
+    { 1651, 1063 },
+    { 1642, 1074 },
+    { 1634, 1086 },
+    { 1622, 1104 },
+    { 1614, 1114 },
+    { 1602, 1131 },
+    { 1590, 1151 },
+    { 1580, 1168 },
+    { 1569, 1185 },
+    { 1559, 1203 },
+    { 1548, 1220 },
+    { 1539, 1237 },
+    { 1530, 1253 },
+    { 1521, 1269 },
+    { 1513, 1283 },
+    { 1505, 1298 },
+    { 1498, 1311 },
+    { 1491, 1324 },
+    { 1484, 1337 },
+    { 1478, 1349 },
+    { 1471, 1361 },
+    { 1465, 1373 },
+    { 1460, 1384 },
+    { 1454, 1395 },
+    { 1448, 1406 },
+    { 1443, 1417 },
+    { 1443, 1413 },
+    { 1446, 1404 },
+    { 1449, 1394 },
+    { 1454, 1383 },
+    { 1457, 1373 },
+    { 1461, 1363 },
+    { 1463, 1353 },
+    { 1467, 1342 },
+    { 1471, 1331 },
+    { 1474, 1321 },
+    { 1478, 1309 },
+    { 1481, 1299 },
+    { 1484, 1289 },
+    { 1488, 1278 },
+    { 1490, 1268 },
+    { 1493, 1257 },
+    { 1496, 1247 },
+    { 1497, 1238 },
+    { 1498, 1230 },
+    { 1498, 1223 },
+    { 1498, 1218 },
+    { 1496, 1214 },
+    { 1494, 1212 },
+    { 1490, 1213 },
+    { 1485, 1216 },
+    { 1481, 1219 },
+    { 1475, 1224 },
+    { 1469, 1229 },
+    { 1462, 1238 },
+    { 1457, 1243 },
+    { 1450, 1250 },
+    { 1454, 1247 },
+    { 1461, 1239 },
+    { 1468, 1231 },
+    { 1473, 1226 },
+    { 1479, 1221 },
+    { 1485, 1215 },
+    { 1489, 1215 },
+    { 1492, 1215 },
+    { 1495, 1214 },
+    { 1497, 1218 },
+    { 1498, 1222 },
+    { 1498, 1229 },
+    { 1497, 1237 },
+    { 1496, 1245 },
+    { 1493, 1256 },
+    { 1491, 1266 },
+    { 1488, 1276 },
+    { 1485, 1286 },
+    { 1482, 1297 },
+    { 1478, 1308 },
+    { 1474, 1319 },
+    { 1472, 1329 },
+    { 1467, 1340 },
+    { 1464, 1351 },
+    { 1461, 1361 },
+    { 1458, 1371 },
+    { 1454, 1382 },
+    { 1450, 1392 },
+    { 1446, 1402 },
+    { 1443, 1412 },
+    { 1441, 1420 },
+    { 1440, 1421 },
+    { 1441, 1422 },
+    { 1446, 1412 },
+    { 1451, 1401 },
+    { 1457, 1390 },
+    { 1462, 1379 },
+    { 1468, 1367 },
+    { 1474, 1356 },
+    { 1481, 1344 },
+    { 1488, 1331 },
+    { 1495, 1318 },
+    { 1502, 1305 },
+    { 1509, 1291 },
+    { 1517, 1276 },
+    { 1525, 1262 },
+    { 1534, 1246 },
+    { 1544, 1229 },
+    { 1553, 1212 },
+    { 1564, 1194 },
+    { 1575, 1177 },
+    { 1585, 1159 },
+    { 1596, 1142 },
+    { 1608, 1122 },
+    { 1620, 1106 },
+    { 1629, 1093 },
+    { 1638, 1080 },
+    { 1645, 1072 },
+    { 1654, 1060 },
+    { 1661, 1052 },
+    { 1665, 1052 },
+    { 1668, 1051 },
+    { 1672, 1049 },
+    { 1677, 1047 },
+    { 1677, 1052 },
+    { 1678, 1058 },
+    { 1678, 1063 },
+    { 1677, 1071 },
+    { 1677, 1079 },
+    { 1677, 1085 },
+    { 1676, 1093 },
+    { 1675, 1101 },
+    { 1673, 1111 },
+    { 1672, 1121 },
+    { 1670, 1131 },
+    { 1666, 1144 },
+    { 1663, 1155 },
+    { 1660, 1168 },
+    { 1656, 1181 },
+    { 1651, 1196 },
+    { 1645, 1212 },
+    { 1639, 1227 },
+    { 1633, 1243 },
+    { 1626, 1258 },
+    { 1619, 1273 },
+    { 1613, 1288 },
+    { 1606, 1302 },
+    { 1599, 1316 },
+    { 1592, 1329 },
+    { 1585, 1341 },
+    { 1579, 1353 },
+    { 1572, 1365 },
+    { 1566, 1376 },
+    { 1559, 1387 },
+    { 1553, 1398 },
+    { 1547, 1408 },
+    { 1541, 1418 },
+    { 1534, 1428 },
+    { 1528, 1437 },
+    { 1522, 1446 },
+    { 1516, 1454 },
+    { 1511, 1462 },
+    { 1512, 1463 },
+    { 1517, 1457 },
+    { 1523, 1451 },
+    { 1529, 1445 },
+    { 1535, 1440 },
+    { 1541, 1433 },
+    { 1547, 1428 },
+    { 1554, 1420 },
+    { 1559, 1415 },
+    { 1565, 1409 },
+    { 1571, 1403 },
+    { 1578, 1396 },
+    { 1584, 1391 },
+    { 1590, 1385 },
+    { 1597, 1379 },
+    { 1602, 1374 },
+    { 1608, 1368 },
+    { 1615, 1363 },
+    { 1620, 1359 },
+    { 1626, 1355 },
+    { 1630, 1353 },
+    { 1635, 1351 },
+    { 1639, 1350 },
+    { 1643, 1351 },
+    { 1645, 1352 },
+    { 1647, 1355 },
+    { 1649, 1359 },
+    { 1650, 1365 },
+    { 1650, 1371 },
+    { 1650, 1377 },
+    { 1650, 1384 },
+    { 1648, 1392 },
+    { 1647, 1399 },
+    { 1646, 1407 },
+    { 1645, 1414 },
+    { 1643, 1422 },
+    { 1642, 1430 },
+    { 1640, 1438 },
+    { 1638, 1447 },
+    { 1636, 1455 },
+    { 1635, 1463 },
+    { 1633, 1471 },
+    { 1631, 1480 },
+    { 1628, 1488 },
+    { 1625, 1497 },
+    { 1623, 1505 },
+    { 1620, 1513 },
+    { 1617, 1522 },
+    { 1613, 1530 },
+    { 1609, 1539 },
+    { 1605, 1547 },
+    { 1600, 1554 },
+    { 1595, 1562 },
+    { 1589, 1570 },
+    { 1583, 1577 },
+    { 1577, 1583 },
+    { 1571, 1589 },
+    { 1564, 1594 },
+    { 1558, 1599 },
+    { 1551, 1604 },
+    { 1544, 1609 },
+    { 1538, 1613 },
+    { 1531, 1617 },
+    { 1524, 1620 },
+    { 1517, 1623 },
+    { 1511, 1626 },
+    { 1504, 1628 },
+    { 1498, 1629 },
+    { 1497, 1633 },
+    { 1504, 1633 },
+    { 1509, 1633 },
+    { 1514, 1634 },
+    { 1520, 1634 },
+    { 1525, 1635 },
+    { 1530, 1636 },
+    { 1536, 1636 },
+    { 1542, 1637 },
+    { 1547, 1638 },
+    { 1551, 1640 },
+    { 1557, 1641 },
+    { 1561, 1644 },
+    { 1565, 1646 },
+    { 1570, 1649 },
+    { 1573, 1653 },
+    { 1576, 1657 },
+    { 1578, 1662 },
+    { 1580, 1667 },
+    { 1581, 1673 },
+    { 1581, 1679 },
+    { 1582, 1685 },
+    { 1581, 1692 },
+    { 1580, 1698 },
+    { 1580, 1705 },
+    { 1578, 1712 },
+    { 1577, 1718 },
+    { 1574, 1725 },
+    { 1573, 1732 },
+    { 1570, 1739 },
+    { 1567, 1746 },
+    { 1564, 1753 },
+    { 1561, 1759 },
+    { 1556, 1766 },
+    { 1553, 1773 },
+    { 1548, 1779 },
+    { 1543, 1786 },
+    { 1538, 1793 },
+    { 1530, 1799 },
+    { 1525, 1805 },
+    { 1517, 1811 },
+    { 1509, 1817 },
+    { 1502, 1823 },
+    { 1492, 1828 },
+    { 1482, 1833 },
+    { 1471, 1838 },
+    { 1460, 1843 },
+    { 1447, 1846 },
+    { 1434, 1850 },
+    { 1420, 1852 },
+    { 1406, 1855 },
+    { 1391, 1856 },
+    { 1377, 1857 },
+    { 1363, 1856 },
+    { 1350, 1855 },
+    { 1338, 1854 },
+    { 1327, 1851 },
+    { 1317, 1848 },
+    { 1307, 1844 },
+    { 1301, 1840 },
+    { 1294, 1835 },
+    { 1289, 1830 },
+    { 1286, 1825 },
+    { 1283, 1819 },
+    { 1281, 1813 },
+    { 1281, 1807 },
+    { 1280, 1804 },
+    { 1273, 1809 },
+    { 1268, 1816 },
+    { 1261, 1822 },
+    { 1253, 1828 },
+    { 1245, 1834 },
+    { 1236, 1840 },
+    { 1226, 1845 },
+    { 1215, 1850 },
+    { 1204, 1854 },
+    { 1190, 1857 },
+    { 1177, 1860 },
+    { 1162, 1862 },
+    { 1148, 1862 },
+    { 1134, 1862 },
+    { 1121, 1861 },
+    { 1107, 1860 },
+    { 1095, 1857 },
+    { 1084, 1854 },
+    { 1075, 1850 },
+    { 1067, 1846 },
+    { 1060, 1841 },
+    { 1055, 1836 },
+    { 1050, 1831 },
+    { 1046, 1826 },
+    { 1043, 1820 },
+    { 1041, 1814 },
+    { 1039, 1808 },
+    { 1038, 1802 },
+    { 1039, 1795 },
+    { 1039, 1789 },
+    { 1040, 1783 },
+    { 1041, 1776 },
+    { 1043, 1769 },
+    { 1045, 1763 },
+    { 1048, 1756 },
+    { 1053, 1749 },
+    { 1057, 1743 },
+    { 1062, 1736 },
+    { 1067, 1729 },
+    { 1073, 1723 },
+    { 1080, 1717 },
+    { 1087, 1712 },
+    { 1095, 1706 },
+    { 1103, 1702 },
+    { 1110, 1698 },
+    { 1118, 1694 },
+    { 1126, 1690 },
+    { 1133, 1687 },
+    { 1141, 1684 },
+    { 1148, 1682 },
+    { 1155, 1680 },
+    { 1162, 1678 },
+    { 1169, 1676 },
+    { 1177, 1673 },
+    { 1184, 1672 },
+    { 1191, 1669 },
+    { 1198, 1668 },
+    { 1204, 1666 },
+    { 1197, 1668 },
+    { 1190, 1669 },
+    { 1183, 1672 },
+    { 1176, 1674 },
+    { 1169, 1676 },
+    { 1162, 1678 },
+    { 1155, 1680 },
+    { 1148, 1682 },
+    { 1141, 1685 },
+    { 1133, 1687 },
+    { 1125, 1690 },
+    { 1118, 1693 },
+    { 1110, 1697 },
+    { 1102, 1701 },
+    { 1095, 1706 },
+    { 1087, 1711 },
+    { 1080, 1717 },
+    { 1073, 1723 },
+    { 1067, 1730 },
+    { 1061, 1736 },
+    { 1056, 1743 },
+    { 1053, 1750 },
+    { 1048, 1756 },
+    { 1045, 1763 },
+    { 1043, 1770 },
+    { 1041, 1776 },
+    { 1039, 1783 },
+    { 1039, 1790 },
+    { 1039, 1796 },
+    { 1038, 1802 },
+    { 1038, 1809 },
+    { 1040, 1814 },
+    { 1043, 1820 },
+    { 1045, 1826 },
+    { 1049, 1832 },
+    { 1054, 1837 },
+    { 1059, 1842 },
+    { 1067, 1847 },
+    { 1075, 1851 },
+    { 1084, 1855 },
+    { 1095, 1858 },
+    { 1107, 1861 },
+    { 1121, 1861 },
+    { 1134, 1863 },
+    { 1148, 1862 },
+    { 1162, 1862 },
+    { 1177, 1860 },
+    { 1190, 1857 },
+    { 1204, 1854 },
+    { 1216, 1850 },
+    { 1227, 1845 },
+    { 1237, 1839 },
+    { 1246, 1834 },
+    { 1254, 1828 },
+    { 1262, 1822 },
+    { 1269, 1815 },
+    { 1275, 1809 },
+    { 1278, 1805 },
+    { 1280, 1809 },
+    { 1281, 1816 },
+    { 1284, 1821 },
+    { 1286, 1827 },
+    { 1291, 1832 },
+    { 1296, 1838 },
+    { 1303, 1842 },
+    { 1311, 1846 },
+    { 1320, 1850 },
+    { 1331, 1853 },
+    { 1343, 1855 },
+    { 1357, 1856 },
+    { 1370, 1857 },
+    { 1384, 1857 },
+    { 1399, 1856 },
+    { 1413, 1854 },
+    { 1427, 1852 },
+    { 1441, 1849 },
+    { 1454, 1845 },
+    { 1465, 1840 },
+    { 1477, 1836 },
+    { 1487, 1831 },
+    { 1495, 1826 },
+    { 1505, 1820 },
+    { 1514, 1815 },
+    { 1520, 1808 },
+    { 1527, 1802 },
+    { 1533, 1796 },
+    { 1540, 1790 },
+    { 1545, 1783 },
+    { 1550, 1777 },
+    { 1553, 1770 },
+    { 1558, 1763 },
+    { 1561, 1757 },
+    { 1565, 1750 },
+    { 1568, 1743 },
+    { 1571, 1736 },
+    { 1573, 1730 },
+    { 1575, 1723 },
+    { 1578, 1716 },
+    { 1579, 1709 },
+    { 1581, 1702 },
+    { 1581, 1696 },
+    { 1582, 1689 },
+    { 1582, 1683 },
+    { 1582, 1677 },
+    { 1581, 1671 },
+    { 1580, 1665 },
+    { 1578, 1660 },
+    { 1575, 1656 },
+    { 1571, 1652 },
+    { 1568, 1648 },
+    { 1564, 1646 },
+    { 1560, 1643 },
+    { 1556, 1640 },
+    { 1550, 1640 },
+    { 1545, 1638 },
+    { 1540, 1637 },
+    { 1534, 1636 },
+    { 1529, 1635 },
+    { 1524, 1634 },
+    { 1518, 1634 },
+    { 1513, 1633 },
+    { 1508, 1633 },
+    { 1502, 1632 },
+    { 1499, 1633 },
+    { 1500, 1630 },
+    { 1506, 1628 },
+    { 1513, 1626 },
+    { 1519, 1622 },
+    { 1526, 1619 },
+    { 1533, 1616 },
+    { 1540, 1612 },
+    { 1547, 1608 },
+    { 1553, 1603 },
+    { 1560, 1598 },
+    { 1566, 1593 },
+    { 1573, 1587 },
+    { 1579, 1581 },
+    { 1585, 1575 },
+    { 1591, 1567 },
+    { 1596, 1560 },
+    { 1601, 1552 },
+    { 1606, 1544 },
+    { 1609, 1537 },
+    { 1614, 1528 },
+    { 1618, 1520 },
+    { 1621, 1511 },
+    { 1624, 1503 },
+    { 1626, 1494 },
+    { 1629, 1486 },
+    { 1632, 1477 },
+    { 1634, 1469 },
+    { 1635, 1461 },
+    { 1637, 1453 },
+    { 1639, 1445 },
+    { 1641, 1436 },
+    { 1642, 1429 },
+    { 1644, 1420 },
+    { 1646, 1412 },
+    { 1647, 1404 },
+    { 1648, 1397 },
+    { 1649, 1390 },
+    { 1650, 1383 },
+    { 1650, 1375 },
+    { 1650, 1370 },
+    { 1649, 1364 },
+    { 1648, 1359 },
+    { 1647, 1355 },
+    { 1645, 1352 },
+    { 1642, 1350 },
+    { 1639, 1349 },
+    { 1635, 1350 },
+    { 1630, 1352 },
+    { 1625, 1355 },
+    { 1620, 1359 },
+    { 1614, 1364 },
+    { 1608, 1368 },
+    { 1602, 1374 },
+    { 1596, 1380 },
+    { 1589, 1386 },
+    { 1583, 1391 },
+    { 1577, 1397 },
+    { 1571, 1404 },
+    { 1564, 1410 },
+    { 1559, 1416 },
+    { 1553, 1421 },
+    { 1546, 1429 },
+    { 1540, 1434 },
+    { 1534, 1441 },
+    { 1528, 1446 },
+    { 1522, 1453 },
+    { 1516, 1457 },
+    { 1511, 1465 },
+    { 1506, 1474 },
+    { 1501, 1484 },
+    { 1497, 1493 },
+    { 1493, 1502 },
+    { 1486, 1507 },
+    { 1481, 1512 },
+    { 1474, 1518 },
+    { 1468, 1524 },
+    { 1462, 1530 },
+    { 1462, 1536 },
+    { 1462, 1542 },
+    { 1462, 1548 },
+    { 1462, 1555 },
+    { 1461, 1561 },
+    { 1460, 1568 },
+    { 1458, 1576 },
+    { 1456, 1584 },
+    { 1453, 1591 },
+    { 1450, 1599 },
+    { 1446, 1607 },
+    { 1445, 1614 },
+    { 1451, 1614 },
+    { 1456, 1614 },
+    { 1462, 1614 },
+    { 1468, 1613 },
+    { 1474, 1613 },
+    { 1480, 1612 },
+    { 1486, 1611 },
+    { 1492, 1609 },
+    { 1498, 1608 },
+    { 1504, 1607 },
+    { 1510, 1604 },
+    { 1517, 1602 },
+    { 1523, 1599 },
+    { 1530, 1596 },
+    { 1536, 1593 },
+    { 1543, 1589 },
+    { 1549, 1585 },
+    { 1556, 1580 },
+    { 1563, 1575 },
+    { 1569, 1569 },
+    { 1575, 1563 },
+    { 1581, 1557 },
+    { 1587, 1549 },
+    { 1591, 1541 },
+    { 1596, 1533 },
+    { 1600, 1524 },
+    { 1603, 1516 },
+    { 1606, 1507 },
+    { 1609, 1499 },
+    { 1612, 1490 },
+    { 1614, 1482 },
+    { 1616, 1474 },
+    { 1618, 1466 },
+    { 1620, 1457 },
+    { 1621, 1450 },
+    { 1622, 1442 },
+    { 1624, 1434 },
+    { 1625, 1427 },
+    { 1626, 1420 },
+    { 1626, 1413 },
+    { 1627, 1406 },
+    { 1627, 1400 },
+    { 1626, 1396 },
+    { 1625, 1392 },
+    { 1622, 1389 },
+    { 1619, 1389 },
+    { 1614, 1391 },
+    { 1609, 1393 },
+    { 1603, 1396 },
+    { 1597, 1401 },
+    { 1591, 1407 },
+    { 1585, 1412 },
+    { 1579, 1418 },
+    { 1573, 1424 },
+    { 1566, 1430 },
+    { 1560, 1436 },
+    { 1554, 1442 },
+    { 1548, 1447 },
+    { 1542, 1455 },
+    { 1536, 1460 },
+    { 1529, 1467 },
+    { 1524, 1472 },
+    { 1517, 1478 },
+    { 1511, 1484 },
+    { 1505, 1489 },
+    { 1499, 1496 },
+    { 1492, 1502 },
+};
+
+static const unsigned short flower_duty_lod2[][2] = {
+    { 1423, 1646 },
+    { 1434, 1648 },
+    { 1444, 1651 },
+    { 1455, 1653 },
+    { 1467, 1655 },
+    { 1478, 1657 },
+    { 1490, 1658 },
+    { 1502, 1659 },
+    { 1514, 1660 },
+    { 1525, 1661 },
+    { 1536, 1664 },
+    { 1545, 1669 },
+    { 1553, 1676 },
+    { 1556, 1686 },
+    { 1556, 1699 },
+    { 1553, 1713 },
+    { 1549, 1727 },
+    { 1543, 1740 },
+    { 1535, 1754 },
+    { 1525, 1767 },
+    { 1515, 1780 },
+    { 1502, 1792 },
+    { 1486, 1804 },
+    { 1468, 1814 },
+    { 1448, 1824 },
+    { 1424, 1830 },
+    { 1399, 1835 },
+    { 1374, 1835 },
+    { 1353, 1831 },
+    { 1337, 1824 },
+    { 1325, 1815 },
+    { 1318, 1804 },
+    { 1316, 1792 },
+    { 1316, 1780 },
+    { 1318, 1767 },
+    { 1322, 1754 },
+    { 1328, 1740 },
+    { 1334, 1726 },
+    { 1342, 1712 },
+    { 1351, 1698 },
+    { 1361, 1692 },
+    { 1376, 1686 },
+    { 1391, 1677 },
+    { 1404, 1666 },
+    { 1417, 1653 },
+    { 1422, 1647 },
+    { 1409, 1652 },
+    { 1395, 1657 },
+    { 1381, 1661 },
+    { 1366, 1665 },
+    { 1352, 1668 },
+    { 1338, 1671 },
+    { 1326, 1670 },
+    { 1319, 1663 },
+    { 1314, 1654 },
+    { 1312, 1643 },
+    { 1314, 1629 },
+    { 1320, 1614 },
+    { 1327, 1598 },
+    { 1338, 1583 },
+    { 1349, 1568 },
+    { 1362, 1555 },
+    { 1374, 1543 },
+    { 1387, 1534 },
+    { 1398, 1528 },
+    { 1409, 1524 },
+    { 1419, 1523 },
+    { 1427, 1525 },
+    { 1434, 1529 },
+    { 1438, 1537 },
+    { 1441, 1547 },
+    { 1441, 1560 },
+    { 1440, 1573 },
+    { 1436, 1587 },
+    { 1431, 1603 },
+    { 1422, 1618 },
+    { 1412, 1633 },
+    { 1400, 1647 },
+    { 1386, 1658 },
+    { 1372, 1667 },
+    { 1358, 1671 },
+    { 1344, 1674 },
+    { 1332, 1673 },
+    { 1318, 1674 },
+    { 1305, 1675 },
+    { 1291, 1676 },
+    { 1297, 1684 },
+    { 1305, 1692 },
+    { 1316, 1696 },
+    { 1319, 1697 },
+    { 1312, 1711 },
+    { 1304, 1725 },
+    { 1296, 1739 },
+    { 1287, 1752 },
+    { 1277, 1766 },
+    { 1266, 1779 },
+    { 1255, 1792 },
+    { 1242, 1805 },
+    { 1226, 1817 },
+    { 1208, 1828 },
+    { 1186, 1836 },
+    { 1162, 1840 },
+    { 1138, 1841 },
+    { 1117, 1836 },
+    { 1100, 1828 },
+    { 1088, 1819 },
+    { 1080, 1809 },
+    { 1075, 1797 },
+    { 1073, 1785 },
+    { 1074, 1772 },
+    { 1077, 1759 },
+    { 1082, 1746 },
+    { 1092, 1733 },
+    { 1106, 1721 },
+    { 1122, 1713 },
+    { 1138, 1707 },
+    { 1154, 1702 },
+    { 1169, 1697 },
+    { 1184, 1693 },
+    { 1199, 1689 },
+    { 1214, 1685 },
+    { 1229, 1680 },
+    { 1243, 1675 },
+    { 1258, 1671 },
+    { 1272, 1667 },
+    { 1286, 1662 },
+    { 1290, 1671 },
+    { 1290, 1676 },
+    { 1276, 1676 },
+    { 1264, 1675 },
+    { 1251, 1674 },
+    { 1239, 1672 },
+    { 1228, 1670 },
+    { 1216, 1667 },
+    { 1206, 1664 },
+    { 1194, 1663 },
+    { 1184, 1661 },
+    { 1174, 1657 },
+    { 1165, 1653 },
+    { 1158, 1646 },
+    { 1152, 1637 },
+    { 1150, 1626 },
+    { 1151, 1613 },
+    { 1156, 1598 },
+    { 1162, 1583 },
+    { 1172, 1567 },
+    { 1183, 1552 },
+    { 1194, 1537 },
+    { 1206, 1522 },
+    { 1218, 1507 },
+    { 1230, 1492 },
+    { 1243, 1477 },
+    { 1256, 1463 },
+    { 1268, 1450 },
+    { 1280, 1441 },
+    { 1290, 1436 },
+    { 1298, 1435 },
+    { 1305, 1437 },
+    { 1311, 1441 },
+    { 1315, 1448 },
+    { 1318, 1457 },
+    { 1321, 1466 },
+    { 1324, 1466 },
+    { 1327, 1451 },
+    { 1332, 1433 },
+    { 1338, 1415 },
+    { 1347, 1394 },
+    { 1358, 1374 },
+    { 1371, 1352 },
+    { 1386, 1330 },
+    { 1400, 1311 },
+    { 1415, 1292 },
+    { 1429, 1274 },
+    { 1444, 1257 },
+    { 1446, 1255 },
+    { 1435, 1268 },
+    { 1421, 1285 },
+    { 1406, 1304 },
+    { 1391, 1323 },
+    { 1377, 1344 },
+    { 1363, 1366 },
+    { 1351, 1387 },
+    { 1341, 1408 },
+    { 1333, 1427 },
+    { 1328, 1444 },
+    { 1325, 1461 },
+    { 1323, 1468 },
+    { 1320, 1461 },
+    { 1316, 1452 },
+    { 1312, 1445 },
+    { 1308, 1438 },
+    { 1302, 1435 },
+    { 1295, 1434 },
+    { 1285, 1439 },
+    { 1274, 1446 },
+    { 1261, 1458 },
+    { 1249, 1471 },
+    { 1236, 1486 },
+    { 1223, 1500 },
+    { 1211, 1515 },
+    { 1199, 1530 },
+    { 1188, 1545 },
+    { 1177, 1560 },
+    { 1166, 1576 },
+    { 1158, 1591 },
+    { 1152, 1607 },
+    { 1150, 1621 },
+    { 1151, 1633 },
+    { 1156, 1642 },
+    { 1162, 1650 },
+    { 1170, 1656 },
+    { 1180, 1659 },
+    { 1190, 1662 },
+    { 1200, 1664 },
+    { 1214, 1658 },
+    { 1229, 1649 },
+    { 1243, 1640 },
+    { 1255, 1639 },
+    { 1267, 1637 },
+    { 1280, 1635 },
+    { 1292, 1632 },
+    { 1299, 1619 },
+    { 1307, 1603 },
+    { 1316, 1588 },
+    { 1327, 1573 },
+    { 1325, 1562 },
+    { 1322, 1553 },
+    { 1318, 1544 },
+    { 1315, 1534 },
+    { 1312, 1525 },
+    { 1309, 1516 },
+    { 1305, 1506 },
+    { 1302, 1497 },
+    { 1299, 1488 },
+    { 1295, 1480 },
+    { 1291, 1473 },
+    { 1286, 1467 },
+    { 1277, 1468 },
+    { 1266, 1475 },
+    { 1253, 1487 },
+    { 1241, 1501 },
+    { 1228, 1516 },
+    { 1216, 1531 },
+    { 1205, 1546 },
+    { 1193, 1562 },
+    { 1183, 1578 },
+    { 1175, 1593 },
+    { 1172, 1607 },
+    { 1175, 1618 },
+    { 1180, 1626 },
+    { 1189, 1632 },
+    { 1197, 1636 },
+    { 1207, 1638 },
+    { 1217, 1639 },
+    { 1228, 1641 },
+    { 1239, 1640 },
+    { 1253, 1632 },
+    { 1267, 1622 },
+    { 1280, 1611 },
+    { 1293, 1600 },
+    { 1306, 1588 },
+    { 1319, 1576 },
+    { 1332, 1564 },
+    { 1345, 1551 },
+    { 1357, 1538 },
+    { 1370, 1526 },
+    { 1382, 1515 },
+    { 1394, 1506 },
+    { 1400, 1489 },
+    { 1407, 1472 },
+    { 1408, 1470 },
+    { 1402, 1487 },
+    { 1395, 1504 },
+    { 1390, 1510 },
+    { 1378, 1519 },
+    { 1365, 1530 },
+    { 1353, 1541 },
+    { 1349, 1532 },
+    { 1346, 1522 },
+    { 1344, 1512 },
+    { 1343, 1501 },
+    { 1342, 1489 },
+    { 1342, 1476 },
+    { 1343, 1462 },
+    { 1344, 1448 },
+    { 1348, 1432 },
+    { 1352, 1415 },
+    { 1359, 1396 },
+    { 1371, 1375 },
+    { 1385, 1354 },
+    { 1399, 1335 },
+    { 1413, 1318 },
+    { 1427, 1302 },
+    { 1439, 1289 },
+    { 1451, 1278 },
+    { 1460, 1273 },
+    { 1467, 1272 },
+    { 1468, 1283 },
+    { 1465, 1300 },
+    { 1459, 1320 },
+    { 1453, 1340 },
+    { 1447, 1360 },
+    { 1439, 1381 },
+    { 1432, 1401 },
+    { 1426, 1421 },
+    { 1419, 1439 },
+    { 1413, 1457 },
+    { 1411, 1464 },
+    { 1417, 1446 },
+    { 1424, 1428 },
+    { 1430, 1409 },
+    { 1436, 1389 },
+    { 1444, 1368 },
+    { 1451, 1347 },
+    { 1457, 1328 },
+    { 1463, 1308 },
+    { 1468, 1288 },
+    { 1469, 1274 },
+    { 1464, 1271 },
+    { 1455, 1274 },
+    { 1443, 1286 },
+    { 1432, 1296 },
+    { 1419, 1311 },
+    { 1405, 1326 },
+    { 1391, 1344 },
+    { 1377, 1364 },
+    { 1364, 1386 },
+    { 1356, 1405 },
+    { 1349, 1424 },
+    { 1345, 1441 },
+    { 1343, 1456 },
+    { 1342, 1470 },
+    { 1341, 1483 },
+    { 1342, 1495 },
+    { 1343, 1507 },
+    { 1345, 1518 },
+    { 1347, 1528 },
+    { 1350, 1537 },
+    { 1355, 1541 },
+    { 1366, 1538 },
+    { 1377, 1535 },
+    { 1388, 1531 },
+    { 1399, 1527 },
+    { 1411, 1522 },
+    { 1422, 1517 },
+    { 1434, 1511 },
+    { 1445, 1505 },
+    { 1457, 1498 },
+    { 1469, 1491 },
+    { 1481, 1481 },
+    { 1492, 1465 },
+    { 1504, 1449 },
+    { 1517, 1432 },
+    { 1529, 1414 },
+    { 1542, 1394 },
+    { 1555, 1374 },
+    { 1568, 1351 },
+    { 1582, 1326 },
+    { 1595, 1299 },
+    { 1609, 1270 },
+    { 1620, 1242 },
+    { 1626, 1219 },
+    { 1628, 1203 },
+    { 1628, 1190 },
+    { 1626, 1182 },
+    { 1622, 1176 },
+    { 1618, 1171 },
+    { 1612, 1170 },
+    { 1606, 1169 },
+    { 1596, 1176 },
+    { 1583, 1190 },
+    { 1567, 1211 },
+    { 1548, 1242 },
+    { 1531, 1273 },
+    { 1515, 1302 },
+    { 1501, 1328 },
+    { 1488, 1353 },
+    { 1476, 1376 },
+    { 1466, 1398 },
+    { 1455, 1419 },
+    { 1445, 1439 },
+    { 1436, 1459 },
+    { 1426, 1478 },
+    { 1420, 1495 },
+    { 1429, 1493 },
+    { 1437, 1494 },
+    { 1445, 1496 },
+    { 1451, 1501 },
+    { 1456, 1508 },
+    { 1469, 1495 },
+    { 1481, 1483 },
+    { 1493, 1475 },
+    { 1505, 1466 },
+    { 1517, 1454 },
+    { 1530, 1435 },
+    { 1542, 1416 },
+    { 1555, 1396 },
+    { 1567, 1374 },
+    { 1580, 1351 },
+    { 1594, 1326 },
+    { 1607, 1300 },
+    { 1621, 1271 },
+    { 1634, 1240 },
+    { 1646, 1209 },
+    { 1656, 1180 },
+    { 1664, 1153 },
+    { 1671, 1127 },
+    { 1675, 1107 },
+    { 1678, 1088 },
+    { 1679, 1073 },
+    { 1681, 1056 },
+    { 1681, 1045 },
+    { 1675, 1044 },
+    { 1667, 1046 },
+    { 1654, 1060 },
+    { 1637, 1081 },
+    { 1619, 1106 },
+    { 1595, 1144 },
+    { 1574, 1177 },
+    { 1553, 1212 },
+    { 1534, 1245 },
+    { 1517, 1276 },
+    { 1502, 1304 },
+    { 1488, 1331 },
+    { 1474, 1355 },
+    { 1462, 1379 },
+    { 1451, 1401 },
+    { 1442, 1418 },
+    { 1447, 1399 },
+    { 1455, 1378 },
+    { 1462, 1358 },
+    { 1469, 1337 },
+    { 1476, 1315 },
+    { 1483, 1294 },
+    { 1488, 1274 },
+    { 1495, 1252 },
+    { 1497, 1234 },
+    { 1499, 1219 },
+    { 1495, 1213 },
+    { 1487, 1216 },
+    { 1478, 1222 },
+    { 1466, 1232 },
+    { 1453, 1248 },
+    { 1451, 1249 },
+    { 1464, 1236 },
+    { 1476, 1223 },
+    { 1486, 1217 },
+    { 1494, 1214 },
+    { 1498, 1220 },
+    { 1498, 1232 },
+    { 1494, 1250 },
+    { 1489, 1271 },
+    { 1483, 1293 },
+    { 1477, 1313 },
+    { 1470, 1335 },
+    { 1462, 1356 },
+    { 1456, 1377 },
+    { 1448, 1397 },
+    { 1442, 1416 },
+    { 1441, 1420 },
+    { 1440, 1421 },
+    { 1441, 1422 },
+    { 1451, 1401 },
+    { 1462, 1379 },
+    { 1474, 1356 },
+    { 1488, 1331 },
+    { 1502, 1305 },
+    { 1517, 1276 },
+    { 1534, 1246 },
+    { 1553, 1212 },
+    { 1575, 1177 },
+    { 1596, 1142 },
+    { 1620, 1106 },
+    { 1638, 1080 },
+    { 1654, 1060 },
+    { 1665, 1052 },
+    { 1672, 1049 },
+    { 1677, 1052 },
+    { 1678, 1063 },
+    { 1677, 1079 },
+    { 1676, 1093 },
+    { 1673, 1111 },
+    { 1670, 1131 },
+    { 1663, 1155 },
+    { 1656, 1181 },
+    { 1645, 1212 },
+    { 1633, 1243 },
+    { 1619, 1273 },
+    { 1606, 1302 },
+    { 1592, 1329 },
+    { 1579, 1353 },
+    { 1566, 1376 },
+    { 1553, 1398 },
+    { 1541, 1418 },
+    { 1528, 1437 },
+    { 1516, 1454 },
+    { 1511, 1462 },
+    { 1512, 1463 },
+    { 1523, 1451 },
+    { 1535, 1440 },
+    { 1547, 1428 },
+    { 1559, 1415 },
+    { 1571, 1403 },
+    { 1584, 1391 },
+    { 1597, 1379 },
+    { 1608, 1368 },
+    { 1620, 1359 },
+    { 1630, 1353 },
+    { 1639, 1350 },
+    { 1645, 1352 },
+    { 1649, 1359 },
+    { 1650, 1371 },
+    { 1650, 1384 },
+    { 1647, 1399 },
+    { 1645, 1414 },
+    { 1642, 1430 },
+    { 1638, 1447 },
+    { 1635, 1463 },
+    { 1631, 1480 },
+    { 1625, 1497 },
+    { 1620, 1513 },
+    { 1613, 1530 },
+    { 1605, 1547 },
+    { 1595, 1562 },
+    { 1583, 1577 },
+    { 1571, 1589 },
+    { 1558, 1599 },
+    { 1544, 1609 },
+    { 1531, 1617 },
+    { 1517, 1623 },
+    { 1504, 1628 },
+    { 1497, 1631 },
+    { 1506, 1633 },
+    { 1517, 1634 },
+    { 1528, 1635 },
+    { 1539, 1637 },
+    { 1549, 1639 },
+    { 1559, 1642 },
+    { 1568, 1648 },
+    { 1574, 1655 },
+    { 1579, 1664 },
+    { 1581, 1676 },
+    { 1581, 1688 },
+    { 1580, 1702 },
+    { 1577, 1715 },
+    { 1573, 1729 },
+    { 1569, 1742 },
+    { 1562, 1756 },
+    { 1554, 1770 },
+    { 1546, 1783 },
+    { 1534, 1796 },
+    { 1521, 1808 },
+    { 1506, 1820 },
+    { 1487, 1831 },
+    { 1466, 1840 },
+    { 1441, 1848 },
+    { 1413, 1853 },
+    { 1384, 1856 },
+    { 1356, 1856 },
+    { 1331, 1853 },
+    { 1311, 1847 },
+    { 1297, 1838 },
+    { 1287, 1828 },
+    { 1282, 1816 },
+    { 1280, 1804 },
+    { 1268, 1816 },
+    { 1253, 1828 },
+    { 1236, 1840 },
+    { 1215, 1850 },
+    { 1190, 1857 },
+    { 1162, 1862 },
+    { 1134, 1862 },
+    { 1107, 1860 },
+    { 1084, 1854 },
+    { 1067, 1846 },
+    { 1055, 1836 },
+    { 1046, 1826 },
+    { 1041, 1814 },
+    { 1038, 1802 },
+    { 1039, 1789 },
+    { 1041, 1776 },
+    { 1045, 1763 },
+    { 1053, 1749 },
+    { 1062, 1736 },
+    { 1073, 1723 },
+    { 1087, 1712 },
+    { 1103, 1702 },
+    { 1118, 1694 },
+    { 1133, 1687 },
+    { 1148, 1682 },
+    { 1162, 1678 },
+    { 1177, 1673 },
+    { 1191, 1669 },
+    { 1204, 1666 },
+    { 1190, 1669 },
+    { 1176, 1674 },
+    { 1162, 1678 },
+    { 1148, 1682 },
+    { 1133, 1687 },
+    { 1118, 1693 },
+    { 1102, 1701 },
+    { 1087, 1711 },
+    { 1073, 1723 },
+    { 1061, 1736 },
+    { 1053, 1750 },
+    { 1045, 1763 },
+    { 1041, 1776 },
+    { 1039, 1790 },
+    { 1038, 1802 },
+    { 1040, 1814 },
+    { 1045, 1826 },
+    { 1054, 1837 },
+    { 1067, 1847 },
+    { 1084, 1855 },
+    { 1107, 1861 },
+    { 1134, 1863 },
+    { 1162, 1862 },
+    { 1190, 1857 },
+    { 1216, 1850 },
+    { 1237, 1839 },
+    { 1254, 1828 },
+    { 1269, 1815 },
+    { 1278, 1805 },
+    { 1281, 1816 },
+    { 1286, 1827 },
+    { 1296, 1838 },
+    { 1311, 1846 },
+    { 1331, 1853 },
+    { 1357, 1856 },
+    { 1384, 1857 },
+    { 1413, 1854 },
+    { 1441, 1849 },
+    { 1465, 1840 },
+    { 1487, 1831 },
+    { 1505, 1820 },
+    { 1520, 1808 },
+    { 1533, 1796 },
+    { 1545, 1783 },
+    { 1553, 1770 },
+    { 1561, 1757 },
+    { 1568, 1743 },
+    { 1573, 1730 },
+    { 1578, 1716 },
+    { 1581, 1702 },
+    { 1582, 1689 },
+    { 1582, 1677 },
+    { 1580, 1665 },
+    { 1575, 1656 },
+    { 1568, 1648 },
+    { 1560, 1643 },
+    { 1550, 1640 },
+    { 1540, 1637 },
+    { 1529, 1635 },
+    { 1518, 1634 },
+    { 1508, 1633 },
+    { 1499, 1633 },
+    { 1500, 1630 },
+    { 1513, 1626 },
+    { 1526, 1619 },
+    { 1540, 1612 },
+    { 1553, 1603 },
+    { 1566, 1593 },
+    { 1579, 1581 },
+    { 1591, 1567 },
+    { 1601, 1552 },
+    { 1609, 1537 },
+    { 1618, 1520 },
+    { 1624, 1503 },
+    { 1629, 1486 },
+    { 1634, 1469 },
+    { 1637, 1453 },
+    { 1641, 1436 },
+    { 1644, 1420 },
+    { 1647, 1404 },
+    { 1649, 1390 },
+    { 1650, 1375 },
+    { 1649, 1364 },
+    { 1647, 1355 },
+    { 1642, 1350 },
+    { 1635, 1350 },
+    { 1625, 1355 },
+    { 1614, 1364 },
+    { 1602, 1374 },
+    { 1589, 1386 },
+    { 1577, 1397 },
+    { 1564, 1410 },
+    { 1553, 1421 },
+    { 1540, 1434 },
+    { 1528, 1446 },
+    { 1516, 1457 },
+    { 1511, 1465 },
+    { 1501, 1484 },
+    { 1493, 1502 },
+    { 1481, 1512 },
+    { 1468, 1524 },
+    { 1462, 1530 },
+    { 1462, 1542 },
+    { 1462, 1555 },
+    { 1460, 1568 },
+    { 1456, 1584 },
+    { 1450, 1599 },
+    { 1445, 1614 },
+    { 1456, 1614 },
+    { 1468, 1613 },
+    { 1480, 1612 },
+    { 1492, 1609 },
+    { 1504, 1607 },
+    { 1517, 1602 },
+    { 1530, 1596 },
+    { 1543, 1589 },
+    { 1556, 1580 },
+    { 1569, 1569 },
+    { 1581, 1557 },
+    { 1591, 1541 },
+    { 1600, 1524 },
+    { 1606, 1507 },
+    { 1612, 1490 },
+    { 1616, 1474 },
+    { 1620, 1457 },
+    { 1622, 1442 },
+    { 1625, 1427 },
+    { 1626, 1413 },
+    { 1627, 1400 },
+    { 1625, 1392 },
+    { 1619, 1389 },
+    { 1609, 1393 },
+    { 1597, 1401 },
+    { 1585, 1412 },
+    { 1573, 1424 },
+    { 1560, 1436 },
+    { 1548, 1447 },
+    { 1536, 1460 },
+    { 1524, 1472 },
+    { 1511, 1484 },
+    { 1499, 1496 },
+    { 1492, 1502 },
+};
+
+const halo_traj_lod_t flower_lods[FLOWER_LOD_COUNT] = {
+    { flower_duty, 2894, 0.0987f },
+    { flower_duty_lod1, 1451, 0.1959f },
+    { flower_duty_lod2, 736, 0.3855f },
+};
@@ -0,0 +1,11 @@
+#ifndef FLOWER_LOD_H
+#define FLOWER_LOD_H
+
+#include "halo_trajectory.h"
+
+#define FLOWER_LOD_COUNT 3
+
+// flower_duty and coarser copies, finest first
+extern const halo_traj_lod_t flower_lods[FLOWER_LOD_COUNT];
+
+#endif // FLOWER_LOD_H
@@ -0,0 +1,372 @@
+#include "flower_path.h"
+
+// ----------------------------
+// Generated flower path (do not edit)
+// ----------------------------
+
+static const signed char flower_path_data[] = {
+      -8,   -6,   -5,   -8,   -5,   -9,   -6,   -8,   -5,   -9,   -5,   -8,   -6,   -9,   -5,   -8,
+      -5,   -9,   -5,   -8,   -6,   -8,   -5,   -9,   -5,   -8,   -6,   -9,   -5,   -8,   -5,   -9,
+      -5,   -9,   -5,   -9,   -4,   -8,   -5,   -9,   -5,   -9,   -4,   -9,   -5,   -9,   -5,   -8,
+      -5,   -9,   -4,   -9,   -5,   -9,   -5,   -9,   -5,   -8,   -4,   -9,   -5,   -9,   -3,  -10,
+      -4,   -9,   -1,   -9,   -4,   -9,   -4,   -9,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,
+      -2,  -10,   -1,  -10,    0,  -10,    0,  -10,    0,  -10,    2,   -9,    3,  -10,    2,  -10,
+       3,   -9,    4,   -9,    6,   -8,    6,   -8,    6,   -8,    7,   -7,    7,   -7,    8,   -6,
+       8,   -6,    8,   -6,    9,   -5,    9,   -4,    9,   -5,    9,   -4,    9,   -4,    9,   -5,
+       9,   -2,    9,   -3,    9,   -2,    9,   -4,   10,   -3,    9,   -2,   10,   -3,   10,    0,
+      10,   -2,    9,   -3,   10,    0,   10,    0,   10,    0,    9,   -2,   10,    0,   10,    1,
+      10,    0,   10,    0,   10,    1,   10,    0,   10,    0,   10,    2,   10,    2,    9,    2,
+      10,    3,    9,    3,   10,    2,    9,    3,    8,    5,    9,    3,   10,    2,    9,    5,
+       9,    4,    8,    5,    9,    6,    8,    6,    7,    6,    8,    7,    8,    6,    7,    6,
+       6,    9,    6,    8,    6,    8,    6,    8,    3,    9,    5,    9,    3,    9,    2,    9,
+       3,   10,    4,    9,    0,   10,    1,   10,    2,    9,    2,   10,   -1,   10,   -1,   10,
+      -1,   10,   -1,   10,    0,   10,   -2,   10,   -4,    9,    0,   10,   -5,    8,    0,   10,
+      -5,    8,   -2,    9,   -2,    9,   -3,   10,   -4,    9,   -3,    9,   -5,    9,   -4,    9,
+      -5,    9,   -4,    9,   -5,    9,   -4,    9,   -6,    8,   -5,    9,   -5,    8,   -6,    8,
+      -5,    9,   -6,    8,   -5,    9,   -5,    8,   -7,    8,   -6,    7,   -7,    8,   -6,    8,
+      -7,    7,   -6,    8,   -7,    7,   -6,    8,   -8,    5,   -9,   -3,  -10,   -3,   -9,   -3,
+     -10,    0,  -10,   -3,   -9,   -2,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,    0,   -9,    5,  -10,    0,   -9,    2,   -9,    3,  -10,    2,   -9,    4,   -9,    4,
+      -9,    4,    8,    4,    9,    3,   10,    4,    9,    4,    9,    4,    9,    3,   10,    4,
+       9,    4,    9,    4,    9,    3,   10,    4,    9,    4,    9,    4,    9,    4,   10,    3,
+       9,    4,    9,    4,    9,    4,   10,    3,    9,    4,    9,    4,    9,    4,   10,    3,
+       9,    4,    9,    4,   10,    4,    8,    5,    6,    8,    6,    8,    6,    7,    7,    8,
+       3,    9,    5,    8,    3,   10,    5,    8,    3,    9,    2,   10,    2,   10,    2,    9,
+       3,   10,    0,   10,    0,   10,    0,   10,    0,   10,   -2,   10,   -2,   10,   -2,    9,
+      -2,   10,   -4,    9,   -4,   10,   -4,    9,   -4,    9,   -6,    8,   -5,    8,   -6,    9,
+      -7,    7,   -7,    7,   -7,    7,   -7,    7,   -8,    6,   -9,    5,   -8,    6,   -8,    5,
+      -9,    4,  -10,    3,   -9,    4,  -10,    3,   -9,    2,  -10,    0,   -9,    5,  -10,    0,
+     -10,    0,  -10,    0,  -10,    0,   -9,   -4,   -9,   -1,  -10,    0,  -10,   -4,   -9,   -3,
+      -9,   -4,  -10,   -4,   -9,   -4,   -8,   -5,   -8,   -6,   -8,   -6,   -8,   -6,   -7,   -7,
+      -8,   -7,   -7,   -7,   -6,   -8,   -6,   -8,   -6,   -8,   -4,   -9,   -4,   -9,   -4,   -9,
+      -5,   -9,   -1,   -9,   -4,   -9,    0,  -10,   -5,   -8,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    4,   -9,    1,   -9,    1,  -10,    5,   -9,    4,   -9,
+       2,  -10,    5,   -8,    5,   -9,    5,   -8,    6,   -9,    7,   -7,    6,   -7,    7,   -8,
+       7,   -7,    9,   -5,    8,   -6,    8,   -5,    9,   -6,    9,   -4,    9,   -3,    9,   -4,
+      10,   -3,   10,   -2,    9,   -2,   10,   -2,   10,   -2,   10,    0,   10,    0,   10,    0,
+      10,    2,    9,    2,   10,    2,   10,    3,    9,    4,    9,    4,   10,    2,    8,    5,
+       9,    5,    9,    5,    8,    5,    7,    7,    8,    7,    7,    6,   10,    3,    9,    4,
+       9,    4,   10,    4,    9,    3,    9,    4,    9,    4,   10,    3,    9,    4,    9,    4,
+      10,    3,   -5,   -8,   -4,   -9,   -5,   -9,   -5,   -8,   -5,   -9,   -4,   -9,   -6,   -8,
+      -7,   -8,   -6,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,    4,   -7,    5,   -8,
+       6,   -9,    5,   -8,    6,   -8,    5,   -9,    6,   -8,    5,   -8,    6,   -9,    5,   -8,
+       6,   -8,    5,   -9,    6,   -8,    6,   -8,    7,   -7,    6,   -8,    6,   -8,    6,   -8,
+       6,   -8,    6,   -8,    7,   -8,    7,   -7,    6,   -7,    7,   -8,    7,   -7,    7,   -7,
+       7,   -7,    6,   -8,    7,   -7,    7,   -7,    7,   -7,    8,   -7,    8,   -6,    7,   -7,
+       8,   -6,    8,   -6,    8,   -6,    8,   -5,    9,   -6,    9,   -4,    9,   -5,    9,   -4,
+       9,   -2,    9,   -4,   10,    0,    9,   -2,    9,   -3,    9,    3,    9,    2,   10,    0,
+       8,    5,   10,    1,    8,    5,    9,    4,    8,    5,    9,    6,    8,    5,    8,    6,
+       7,    7,    8,    7,    7,    6,    7,    7,    8,    7,    6,    8,    6,    8,    7,    7,
+       6,    8,    6,    8,    6,    8,    6,    8,    5,    9,    6,    8,    5,    8,    5,    9,
+       6,    8,    4,    9,    3,   10,    5,    8,    4,    9,    3,   10,    5,    8,    1,    9,
+       5,    9,    2,   10,    4,    9,    1,   10,    1,    9,    3,   10,    0,   10,    0,   10,
+      -2,    9,   -2,   10,   -3,   10,   -4,    9,   -5,    9,   -6,    7,   -7,    8,   -6,    7,
+      -8,    6,   -9,    6,   -8,    5,   -9,    5,   -9,    4,   -9,    4,   -9,    5,   -9,    4,
+     -10,    2,   -9,    2,   -9,    4,   -9,    3,  -10,    2,   -9,    3,  -10,    2,   -9,    2,
+     -10,    3,   -9,    2,  -10,    1,  -10,    3,   -9,    2,  -10,    1,  -10,    0,   -9,    4,
+     -10,    1,  -10,    0,  -10,    1,   -9,    4,  -10,    0,  -10,    0,  -10,    0,  -10,    3,
+      -9,    2,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,   -6,   -5,   -3,  -10,
+      -3,   -9,   -3,  -10,   -2,   -9,    2,   -4,   10,    4,    9,    3,    9,    4,   10,    4,
+       9,    3,    9,    4,    9,    4,   10,    3,    9,    4,    9,    4,   10,    3,    9,    4,
+       9,    4,   10,    3,    9,    4,    9,    4,    9,    3,   10,    4,    9,    4,    9,    3,
+      10,    4,    9,    4,    9,    3,   10,    4,    9,    4,    9,    3,    9,    4,   10,    4,
+      10,    0,   10,    0,    8,    5,   10,    0,    9,    3,    9,    2,    9,    1,    9,    4,
+      10,    0,    8,    5,   10,    1,    8,    3,    9,    4,    9,    2,    9,    3,   10,    4,
+       9,    3,    9,    5,    9,    4,    9,    5,    9,    4,    9,    5,    8,    5,    8,    6,
+       9,    6,    7,    6,    7,    8,    6,    7,    7,    7,    7,    8,    7,    7,    4,    9,
+       5,    9,    5,    8,    2,   10,    3,   10,    4,    8,    0,   10,    1,   10,    4,    9,
+       0,   10,    0,   10,    0,   10,   -4,    9,   -1,   10,    0,   10,   -3,    9,   -1,   10,
+      -3,    9,   -3,   10,   -4,    9,   -3,   10,   -2,    9,   -4,    9,   -3,    9,   -5,    9,
+      -3,    9,   -3,    9,   -5,    9,   -5,    9,   -5,    8,   -4,    9,   -4,    9,   -5,    8,
+      -6,    9,   -6,    8,   -5,    8,   -6,    9,   -5,    8,   -6,    8,   -6,    8,   -8,    7,
+      -7,    6,   -7,    7,   -8,    7,   -7,    7,   -8,    5,   -9,    5,   -8,    5,   -9,    5,
+     -10,    3,   -9,    1,   -9,    4,  -10,    0,  -10,    0,   -8,    5,  -10,    0,   -8,   -5,
+     -10,    0,  -10,    0,   -9,   -1,   -9,   -4,   -9,   -2,   -8,   -4,  -10,   -3,   -9,   -3,
+      -9,   -5,   -9,   -5,   -9,   -4,   -9,   -5,   -8,   -5,   -9,   -5,   -8,   -6,   -8,   -6,
+      -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -4,    4,    6,    8,    5,    8,
+       3,   10,    4,    9,    4,    9,    3,    9,    4,   10,    2,    9,    2,   10,    2,    8,
+       0,   10,    4,    9,    1,    9,    0,   10,    0,   10,    0,   10,   -5,    8,    0,   10,
+      -3,    9,   -1,    9,   -3,   10,   -5,    9,   -5,    8,   -6,    8,   -5,    9,   -6,    8,
+      -7,    7,   -7,    7,   -7,    7,   -7,    7,   -8,    6,   -9,    5,   -8,    5,   -9,    6,
+      -8,    5,   -9,    5,   -8,    5,   -9,    5,  -10,    3,   -9,    4,   -8,    5,  -10,    2,
+     -10,    2,   -8,    6,   -9,    0,    5,    0,    8,   -4,   10,   -1,    8,   -5,    9,   -3,
+      10,   -3,    8,   -6,    9,   -3,    9,   -4,    9,   -5,    8,   -6,    9,   -5,    8,   -6,
+       8,   -5,    9,   -6,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    6,   -8,
+       5,   -9,    5,   -8,    6,   -8,    3,  -10,    2,  -10,    5,   -8,    0,  -10,    4,   -8,
+       1,   -9,    0,  -10,    0,  -10,    0,  -10,   -5,   -8,    0,  -10,    0,  -10,   -4,   -8,
+      -1,  -10,   -4,   -9,   -2,  -10,   -4,   -9,   -4,   -9,   -4,   -9,   -4,   -9,   -6,   -8,
+      -3,   -9,    9,    1,    7,    7,    7,    7,    8,    5,    8,    6,    9,    6,    8,    5,
+       8,    6,    8,    6,    9,    4,    9,    5,    9,    5,    9,    4,    9,    5,    9,    3,
+       8,    4,    8,    4,   10,    1,    8,    5,   10,    0,   10,    0,   10,    0,    8,    5,
+      10,   -1,    8,   -4,   10,    0,   10,    0,    8,   -5,   10,    0,    8,   -5,    9,   -5,
+       9,   -5,    9,   -5,    7,   -6,    8,   -6,    7,   -7,    7,   -7,    8,   -7,    7,   -7,
+       6,   -8,    6,   -8,    5,   -8,    6,   -8,    6,   -9,    5,   -8,    6,   -8,    5,   -8,
+       4,   -9,    5,   -9,    5,   -8,    5,   -9,    3,   -9,    5,   -9,    4,   -9,    4,   -9,
+       4,   -9,    4,   -9,    1,  -10,    5,   -9,    3,   -9,    2,  -10,    2,  -10,    2,   -9,
+       2,  -10,    0,  -10,    2,   -9,    3,   -9,    0,  -10,    0,  -10,    0,  -10,   -5,   -9,
+       0,  -10,    0,  -10,   -5,   -9,   -2,   -9,   -3,  -10,   -6,   -8,   -5,   -9,   -6,   -8,
+      -5,   -8,   -7,   -7,   -7,   -7,   -7,   -8,   -7,   -7,   -8,   -6,   -9,   -5,   -8,   -5,
+      -9,   -6,   -8,   -5,   -9,   -5,   -8,   -5,   -9,   -5,   -9,   -3,  -10,   -4,   -9,   -4,
+      -9,   -3,   -9,   -3,   -9,   -2,   -8,   -4,  -10,    0,   -8,   -5,  -10,    0,   -8,   -5,
+     -10,    0,   -8,   -5,  -10,    0,  -10,   -1,   -9,   -4,  -10,    0,   -9,    2,   -9,    5,
+      -9,    5,   -8,    5,   -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -9,    5,
+      -8,    4,  -10,   -2,  -10,   -2,  -10,   -2,  -10,   -2,   -9,   -2,  -10,   -2,  -10,    0,
+     -10,    0,   -9,   -3,  -10,   -2,  -10,    0,  -10,   -1,   -9,   -4,  -10,    0,  -10,    0,
+      -8,    0,   -5,    4,   -2,    9,   -3,   10,   -3,   10,   -2,    9,   -3,   10,   -3,    9,
+      -5,    9,   -5,    9,   -4,    9,   -5,    9,   -5,    8,   -6,    8,   -7,    8,   -6,    7,
+      -6,    8,   -1,    8,    6,    8,    6,    8,    6,    8,    6,    8,    5,    8,    6,    9,
+       6,    8,    6,    8,    7,    7,    6,    8,    7,    7,    6,    8,    7,    7,    6,    8,
+       7,    7,    7,    8,    6,    8,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    8,    7,    7,    7,    8,    6,    8,    7,    7,    6,
+       8,    7,    7,    6,    8,    7,    8,    6,    8,    6,    8,    5,    9,    6,    8,    5,
+       8,    6,    9,    5,    8,    6,    9,    4,    9,    4,    9,    4,    9,    4,   10,    2,
+       8,    4,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,    8,   -4,    9,   -4,
+       9,   -5,    8,   -5,    7,   -7,    8,   -7,    7,   -7,    6,   -8,    6,   -8,    6,   -8,
+       5,   -8,    6,   -8,    6,   -9,    5,   -8,    4,   -9,    5,   -9,    5,   -9,    5,   -8,
+       1,  -10,    6,   -8,    4,   -9,    3,  -10,    4,   -9,    3,   -9,    2,  -10,    3,  -10,
+       3,   -9,    2,  -10,    2,  -10,    0,  -10,    1,  -10,    1,  -10,   -2,   -9,    0,  -10,
+      -1,  -10,   -4,   -9,   -3,   -9,   -6,   -9,   -6,   -7,   -7,   -8,   -7,   -7,   -7,   -7,
+      -8,   -5,   -9,   -6,   -8,   -5,   -9,   -4,   -9,   -5,   -9,   -4,   -9,   -4,  -10,   -3,
+      -9,   -2,   -9,   -4,   -8,   -4,  -10,   -1,   -8,   -4,  -10,    0,   -8,   -5,  -10,    0,
+      -9,   -3,   -9,   -2,  -10,    0,   -8,   -5,  -10,    0,   -9,   -2,   -9,   -3,  -10,    0,
+      -9,   -4,   -9,   -1,  -10,    0,   -9,   -4,  -10,   -1,  -10,    0,   -9,    5,   -8,    5,
+      -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -9,    5,   -8,    5,   -9,    5,
+      -9,    5,   -8,    5,   -9,    4,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -9,    5,
+      -8,    5,   -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -9,    5,   -8,    4,
+      -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,
+      -9,    5,   -8,    4,   -9,    5,  -10,    3,  -10,    2,   -9,    3,   -9,    3,  -10,    0,
+      -8,    5,  -10,    0,  -10,    0,  -10,    0,   -7,    4,   -4,    9,   -1,    9,   -3,    9,
+       0,   10,   -5,    8,    0,   10,   -4,    8,   -1,   10,    0,   10,    0,   -4,    0,  -10,
+       3,   -9,    2,   -9,    1,  -10,    4,   -8,    0,  -10,    4,   -8,    2,  -10,    5,   -8,
+      10,   -1,   10,    0,   10,    0,    8,   -4,   10,   -1,    9,   -1,    9,   -5,   10,   -2,
+      10,   -1,    9,   -4,    9,   -4,    9,   -4,    8,   -2,    6,    8,    6,    8,    6,    8,
+       6,    8,    6,    8,    6,    8,    6,    8,    6,    9,    5,    8,    6,    8,    5,    9,
+       6,    8,    6,    8,    5,    9,    6,    8,    5,    8,    6,    8,    5,    9,    6,    8,
+       5,    9,    5,    8,    5,    9,    5,    8,    6,    9,    5,    9,    5,    8,    5,    9,
+       5,    8,    3,    9,    6,    8,    5,    9,    4,    9,    4,    9,    5,    9,    4,    9,
+       4,    9,    4,    9,    4,   10,    1,    9,    5,    8,    0,   10,    0,   10,    5,    8,
+       0,   10,   -5,    8,    0,   10,   -3,    9,   -5,    9,   -5,    9,   -6,    8,   -7,    7,
+      -7,    7,   -7,    7,   -7,    7,   -9,    6,   -8,    5,   -8,    6,   -9,    5,   -9,    4,
+      -9,    5,   -9,    4,   -9,    3,  -10,    3,   -8,    5,  -10,    1,   -8,    4,  -10,    0,
+      -8,    5,  -10,    0,  -10,    0,   -8,    4,  -10,    1,  -10,    0,  -10,    0,   -9,   -2,
+      -9,   -3,  -10,    0,   -8,   -4,   -9,   -2,   -9,   -5,   -9,   -5,   -8,   -6,   -6,   -8,
+      -7,   -7,   -7,   -7,   -5,   -9,   -6,   -8,   -5,   -9,   -3,   -9,   -3,  -10,   -4,   -8,
+      -1,   -9,   -4,   -9,    0,  -10,   -5,   -8,    0,  -10,    0,  -10,   -5,   -8,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    2,  -10,    3,   -8,
+       0,  -10,    0,  -10,    0,  -10,    5,   -8,    0,  -10,    0,  -10,    0,   -6,    0,   10,
+       0,   10,   -2,    9,   -3,    9,    0,   10,    0,   10,    0,   10,   -5,    8,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    3,   10,    2,    9,
+       0,   10,    1,    9,    4,    9,    0,   10,    5,    8,    0,   10,    5,    8,    3,    9,
+       4,    9,    5,    9,    5,    8,    5,    9,    7,    7,    7,    7,    7,    7,    8,    6,
+       9,    4,   10,    3,    8,    4,   10,    2,   10,    0,    8,    5,   10,    0,   10,    0,
+      10,    0,    8,   -4,   10,   -1,   10,    0,    9,   -1,    9,   -4,   10,    0,    8,   -5,
+       9,   -2,    9,   -3,    8,   -4,    9,   -2,    9,   -4,    9,   -5,    9,   -4,    9,   -5,
+       8,   -5,    8,   -6,    9,   -6,    7,   -7,    7,   -7,    6,   -7,    7,   -8,    7,   -7,
+       5,   -9,    4,   -9,    2,   -9,    0,  -10,    5,   -8,    0,  -10,   -5,   -8,    0,  -10,
+       0,  -10,   -5,   -8,   -1,  -10,   -4,  -10,   -3,   -9,   -4,   -9,   -4,   -9,   -4,   -9,
+      -5,   -9,   -6,   -8,   -3,   -9,   -6,   -8,   -3,   -9,   -5,   -9,   -5,   -8,   -5,   -9,
+      -5,   -9,   -5,   -8,   -6,   -9,   -5,   -8,   -5,   -9,   -5,   -8,   -5,   -9,   -6,   -8,
+      -5,   -9,   -6,   -8,   -5,   -8,   -6,   -9,   -6,   -8,   -5,   -8,   -6,   -8,   -6,   -9,
+      -5,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -5,   -8,   -6,   -9,   -6,   -8,   -6,   -8,
+      -6,   -7,  -10,   -2,  -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,   -2,
+     -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,   -2,  -10,   -3,   -9,   -2,
+     -10,   -3,  -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,   -2,  -10,   -3,
+     -10,   -2,   -9,   -3,  -10,   -2,  -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,
+     -10,   -2,  -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,   -2,  -10,   -3,
+      -9,   -2,  -10,   -3,  -10,   -3,   -9,   -2,   -9,    3,  -10,    1,   -8,    5,   -9,    1,
+      -9,    4,   -8,    3,  -10,    2,   -8,    5,   -8,    2,   -9,    4,  -10,    2,   -9,    4,
+      -9,    5,  -10,    2,   -9,    4,   -8,    4,  -10,    3,   -9,    5,   -9,    4,   -9,    4,
+      -9,    5,   -9,    4,   -9,    5,   -8,    3,   -8,    5,   -9,    4,   -8,    6,   -9,    5,
+      -9,    5,   -8,    5,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -7,    7,
+      -7,    7,   -8,    7,   -7,    7,   -5,    8,   -5,    9,   -5,    8,   -5,    9,   -3,   10,
+      -3,    9,    0,   10,    0,   10,    0,   10,    2,   10,    3,   10,    2,    9,    4,   10,
+       4,    8,    5,    9,    5,    9,    5,    8,    5,    9,    6,    8,    6,    8,    7,    8,
+       6,    7,    6,    8,    7,    8,    7,    7,    7,    7,    7,    7,    7,    7,    8,    7,
+       7,    6,    7,    7,    8,    7,    8,    6,    8,    6,    8,    6,    8,    6,    8,    6,
+       8,    5,    8,    6,    9,    3,    9,    5,    9,    5,    9,    4,    9,    2,    9,    5,
+       9,    2,   10,    0,    9,    2,    9,   -2,   10,    0,   10,    0,    9,   -4,    9,   -4,
+       8,   -6,    9,   -6,    8,   -5,    7,   -7,    7,   -7,    7,   -7,    7,   -8,    6,   -8,
+       6,   -8,    6,   -8,    6,   -7,    6,   -8,    6,   -8,    6,   -8,    6,   -9,    5,   -8,
+       6,   -9,    5,   -8,    5,   -8,    6,   -9,    5,   -8,    5,   -9,    3,   -9,    7,   -8,
+       2,   -9,    6,   -8,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -8,    4,   -9,
+       4,   -9,    5,   -9,    5,   -9,    4,   -8,    5,   -9,    5,   -9,    5,   -9,    5,   -8,
+       5,   -9,    5,   -9,    4,   -9,    5,   -8,    4,   -9,   -1,  -10,   -9,   -3,   -9,   -4,
+      -9,   -4,   -9,   -5,   -8,   -5,   -8,   -7,   -8,   -6,   -8,   -6,   -7,   -6,   -8,   -7,
+      -8,   -6,   -7,   -7,   -6,   -8,   -7,   -7,   -6,   -8,   -6,   -8,   -5,   -9,   -5,   -9,
+      -5,   -8,   -4,   -9,  -10,   -2,  -10,    3,   -9,    2,  -10,    3,  -10,    3,   -9,    2,
+     -10,    0,  -10,   -3,   -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,   -2,  -10,   -3,
+      -9,   -2,  -10,   -3,  -10,   -2,   -9,   -3,  -10,    2,  -10,    3,   -9,    4,   -9,    4,
+      -9,    4,   -9,    4,  -10,    3,   -9,    4,   -9,    4,   -9,    4,   -9,    5,   -9,    4,
+      -9,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    4,   -9,    5,   -8,    5,   -9,    6,
+      -8,    5,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -7,    7,
+      -7,    7,   -7,    7,   -7,    7,   -7,    8,   -5,    8,   -6,    8,   -6,    8,   -5,    9,
+      -4,    9,   -4,    9,   -3,   10,   -3,    9,   -1,   10,   -3,    9,   -2,   10,    0,   10,
+       0,   10,    3,    9,    2,   10,    0,   10,    3,    9,    4,   10,    3,    9,    4,   10,
+       3,    9,    4,    9,    4,    9,    5,    9,    6,    8,    5,    9,    5,    8,    7,    8,
+       6,    8,    6,    8,    6,    7,    7,    8,    7,    7,    6,    7,    7,    8,    7,    7,
+       7,    7,    7,    7,    8,    7,    7,    7,    8,    6,    7,    7,    8,    6,    8,    6,
+       8,    6,    8,    5,    8,    6,    9,    6,    8,    5,    8,    6,    9,    5,    8,    6,
+       9,    3,    9,    5,    9,    4,    8,    5,    9,    2,    9,    3,    9,    3,    9,    2,
+      10,    0,    9,    4,   10,    0,   10,    0,   10,    0,    9,   -4,   10,    0,    8,   -4,
+      10,   -1,    8,   -4,    9,   -3,    9,   -5,    8,   -5,    9,   -5,    8,   -6,    7,   -7,
+       7,   -7,    8,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -8,    5,   -8,
+       6,   -8,    6,   -8,    5,   -8,    6,   -9,    6,   -8,    5,   -8,    6,   -8,    6,   -9,
+       6,   -8,    5,   -8,    5,   -9,    5,   -8,    5,   -9,    5,   -9,    5,   -9,    4,   -8,
+       5,   -9,    5,   -9,    5,   -9,    5,   -8,    5,   -9,    4,   -1,    0,   10,    0,   10,
+       0,   10,    0,   10,   -1,   10,   -2,   10,   -1,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    1,   10,    2,    9,    1,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       5,    9,    0,   10,    0,   10,    5,    8,    0,   10,    3,    9,    2,    9,    3,    9,
+       2,    9,    5,    8,    2,    9,    5,    9,    4,    9,    4,    9,    5,    9,    6,    8,
+       6,    8,    7,    7,    7,    7,    7,    7,    7,    7,    8,    6,    8,    5,    9,    5,
+       9,    5,    9,    5,    9,    4,   10,    0,    8,    4,   10,    0,    9,    3,    9,    2,
+      10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,   -1,    9,   -4,   10,    0,
+      10,    0,    8,   -4,   10,    0,   -4,    0,  -10,    0,   -8,    4,  -10,    0,  -10,    1,
+      -9,    4,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,   -8,   -5,
+     -10,    0,  -10,    0,   -8,   -5,  -10,   -3,   -9,   -3,   -9,   -5,   -9,   -5,   -8,   -5,
+      -8,   -6,   -8,   -7,   -7,   -6,   -8,   -7,   -6,   -8,   -6,   -7,   -6,   -8,   -6,   -9,
+      -4,   -9,   -5,   -8,   -5,   -9,   -4,   -9,   -4,   -9,   -1,   -9,   -5,   -8,    0,  -10,
+      -5,   -8,    0,  -10,   -3,   -9,   -2,  -10,    0,  -10,   -4,   -8,   -1,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,   -2,  -10,   -2,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,   -9,    3,  -10,    1,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,
+      -2,   -9,    7,    1,    0,    1,   -6,   -5,   -4,    8,   -4,    9,   -5,    9,   -5,    9,
+      -5,    9,   -5,    8,   -5,    9,   -4,    9,   -5,    8,   -5,    9,   -5,    9,   -6,    8,
+      -5,    8,   -6,    8,   -6,    9,   -5,    8,   -6,    8,   -6,    8,   -6,    9,   -5,    8,
+      -6,    8,   -6,    8,   -5,    8,   -7,    8,   -7,    7,   -8,    7,   -7,    7,   -7,    7,
+      -7,    7,   -7,    7,   -7,    7,   -8,    6,   -8,    6,   -9,    4,   -9,    4,   -9,    4,
+      -8,    5,   -9,    2,   -9,    3,  -10,    0,   -9,    4,  -10,    0,  -10,    0,  -10,   -1,
+      -9,   -3,  -10,    0,   -9,   -3,   -9,   -2,   -8,   -3,   -9,   -5,   -9,   -4,  -10,   -3,
+      -9,   -4,   -8,   -5,   -9,   -6,   -8,   -6,   -8,   -5,   -8,   -6,   -9,   -5,   -8,   -6,
+      -8,   -6,   -9,   -5,   -7,   -7,   -8,   -6,   -7,   -7,   -8,   -6,   -7,   -7,   -8,   -7,
+      -7,   -7,   -6,   -7,   -7,   -7,   -7,   -8,   -7,   -7,   -7,   -7,   -7,   -8,   -6,   -8,
+      -6,   -7,   -6,   -8,   -6,   -8,   -5,   -9,   -6,   -8,   -5,   -9,   -5,   -8,   -5,   -9,
+      -3,   -9,   -4,  -10,   -4,   -9,   -3,   -9,   -4,  -10,   -2,   -9,    0,  -10,   -4,   -9,
+      -1,  -10,    0,  -10,    0,  -10,    4,   -9,    1,  -10,    2,  -10,    3,   -9,    4,   -9,
+       4,  -10,    4,   -9,    6,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -7,    7,   -8,
+       8,   -7,    7,   -7,    7,   -7,    8,   -6,    8,   -5,    8,   -6,    8,   -6,    8,   -6,
+       8,   -6,    8,   -6,    9,   -5,    9,   -5,    8,   -5,    9,   -4,    9,   -5,    9,   -5,
+       8,   -5,    9,   -5,    9,   -4,    9,   -4,    9,   -4,   10,   -4,    9,   -4,    9,   -4,
+       9,   -4,    8,   -4,    9,   -5,    9,   -1,    9,   -4,    6,   -3,   -6,   -6,    5,    0,
+      -7,    5,   -9,   -3,   -9,   -2,  -10,    0,  -10,    0,  -10,    0,   -9,   -3,   -9,   -2,
+     -10,    0,  -10,    0,  -10,   -2,   -8,   -3,  -10,    0,  -10,    0,   -8,   -5,  -10,    0,
+     -10,   -1,   -9,   -4,  -10,    0,   -8,   -5,  -10,    0,  -10,   -2,   -9,   -3,  -10,   -4,
+      -9,   -3,  -10,   -3,   -9,   -3,  -10,   -4,   -9,   -3,   -8,   -5,   -9,   -5,   -9,   -4,
+      -9,   -4,  -10,   -4,   -8,   -5,   -8,   -6,   -8,   -6,   -8,   -6,   -7,   -7,   -7,   -7,
+      -7,   -7,   -7,   -7,   -7,   -8,   -5,   -8,   -6,   -8,   -4,   -9,   -5,   -9,   -4,   -9,
+      -3,  -10,   -2,  -10,   -2,   -9,   -2,  -10,   -1,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    1,  -10,    2,  -10,    2,  -10,    2,   -9,    3,  -10,    2,   -9,    5,   -8,
+       0,  -10,    6,   -8,    3,   -9,    3,  -10,    4,   -9,    6,   -8,    3,   -9,    4,   -9,
+       5,   -9,    6,   -8,    5,   -9,    5,   -8,    6,   -9,    5,   -8,    5,   -9,    6,   -8,
+       5,   -8,    7,   -8,    6,   -8,    6,   -8,    7,   -7,    7,   -7,    7,   -7,    7,   -7,
+       8,   -7,    7,   -7,    8,   -6,    8,   -6,    8,   -6,    8,   -5,    9,   -3,    9,   -5,
+       9,   -5,    8,   -5,   10,   -1,    8,   -5,   10,    0,    8,   -5,   10,    0,   10,    0,
+      10,    0,   10,    0,   10,    0,    9,    2,    9,    3,   10,    0,    9,    5,    9,    2,
+      10,    2,    9,    4,    8,    5,    9,    4,    9,    4,   10,    4,    9,    4,    9,    5,
+       8,    5,    8,    6,    9,    5,    8,    5,    9,    6,    8,    5,    8,    6,    8,    6,
+       8,    7,    8,    6,    8,    6,    7,    7,    6,    7,    7,    8,    5,   -2,    1,   -9,
+      -7,   -7,   -5,   -9,   -5,   -9,   -5,   -8,   -3,  -10,   -5,   -8,   -4,   -8,   -4,   -8,
+      -4,   -9,   -4,   -9,   -4,  -10,   -3,   -9,   -4,   -9,   -4,  -10,   -3,   -9,   -4,   -9,
+      -3,   -9,   -2,  -10,   -2,  -10,   -1,  -10,   -4,   -9,   -1,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    3,   -9,    2,   -9,    2,  -10,    4,   -9,
+       3,  -10,    4,   -9,    6,   -8,    5,   -9,    5,   -8,    7,   -8,    6,   -7,    7,   -8,
+       6,   -7,    8,   -7,    8,   -5,    8,   -6,    8,   -6,    8,   -6,    9,   -6,    8,   -6,
+       9,   -3,    9,   -5,    8,   -5,    9,   -5,    9,   -2,   10,   -3,    9,   -5,    9,   -4,
+       9,   -3,   10,   -3,    9,   -2,   10,   -2,   10,   -2,   10,   -3,    9,   -2,   10,   -2,
+      10,   -1,   10,    0,   10,    0,    9,   -4,   10,    0,   10,    0,   10,    0,   10,    0,
+      10,    0,   10,    0,    9,    2,   10,    2,   10,    0,   10,    0,    9,    3,   10,    2,
+      10,    0,    9,    4,   10,    1,    9,    3,   10,    3,    9,    3,   10,    3,    9,    4,
+       9,    5,    9,    4,    9,    4,    9,    4,    9,    5,    8,    6,    8,    5,    9,    6,
+       7,    6,    8,    7,    7,    7,    8,    6,    7,    7,    7,    7,    6,    8,    6,    8,
+       6,    8,    5,    8,    5,    9,    4,    8,    4,    9,    5,    9,    5,    9,    1,    9,
+       5,    9,    0,   10,    5,    9,    1,    9,    0,   10,    1,   10,    3,    9,    0,   10,
+       0,   10,    0,   10,    0,   10,   -3,    9,    0,   10,   -1,   10,   -1,   10,   -1,   10,
+      -3,   10,   -3,    9,   -1,    9,    8,    0,    7,   -8,    6,   -7,    7,   -8,    8,   -6,
+       8,   -6,    8,   -6,    8,   -6,    8,   -6,    8,   -6,    9,   -5,    9,   -4,    8,   -5,
+       9,   -5,    9,   -5,    9,   -2,    9,   -3,    8,   -4,   10,    0,   10,    0,    8,   -5,
+      10,    0,   10,    0,   10,    0,    9,    1,    9,    4,   10,    0,    8,    3,   10,    1,
+       8,    6,    9,    2,   10,    4,    8,    5,    9,    6,    8,    5,    9,    5,    8,    6,
+       8,    6,    7,    7,    8,    6,    7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    8,    7,    7,    6,    8,    5,    8,    6,    8,    6,    8,    6,    8,    6,    8,
+       6,    8,    5,    9,    6,    8,    5,    9,    3,    9,    6,    8,    4,    9,    4,    9,
+       5,    9,    4,    9,    4,    9,    4,    9,    3,   10,    4,    9,    3,    9,    1,   10,
+       4,    9,    0,   10,    2,    9,    3,    9,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,   -5,    9,    0,   10,   -3,   10,   -4,    9,   -4,    9,   -5,    9,   -5,    8,
+      -6,    8,   -6,    8,   -7,    7,   -7,    7,   -8,    7,   -7,    6,   -8,    7,   -8,    6,
+      -8,    5,   -9,    4,   -9,    5,   -9,    5,   -8,    5,   -9,    4,   -9,    3,   -9,    3,
+     -10,    3,   -8,    4,  -10,    1,   -8,    5,  -10,    0,   -9,    5,  -10,    2,   -9,    2,
+     -10,    2,  -10,    1,   -9,    5,  -10,    0,  -10,    1,  -10,    2,   -8,    2,   10,   -2,
+      10,   -3,   10,    0,    9,   -1,   10,   -4,    9,   -2,   10,   -1,   10,   -2,   10,   -2,
+       9,   -5,    9,   -1,    9,   -4,    9,   -2,    9,   -2,    9,   -4,    9,   -4,   10,   -2,
+       8,   -5,    9,   -4,    9,   -4,    9,   -4,    8,   -6,    9,   -5,    8,   -6,    8,   -6,
+       8,   -6,    7,   -7,    7,   -7,    7,   -8,    5,   -8,    6,   -8,    6,   -8,    4,   -9,
+       4,   -9,    3,  -10,    3,  -10,    2,   -9,    3,  -10,    0,  -10,    0,  -10,    0,  -10,
+       0,  -10,    0,  -10,   -3,   -9,   -2,   -9,    0,  -10,   -4,   -9,   -1,  -10,   -4,   -9,
+      -3,   -9,   -4,  -10,   -3,   -9,   -4,   -9,   -3,  -10,   -5,   -8,   -5,   -9,   -5,   -9,
+      -5,   -9,   -3,   -9,   -5,   -8,   -5,   -9,   -5,   -8,   -6,   -8,   -6,   -8,   -6,   -9,
+      -6,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -7,   -7,   -6,   -7,   -7,   -8,   -7,   -7,
+      -7,   -7,   -7,   -7,   -8,   -6,   -8,   -6,   -8,   -7,   -8,   -6,   -7,   -6,   -8,   -6,
+      -9,   -5,   -9,   -5,   -8,   -5,  -10,   -3,  -10,   -2,   -7,   -6,  -10,   -1,   -8,   -3,
+     -10,    0,   -9,   -4,   -9,   -1,  -10,    0,  -10,    0,  -10,    0,   -8,    5,  -10,    0,
+     -10,    0,   -8,    4,  -10,    2,   -9,    4,  -10,    3,   -8,    5,   -9,    5,   -9,    5,
+      -9,    5,   -8,    5,   -8,    6,   -8,    6,   -8,    7,   -8,    6,   -7,    6,   -8,    7,
+      -7,    7,   -6,    2,   -3,    7,   -3,   -7,    4,   -9,    2,  -10,    2,  -10,    1,  -10,
+       0,  -10,    1,  -10,    3,   -9,    0,  -10,    0,  -10,    0,  -10,    0,  -10,   -1,  -10,
+      -2,   -9,   -2,  -10,   -1,  -10,   -2,  -10,   -2,  -10,   -3,   -9,   -4,  -10,   -3,   -9,
+      -4,   -9,   -4,   -9,   -6,   -8,   -5,   -9,   -4,   -8,   -6,   -8,   -6,   -8,   -6,   -8,
+      -7,   -8,   -7,   -6,   -8,   -7,   -7,   -6,   -8,   -7,   -7,   -6,   -9,   -6,   -8,   -5,
+      -9,   -6,   -8,   -5,   -9,   -3,   -9,   -4,   -9,   -5,   -9,   -3,   -8,   -5,  -10,   -1,
+     -10,   -3,   -9,   -3,  -10,   -3,   -9,   -3,  -10,   -3,  -10,   -1,   -9,   -2,   -9,   -3,
+     -10,    0,  -10,    0,  -10,   -1,   -9,   -3,  -10,    0,  -10,    0,  -10,    0,  -10,    0,
+     -10,    0,  -10,    0,   -9,    4,  -10,    0,  -10,    0,  -10,    0,   -9,    4,  -10,    1,
+     -10,    1,   -9,    4,  -10,    2,  -10,    2,   -9,    2,  -10,    4,   -9,    4,   -9,    2,
+      -9,    5,   -9,    3,  -10,    3,   -8,    4,   -9,    5,   -9,    6,   -9,    3,   -8,    6,
+      -8,    5,   -8,    6,   -8,    6,   -8,    6,   -8,    6,   -7,    7,   -7,    8,   -6,    7,
+      -6,    8,   -6,    8,   -6,    9,   -5,    8,   -4,    9,   -3,   10,   -4,    9,   -3,    9,
+       0,   10,   -5,    9,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,
+       0,   10,    3,    9,    3,   10,    1,    9,    2,   10,    2,   10,    4,    9,    4,   10,
+       3,    9,    4,    9,    3,   10,    4,    9,    3,    9,    4,   10,    6,    8,    3,    8,
+       4,    9,    3,    8,    5,    9,    5,    9,    5,    9,    6,    6,   -4,    8,   -8,   -7,
+      -7,   -7,   -8,   -6,   -7,   -7,   -8,   -5,   -9,   -6,   -8,   -6,   -8,   -6,   -8,   -5,
+      -8,   -6,   -8,   -6,   -9,   -5,   -9,   -5,   -9,   -5,   -8,   -4,   -9,   -5,   -9,   -4,
+      -9,   -5,  -10,   -2,   -8,   -5,  -10,   -2,   -9,   -2,   -9,   -5,  -10,   -1,  -10,    0,
+      -8,   -5,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,   -8,    4,  -10,    1,
+      -9,    3,   -9,    2,   -8,    5,   -9,    1,   -9,    5,   -9,    5,   -9,    5,   -8,    5,
+      -8,    6,   -8,    6,   -8,    6,   -7,    7,   -7,    7,   -7,    7,   -7,    7,   -7,    8,
+      -7,    7,   -6,    8,   -7,    8,   -5,    8,   -6,    8,   -5,    9,   -5,    8,   -6,    8,
+      -5,    9,   -6,    8,   -5,    9,   -5,    8,   -3,    9,   -6,    8,   -4,    9,   -4,   10,
+      -4,    9,   -4,    9,   -4,    9,   -2,   10,   -3,    8,   -2,   10,   -4,    8,   -2,   10,
+      -2,   10,   -2,   10,   -1,   10,   -1,   10,    1,   10,    0,   10,    0,   10,    1,    9,
+       0,   10,    1,   10,    3,   10,    4,    9,    2,   10,    3,    9,    4,    9,    5,    9,
+       6,    8,    5,    8,    7,    8,    7,    7,    7,    7,    7,    7,    8,    7,    8,    5,
+       8,    6,    8,    6,    9,    3,    9,    5,    8,    5,    9,    5,    9,    3,   10,    4,
+       9,    3,   10,    3,    9,    3,   10,    4,    9,    3,    9,    3,   10,    4,   10,    1,
+       9,    2,    9,    3,   10,    0,    9,    5,   10,    0,    9,    1,    9,    4,   10,    0,
+      10,    0,    8,    5,   10,    0,   10,    0,   10,    0,    8,    5,   10,    0,   10,    0,
+      10,    0,   10,    0,    8,    4,   10,    1,    7,   -7,    6,   -8,    7,   -7,    7,   -7,
+       7,   -8,    7,   -7,    6,   -7,    7,   -8,    7,   -7,   10,    0,    9,    2,    9,    3,
+      10,    0,   10,    0,   10,    0,   10,    0,   10,    0,   10,    0,    7,   -3,    0,  -10,
+       0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    0,  -10,    2,   -9,    3,   -9,
+       0,  -10,    5,   -8,    2,  -10,    4,   -9,    4,   -9,    4,   -9,    5,   -9,    4,   -9,
+       6,   -8,    5,   -8,    6,   -8,    7,   -8,    7,   -7,    6,   -8,    0,   -9,   -6,   -8,
+      -7,   -7,   -7,   -8,   -6,   -7,   -7,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,
+      -7,   -7,   -8,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -7,   -8,   -7,
+      -7,   -7,   -7,   -7,   -7,   -7,   -8,   -6,   -8,   -6,   -8,   -6,   -8,   -6,   -7,   -7,
+      -8,   -6,   -8,   -6,   -8,   -5,   -9,   -6,   -8,   -5,   -9,   -6,   -8,   -5,   -9,   -5,
+      -8,   -5,   -9,   -4,   -9,   -4,  -10,   -4,   -9,   -5,   -9,   -3,  -10,   -1,   -8,   -4,
+     -10,    0,   -9,   -4,   -9,   -1,  -10,    0,  -10,    0,   -9,    5,  -10,    0,   -9,    3,
+      -9,    5,   -9,    4,   -9,    5,   -8,    5,   -8,    6,   -8,    6,   -7,    7,   -7,    7,
+      -7,    7,   -7,    8,   -7,    7,   -6,    8,   -7,    8,   -5,    8,   -6,    8,   -5,    8,
+      -6,    9,   -5,    8,   -6,    9,   -4,    8,   -4,   10,   -4,    9,   -5,    9,   -4,    9,
+      -5,    8,   -3,    9,   -2,    9,   -5,    8,    0,   10,   -5,    8,    0,   10,   -5,    8,
+       0,   10,    0,   10,   -2,    9,    2,   10,    0,   10,    0,   10,    3,    9,    4,    9,
+       2,   10,    5,    8,    6,    8,    6,    8,    8,    6,    8,    7,    7,    7,    8,    6,
+       8,    6,    8,    5,    9,    5,    9,    4,   10,    3,    9,    4,    9,    3,   10,    3,
+       9,    3,    9,    3,   10,    2,   10,    3,    9,    2,    9,    4,   10,    0,   10,    4,
+       9,    1,   10,    0,    9,    5,   10,    0,   10,    0,    9,    4,    9,    1,   10,    0,
+      10,    0,    8,    4,   10,    1,   10,    0,   10,    0,   10,    0,    9,    2,    9,    3,
+      10,    0,   10,    0,   10,    0,   10,    0,   10,    0,
+};
+
+const halo_path_t flower_path = { flower_path_data, 2894, -737, 753 };
@@ -0,0 +1,9 @@
+#ifndef FLOWER_PATH_H
+#define FLOWER_PATH_H
+
+#include "halo_path.h"
+
+// Delta-encoded flower outline, 0.01 cm fixed point
+extern const halo_path_t flower_path;
+
+#endif // FLOWER_PATH_H
@@ -1,8 +1,8 @@
 """
-@file    generate_clover_coords.py
-@brief   Loads an image of a clover/flower, extracts its contour points,
-         normalizes, scales, and translates them to fit a robot workspace,
-         then saves as a C array for robotic arm use.
+@file    generate_flower_coords.py
+@brief   Loads an image of a flower/flower, extracts its contour points,
+         fits them into the robot workspace, then saves them as C tables
+         for robotic arm use.
 
 @author  Adithya
 @date    2025-08-28
@@ -10,22 +10,49 @@
 @details
 - Loads an image using OpenCV
 - Converts to grayscale and detects edges
-- Finds contours and subsamples points
 - Normalizes coordinates to center at origin
 - Flips Y axis to convert image coordinates to math coordinates
-- Scales to target radius and applies translation
-- Saves coordinates as a C array
+- Fits the outline into the workspace: the largest scale and the placement
+  that keep every point reachable with each joint at least fit_margin_deg
+  inside the 0-180 deg servo window (arm model in halo_pattern.py)
+- Finds contours and orders them for the shortest travel between them
+  (nearest neighbour + 2-opt, contours may be reversed or re-entered)
+- Simplifies each contour to a deviation tolerance
+  (Douglas-Peucker)
+- Resamples the outline by arc length to one point per servo period at
+  tool_speed_cm_s, so the player moves the tool at constant speed
+- Saves coordinates, already in arm cm, as a compact delta-encoded C table
+  (halo_path)
+- Fits the outline with cubic Bezier segments and saves them as a
+  halo_curve table, evaluated at any point spacing by the firmware, with
+  the elbow branch of each segment planned like the duty table's
+- Pre-solves the path into a const PWM duty table for the firmware player,
+  on the elbow branch per point that needs the least joint travel
+- Adds 1/2 and 1/4 density levels of the duty table (curvature-aware
+  decimation) so fast playback writes only the pairs the servos can follow
+- Fails if any point of the saved tables is outside the workspace
 - Plots the final transformed points for visualization
 """
 
+import os
+import sys
 import cv2
 import numpy as np
 import matplotlib.pyplot as plt
 
-# --- Parameters you can adjust ---
-target_radius = 8.0   # Final max radius in cm (scales image size)
-shift_x = -8.0         # Shift along X (cm)
-shift_y = -1.0         # Shift along Y (cm)
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(SCRIPT_DIR, "..", "..", "common"))
+import halo_pattern
+
+# --- Workspace fit ---
+fit_margin_deg = 5.0     # min distance of every joint from its servo limits
+
+# --- Simplification and speed, in arm cm ---
+simplify_tol_cm = 0.02   # max deviation from the traced outline
+tool_speed_cm_s = 5.0    # constant tool speed of the streaming player
+curve_tol_cm = 0.04      # max deviation of the cubic fit from the traced outline
+lod_factors = (2, 4)     # coarser levels of detail: keep ~1 in N points
+lod_tol_cm = 0.05        # max chord deviation from the full-density path
 
 # --- Load and process image ---
 img = cv2.imread("flower.png")
@@ -33,49 +60,97 @@ gray = cv2.cvtColor(img, cv2.COLOR_BGR2GRAY)
 edges = cv2.Canny(gray, 50, 150)
 contours, _ = cv2.findContours(edges, cv2.RETR_EXTERNAL, cv2.CHAIN_APPROX_NONE)
 
-coords = []
-for contour in contours:
-    for (x, y) in contour.reshape(-1, 2):
-        coords.append((x, y))
-coords = np.array(coords)
+runs = halo_pattern.contour_runs(contours)
+dense = np.concatenate(runs)
 
-# Subsample (reduce number of points)
-step = 5
-coords = coords[::step]
-
-# --- Normalize & scale to robot workspace ---
-# 1. Center at origin
-coords = coords - np.mean(coords, axis=0)
+# --- Normalize & fit to robot workspace ---
+# 1. Center at origin (over every contour pixel)
+center = np.mean(dense, axis=0)
 
 # 2. Flip Y (image coords -> math coords)
-coords[:,1] = -coords[:,1]
+flip = np.array([1.0, -1.0])
+
+runs = [(run - center) * flip for run in runs]
+
+# 3. Largest scale and placement that keep the whole outline reachable
+scale, offset = halo_pattern.fit_workspace(np.concatenate(runs), fit_margin_deg)
+runs = [run * scale + offset for run in runs]
+dense = np.concatenate(runs)
+extent = np.max(np.linalg.norm(dense - offset, axis=1))
+print(f"Fitted to the workspace: radius {extent:.2f} cm centred at "
+      f"({offset[0]:.2f}, {offset[1]:.2f}) cm, {fit_margin_deg:.0f} deg joint margin")
+
+# --- Order contours: shortest jumps between them (no pen lift, pattern loops) ---
+runs, travel_before, travel_after = halo_pattern.order_runs(runs, 2.0 * scale)
+print(f"Travel between {len(runs)} contours: {travel_before:.2f} cm -> {travel_after:.2f} cm")
+
+ordered = runs
 
-# 3. Scale to fit inside target radius
-max_extent = np.max(np.linalg.norm(coords, axis=1))
-scale = target_radius / max_extent
-coords = coords * scale
+# --- Simplify: drop points that lie within tolerance of the outline ---
+runs, _ = halo_pattern.simplify_runs(runs, simplify_tol_cm)
 
-# 4. Translate flower
-coords[:,0] += shift_x
-coords[:,1] += shift_y
+# --- Resample by arc length: equal steps = constant speed at one point per period ---
+spacing = tool_speed_cm_s * halo_pattern.SERVO_PERIOD_S
+coords = halo_pattern.resample_arc_length(np.concatenate(runs), spacing)
 
-# --- Save as C array ---
-with open("flower_coords.c", "w") as f:
-    f.write("float flowerer_coords[][2] = {\n")
-    for (x, y) in coords:
-        f.write(f"    {{ {x:.2f}, {y:.2f} }},\n")
-    f.write("};\n")
+max_dev = halo_pattern.polyline_deviation(dense, coords)
+print(f"Resampled {len(dense)} contour points to {len(coords)} at {spacing:.3f} cm "
+      f"(max deviation {max_dev:.4f} cm, "
+      f"{len(coords) * halo_pattern.SERVO_PERIOD_S:.1f} s per cycle)")
 
-print(f"Saved {len(coords)} coordinates scaled & transformed for robot in flower_coords.c")
+# --- Save as compact path table ---
+coords_dir = os.path.join(SCRIPT_DIR, "..", "coords")
+margin = halo_pattern.validate_workspace(coords, "flower_path")
+path_bytes = halo_pattern.write_path_table(coords_dir, "flower", coords)
+
+print(f"Saved {len(coords)} coordinates in arm cm in flower_path.c "
+      f"({path_bytes} bytes, {len(coords) * 8} as float, min joint margin {margin:.1f} deg)")
+
+# --- Fit cubic segments: the firmware picks the point spacing at run time ---
+chain = halo_pattern.curve_chain(ordered, curve_tol_cm)
+halo_pattern.validate_workspace(halo_pattern.sample_chain(chain), "flower_curve")
+curve_elbow_up, curve_travel = halo_pattern.plan_curve_branches(chain)
+curve_bytes = halo_pattern.write_curve_table(coords_dir, "flower", chain, curve_elbow_up)
+curve_dev = halo_pattern.polyline_deviation(np.concatenate(ordered),
+                                            halo_pattern.sample_chain(chain))
+print(f"Saved {len(chain)} cubic segments in flower_curve.c ({curve_bytes} bytes, "
+      f"max deviation {curve_dev:.4f} cm, "
+      f"{int(np.count_nonzero(np.diff(curve_elbow_up)))} branch flips)")
+
+# --- Pre-solve joint-space duty table ---
+duty, elbow_up, travel = halo_pattern.solve_duty_table(coords)
+halo_pattern.write_duty_table(coords_dir, "flower", duty, elbow_up)
+
+greedy_travel, greedy_flips = halo_pattern.greedy_branch_travel(coords)
+print(f"Saved {len(duty)} duty pairs in flower_duty.c: {int(np.sum(elbow_up))} elbow-up, "
+      f"{int(np.count_nonzero(np.diff(elbow_up)))} branch flips, {travel:.0f} deg joint travel per loop "
+      f"(per-point choice: {greedy_flips} flips, {greedy_travel:.0f} deg)")
+
+# --- Levels of detail: fewer pairs per cm for faster playback ---
+levels = []
+spacings = [halo_pattern.mean_spacing(coords)]
+for factor in lod_factors:
+    keep = halo_pattern.decimate_lod(coords, factor, lod_tol_cm)
+    levels.append(duty[keep])
+    spacings.append(halo_pattern.mean_spacing(coords[keep]))
+    lod_dev = halo_pattern.polyline_deviation(coords, coords[keep])
+    print(f"LOD 1/{factor}: {len(keep)} pairs, {spacings[-1]:.3f} cm mean spacing "
+          f"(max deviation {lod_dev:.4f} cm, full speed {spacings[-1] / halo_pattern.SERVO_PERIOD_S:.1f} cm/s)")
+lod_bytes = halo_pattern.write_lod_table(coords_dir, "flower", len(duty), levels, spacings)
+print(f"Saved {len(levels)} levels of detail in flower_lod.c ({lod_bytes} bytes)")
+
+joint_speed = halo_pattern.max_joint_speed(coords)
+print(f"Peak joint speed {joint_speed:.0f} deg/s of {halo_pattern.SERVO_MAX_SPEED_DEG_S:.0f}: "
+      f"tool_speed_cm_s can go up to "
+      f"{tool_speed_cm_s * halo_pattern.SERVO_MAX_SPEED_DEG_S / joint_speed:.1f}")
 
 # --- Plot final transformed flower ---
 plt.figure(figsize=(6,6))
 plt.plot(coords[:,0], coords[:,1], 'k.', markersize=2)
-circle = plt.Circle((0,0), 20, color='r', fill=False, linestyle="--")  # for reference
+circle = plt.Circle((0,0), halo_pattern.L1 + halo_pattern.L2, color='r', fill=False, linestyle="--")  # reach
 plt.gca().add_patch(circle)
 plt.axis("equal")
 plt.xlabel("X (cm)")
 plt.ylabel("Y (cm)")
 plt.title("Plot from coords")
 plt.show()
-
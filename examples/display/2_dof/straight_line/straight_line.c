@@ -8,7 +8,11 @@
  * 
  * @details
  * - Uses 2-link planar arm with lengths L1 and L2
- * - Performs inverse kinematics to compute joint angles
+ * - Solves the IK only at adaptive knots that keep the joint-space chord
+ *   within 0.2 mm of the line (halo_subdiv); setpoints in between
+ *   interpolate the joints
+ * - Paces the line with a jerk-limited profile within the servo limits,
+ *   one setpoint per PWM period (halo_profile)
  * - Generates PWM duty cycles to move servos along a straight path
  * 
  * @note
@@ -19,18 +23,24 @@
 
 #include "straight_line.h"
 #include "halo.h"
-#include <math.h>
+#include "halo_kinematics.h"
+#include "halo_pwm.h"
+#include "halo_profile.h"
+#include "halo_subdiv.h"
+#include "halo_loop.h"
 
 #define L1 10.0f
 #define L2 10.0f
 
-// ---------- helpers ----------
-static inline float clampf(float v, float min, float max) {
-    if (v < min) return min;
-    if (v > max) return max;
-    return v;
-}
+static const halo_arm_t arm = { L1, L2 };
+
+// move_line() knots: 0.2 mm chord error, 10° per piece
+static const halo_subdiv_cfg_t subdiv_cfg = HALO_SUBDIV_CFG_DEFAULT;
 
+// Velocity / acceleration / jerk limits of { shoulder, elbow }
+static const halo_joint_limits_t servo_limits[2] = { HALO_PROFILE_SERVO_LIMITS, HALO_PROFILE_SERVO_LIMITS };
+
+// ---------- helpers ----------
 // Convert angle to pulse width (us)
 static unsigned int angle_to_duty_us(float angle)
 {
@@ -39,64 +49,45 @@ static unsigned int angle_to_duty_us(float angle)
     return 1000 + (unsigned int)((angle * 1000) / 180.0f);
 }
 
-// Inverse Kinematics
-static int computeIK(float x, float y, float *theta1_deg, float *theta2_deg, int elbowUp)
+// ---------- move to solved joint pair ----------
+static void move_to_joints(float t1_deg, float t2_deg)
 {
-    float r2 = x*x + y*y;
-    float r  = sqrtf(r2);
-
-        // Check reachability
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0;
-    
-    // theta2
-    float c2 = (r2 - L1*L1 - L2*L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
-    float ang2 = acosf(c2);
-    if (elbowUp) ang2 = -ang2;
-
-    // theta1
-    float s2 = sinf(ang2);
-    float k1 = L1 + L2 * c2;
-    float k2 = L2 * s2;
-
-    float ang1 = atan2f(y, x) - atan2f(k2, k1);
-
-    // Convert to degrees
-    *theta1_deg = ang1 * 180.0f / M_PI;
-    *theta2_deg = ang2 * 180.0f / M_PI;
-
-    return 1;
-}
-
-// ---------- move to single point ----------
-static void move_to(float x, float y, int elbowUp)
-{
-    float t1_deg, t2_deg;
-    if (computeIK(x, y, &t1_deg, &t2_deg, elbowUp))
-    {
-        // Clamp to servo safe range (0–180°)
-        if (t1_deg < 0.0f)   t1_deg = 0.0f;
-        if (t1_deg > 180.0f) t1_deg = 180.0f;
-        if (t2_deg < 0.0f)   t2_deg = 0.0f;
-        if (t2_deg > 180.0f) t2_deg = 180.0f;
-
-        // Write PWM duties
-        WRITE_REGISTER(0x40004004, angle_to_duty_us(t1_deg)); // shoulder
-        WRITE_REGISTER(0x40004044, angle_to_duty_us(t2_deg)); // elbow
-    }
+    // Clamp to servo safe range (0–180°)
+    if (t1_deg < 0.0f)   t1_deg = 0.0f;
+    if (t1_deg > 180.0f) t1_deg = 180.0f;
+    if (t2_deg < 0.0f)   t2_deg = 0.0f;
+    if (t2_deg > 180.0f) t2_deg = 180.0f;
+
+    // Write PWM duties
+    unsigned int pwm_duty[2] = { angle_to_duty_us(t1_deg), angle_to_duty_us(t2_deg) }; // shoulder, elbow
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
 }
 
 
 // ---------- move along straight line ----------
-static void move_line(float x1, float y1, float x2, float y2, int steps, int elbowUp)
+static void move_line(float x1, float y1, float x2, float y2, int elbowUp)
 {
-    for (int i = 0; i <= steps; i++) {
-        float t = (float)i / (float)steps;
-        float x = x1 + t * (x2 - x1);
-        float y = y1 + t * (y2 - y1);
-        move_to(x, y, elbowUp);
-        delay_us(20); // ~20 ms between steps
+    // IK only at knots where the joint-space chord stays on the line;
+    // setpoints in between interpolate the joints
+    static halo_subdiv_knot_t knots[HALO_SUBDIV_MAX_KNOTS];
+    int nk = halo_subdiv_line(&arm, x1, y1, x2, y2, elbowUp, &subdiv_cfg, knots, HALO_SUBDIV_MAX_KNOTS);
+
+    // Minimum-time S-curve within the servo limits, one setpoint per PWM period
+    halo_profile_t prof;
+    halo_profile_plan_line(&prof, &arm, x1, y1, x2, y2, elbowUp, servo_limits, 1);
+    int n = halo_profile_steps(&prof, HALO_PROFILE_SERVO_PERIOD_S);
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    int cursor = 0;
+    for (int k = 0; k <= n; k++) {
+        if (k > 0)
+            halo_loop_wait(&loop);
+        float s = halo_profile_pos(&prof, (float)k * HALO_PROFILE_SERVO_PERIOD_S);
+        float t1_deg, t2_deg;
+        if (halo_subdiv_sample(knots, nk, &cursor, s, &t1_deg, &t2_deg))
+            move_to_joints(t1_deg, t2_deg);
     }
 }
 
@@ -110,7 +101,7 @@ void straight_line_pattern_gen(void)
     WRITE_REGISTER(0x40004048, 0x01);  
 
     // Example: Move in straight line from (-15,0) to (14,14)
-    move_line(-15.0f, 0.0f, 14.0f, 14.0f, 50, 0);
+    move_line(-15.0f, 0.0f, 14.0f, 14.0f, 0);
 
     while (1) {
         delay_us(20); // idle to keep PWM alive
@@ -13,10 +13,14 @@
  */
 
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 50   // refresh frames per blink phase (400 ms)
+
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF); 
-    WRITE_REGISTER(0x40000400, 0xFF); 
+    halo_matrix_init(ROW_US);
 
     
     unsigned char smiley_on[8] = {
@@ -39,16 +43,8 @@ void fw_main(void)
         {
             unsigned char* current_frame = (blink == 0) ? smiley_on : smiley_off;
 
-            for (int repeat = 0; repeat < 50; repeat++)  
-            {
-                for (int row = 0; row < 8; row++)
-                {
-                    WRITE_REGISTER(0x40000008, (1 << row));                
-                    WRITE_REGISTER(0x40000408, ~current_frame[row]);       
-                    delay_us(5);                                          
-                    WRITE_REGISTER(0x40000408, 0xFF);                    
-                }
-            }
+            halo_matrix_show(current_frame);
+            delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
         }
     }
 }
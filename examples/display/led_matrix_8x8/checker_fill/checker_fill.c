@@ -14,11 +14,15 @@
  */
 
  #include "checker_fill.h"
+ #include "halo.h"
+ #include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 60   // refresh frames per pattern (480 ms)
 
 void checker_fill_pattern_gen(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF);
-    WRITE_REGISTER(0x40000400, 0xFF);
+    halo_matrix_init(ROW_US);
 
     unsigned char pattern1[8];
     unsigned char pattern2[8];
@@ -41,16 +45,8 @@ void checker_fill_pattern_gen(void)
 
     while (1)
     {
-        for (int frame = 0; frame < 100; frame++)
-        {
-            for (int row = 0; row < 8; row++)
-            {
-                WRITE_REGISTER(0x40000008, (1 << row));
-                WRITE_REGISTER(0x40000408, ~(current[row]));
-                delay_us(10);
-                WRITE_REGISTER(0x40000408, 0xFF);
-            }
-        }
+        halo_matrix_show(current);
+        delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
 
         current = (current == pattern1) ? pattern2 : pattern1;
     }
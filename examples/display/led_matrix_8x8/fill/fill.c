@@ -13,51 +13,42 @@
  * - Controller: Halo Ver 1.0
  */
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 10   // refresh frames per fill step (80 ms)
+
+// Light every row whose bit is set in row_mask
+static void show_rows(int row_mask)
+{
+    unsigned char* frame = halo_matrix_back_buffer();
+
+    for (int row = 0; row < HALO_MATRIX_ROWS; row++)
+        frame[row] = (row_mask & (1 << row)) ? 0xFF : 0x00;
+
+    halo_matrix_flip();
+    delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
+}
 
 void fw_main(void)
 {
     //USER CODE BEGINS
-    WRITE_REGISTER(0x40000000, 0xFF);
-    WRITE_REGISTER(0x40000400, 0xFF); 
+    halo_matrix_init(ROW_US);
     int i=0;
-    int col;
-    int frame;
     while (1)
     {
         if(i < 0xff)
         {
             i = (i <<  1) + 1;
-            WRITE_REGISTER(0x40000008,i);
-            for (frame = 0; frame < 20; frame++) 
-            {
-                col = 1;
-                for (int j = 0;j < 8; j++)
-                {
-                    WRITE_REGISTER(0x40000408,col);
-                    delay_us(10);
-                    col = col << 1;
-                }
-                WRITE_REGISTER(0x40000408, 0xFF);
-            }
+            show_rows(i);
         }
         else if(i >=0)
         {
             while(i >=0)
             {
                 i = i >> 1;
-                WRITE_REGISTER(0x40000008,i);
-                for (frame = 0; frame < 20; frame++) 
-                {
-                    col = 1;
-                    for (int j = 0;j < 8; j++)
-                    {
-                        WRITE_REGISTER(0x40000408,col);
-                        delay_us(10);
-                        col = col << 1;
-                    }
-                    WRITE_REGISTER(0x40000408, 0xFF);
-                }
+                show_rows(i);
             }
         }
     }
-}
\ No newline at end of file
+}
@@ -14,11 +14,15 @@
  */
 
  #include "fire_works.h"
+ #include "halo.h"
+ #include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 12   // refresh frames per animation step (~100 ms)
 
 void fire_works_animation(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF);
-    WRITE_REGISTER(0x40000400, 0xFF);
+    halo_matrix_init(ROW_US);
 
     const unsigned char explosion[5][8] = {
         {
@@ -77,16 +81,9 @@ void fire_works_animation(void)
     {
         for (int f = 0; f < 5; f++)
         {
-            for (int repeat = 0; repeat < 60; repeat++)
-            {
-                for (int row = 0; row < 8; row++)
-                {
-                    WRITE_REGISTER(0x40000008, (1 << row));
-                    WRITE_REGISTER(0x40000408, ~(explosion[f][row]));
-                    delay_us(10);
-                    WRITE_REGISTER(0x40000408, 0xFF);
-                }
-            }
+            // The timer ISR refreshes the matrix; the CPU is free while we hold
+            halo_matrix_show(explosion[f]);
+            delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
         }
     }
 }
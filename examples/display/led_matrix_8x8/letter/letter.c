@@ -15,11 +15,14 @@
  */
 
 #include "halo.h"  
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 15   // refresh frames per shift (120 ms)
 
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF);
-    WRITE_REGISTER(0x40000400, 0xFF);  
+    halo_matrix_init(ROW_US);
 
     unsigned char pattern[8] = {
         0x81, 
@@ -36,20 +39,13 @@ void fw_main(void)
     {
         for(int shift=0;shift<8;shift++)
         {
-            for (int frame = 0; frame < 50; frame++) 
-            {   
-                for (int row = 0;row < 8; row++)
-                {
-                    unsigned char row_mask = (1 << row);
-        
-                    unsigned char col_data = ~( (pattern[row] << shift) & 0xFF );
-        
-                    WRITE_REGISTER(0x40000008, row_mask); 
-                    WRITE_REGISTER(0x40000408, col_data); 
-                    delay_us(10);  
-                    WRITE_REGISTER(0x40000408, 0XFF);                       
-                }
-            }
+            unsigned char* frame = halo_matrix_back_buffer();
+
+            for (int row = 0;row < 8; row++)
+                frame[row] = (pattern[row] << shift) & 0xFF;
+
+            halo_matrix_flip();
+            delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
         }
     }
 }
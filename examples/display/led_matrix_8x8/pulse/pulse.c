@@ -15,11 +15,34 @@
  */
 
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define OUT_FRAMES  5    // refresh frames per lit ring, growing outwards
+#define IN_FRAMES   50   // same, shrinking back (10x slower, as before)
+
+// Light rings 0..j; each ring is the same mask on rows and columns
+static void show_rings(const unsigned char* vals, int j, unsigned int hold_us)
+{
+    unsigned char* frame = halo_matrix_back_buffer();
+
+    for (int row = 0; row < HALO_MATRIX_ROWS; row++)
+    {
+        frame[row] = 0;
+        for (int i = 0; i <= j; i++)
+        {
+            if (vals[i] & (1 << row))
+                frame[row] |= vals[i];
+        }
+    }
+
+    halo_matrix_flip();
+    delay_us(hold_us);
+}
 
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF);
-    WRITE_REGISTER(0x40000400, 0xFF);  
+    halo_matrix_init(ROW_US);
 
     unsigned char vals[4] = {
         0x18,  
@@ -29,41 +52,16 @@ void fw_main(void)
     };
     
     int j = 0;
-    int count = 0;
 
     while (1)
     {
-        for (count = 0; count < 100; count++)
-        {
-            for (int i = 0; i <= j; i++)
-            {
-                // Set row
-                WRITE_REGISTER(0x40000008, vals[i]);     
-
-                WRITE_REGISTER(0x40000408, ~vals[i]);  
-
-                delay_us(10);
-
-                WRITE_REGISTER(0x40000408, 0xFF);
-            }
-        }
+        // Hold grows with the number of lit rings, as the old per-ring scan
+        show_rings(vals, j, OUT_FRAMES * (j + 1) * HALO_MATRIX_ROWS * ROW_US);
         j++;
         if (j >= 3) 
             while( j >=0 )
             {
-                for (count = 0; count < 1000; count++)
-                {
-                    for (int i = 0; i <= j; i++)
-                    {
-                        WRITE_REGISTER(0x40000008, vals[i]);     
-                
-                        WRITE_REGISTER(0x40000408, ~vals[i]);  
-                
-                        delay_us(10);
-
-                        WRITE_REGISTER(0x40000408, 0xFF);
-                    }
-                } 
+                show_rings(vals, j, IN_FRAMES * (j + 1) * HALO_MATRIX_ROWS * ROW_US);
                 j--;
             }
     }
@@ -13,10 +13,14 @@
  */
 
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 12   // refresh frames per shift (~100 ms)
+
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF); 
-    WRITE_REGISTER(0x40000400, 0xFF); 
+    halo_matrix_init(ROW_US);
     unsigned char arrow[8] = {
         0b00010000,
         0b00111000,
@@ -30,22 +34,15 @@ void fw_main(void)
 
     while (1)
     {
-        for (int repeat = 0; repeat < 1; repeat++)
+        // Shift the arrow by one column every HOLD_FRAMES refresh frames
+        for (int row = 0; row < 8; row++)
         {
-            for (int frame = 0; frame < 50; frame++) 
-            {
-                for (int row = 0; row < 8; row++)
-                {
-                    WRITE_REGISTER(0x40000008, (1 << row)); 
-                    unsigned char current = arrow[row];
-                    unsigned char rotated = (current << 1) | (current >> 7);
-                    arrow[row] = rotated;
-                    WRITE_REGISTER(0x40000408, ~rotated);
-                    delay_us(10);
-                    WRITE_REGISTER(0x40000408, 0xFF); 
-                }
-            }
+            unsigned char current = arrow[row];
+            arrow[row] = (current << 1) | (current >> 7);
         }
+
+        halo_matrix_show(arrow);
+        delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
     }
 }
 
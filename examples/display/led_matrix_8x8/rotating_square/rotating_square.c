@@ -13,10 +13,14 @@
  */
 
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 15   // refresh frames per position (120 ms)
+
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF); 
-    WRITE_REGISTER(0x40000400, 0xFF); 
+    halo_matrix_init(ROW_US);
 
    
     unsigned char frames[4][8] = {
@@ -66,16 +70,8 @@ void fw_main(void)
     {
         for (int f = 0; f < 4; f++)  
         {
-            for (int repeat = 0; repeat < 50; repeat++)  
-            {
-                for (int row = 0; row < 8; row++)
-                {
-                    WRITE_REGISTER(0x40000008, (1 << row));           
-                    WRITE_REGISTER(0x40000408, ~frames[f][row]);      
-                    delay_us(5);                                     
-                    WRITE_REGISTER(0x40000408, 0xFF);                 
-                }
-            }
+            halo_matrix_show(frames[f]);
+            delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
         }
     }
 }
@@ -13,6 +13,7 @@
  * - Controller: Halo Ver 1.0
  */
 #include "halo.h"
+#include "halo_matrix.h"
 
 // 5 characters "HELLO" (each 6 cols wide, including spacing)
 const unsigned char font[][6] = {
@@ -32,11 +33,12 @@ const unsigned char font[][6] = {
 #define FONT_WIDTH  6
 #define MATRIX_COLS 8
 #define MATRIX_ROWS 8
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 12   // refresh frames per scroll step (~100 ms)
 
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF); // rows as output
-    WRITE_REGISTER(0x40000400, 0xFF); // cols as output
+    halo_matrix_init(ROW_US); // rows/cols as output, timer-driven refresh
 
     int total_width = NUM_CHARS * FONT_WIDTH + MATRIX_COLS; // include trailing blank
     int shift = 0;
@@ -45,36 +47,33 @@ void fw_main(void)
     {
         for (shift = 0; shift < total_width; shift++) // scroll across full width
         {
-            for (int frame = 0; frame < 40; frame++)  // hold each shift for visibility
+            unsigned char* frame = halo_matrix_back_buffer();
+
+            for (int row = 0; row < MATRIX_ROWS; row++)
             {
-                for (int row = 0; row < MATRIX_ROWS; row++)
-                {
-                    unsigned char row_mask = (1 << row);
-                    unsigned char col_data = 0xFF;
+                unsigned char row_data = 0;
 
-                    for (int col = 0; col < MATRIX_COLS; col++)
+                for (int col = 0; col < MATRIX_COLS; col++)
+                {
+                    int font_col_index = shift + col;
+                    if (font_col_index < NUM_CHARS * FONT_WIDTH)
                     {
-                        int font_col_index = shift + col;
-                        if (font_col_index < NUM_CHARS * FONT_WIDTH)
-                        {
-                            // Pick correct character + column inside character
-                            int char_index = font_col_index / FONT_WIDTH;
-                            int col_index  = font_col_index % FONT_WIDTH;
+                        // Pick correct character + column inside character
+                        int char_index = font_col_index / FONT_WIDTH;
+                        int col_index  = font_col_index % FONT_WIDTH;
 
-                            if (font[char_index][col_index] & (1 << row))
-                            {
-                                col_data &= ~(1 << col); // LED ON
-                            }
+                        if (font[char_index][col_index] & (1 << row))
+                        {
+                            row_data |= (1 << col); // LED ON
                         }
                     }
-
-                    WRITE_REGISTER(0x40000408, col_data); // set columns
-                    WRITE_REGISTER(0x40000008, row_mask); // select row
-                    delay_us(1);                       // ~1ms for brightness
-                    WRITE_REGISTER(0x40000408, 0xFF);     // clear
                 }
+
+                frame[row] = row_data;
             }
+
+            halo_matrix_flip();
+            delay_us(HOLD_FRAMES * MATRIX_ROWS * ROW_US); // hold each shift for visibility
         }
     }
 }
-
@@ -12,27 +12,23 @@
  */
 
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 15   // refresh frames per column (120 ms)
 void fw_main(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF);  
-    WRITE_REGISTER(0x40000400, 0xFF);  
+    halo_matrix_init(ROW_US);
+
+    unsigned char frame[8] = {0};
 
     while (1)
     {
         for (int col = 0; col < 8; col++)         
             {
-            for (int repeat = 0; repeat < 30; repeat++)  
-                {
-                WRITE_REGISTER(0x40000008, 0b00000001);  
-
-                unsigned char col_pattern = ~(1 << col); 
-                WRITE_REGISTER(0x40000408, col_pattern); 
-                delay_us(5);  
-
-                WRITE_REGISTER(0x40000408, 0xFF);  
-                }
+            frame[0] = (1 << col); // top row only
+            halo_matrix_show(frame);
+            delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
             }
     }
 }
-
-
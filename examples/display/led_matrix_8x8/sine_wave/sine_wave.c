@@ -15,11 +15,14 @@
 
 #include "sine_wave.h"
 #include "halo.h"
+#include "halo_matrix.h"
+
+#define ROW_US      1000 // row scan period: 8 ms frame, 125 Hz refresh
+#define HOLD_FRAMES 10   // refresh frames per wave step (80 ms)
 
 void sine_wave_animation(void)
 {
-    WRITE_REGISTER(0x40000000, 0xFF); 
-    WRITE_REGISTER(0x40000400, 0xFF); 
+    halo_matrix_init(ROW_US);
 
     const unsigned char sine_y[16] = {3, 4, 5, 4, 3, 2, 1, 2, 3, 4, 5, 4, 3, 2, 1, 2};
 
@@ -27,26 +30,25 @@ void sine_wave_animation(void)
 
     while (1)
     {
-        for (int frame = 0; frame < 50; frame++)
+        unsigned char* frame = halo_matrix_back_buffer();
+
+        for (int row = 0; row < 8; row++)
         {
-            for (int row = 0; row < 8; row++)
+            unsigned char row_data = 0;
+
+            for (int col = 0; col < 8; col++)
             {
-                WRITE_REGISTER(0x40000008, (1 << row));
-                unsigned char col_pattern = 0xFF;
-
-                for (int col = 0; col < 8; col++)
-                {
-                    int index = (offset + col) % 16;
-                    if (row == sine_y[index])
-                        col_pattern &= ~(1 << (7 - col));
-                }
-
-                WRITE_REGISTER(0x40000408, col_pattern);
-                delay_us(1);
-                WRITE_REGISTER(0x40000408, 0xFF);
+                int index = (offset + col) % 16;
+                if (row == sine_y[index])
+                    row_data |= (1 << (7 - col));
             }
+
+            frame[row] = row_data;
         }
 
+        halo_matrix_flip();
+        delay_us(HOLD_FRAMES * HALO_MATRIX_ROWS * ROW_US);
+
         offset = (offset + 1) % 16;
     }
 }
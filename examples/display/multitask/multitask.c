@@ -0,0 +1,147 @@
+/**
+ * @file    multitask.c
+ * @brief   LED matrix animation, arm trajectory and PI servo loop sharing
+ *          one core under the cooperative scheduler.
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Matrix: 125 µs row period from the TIMER interrupt (1 kHz frame refresh),
+ *   a 10 Hz task draws the animation frames
+ * - Trajectory: 50 Hz task walks a square in the workspace and turns each
+ *   point into joint setpoints with IK
+ * - PI: 50 Hz task closes the joint loops on the servo feedback registers
+ * - Report: once a second prints per-task timing and the core's slack
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Display: 8×8 LED Matrix
+ * - Servo range: 0° – 180°, PWM period: 20 ms (50 Hz)
+ */
+
+#include "halo.h"
+#include "halo_sched.h"
+#include "halo_matrix.h"
+#include "halo_kinematics.h"
+#include "halo_pwm.h"
+#include <stdio.h>
+
+#define MATRIX_ROW_US   125       // 8 rows -> 1 kHz refresh
+#define ANIM_PERIOD_US  100000    // 10 Hz
+#define TRAJ_PERIOD_US  20000     // 50 Hz
+#define PI_PERIOD_US    20000     // 50 Hz
+#define REPORT_PERIOD_US 1000000  // 1 Hz
+
+#define SIDE_STEPS      50        // trajectory points per square side (1 s)
+
+// PI controller gains (as in pi_controller.h)
+#define KP 1.0f
+#define KI 0.5f
+
+// Joint setpoints, written by the trajectory task, read by the PI task
+static float setpoint_deg[2] = { 90.0f, 90.0f };
+
+// ---------- Matrix animation task ----------
+
+static void anim_task(void* ctx)
+{
+    unsigned int* step = ctx;
+    unsigned char* frame = halo_matrix_back_buffer();
+
+    // Diagonal bar sweeping across the matrix
+    for (int row = 0; row < HALO_MATRIX_ROWS; row++)
+        frame[row] = (unsigned char)(0x81u << ((row + *step) & 7));
+
+    halo_matrix_flip();
+    (*step)++;
+}
+
+// ---------- Trajectory task ----------
+
+static void traj_task(void* ctx)
+{
+    static const halo_arm_t arm = HALO_ARM_2DOF;
+    static const float corners[4][2] = {
+        { -5.0f, 10.0f }, { 5.0f, 10.0f }, { 5.0f, 15.0f }, { -5.0f, 15.0f }
+    };
+    unsigned int* step = ctx;
+
+    int side = (*step / SIDE_STEPS) % 4;
+    float t  = (float)(*step % SIDE_STEPS) / SIDE_STEPS;
+    const float* a = corners[side];
+    const float* b = corners[(side + 1) % 4];
+
+    float t1_deg, t2_deg;
+    if (halo_ik_solve(&arm, a[0] + t * (b[0] - a[0]), a[1] + t * (b[1] - a[1]),
+                      HALO_ELBOW_DOWN, &t1_deg, &t2_deg))
+    {
+        setpoint_deg[0] = t1_deg;
+        setpoint_deg[1] = t2_deg;
+    }
+    (*step)++;
+}
+
+// ---------- PI task ----------
+
+static unsigned int pi_joint(int ch, float* integral)
+{
+    float current_deg = READ_REGISTER(0x40001000 + 4 * ch);
+    float error = setpoint_deg[ch] - current_deg;
+
+    *integral += error * (PI_PERIOD_US * 1e-6f);
+    if (*integral < -50.0f) *integral = -50.0f;
+    if (*integral >  50.0f) *integral =  50.0f;
+
+    float angle_deg = current_deg + KP * error + KI * (*integral);
+    if (angle_deg < 0.0f)   angle_deg = 0.0f;
+    if (angle_deg > 180.0f) angle_deg = 180.0f;
+
+    return 1000 + (unsigned int)(angle_deg * 1000.0f / 180.0f);
+}
+
+static void pi_task(void* ctx)
+{
+    float* integral = ctx;
+    unsigned int duty[2];
+
+    duty[0] = pi_joint(HALO_PWM_SHOULDER, &integral[0]);
+    duty[1] = pi_joint(HALO_PWM_ELBOW, &integral[1]);
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, duty, 2);
+}
+
+// ---------- Report task ----------
+
+static void report_task(void* ctx)
+{
+    (void)ctx;
+    unsigned long long elapsed = halo_sched_elapsed_us();
+
+    printf("t=%llu ms slack %.2f%%\n", elapsed / 1000,
+           elapsed ? 100.0 * halo_sched_idle_us() / elapsed : 0.0);
+
+    for (int i = 0; i < halo_sched_task_count(); i++)
+    {
+        const halo_task_stats_t* s = halo_sched_task_stats(i);
+        printf("  %-7s runs %6lu  miss %lu  skip %lu  exec max %u us  late max %u us\n",
+               s->name, s->runs, s->misses, s->skipped, s->max_exec_us, s->max_late_us);
+    }
+}
+
+// ---------- Main ----------
+
+void fw_main(void)
+{
+    static unsigned int anim_step, traj_step;
+    static float integral[2];
+
+    halo_pwm_enable(HALO_PWM_SHOULDER, 20000);
+    halo_pwm_enable(HALO_PWM_ELBOW, 20000);
+    halo_matrix_init(MATRIX_ROW_US);
+
+    halo_sched_add("pi",     pi_task,     integral,   PI_PERIOD_US,     0, 0);
+    halo_sched_add("traj",   traj_task,   &traj_step, TRAJ_PERIOD_US,   0, 0);
+    halo_sched_add("anim",   anim_task,   &anim_step, ANIM_PERIOD_US,   0, 0);
+    halo_sched_add("report", report_task, 0,          REPORT_PERIOD_US, 0, REPORT_PERIOD_US);
+
+    halo_sched_run();
+}
@@ -0,0 +1,162 @@
+/**
+ * @file    cpp_kinematics.cpp
+ * @brief   Checks the header-only C++ kinematics against the C solver.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Instantiates halo::kinematics for the three layouts of
+ *   halo_kinematics.hpp: the HALO 2-DOF arm (planar 2R), a 3-link planar
+ *   arm and a SCARA
+ * - 2R: ik() and ik_batch() on both elbow branches over a grid covering the
+ *   workspace, compared with halo_ik_solve() for the same arm
+ * - 3R and SCARA: fk(ik(pose)) round trip over reachable poses
+ * - Prints the largest differences and returns
+ *
+ * Build (C libraries as C, this file as C++17):
+ * @code
+ * cc -c -O2 -Ihost -Ilib/halo_math -Ilib/halo_kinematics \
+ *    lib/halo_math/halo_math.c lib/halo_kinematics/halo_kinematics.c \
+ *    host/halo_host.c host/halo_run.c
+ * c++ -std=c++17 -O2 -Ihost -Ilib/halo_math -Ilib/halo_kinematics \
+ *    examples/robotics/2DOF/2dof_cpp_kinematics/cpp_kinematics.cpp *.o -lm -o cpp_kinematics
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Build without -DHALO_KINEMATICS_FIXED: the templates are float only,
+ *   so the comparison needs the float C solver
+ */
+
+#include "halo_kinematics.hpp"
+#include <cstdio>
+
+// 3-link planar arm: HALO 2-DOF links plus a 4 cm tool
+struct arm_3link
+{
+    static constexpr halo::layout kind = halo::layout::planar_3r;
+    static constexpr float l1 = 10.0f, l2 = 10.0f, l3 = 4.0f;
+};
+
+// SCARA: HALO 2-DOF links, quill from z = 15 cm down to 5 cm
+struct arm_scara
+{
+    static constexpr halo::layout kind = halo::layout::scara;
+    static constexpr float l1 = 10.0f, l2 = 10.0f;
+    static constexpr float z0 = 15.0f, d3_max = 10.0f;
+};
+
+#define GRID_STEP_CM 0.5f
+
+// ---------- Helpers ----------
+
+static inline float absf(float v)
+{
+    return v < 0.0f ? -v : v;
+}
+
+// Largest joint difference (deg) between the 2R template and halo_ik_solve()
+template <int ElbowUp>
+static float check_2r(int* points, int* mismatches)
+{
+    using arm2 = halo::kinematics<halo::arm_2dof>;
+    static const halo_arm_t arm = HALO_ARM_2DOF;
+
+    float max_err = 0.0f;
+    for (float y = -20.0f; y <= 20.0f; y += GRID_STEP_CM)
+    {
+        for (float x = -20.0f; x <= 20.0f; x += GRID_STEP_CM)
+        {
+            float t1, t2;
+            int ok_c = halo_ik_solve(&arm, x, y, ElbowUp, &t1, &t2);
+
+            arm2::joints q;
+            int ok = arm2::template ik<ElbowUp>({ { x, y } }, q);
+
+            (*points)++;
+            if (ok != ok_c)
+            {
+                (*mismatches)++;
+                continue;
+            }
+            if (!ok)
+                continue;
+
+            float e1 = absf(q[0] - t1);
+            float e2 = absf(q[1] - t2);
+            if (e1 > max_err) max_err = e1;
+            if (e2 > max_err) max_err = e2;
+        }
+    }
+    return max_err;
+}
+
+// Largest |fk(ik(p)) - p| over reachable poses, lengths in cm, angles in deg
+template <class Arm>
+static float check_round_trip(const typename Arm::pose* poses, int n)
+{
+    float max_err = 0.0f;
+    for (int i = 0; i < n; i++)
+    {
+        typename Arm::joints q;
+        if (!Arm::template ik<HALO_ELBOW_DOWN>(poses[i], q))
+            continue;
+
+        typename Arm::pose p = Arm::fk(q);
+        for (int k = 0; k < Arm::dof; k++)
+        {
+            float e = absf(p[k] - poses[i][k]);
+            if (e > max_err)
+                max_err = e;
+        }
+    }
+    return max_err;
+}
+
+// ---------- Main ----------
+
+extern "C" void fw_main(void)
+{
+    // 2R: both branches against the C solver
+    int points = 0, mismatches = 0;
+    float err_down = check_2r<HALO_ELBOW_DOWN>(&points, &mismatches);
+    float err_up   = check_2r<HALO_ELBOW_UP>(&points, &mismatches);
+    printf("2R    : %d points, %d reach mismatches, max |dq| %.6f deg (down) %.6f deg (up)\n",
+           points, mismatches, err_down, err_up);
+
+    // 2R batch form: same results as the single-point form
+    using arm2 = halo::kinematics<halo::arm_2dof>;
+    arm2::pose    line[16];
+    arm2::joints  q_batch[16];
+    unsigned char reach[16];
+    for (int i = 0; i < 16; i++)
+        line[i] = { { -12.0f + 0.5f * i, 8.0f } };
+    int reachable = arm2::ik_batch<HALO_ELBOW_DOWN>(line, q_batch, reach, 16);
+
+    int differ = 0;
+    for (int i = 0; i < 16; i++)
+    {
+        arm2::joints q;
+        int ok = arm2::ik<HALO_ELBOW_DOWN>(line[i], q);
+        differ += (ok != reach[i]) | (q[0] != q_batch[i][0]) | (q[1] != q_batch[i][1]);
+    }
+    printf("2R    : ik_batch %d of 16 reachable, %d differ from ik(), reach %.1f - %.1f cm\n",
+           reachable, differ, arm2::reach_min, arm2::reach_max);
+
+    // 3R and SCARA: forward of inverse returns the pose
+    using arm3 = halo::kinematics<arm_3link>;
+    using scara = halo::kinematics<arm_scara>;
+
+    arm3::pose  poses3[36];
+    scara::pose poses4[36];
+    for (int i = 0; i < 36; i++)
+    {
+        float x = -12.0f + (float)(i % 6) * 3.0f;
+        float y = 2.0f + (float)(i / 6) * 2.5f;
+        poses3[i] = { { x, y, (float)(i * 10 - 180) } };
+        poses4[i] = { { x, y, 8.0f + (float)(i % 4), (float)(i * 5) } };
+    }
+    printf("3R    : max |fk(ik(p)) - p| %.5f\n", check_round_trip<arm3>(poses3, 36));
+    printf("SCARA : max |fk(ik(p)) - p| %.5f\n", check_round_trip<scara>(poses4, 36));
+}
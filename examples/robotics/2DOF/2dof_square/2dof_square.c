@@ -7,7 +7,8 @@
  * 
  * @details
  * This file controls two servo motors mimicing a robotic arm, to trace a square with the effectors. 
- * The square is defined by four corner coordinates and the program interpolates between each pair of corners in small steps, making the arm move along each side.
+ * The square is defined by four corner coordinates. The sides are streamed into a look-ahead planner
+ * (halo_planner) that blends through the corners within CORNER_DEVIATION_CM and emits one setpoint per PWM period.
  * @note
  * - Controller: Halo Ver 1.0
  * - Servo range: 0° – 180°
@@ -15,38 +16,30 @@
  */
 
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_pwm.h"
+#include "halo_profile.h"
+#include "halo_planner.h"
+#include "halo_loop.h"
 #include <stdio.h>
-#include <math.h>
-
-#define PI 3.141592653589793
-#define DEG_TO_RAD(deg) ((deg) * PI / 180.0)
-#define RAD_TO_DEG(rad) ((rad) * 180.0 / PI)
 
 // Arm link lengths (in cm)
-#define L1 10.0
-#define L2 10.0
+#define L1 10.0f
+#define L2 10.0f
 
-unsigned int angle_to_duty_us(unsigned int angle) {
-    if (angle > 180) angle = 180;
-    return 1000 + (angle * 1000) / 180;
-}
+static const halo_arm_t arm = { L1, L2 };
 
-void inverse_kinematics(float x, float y, float* theta1, float* theta2) {
-    float d = (x * x + y * y - L1 * L1 - L2 * L2) / (2 * L1 * L2);
-    if (d > 1.0) d = 1.0;
-    if (d < -1.0) d = -1.0;
+// Velocity / acceleration / jerk limits of { shoulder, elbow }
+static const halo_joint_limits_t servo_limits[2] = { HALO_PROFILE_SERVO_LIMITS, HALO_PROFILE_SERVO_LIMITS };
 
-    float t2 = acos(d);
-    float t1 = atan2(y, x) - atan2(L2 * sin(t2), L1 + L2 * cos(t2));
+#define CORNER_DEVIATION_CM 0.1f  // how far a blended corner may be cut
 
-    *theta1 = RAD_TO_DEG(t1);
-    *theta2 = RAD_TO_DEG(t2);
+unsigned int angle_to_duty_us(unsigned int angle) {
+    if (angle > 180) angle = 180;
+    return 1000 + (angle * 1000) / 180;
 }
 
-void move_to(float x, float y) {
-    float theta1, theta2;
-    inverse_kinematics(x, y, &theta1, &theta2);
-
+void move_to_joints(float theta1, float theta2) {
     if (theta1 < 0) theta1 = 0;
     if (theta1 > 180) theta1 = 180;
     if (theta2 < 0) theta2 = 0;
@@ -55,10 +48,14 @@ void move_to(float x, float y) {
     unsigned int duty0 = angle_to_duty_us((unsigned int)theta1);
     unsigned int duty1 = angle_to_duty_us((unsigned int)theta2);
 
-    WRITE_REGISTER(0x40004004, duty0); // pwm0_duty
-    WRITE_REGISTER(0x40004044, duty1); // pwm1_duty
+    unsigned int pwm_duty[2] = { duty0, duty1 }; // shoulder, elbow
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
+}
 
-    delay_us(200); // smooth motion
+void move_to(float x, float y) {
+    float theta1, theta2;
+    halo_ik_solve(&arm, x, y, HALO_ELBOW_DOWN, &theta1, &theta2); // out-of-reach -> clamped pose
+    move_to_joints(theta1, theta2);
 }
 
 void fw_main(void) {
@@ -75,20 +72,24 @@ void fw_main(void) {
         {5.0, -5.0}   // bottom-left
     };
 
+    static halo_planner_t planner;
+    halo_planner_init(&planner, &arm, HALO_ELBOW_DOWN, servo_limits, CORNER_DEVIATION_CM,
+                      HALO_PROFILE_SERVO_PERIOD_S);
+    halo_planner_start(&planner, square[0][0], square[0][1]);
+    move_to(square[0][0], square[0][1]);
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    int corner = 1;
     while (1) {
-        for (int i = 0; i < 4; ++i) {
-            float x1 = square[i][0];
-            float y1 = square[i][1];
-            float x2 = square[(i + 1) % 4][0];
-            float y2 = square[(i + 1) % 4][1];
-
-            int segments = 20;
-            for (int j = 0; j <= segments; ++j) {
-                float t = (float)j / segments;
-                float x = x1 + t * (x2 - x1);
-                float y = y1 + t * (y2 - y1);
-                move_to(x, y);
-            }
-        }
+        // Keep queueing sides so the planner never runs out of look-ahead
+        while (halo_planner_line_to(&planner, square[corner][0], square[corner][1]))
+            corner = (corner + 1) % 4;
+
+        float theta1, theta2;
+        halo_planner_next(&planner, &theta1, &theta2);
+        halo_loop_wait(&loop);
+        move_to_joints(theta1, theta2);
     }
 }
@@ -1,12 +1,28 @@
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_iklut_2dof.h"
+#include "halo_pwm.h"
+#include "halo_profile.h"
+#include "halo_planner.h"
+#include "halo_subdiv.h"
+#include "halo_loop.h"
 #include"draw_letter.h"
 #include <stdio.h>
-#include <math.h>
 
 // -------------------- Robot Parameters --------------------
 #define L1 10.0f
 #define L2 10.0f
 
+static const halo_arm_t arm = { L1, L2 };
+
+// move_line() knots: 0.2 mm chord error, 10° per piece
+static const halo_subdiv_cfg_t subdiv_cfg = HALO_SUBDIV_CFG_DEFAULT;
+
+// Velocity / acceleration / jerk limits of { shoulder, elbow }
+static const halo_joint_limits_t servo_limits[2] = { HALO_PROFILE_SERVO_LIMITS, HALO_PROFILE_SERVO_LIMITS };
+
+#define CORNER_DEVIATION_CM 0.1f  // how far a blended corner may be cut
+
 // Servo pulse limits
 #define SERVO_MIN_US 1000
 #define SERVO_MAX_US 2000
@@ -23,52 +39,68 @@ static inline unsigned int angle_to_duty_us(float angle_deg)
     return SERVO_MIN_US + (unsigned int)((a * (SERVO_MAX_US - SERVO_MIN_US)) / SERVO_RANGE_DEG);
 }
 
-// -------------------- Inverse Kinematics --------------------
-int computeIK(float x, float y, float *theta1_deg, float *theta2_deg, int elbowUp)
+// -------------------- Motion --------------------
+void move_to_joints(float t1, float t2)
 {
-    float r2 = x*x + y*y;
-    float r  = sqrtf(r2);
-
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0;
-
-    float c2 = (r2 - L1*L1 - L2*L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
-
-    float ang2 = acosf(c2);
-    if (elbowUp) ang2 = -ang2;
-
-    float s2 = sinf(ang2);
-    float k1 = L1 + L2 * c2;
-    float k2 = L2 * s2;
-
-    float beta  = atan2f(y, x);
-    float alpha = atan2f(k2, k1);
-    float ang1  = beta - alpha;
-
-    *theta1_deg = ang1 * 180.0f / M_PI;
-    *theta2_deg = ang2 * 180.0f / M_PI;
-    return 1;
+    unsigned int pwm_duty[2] = { angle_to_duty_us(t1), angle_to_duty_us(t2) }; // shoulder, elbow
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
 }
 
-// -------------------- Motion --------------------
 void move_to(float x, float y, int elbowUp)
 {
     float t1, t2;
-    if (computeIK(x, y, &t1, &t2, elbowUp)) {
-        WRITE_REGISTER(0x40004004, angle_to_duty_us(t1));
-        WRITE_REGISTER(0x40004044, angle_to_duty_us(t2));
+    if (halo_iklut_solve(&halo_iklut_2dof, &arm, x, y, elbowUp, &t1, &t2))
+        move_to_joints(t1, t2);
+}
+
+void move_line(float x1, float y1, float x2, float y2, int elbowUp)
+{
+    // IK only at knots where the joint-space chord stays on the line;
+    // setpoints in between interpolate the joints
+    static halo_subdiv_knot_t knots[HALO_SUBDIV_MAX_KNOTS];
+    int nk = halo_subdiv_line(&arm, x1, y1, x2, y2, elbowUp, &subdiv_cfg, knots, HALO_SUBDIV_MAX_KNOTS);
+
+    // Minimum-time S-curve within the servo limits, one setpoint per PWM period
+    halo_profile_t prof;
+    halo_profile_plan_line(&prof, &arm, x1, y1, x2, y2, elbowUp, servo_limits, 1);
+    int n = halo_profile_steps(&prof, HALO_PROFILE_SERVO_PERIOD_S);
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    int cursor = 0;
+    for (int k = 0; k <= n; k++) {
+        if (k > 0)
+            halo_loop_wait(&loop);
+        float s = halo_profile_pos(&prof, (float)k * HALO_PROFILE_SERVO_PERIOD_S);
+        float t1, t2;
+        if (halo_subdiv_sample(knots, nk, &cursor, s, &t1, &t2))
+            move_to_joints(t1, t2);
     }
 }
 
-void move_line(float x1, float y1, float x2, float y2, int steps, int elbowUp)
+// Draws pts[0] -> pts[1] -> ... blending through the corners
+void move_polyline(const float (*pts)[2], int n, int elbowUp)
 {
-    for (int i = 0; i <= steps; i++) {
-        float t = (float)i / (float)steps;
-        float x = x1 + t * (x2 - x1);
-        float y = y1 + t * (y2 - y1);
-        move_to(x, y, elbowUp);
-        delay_us(100);
+    static halo_planner_t planner;
+    halo_planner_init(&planner, &arm, elbowUp, servo_limits, CORNER_DEVIATION_CM,
+                      HALO_PROFILE_SERVO_PERIOD_S);
+    halo_planner_start(&planner, pts[0][0], pts[0][1]);
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    int i = 1;
+    for (;;) {
+        // Keep the look-ahead buffer full
+        while (i < n && halo_planner_line_to(&planner, pts[i][0], pts[i][1]))
+            i++;
+
+        float t1, t2;
+        if (!halo_planner_next(&planner, &t1, &t2))
+            break;
+        halo_loop_wait(&loop);
+        move_to_joints(t1, t2);
     }
 }
 
@@ -79,10 +111,12 @@ void draw_letter_L(void)
     // Start point (move without drawing if you have pen-up control)
     move_to(-5.0f, 10.0f, 0);  
     
-    // Vertical stroke
-    move_line(-5.0f, 10.0f, -5.0f, 5.0f, 30, 0);
-    // Horizontal base
-    move_line(-5.0f, 5.0f, 0.0f, 5.0f, 30, 0);
+    static const float stroke[][2] = {
+        { -5.0f, 10.0f },
+        { -5.0f,  5.0f },   // vertical stroke
+        {  0.0f,  5.0f },   // horizontal base
+    };
+    move_polyline(stroke, 3, 0);
 }
 
 // Example: draw a square symbol
@@ -92,17 +126,19 @@ void draw_n(void)
     // Start point (move without drawing if you have pen-up control)
     move_to(0.0f, 10.0f, 0);  
     
-    // Vertical stroke
-    move_line(0.0f, 10.0f, 0.0f, 5.0f, 30, 0);
-    // Horizontal base
-    move_line(0.0f, 5.0f, -5.0f, 10.0f, 30, 0);
-    move_line(-5.0f, 10.0f, -5.0f, -5.0f, 30, 0);
+    static const float stroke[][2] = {
+        {  0.0f, 10.0f },
+        {  0.0f,  5.0f },   // vertical stroke
+        { -5.0f, 10.0f },   // diagonal
+        { -5.0f, -5.0f },
+    };
+    move_polyline(stroke, 4, 0);
     
     //Reverse
-    //move_line(-5.0f, -5.0f, -5.0f, 10.0f, 30, 0);
-    //move_line(0.0f, 5.0f, -5.0f, 10.0f, 30, 0);
-    //move_line(-5.0f, 10.0f, 0.0f, 5.0f, 30, 0);
-    //move_line(0.0f, 5.0f, 0.0f, 10.0f, 30, 0);
+    //move_line(-5.0f, -5.0f, -5.0f, 10.0f, 0);
+    //move_line(0.0f, 5.0f, -5.0f, 10.0f, 0);
+    //move_line(-5.0f, 10.0f, 0.0f, 5.0f, 0);
+    //move_line(0.0f, 5.0f, 0.0f, 10.0f, 0);
     //move_to(20.0f, 0.0f, 0);  
 }
 
@@ -1,11 +1,24 @@
 #include "halo.h"
+#include "halo_kinematics.h"
+#include "halo_iklut_2dof.h"
+#include "halo_pwm.h"
+#include "halo_profile.h"
+#include "halo_subdiv.h"
+#include "halo_loop.h"
 #include"straight_line.h"
 #include <stdio.h>
-#include <math.h>
 
 #define L1 10.0f
 #define L2 10.0f
 
+static const halo_arm_t arm = { L1, L2 };
+
+// move_line() knots: 0.2 mm chord error, 10° per piece
+static const halo_subdiv_cfg_t subdiv_cfg = HALO_SUBDIV_CFG_DEFAULT;
+
+// Velocity / acceleration / jerk limits of { shoulder, elbow }
+static const halo_joint_limits_t servo_limits[2] = { HALO_PROFILE_SERVO_LIMITS, HALO_PROFILE_SERVO_LIMITS };
+
 #define SERVO_MIN_US 1000
 #define SERVO_MAX_US 2000
 #define SERVO_RANGE_DEG 180.0f
@@ -20,50 +33,42 @@ static inline unsigned int angle_to_duty_us(float angle_deg)
     return SERVO_MIN_US + (unsigned int)((a * (SERVO_MAX_US - SERVO_MIN_US)) / SERVO_RANGE_DEG);
 }
 
-int computeIK(float x, float y, float *theta1_deg, float *theta2_deg, int elbowUp)
+void move_to_joints(float t1_deg, float t2_deg)
 {
-    float r2 = x * x + y * y;
-    float r  = sqrtf(r2);
-
-    if (r > (L1 + L2) || r < fabsf(L1 - L2))
-        return 0; 
-
-    float c2 = (r2 - L1*L1 - L2*L2) / (2.0f * L1 * L2);
-    c2 = clampf(c2, -1.0f, 1.0f);
-
-    float ang2 = acosf(c2);
-    if (elbowUp) ang2 = -ang2;
-
-    float s2 = sinf(ang2);
-    float k1 = L1 + L2 * c2;
-    float k2 = L2 * s2;
-
-    float beta  = atan2f(y, x);
-    float alpha = atan2f(k2, k1);
-    float ang1  = beta - alpha;
-
-    *theta1_deg = ang1 * 180.0f / M_PI;
-    *theta2_deg = ang2 * 180.0f / M_PI;
-    return 1;
+    unsigned int pwm_duty[2] = { angle_to_duty_us(t1_deg), angle_to_duty_us(t2_deg) }; // shoulder, elbow
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pwm_duty, 2); // both joints latch on the same period
 }
 
 void move_to(float x, float y, int elbowUp)
 {
     float t1_deg, t2_deg;
-    if (computeIK(x, y, &t1_deg, &t2_deg, elbowUp)) {
-        WRITE_REGISTER(0x40004004, angle_to_duty_us(t1_deg));
-        WRITE_REGISTER(0x40004044, angle_to_duty_us(t2_deg));
-    }
+    if (halo_iklut_solve(&halo_iklut_2dof, &arm, x, y, elbowUp, &t1_deg, &t2_deg))
+        move_to_joints(t1_deg, t2_deg);
 }
 
-void move_line(float x1, float y1, float x2, float y2, int steps, int elbowUp)
+void move_line(float x1, float y1, float x2, float y2, int elbowUp)
 {
-    for (int i = 0; i <= steps; i++) {
-        float t = (float)i / (float)steps;
-        float x = x1 + t * (x2 - x1);
-        float y = y1 + t * (y2 - y1);
-        move_to(x, y, elbowUp);
-        delay_us(20); // ~20 ms per step
+    // IK only at knots where the joint-space chord stays on the line;
+    // setpoints in between interpolate the joints
+    static halo_subdiv_knot_t knots[HALO_SUBDIV_MAX_KNOTS];
+    int nk = halo_subdiv_line(&arm, x1, y1, x2, y2, elbowUp, &subdiv_cfg, knots, HALO_SUBDIV_MAX_KNOTS);
+
+    // Minimum-time S-curve within the servo limits, one setpoint per PWM period
+    halo_profile_t prof;
+    halo_profile_plan_line(&prof, &arm, x1, y1, x2, y2, elbowUp, servo_limits, 1);
+    int n = halo_profile_steps(&prof, HALO_PROFILE_SERVO_PERIOD_S);
+
+    halo_loop_t loop;
+    halo_loop_init(&loop, HALO_SERVO_PERIOD_US, 100);
+
+    int cursor = 0;
+    for (int k = 0; k <= n; k++) {
+        if (k > 0)
+            halo_loop_wait(&loop);
+        float s = halo_profile_pos(&prof, (float)k * HALO_PROFILE_SERVO_PERIOD_S);
+        float t1_deg, t2_deg;
+        if (halo_subdiv_sample(knots, nk, &cursor, s, &t1_deg, &t2_deg))
+            move_to_joints(t1_deg, t2_deg);
     }
 }
 
@@ -74,7 +79,7 @@ void fw_main(void)
     WRITE_REGISTER(0x40004040, 20000); 
     WRITE_REGISTER(0x40004048, 0x01);  
 
-    move_line(0.0f, 0.0f, 0.0f, 20.0f, 20, 0);
+    move_line(0.0f, 0.0f, 0.0f, 20.0f, 0);
 
     while (1) {
         delay_us(20); 
@@ -0,0 +1,50 @@
+#ifndef HALO_H
+#define HALO_H
+
+/**
+ * @file    halo.h
+ * @brief   Host backend of the HALO SDK header.
+ *
+ * @details
+ * Drop-in replacement for the VM's halo.h when an example is built for the
+ * host. Register accesses and delays are routed into the virtual-MCU model
+ * in halo_host.c, which keeps the simulated clock and the access trace.
+ *
+ * @note
+ * - Build: see README.md, "Host runner"
+ */
+
+void         halo_write_register(unsigned int addr, unsigned int value);
+unsigned int halo_read_register(unsigned int addr);
+void         delay_us(unsigned int us);
+
+#define WRITE_REGISTER(addr, value) halo_write_register((unsigned int)(addr), (unsigned int)(value))
+#define READ_REGISTER(addr)         halo_read_register((unsigned int)(addr))
+
+// ---------- Register bursts ----------
+// A burst is executed by the VM as one transaction (one trap): the writes
+// land in order and no interrupt is taken between them.
+
+// One write of a burst
+typedef struct
+{
+    unsigned int addr;
+    unsigned int value;
+} halo_reg_write_t;
+
+void halo_write_registers(const halo_reg_write_t* writes, unsigned int count);
+void halo_write_registers_strided(unsigned int base, unsigned int stride,
+                                  const unsigned int* values, unsigned int count);
+
+// Writes count { addr, value } pairs
+#define WRITE_REGISTERS(writes, count) \
+    halo_write_registers((writes), (unsigned int)(count))
+
+// Writes values[i] to base + i * stride, e.g. the DUTY of consecutive PWM channels
+#define WRITE_REGISTERS_STRIDED(base, stride, values, count) \
+    halo_write_registers_strided((unsigned int)(base), (unsigned int)(stride), (values), (unsigned int)(count))
+
+// Interrupt vectors, defined by the firmware (see documentation/timer)
+void TIMER_IRQHandler(void);
+
+#endif // HALO_H
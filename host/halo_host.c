@@ -0,0 +1,688 @@
+/**
+ * @file    halo_host.c
+ * @brief   Host-side HALO virtual-MCU model.
+ *          Backs the host halo.h: keeps the peripheral registers, a
+ *          simulated cycle counter and a timestamped register trace.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Peripheral window 0x40000000–0x4000FFFF is a flat register file
+ * - Every register access costs access_cycles (one VM trap); a burst costs
+ *   one trap plus burst_cycles per extra write. delay_us(us) costs
+ *   us * cpu_mhz cycles. Plain CPU work between accesses is not charged,
+ *   so simulated time is the time the firmware spends on I/O and waits
+ * - PWM duty drives a slew-limited servo model; the feedback registers at
+ *   0x40001000 + 4 * ch return its angle in degrees
+ * - PWM SHADOW/COMMIT: committed channels load SHADOW into DUTY together at
+ *   the next period boundary of the lowest pending channel
+ * - PWM streaming: each channel pops its duty FIFO into DUTY at every
+ *   period boundary while STREAM_CTRL.ENABLE is set
+ * - TIMER (0x40002000) ticks on simulated time and calls the firmware's
+ *   TIMER_IRQHandler; handler cycles are absorbed by a running delay_us,
+ *   as they would be on target
+ * - The run stops (longjmp back to halo_host_run) once sim_limit_us is hit,
+ *   since fw_main never returns
+ *
+ * @note
+ * - Controller: Halo Ver 1.0 (host model)
+ */
+
+#define _POSIX_C_SOURCE 199309L // clock_gettime under -std=c99/c11
+
+#include "halo.h"
+#include "halo_host.h"
+#include <setjmp.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+// ---------- Memory map ----------
+
+#define PERIPH_BASE      0x40000000u
+#define PERIPH_SIZE      0x10000u
+
+#define GPIO0_BASE       0x40000000u
+#define GPIO1_BASE       0x40000400u
+#define FEEDBACK_BASE    0x40001000u
+#define TIMER_BASE       0x40002000u
+#define PWM_BASE         0x40004000u
+#define PWM_STRIDE       0x40u
+#define PWM_CHANNELS     8
+
+#define PWM_PERIOD_OFS   0x00u
+#define PWM_DUTY_OFS     0x04u
+#define PWM_CTRL_OFS     0x08u
+#define PWM_SHADOW_OFS   0x0Cu
+#define PWM_SCTRL_OFS    0x10u
+#define PWM_SDATA_OFS    0x14u
+#define PWM_SSTATUS_OFS  0x18u
+#define PWM_COMMIT       (PWM_BASE + 0x200u)
+
+#define TIMER_COUNT      (TIMER_BASE + 0x00u)
+#define TIMER_PERIOD     (TIMER_BASE + 0x04u)
+#define TIMER_CTRL       (TIMER_BASE + 0x08u)
+#define TIMER_STATUS     (TIMER_BASE + 0x0Cu)
+#define TIMER_ENABLE     0x01u
+#define TIMER_IRQ_EN     0x02u
+#define TIMER_TICK       0x01u
+
+#define STREAM_ENABLE    0x01u
+#define STREAM_FLUSH     0x02u
+#define STREAM_HALF      0x01u
+#define STREAM_EMPTY     0x02u
+#define STREAM_FULL      0x04u
+#define STREAM_UNDERRUN  0x08u
+#define STREAM_OVERFLOW  0x10u
+#define STREAM_DEPTH     16
+
+#define SERVO_MIN_US     1000u
+#define SERVO_MAX_US     2000u
+
+// ---------- Model state ----------
+
+typedef struct
+{
+    unsigned int       fifo[STREAM_DEPTH];
+    unsigned int       head;            // next entry to pop
+    unsigned int       level;           // entries queued
+    unsigned int       flags;           // sticky UNDERRUN / OVERFLOW
+    unsigned long long next_pop;        // cycle of the next period boundary
+} stream_t;
+
+typedef struct
+{
+    float              pos_deg;         // current shaft angle
+    unsigned long long last_cycle;      // cycle of the last position update
+} servo_t;
+
+static halo_host_config_t  cfg = HALO_HOST_CONFIG_DEFAULT;
+static halo_host_stats_t   stats;
+static unsigned int        regs[PERIPH_SIZE / 4];
+static servo_t             servos[PWM_CHANNELS];
+static halo_trace_entry_t* trace;
+static unsigned long       trace_cap;
+static unsigned long long  limit_cycles;
+static jmp_buf             stop_jmp;
+static int                 running;
+static unsigned long long  next_tick;       // cycle of the next timer tick
+static int                 in_isr;
+static unsigned long long  pwm_phase[PWM_CHANNELS];  // cycle the current period started
+static unsigned int        pwm_pending;              // channels waiting for a COMMIT latch
+static unsigned long long  pwm_latch_at;             // cycle of that latch
+static stream_t            streams[PWM_CHANNELS];
+
+// Weak, so firmware without a timer handler still links
+void TIMER_IRQHandler(void) __attribute__((weak));
+
+// ---------- Helpers ----------
+
+static int block_of(unsigned int addr)
+{
+    if (addr >= GPIO0_BASE && addr < GPIO0_BASE + 0x400u)                       return HALO_HOST_GPIO0;
+    if (addr >= GPIO1_BASE && addr < GPIO1_BASE + 0x400u)                       return HALO_HOST_GPIO1;
+    if (addr >= FEEDBACK_BASE && addr < FEEDBACK_BASE + 4u * PWM_CHANNELS)       return HALO_HOST_FEEDBACK;
+    if (addr >= TIMER_BASE && addr <= TIMER_STATUS)                             return HALO_HOST_TIMER;
+    if (addr >= PWM_BASE && addr < PWM_BASE + PWM_STRIDE * PWM_CHANNELS)         return HALO_HOST_PWM;
+    if (addr == PWM_COMMIT)                                                     return HALO_HOST_PWM;
+    return HALO_HOST_OTHER;
+}
+
+static unsigned int* reg(unsigned int addr)
+{
+    if (addr < PERIPH_BASE || addr >= PERIPH_BASE + PERIPH_SIZE || (addr & 3u))
+        return 0;
+    return &regs[(addr - PERIPH_BASE) >> 2];
+}
+
+// Commanded servo angle for a PWM channel, or -1 if the channel is idle
+static float servo_target_deg(int ch)
+{
+    unsigned int base = PWM_BASE + ch * PWM_STRIDE;
+    unsigned int ctrl = *reg(base + PWM_CTRL_OFS);
+    unsigned int duty = *reg(base + PWM_DUTY_OFS);
+
+    if (!(ctrl & 0x01u) || duty < SERVO_MIN_US)
+        return -1.0f;
+    if (duty > SERVO_MAX_US)
+        duty = SERVO_MAX_US;
+    return (float)(duty - SERVO_MIN_US) * 180.0f / (float)(SERVO_MAX_US - SERVO_MIN_US);
+}
+
+// Moves a servo toward its target for the time elapsed since the last update
+static void servo_sync(int ch)
+{
+    servo_t* s = &servos[ch];
+    float target = servo_target_deg(ch);
+    float dt_s = (float)(stats.cycles - s->last_cycle) / (cfg.cpu_mhz * 1e6f);
+    s->last_cycle = stats.cycles;
+
+    if (target < 0.0f)
+        return;
+
+    float step = cfg.servo_deg_per_s * dt_s;
+    float err  = target - s->pos_deg;
+    if (err > step)       s->pos_deg += step;
+    else if (err < -step) s->pos_deg -= step;
+    else                  s->pos_deg = target;
+}
+
+static int pwm_channel_of(unsigned int addr)
+{
+    if (block_of(addr) != HALO_HOST_PWM || addr == PWM_COMMIT)
+        return -1;
+    return (int)((addr - PWM_BASE) / PWM_STRIDE);
+}
+
+// Period of a running channel in cycles, 0 if the channel is idle
+static unsigned long long pwm_period_cycles(int ch)
+{
+    unsigned int base = PWM_BASE + ch * PWM_STRIDE;
+
+    if (!(*reg(base + PWM_CTRL_OFS) & 0x01u))
+        return 0;
+    return (unsigned long long)*reg(base + PWM_PERIOD_OFS) * cfg.cpu_mhz;
+}
+
+// First period boundary of a channel at or after the current cycle
+static unsigned long long pwm_next_boundary(int ch)
+{
+    unsigned long long p = pwm_period_cycles(ch);
+
+    if (p == 0)
+        return stats.cycles;    // idle channel: latch right away
+
+    unsigned long long elapsed = stats.cycles - pwm_phase[ch];
+    return pwm_phase[ch] + (elapsed + p - 1) / p * p;
+}
+
+// Loads SHADOW into DUTY for every pending channel and restarts their periods
+static void pwm_latch(void)
+{
+    for (int ch = 0; ch < PWM_CHANNELS; ch++)
+    {
+        if (!(pwm_pending & (1u << ch)))
+            continue;
+
+        unsigned int base = PWM_BASE + ch * PWM_STRIDE;
+        servo_sync(ch);
+        *reg(base + PWM_DUTY_OFS) = *reg(base + PWM_SHADOW_OFS);
+        pwm_phase[ch] = stats.cycles;
+        streams[ch].next_pop = stats.cycles + pwm_period_cycles(ch);
+    }
+
+    pwm_pending = 0;
+    *reg(PWM_COMMIT) = 0;
+    stats.pwm_latches++;
+}
+
+static int stream_running(int ch)
+{
+    return (*reg(PWM_BASE + ch * PWM_STRIDE + PWM_SCTRL_OFS) & STREAM_ENABLE) && pwm_period_cycles(ch);
+}
+
+// Channel with the earliest pending FIFO pop, or -1
+static int stream_next(void)
+{
+    int next = -1;
+
+    for (int ch = 0; ch < PWM_CHANNELS; ch++)
+        if (stream_running(ch) && (next < 0 || streams[ch].next_pop < streams[next].next_pop))
+            next = ch;
+    return next;
+}
+
+// Period boundary of a streaming channel: load the oldest FIFO entry into DUTY
+static void stream_pop(int ch)
+{
+    stream_t* st = &streams[ch];
+
+    if (st->level)
+    {
+        servo_sync(ch);
+        *reg(PWM_BASE + ch * PWM_STRIDE + PWM_DUTY_OFS) = st->fifo[st->head];
+        st->head = (st->head + 1) % STREAM_DEPTH;
+        st->level--;
+        stats.stream_pops++;
+    }
+    else
+    {
+        st->flags |= STREAM_UNDERRUN;
+        stats.stream_underruns++;
+    }
+
+    st->next_pop += pwm_period_cycles(ch);
+}
+
+static unsigned int stream_status(int ch)
+{
+    const stream_t* st = &streams[ch];
+    unsigned int v = st->flags | (st->level << 16);
+
+    if (st->level <= STREAM_DEPTH / 2) v |= STREAM_HALF;
+    if (st->level == 0)                v |= STREAM_EMPTY;
+    if (st->level == STREAM_DEPTH)     v |= STREAM_FULL;
+    return v;
+}
+
+static void stream_write(int ch, unsigned int ofs, unsigned int value)
+{
+    stream_t*    st   = &streams[ch];
+    unsigned int addr = PWM_BASE + ch * PWM_STRIDE + ofs;
+
+    if (ofs == PWM_SCTRL_OFS)
+    {
+        if (value & STREAM_FLUSH)
+            st->level = 0;
+        if ((value & STREAM_ENABLE) && !(*reg(addr) & STREAM_ENABLE))
+        {
+            // First pop on the next period boundary
+            unsigned long long b = pwm_next_boundary(ch);
+            st->next_pop = (b == stats.cycles) ? b + pwm_period_cycles(ch) : b;
+        }
+        *reg(addr) = value & STREAM_ENABLE;
+    }
+    else if (ofs == PWM_SDATA_OFS)
+    {
+        if (st->level < STREAM_DEPTH)
+        {
+            st->fifo[(st->head + st->level) % STREAM_DEPTH] = value;
+            st->level++;
+        }
+        else
+        {
+            st->flags |= STREAM_OVERFLOW;
+        }
+    }
+    else
+    {
+        st->flags &= ~(value & (STREAM_UNDERRUN | STREAM_OVERFLOW));   // W1C
+    }
+}
+
+static void pwm_write(unsigned int addr, unsigned int value)
+{
+    if (addr == PWM_COMMIT)
+    {
+        pwm_pending |= value & ((1u << PWM_CHANNELS) - 1u);
+        *reg(addr) = pwm_pending;
+
+        if (pwm_pending)
+        {
+            int lowest = 0;
+            while (!(pwm_pending & (1u << lowest)))
+                lowest++;
+            pwm_latch_at = pwm_next_boundary(lowest);
+        }
+        return;
+    }
+
+    // Bring the servo up to date before its target changes
+    int ch = pwm_channel_of(addr);
+    servo_sync(ch);
+
+    unsigned int ofs = (addr - PWM_BASE) % PWM_STRIDE;
+    if (ofs >= PWM_SCTRL_OFS && ofs <= PWM_SSTATUS_OFS)
+    {
+        stream_write(ch, ofs, value);
+        return;
+    }
+
+    if (ofs == PWM_CTRL_OFS && (value & 0x01u) && !(*reg(addr) & 0x01u))
+        pwm_phase[ch] = stats.cycles;   // period starts when the channel is enabled
+
+    *reg(addr) = value;
+}
+
+static void record(char op, unsigned int addr, unsigned int value)
+{
+    if (stats.trace_len < trace_cap)
+    {
+        halo_trace_entry_t* e = &trace[stats.trace_len++];
+        e->cycle = stats.cycles;
+        e->addr  = addr;
+        e->value = value;
+        e->op    = op;
+    }
+    else if (cfg.trace_limit)
+    {
+        stats.trace_dropped++;
+    }
+}
+
+static void check_limit(void)
+{
+    if (running && limit_cycles && stats.cycles >= limit_cycles)
+        longjmp(stop_jmp, 1);
+}
+
+static int timer_enabled(void)
+{
+    return (*reg(TIMER_CTRL) & TIMER_ENABLE) && *reg(TIMER_PERIOD);
+}
+
+static void timer_fire(void)
+{
+    *reg(TIMER_STATUS) |= TIMER_TICK;
+    next_tick += (unsigned long long)*reg(TIMER_PERIOD) * cfg.cpu_mhz;
+
+    if ((*reg(TIMER_CTRL) & TIMER_IRQ_EN) && TIMER_IRQHandler)
+    {
+        unsigned long long start = stats.cycles;
+        in_isr = 1;
+        TIMER_IRQHandler();
+        in_isr = 0;
+        stats.irqs++;
+        stats.irq_cycles += stats.cycles - start;
+    }
+}
+
+// Moves the clock forward, taking every timer tick, PWM latch and stream
+// pop that falls due on the way, in time order
+static void advance(unsigned long long cycles)
+{
+    unsigned long long target = stats.cycles + cycles;
+
+    for (;;)
+    {
+        // Handlers do not nest: ticks that expire inside one are taken after it
+        int tick  = !in_isr && timer_enabled() && next_tick <= target;
+        int latch = pwm_pending && pwm_latch_at <= target;
+        int sch   = stream_next();
+        int pop   = sch >= 0 && streams[sch].next_pop <= target;
+
+        unsigned long long at = target;
+        if (tick)                                at = next_tick;
+        if (latch && pwm_latch_at <= at)         at = pwm_latch_at;
+        if (pop && streams[sch].next_pop <= at)  at = streams[sch].next_pop;
+
+        if (!tick && !latch && !pop)
+            break;
+
+        if (stats.cycles < at)
+            stats.cycles = at;
+
+        if (latch && pwm_latch_at == at)
+        {
+            pwm_latch();
+        }
+        else if (pop && streams[sch].next_pop == at)
+        {
+            stream_pop(sch);
+        }
+        else
+        {
+            check_limit();
+            timer_fire();
+        }
+    }
+
+    if (stats.cycles < target)
+        stats.cycles = target;
+    check_limit();
+}
+
+static void timer_write(unsigned int addr, unsigned int value)
+{
+    if (addr == TIMER_STATUS)
+    {
+        *reg(addr) &= ~value;       // write 1 to clear
+    }
+    else if (addr == TIMER_CTRL)
+    {
+        // First tick one period after the timer is enabled
+        if ((value & TIMER_ENABLE) && !(*reg(addr) & TIMER_ENABLE))
+            next_tick = stats.cycles + (unsigned long long)*reg(TIMER_PERIOD) * cfg.cpu_mhz;
+        *reg(addr) = value;
+    }
+    else if (addr != TIMER_COUNT)   // read-only
+    {
+        *reg(addr) = value;
+    }
+}
+
+// Applies one write to the model without charging time
+static void write_one(unsigned int addr, unsigned int value)
+{
+    unsigned int* r = reg(addr);
+
+    record('W', addr, value);
+    stats.writes++;
+
+    if (!r)
+    {
+        stats.bad_accesses++;
+    }
+    else
+    {
+        int block = block_of(addr);
+        stats.block_writes[block]++;
+
+        if (block == HALO_HOST_FEEDBACK)
+        {
+            // read-only
+        }
+        else if (block == HALO_HOST_TIMER)
+        {
+            timer_write(addr, value);
+        }
+        else if (block == HALO_HOST_PWM)
+        {
+            pwm_write(addr, value);
+        }
+        else
+        {
+            *r = value;
+        }
+    }
+}
+
+// ---------- halo.h backend ----------
+
+void halo_write_register(unsigned int addr, unsigned int value)
+{
+    stats.traps++;
+    write_one(addr, value);
+    advance(cfg.access_cycles);
+}
+
+void halo_write_registers(const halo_reg_write_t* writes, unsigned int count)
+{
+    if (count == 0)
+        return;
+
+    stats.traps++;
+    stats.bursts++;
+    for (unsigned int i = 0; i < count; i++)
+        write_one(writes[i].addr, writes[i].value);
+
+    advance(cfg.access_cycles + (unsigned long long)(count - 1) * cfg.burst_cycles);
+}
+
+void halo_write_registers_strided(unsigned int base, unsigned int stride,
+                                  const unsigned int* values, unsigned int count)
+{
+    if (count == 0)
+        return;
+
+    stats.traps++;
+    stats.bursts++;
+    for (unsigned int i = 0; i < count; i++)
+        write_one(base + i * stride, values[i]);
+
+    advance(cfg.access_cycles + (unsigned long long)(count - 1) * cfg.burst_cycles);
+}
+
+unsigned int halo_read_register(unsigned int addr)
+{
+    unsigned int* r = reg(addr);
+    unsigned int value = 0;
+
+    stats.reads++;
+    stats.traps++;
+
+    if (!r)
+    {
+        stats.bad_accesses++;
+    }
+    else if (block_of(addr) == HALO_HOST_FEEDBACK)
+    {
+        int ch = (int)((addr - FEEDBACK_BASE) >> 2);
+        servo_sync(ch);
+        value = (unsigned int)(servos[ch].pos_deg + 0.5f);
+    }
+    else if (addr == TIMER_COUNT)
+    {
+        value = (unsigned int)(stats.cycles / cfg.cpu_mhz);
+    }
+    else if (pwm_channel_of(addr) >= 0 && (addr - PWM_BASE) % PWM_STRIDE == PWM_SSTATUS_OFS)
+    {
+        value = stream_status(pwm_channel_of(addr));
+    }
+    else if (pwm_channel_of(addr) >= 0 && (addr - PWM_BASE) % PWM_STRIDE == PWM_SDATA_OFS)
+    {
+        value = 0;      // write-only
+    }
+    else
+    {
+        value = *r;
+    }
+
+    record('R', addr, value);
+    advance(cfg.access_cycles);
+    return value;
+}
+
+void delay_us(unsigned int us)
+{
+    stats.delays++;
+    advance((unsigned long long)us * cfg.cpu_mhz);
+}
+
+// ---------- Run control ----------
+
+void halo_host_init(const halo_host_config_t* config)
+{
+    if (config)
+        cfg = *config;
+    if (cfg.cpu_mhz == 0)
+        cfg.cpu_mhz = 1;
+
+    memset(&stats, 0, sizeof(stats));
+    memset(regs, 0, sizeof(regs));
+    memset(servos, 0, sizeof(servos));
+    next_tick = 0;
+    in_isr = 0;
+    memset(pwm_phase, 0, sizeof(pwm_phase));
+    pwm_pending = 0;
+    pwm_latch_at = 0;
+    memset(streams, 0, sizeof(streams));
+
+    free(trace);
+    trace = 0;
+    trace_cap = 0;
+    if (cfg.trace_limit)
+    {
+        trace = malloc(cfg.trace_limit * sizeof(*trace));
+        trace_cap = trace ? cfg.trace_limit : 0;
+    }
+
+    limit_cycles = cfg.sim_limit_us * cfg.cpu_mhz;
+}
+
+static double wall_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int halo_host_run(void (*entry)(void))
+{
+    volatile int stopped = 0;
+    double start = wall_now();
+
+    running = 1;
+    if (setjmp(stop_jmp) == 0)
+        entry();
+    else
+        stopped = 1;
+    running = 0;
+
+    stats.wall_s += wall_now() - start;
+    return stopped;
+}
+
+const halo_host_stats_t* halo_host_stats(void)
+{
+    return &stats;
+}
+
+const halo_trace_entry_t* halo_host_trace(void)
+{
+    return trace;
+}
+
+unsigned long long halo_host_time_us(void)
+{
+    return stats.cycles / cfg.cpu_mhz;
+}
+
+unsigned int halo_host_peek(unsigned int addr)
+{
+    unsigned int* r = reg(addr);
+    return r ? *r : 0;
+}
+
+// ---------- Reporting ----------
+
+void halo_host_report(FILE* f)
+{
+    static const char* names[HALO_HOST_BLOCKS] = { "gpio0", "gpio1", "feedback", "timer", "pwm", "other" };
+    double sim_s = (double)stats.cycles / (cfg.cpu_mhz * 1e6);
+
+    fprintf(f, "sim time      : %.6f s (%llu cycles @ %u MHz, %u cycles/access)\n",
+            sim_s, stats.cycles, cfg.cpu_mhz, cfg.access_cycles);
+    fprintf(f, "wall time     : %.6f s\n", stats.wall_s);
+    fprintf(f, "reg writes    : %llu (%.0f/s sim, %.0f/s wall)\n", stats.writes,
+            sim_s > 0 ? stats.writes / sim_s : 0.0,
+            stats.wall_s > 0 ? stats.writes / stats.wall_s : 0.0);
+    fprintf(f, "reg reads     : %llu\n", stats.reads);
+    fprintf(f, "vm traps      : %llu (%llu bursts)\n", stats.traps, stats.bursts);
+    fprintf(f, "delay_us calls: %llu\n", stats.delays);
+    if (stats.pwm_latches)
+        fprintf(f, "pwm latches   : %llu\n", stats.pwm_latches);
+    if (stats.stream_pops || stats.stream_underruns)
+        fprintf(f, "pwm stream    : %llu entries played, %llu underruns\n",
+                stats.stream_pops, stats.stream_underruns);
+    if (stats.irqs)
+        fprintf(f, "timer irqs    : %llu (%.1f%% of sim time in handlers)\n", stats.irqs,
+                stats.cycles ? 100.0 * stats.irq_cycles / stats.cycles : 0.0);
+
+    for (int b = 0; b < HALO_HOST_BLOCKS; b++)
+        if (stats.block_writes[b])
+            fprintf(f, "  %-9s writes: %llu\n", names[b], stats.block_writes[b]);
+
+    if (stats.bad_accesses)
+        fprintf(f, "bad accesses  : %llu\n", stats.bad_accesses);
+    if (cfg.trace_limit)
+        fprintf(f, "trace         : %lu entries (%lu dropped)\n", stats.trace_len, stats.trace_dropped);
+}
+
+int halo_host_write_trace(const char* path)
+{
+    FILE* f = fopen(path, "w");
+    if (!f)
+        return 0;
+
+    for (unsigned long i = 0; i < stats.trace_len; i++)
+    {
+        const halo_trace_entry_t* e = &trace[i];
+        fprintf(f, "%llu %llu %c 0x%08X 0x%08X\n",
+                e->cycle, e->cycle / cfg.cpu_mhz, e->op, e->addr, e->value);
+    }
+
+    fclose(f);
+    return 1;
+}
@@ -0,0 +1,91 @@
+#ifndef HALO_HOST_H
+#define HALO_HOST_H
+
+/**
+ * @file    halo_host.h
+ * @brief   Host-side HALO virtual-MCU model: configuration, run control,
+ *          statistics and register-access trace.
+ */
+
+#include <stdio.h>
+
+// Peripheral blocks modelled by the host (used to break down statistics)
+enum
+{
+    HALO_HOST_GPIO0 = 0,    // 0x40000000, LED matrix rows
+    HALO_HOST_GPIO1,        // 0x40000400, LED matrix columns
+    HALO_HOST_FEEDBACK,     // 0x40001000, servo angle feedback (read-only)
+    HALO_HOST_TIMER,        // 0x40002000, microsecond counter + periodic tick
+    HALO_HOST_PWM,          // 0x40004000, 8 PWM channels + COMMIT
+    HALO_HOST_OTHER,        // anything else inside the peripheral window
+    HALO_HOST_BLOCKS
+};
+
+typedef struct
+{
+    unsigned int       cpu_mhz;         // simulated core clock
+    unsigned int       access_cycles;   // cost of one register access (VM trap)
+    unsigned long long sim_limit_us;    // stop after this much simulated time (0 = run forever)
+    unsigned long      trace_limit;     // trace entries kept (0 = tracing off)
+    float              servo_deg_per_s; // servo slew rate behind the feedback registers
+    unsigned int       burst_cycles;    // cost of each write after the first in a burst
+} halo_host_config_t;
+
+#define HALO_HOST_CONFIG_DEFAULT { 48, 4, 1000000ull, 0, 600.0f, 1 }
+
+// One register access, timestamped in simulated CPU cycles
+typedef struct
+{
+    unsigned long long cycle;
+    unsigned int       addr;
+    unsigned int       value;
+    char               op;              // 'W' or 'R'
+} halo_trace_entry_t;
+
+typedef struct
+{
+    unsigned long long writes;
+    unsigned long long reads;
+    unsigned long long delays;
+    unsigned long long traps;           // VM entries: single accesses plus bursts
+    unsigned long long bursts;          // WRITE_REGISTERS / WRITE_REGISTERS_STRIDED calls
+    unsigned long long bad_accesses;    // accesses outside the modelled window
+    unsigned long long cycles;          // simulated CPU cycles
+    unsigned long long irqs;            // TIMER_IRQHandler invocations
+    unsigned long long irq_cycles;      // cycles spent inside interrupt handlers
+    unsigned long long pwm_latches;     // PWM COMMIT latches (SHADOW -> DUTY)
+    unsigned long long stream_pops;     // PWM FIFO entries loaded into DUTY
+    unsigned long long stream_underruns;// period boundaries with an empty FIFO
+    unsigned long long block_writes[HALO_HOST_BLOCKS];
+    double             wall_s;          // host time spent inside halo_host_run()
+    unsigned long      trace_len;
+    unsigned long      trace_dropped;   // accesses past trace_limit
+} halo_host_stats_t;
+
+/**
+ * @brief Resets the model (registers, clock, statistics, trace).
+ */
+void halo_host_init(const halo_host_config_t* cfg);
+
+/**
+ * @brief Runs a firmware entry point until it returns or hits sim_limit_us.
+ * @return 1 if stopped by the simulated-time limit, 0 if entry returned
+ */
+int halo_host_run(void (*entry)(void));
+
+const halo_host_stats_t*  halo_host_stats(void);
+const halo_trace_entry_t* halo_host_trace(void);
+
+// Simulated time since halo_host_init()
+unsigned long long halo_host_time_us(void);
+
+// Reads a register without tracing or charging cycles
+unsigned int halo_host_peek(unsigned int addr);
+
+// Prints the benchmark summary
+void halo_host_report(FILE* f);
+
+// Writes the trace as text, one access per line: cycle time_us op addr value
+int halo_host_write_trace(const char* path);
+
+#endif // HALO_HOST_H
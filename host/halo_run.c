@@ -0,0 +1,81 @@
+/**
+ * @file    halo_run.c
+ * @brief   Host runner: links against any example's fw_main, runs it on the
+ *          virtual-MCU model and prints the benchmark summary.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * Options:
+ * - --sim-ms N          stop after N ms of simulated time (default 1000)
+ * - --mhz N             simulated core clock (default 48)
+ * - --access-cycles N   cycles charged per register access (default 4)
+ * - --servo-rate N      servo slew rate in deg/s (default 600)
+ * - --burst-cycles N    cycles per extra write in a register burst (default 1)
+ * - --trace FILE        write the register-access trace to FILE
+ * - --trace-limit N     max trace entries kept (default 1000000)
+ */
+
+#include "halo_host.h"
+#include <stdlib.h>
+#include <string.h>
+
+void fw_main(void);
+
+static void usage(const char* prog)
+{
+    fprintf(stderr,
+            "usage: %s [--sim-ms N] [--mhz N] [--access-cycles N] [--servo-rate N]\n"
+            "          [--burst-cycles N] [--trace FILE] [--trace-limit N]\n", prog);
+}
+
+int main(int argc, char** argv)
+{
+    halo_host_config_t cfg = HALO_HOST_CONFIG_DEFAULT;
+    const char* trace_path = 0;
+    unsigned long trace_limit = 1000000ul;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char* arg = argv[i];
+        const char* val = (i + 1 < argc) ? argv[i + 1] : 0;
+
+        if (!val)
+        {
+            usage(argv[0]);
+            return 2;
+        }
+
+        if      (!strcmp(arg, "--sim-ms"))        cfg.sim_limit_us    = strtoull(val, 0, 0) * 1000ull;
+        else if (!strcmp(arg, "--mhz"))           cfg.cpu_mhz         = (unsigned int)strtoul(val, 0, 0);
+        else if (!strcmp(arg, "--access-cycles")) cfg.access_cycles   = (unsigned int)strtoul(val, 0, 0);
+        else if (!strcmp(arg, "--servo-rate"))    cfg.servo_deg_per_s = strtof(val, 0);
+        else if (!strcmp(arg, "--burst-cycles"))  cfg.burst_cycles    = (unsigned int)strtoul(val, 0, 0);
+        else if (!strcmp(arg, "--trace"))         trace_path          = val;
+        else if (!strcmp(arg, "--trace-limit"))   trace_limit         = strtoul(val, 0, 0);
+        else
+        {
+            usage(argv[0]);
+            return 2;
+        }
+        i++;
+    }
+
+    if (trace_path)
+        cfg.trace_limit = trace_limit;
+
+    halo_host_init(&cfg);
+    int stopped = halo_host_run(fw_main);
+
+    printf("fw_main       : %s\n", stopped ? "stopped at sim limit" : "returned");
+    halo_host_report(stdout);
+
+    if (trace_path && !halo_host_write_trace(trace_path))
+    {
+        fprintf(stderr, "cannot write trace to %s\n", trace_path);
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,151 @@
+/**
+ * @file    halo_curve.c
+ * @brief   Forward-differencing evaluator for cubic Bezier chains.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * For B(t) = a t^3 + b t^2 + c t + P0 and a step h = 1/n:
+ * - d1 = a h^3 + b h^2 + c h
+ * - d2 = 6 a h^3 + 2 b h^2
+ * - d3 = 6 a h^3
+ * and each step is p += d1; d1 += d2; d2 += d3.
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_curve.h"
+#include <math.h>
+
+static float dist(float ax, float ay, float bx, float by)
+{
+    float dx = bx - ax;
+    float dy = by - ay;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+// Steps for segment i starting at (px, py): length ~ (chord + polygon) / 2
+static int segment_steps(const short* c, float px, float py, float spacing)
+{
+    float x1 = c[0] * HALO_CURVE_UNIT_CM, y1 = c[1] * HALO_CURVE_UNIT_CM;
+    float x2 = c[2] * HALO_CURVE_UNIT_CM, y2 = c[3] * HALO_CURVE_UNIT_CM;
+    float x3 = c[4] * HALO_CURVE_UNIT_CM, y3 = c[5] * HALO_CURVE_UNIT_CM;
+
+    float poly  = dist(px, py, x1, y1) + dist(x1, y1, x2, y2) + dist(x2, y2, x3, y3);
+    float chord = dist(px, py, x3, y3);
+    float len   = 0.5f * (poly + chord);
+
+    int n = (int)(len / spacing);
+    if ((float)n * spacing < len)
+        n++;
+    return (n > 0) ? n : 1;
+}
+
+// Sets up the differences for the next segment from the current point
+static void setup_segment(halo_curve_reader_t* r)
+{
+    const short* c = r->curve->ctrl[r->seg++];
+    int n = segment_steps(c, r->x, r->y, r->spacing);
+
+    float p0x = r->x, p0y = r->y;
+    float p1x = c[0] * HALO_CURVE_UNIT_CM, p1y = c[1] * HALO_CURVE_UNIT_CM;
+    float p2x = c[2] * HALO_CURVE_UNIT_CM, p2y = c[3] * HALO_CURVE_UNIT_CM;
+    float p3x = c[4] * HALO_CURVE_UNIT_CM, p3y = c[5] * HALO_CURVE_UNIT_CM;
+
+    // Power basis
+    float ax = p3x - 3.0f * p2x + 3.0f * p1x - p0x;
+    float ay = p3y - 3.0f * p2y + 3.0f * p1y - p0y;
+    float bx = 3.0f * (p2x - 2.0f * p1x + p0x);
+    float by = 3.0f * (p2y - 2.0f * p1y + p0y);
+    float cx = 3.0f * (p1x - p0x);
+    float cy = 3.0f * (p1y - p0y);
+
+    float h  = 1.0f / (float)n;
+    float h2 = h * h;
+    float h3 = h2 * h;
+
+    r->dx   = ax * h3 + bx * h2 + cx * h;
+    r->dy   = ay * h3 + by * h2 + cy * h;
+    r->ddx  = 6.0f * ax * h3 + 2.0f * bx * h2;
+    r->ddy  = 6.0f * ay * h3 + 2.0f * by * h2;
+    r->dddx = 6.0f * ax * h3;
+    r->dddy = 6.0f * ay * h3;
+    r->ex   = p3x;
+    r->ey   = p3y;
+    r->left = n;
+}
+
+// ---------- Reader ----------
+
+void halo_curve_begin(halo_curve_reader_t* r, const halo_curve_t* curve, float spacing_cm)
+{
+    r->curve   = curve;
+    r->spacing = spacing_cm;
+    r->seg     = 0;
+    r->left    = 0;
+    r->started = 0;
+    r->x       = curve->x0 * HALO_CURVE_UNIT_CM;
+    r->y       = curve->y0 * HALO_CURVE_UNIT_CM;
+}
+
+int halo_curve_next(halo_curve_reader_t* r, float* x_cm, float* y_cm)
+{
+    if (!r->started)
+    {
+        r->started = 1;
+    }
+    else
+    {
+        if (r->left == 0)
+        {
+            if (r->seg >= r->curve->count)
+                return 0;
+            setup_segment(r);
+        }
+
+        if (--r->left == 0)
+        {
+            // Land exactly on the stored end point
+            r->x = r->ex;
+            r->y = r->ey;
+        }
+        else
+        {
+            r->x   += r->dx;
+            r->y   += r->dy;
+            r->dx  += r->ddx;
+            r->dy  += r->ddy;
+            r->ddx += r->dddx;
+            r->ddy += r->dddy;
+        }
+    }
+
+    *x_cm = r->x;
+    *y_cm = r->y;
+    return 1;
+}
+
+int halo_curve_segment(const halo_curve_reader_t* r)
+{
+    // r->seg is the next segment to set up, one past the current one
+    return (r->seg > 0) ? r->seg - 1 : 0;
+}
+
+int halo_curve_count(const halo_curve_t* curve, float spacing_cm)
+{
+    float px = curve->x0 * HALO_CURVE_UNIT_CM;
+    float py = curve->y0 * HALO_CURVE_UNIT_CM;
+    int   n  = 1;
+
+    for (int i = 0; i < curve->count; i++)
+    {
+        const short* c = curve->ctrl[i];
+        n += segment_steps(c, px, py, spacing_cm);
+        px = c[4] * HALO_CURVE_UNIT_CM;
+        py = c[5] * HALO_CURVE_UNIT_CM;
+    }
+
+    return n;
+}
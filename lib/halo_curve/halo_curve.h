@@ -0,0 +1,85 @@
+#ifndef HALO_CURVE_H
+#define HALO_CURVE_H
+
+/**
+ * @file    halo_curve.h
+ * @brief   Paths stored as chains of cubic Bezier segments, evaluated by
+ *          forward differencing at a spacing chosen at run time.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * Table format (emitted by halo_pattern.py):
+ * - Start point in the halo_curve_t header (x0, y0)
+ * - Per segment: { x1, y1, x2, y2, x3, y3 }, int16 in 0.01 cm
+ *   (HALO_CURVE_UNIT_CM); P0 is the end of the previous segment
+ * - 12 bytes per segment; a fitted outline needs a few hundred segments
+ *   where a point table needs thousands of points
+ *
+ * The reader splits each segment into ceil(length / spacing) steps, with
+ * the length estimated from the control polygon. Setting up a segment
+ * costs a few multiplies and four square roots; every point after that
+ * is three vector adds:
+ * @code
+ * halo_curve_reader_t r;
+ * halo_curve_begin(&r, &clover_curve, 0.1f);   // one point per 0.1 cm
+ * while (halo_curve_next(&r, &x, &y)) {
+ *     ... solve and write (x, y) ...
+ * }
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Each segment ends exactly on its stored end point, so round-off does
+ *   not build up along the chain
+ * - Steps are uniform in the curve parameter, not in length: on the
+ *   fitted outlines most steps land within 0.65x - 1.15x of the spacing.
+ *   Use a halo_path table where the tool speed must be exactly constant
+ */
+
+#define HALO_CURVE_UNIT_CM 0.01f
+
+typedef struct
+{
+    const short (*ctrl)[6];     // per segment: x1, y1, x2, y2, x3, y3
+    int   count;                // number of segments
+    short x0;                   // start point, 0.01 cm
+    short y0;
+} halo_curve_t;
+
+// Forward-differencing reader state
+typedef struct
+{
+    const halo_curve_t* curve;
+    float spacing;              // target step (cm)
+    int   seg;                  // next segment to set up
+    int   left;                 // steps left in the current segment
+    int   started;              // start point returned
+    float x, y;                 // last point (cm)
+    float dx, dy;               // first difference
+    float ddx, ddy;             // second difference
+    float dddx, dddy;           // third difference (constant per segment)
+    float ex, ey;               // end of the current segment
+} halo_curve_reader_t;
+
+/**
+ * @brief Rewinds the reader to the start point.
+ *
+ * @param spacing_cm  Target distance between points (> 0)
+ */
+void halo_curve_begin(halo_curve_reader_t* r, const halo_curve_t* curve, float spacing_cm);
+
+/**
+ * @brief Returns the next point in cm.
+ * @return 1 if a point was returned, 0 at the end of the curve
+ */
+int halo_curve_next(halo_curve_reader_t* r, float* x_cm, float* y_cm);
+
+// Segment the last point returned belongs to (the start point is in segment 0)
+int halo_curve_segment(const halo_curve_reader_t* r);
+
+// Total points halo_curve_next() returns at this spacing (one pass of setup)
+int halo_curve_count(const halo_curve_t* curve, float spacing_cm);
+
+#endif // HALO_CURVE_H
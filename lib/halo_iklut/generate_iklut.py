@@ -0,0 +1,212 @@
+"""
+@file    generate_iklut.py
+@brief   Generates the workspace IK lookup table for lib/halo_iklut.
+
+@author  Adithya
+@date    2026-10-17
+
+@details
+- Samples the closed-form IK on a square grid over the part of the
+  workspace where both joints land in the 0-180 deg servo window
+- Stores { theta1, theta2 } per grid node as int16 centidegrees
+- Checks every cell against the exact IK on an 8x8 sub-grid, including the
+  centidegree rounding, and keeps only cells whose bilinear blend stays
+  within --tol; the firmware falls back to the exact solver elsewhere
+- Reports the worst-case angular error and the workspace coverage
+
+Usage:
+    python3 generate_iklut.py [--step 0.5] [--tol 0.18] [--elbow-up]
+    python3 generate_iklut.py --sweep     (error / size for several steps)
+"""
+
+import os
+import argparse
+import numpy as np
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+
+# --- Arm model (must match the firmware) ---
+L1 = 10.0
+L2 = 10.0
+SERVO_RANGE_DEG = 180.0
+
+UNITS_PER_DEG = 100     # int16 centidegrees, must match HALO_IKLUT_UNIT_DEG
+SUB = 8                 # error check sub-grid per cell edge
+
+
+def solve_ik(x, y, elbow_up):
+    """Closed-form IK (same equations as halo_ik_solve). Returns (t1, t2, ok) in degrees."""
+    r2 = x * x + y * y
+    ok = (r2 <= (L1 + L2) ** 2) & (r2 >= (L1 - L2) ** 2)
+    c2 = np.clip((r2 - L1 * L1 - L2 * L2) / (2.0 * L1 * L2), -1.0, 1.0)
+    t2 = np.arccos(c2)
+    if elbow_up:
+        t2 = -t2
+    t1 = np.arctan2(y, x) - np.arctan2(L2 * np.sin(t2), L1 + L2 * c2)
+
+    # No wrapping: the table must agree with the raw angles of the firmware
+    # solver, and its jump on the -x axis lies outside the servo window
+    return np.degrees(t1), np.degrees(t2), ok
+
+
+def in_window(t1, t2, ok):
+    return ok & (t1 >= 0.0) & (t1 <= SERVO_RANGE_DEG) & (t2 >= 0.0) & (t2 <= SERVO_RANGE_DEG)
+
+
+def build(step, tol, elbow_up):
+    """
+    Returns a dict with the cropped grid, the int16 node table, the cell
+    bitmap and the error statistics.
+    """
+    reach = L1 + L2
+    n = int(np.ceil(2.0 * reach / step)) + 1
+    x0 = -reach
+    y0 = -reach
+    gx = x0 + step * np.arange(n)
+    gy = y0 + step * np.arange(n)
+    X, Y = np.meshgrid(gx, gy)          # [iy, ix]
+
+    t1, t2, ok = solve_ik(X, Y, elbow_up)
+    node_ok = in_window(t1, t2, ok)
+    # Nodes outside the window only border invalid cells; clip them to int16
+    q1 = np.clip(np.round(t1 * UNITS_PER_DEG), -32768, 32767)
+    q2 = np.clip(np.round(t2 * UNITS_PER_DEG), -32768, 32767)
+
+    # Check every candidate cell on a SUB x SUB grid (edges included)
+    f = np.linspace(0.0, 1.0, SUB + 1)
+    FX, FY = np.meshgrid(f, f)
+    cell_ok = np.zeros((n - 1, n - 1), dtype=bool)
+    cell_err = np.zeros((n - 1, n - 1))
+    for iy in range(n - 1):
+        for ix in range(n - 1):
+            if not (node_ok[iy, ix] and node_ok[iy, ix + 1] and
+                    node_ok[iy + 1, ix] and node_ok[iy + 1, ix + 1]):
+                continue
+            sx = gx[ix] + FX * step
+            sy = gy[iy] + FY * step
+            e1, e2, eok = solve_ik(sx, sy, elbow_up)
+            if not np.all(in_window(e1, e2, eok)):
+                continue
+
+            def blend(q):
+                a = q[iy, ix] + FX * (q[iy, ix + 1] - q[iy, ix])
+                b = q[iy + 1, ix] + FX * (q[iy + 1, ix + 1] - q[iy + 1, ix])
+                return (a + FY * (b - a)) / UNITS_PER_DEG
+
+            err = max(np.max(np.abs(blend(q1) - e1)), np.max(np.abs(blend(q2) - e2)))
+            cell_err[iy, ix] = err
+            cell_ok[iy, ix] = err <= tol
+
+    if not np.any(cell_ok):
+        raise ValueError("no cell meets the tolerance; use a smaller step")
+
+    # Crop to the bounding box of the valid cells
+    rows = np.where(np.any(cell_ok, axis=1))[0]
+    cols = np.where(np.any(cell_ok, axis=0))[0]
+    cy0, cy1 = rows[0], rows[-1] + 1
+    cx0, cx1 = cols[0], cols[-1] + 1
+
+    # Coverage: share of the servo-window workspace served by the table
+    fine = 0.05
+    fx = np.arange(-reach, reach, fine) + fine / 2
+    FXX, FYY = np.meshgrid(fx, fx)
+    w1, w2, wok = solve_ik(FXX, FYY, elbow_up)
+    inside = in_window(w1, w2, wok)
+    cix = np.floor((FXX - x0) / step).astype(int)
+    ciy = np.floor((FYY - y0) / step).astype(int)
+    served = inside & cell_ok[np.clip(ciy, 0, n - 2), np.clip(cix, 0, n - 2)]
+
+    return {
+        "step": step,
+        "elbow_up": elbow_up,
+        "x0": gx[cx0],
+        "y0": gy[cy0],
+        "nx": cx1 - cx0 + 1,
+        "ny": cy1 - cy0 + 1,
+        "q1": q1[cy0:cy1 + 1, cx0:cx1 + 1].astype(np.int64),
+        "q2": q2[cy0:cy1 + 1, cx0:cx1 + 1].astype(np.int64),
+        "cells": cell_ok[cy0:cy1, cx0:cx1],
+        "max_err": float(np.max(cell_err[cell_ok])),
+        "coverage": float(np.count_nonzero(served)) / float(np.count_nonzero(inside)),
+    }
+
+
+def table_bytes(t):
+    ncells = (t["nx"] - 1) * (t["ny"] - 1)
+    return t["nx"] * t["ny"] * 4 + (ncells + 7) // 8
+
+
+def write_table(out_dir, name, t):
+    """Writes <name>.c / <name>.h with a const halo_iklut_t."""
+    guard = f"{name.upper()}_H"
+    nx, ny = t["nx"], t["ny"]
+
+    cells = t["cells"].reshape(-1)
+    bitmap = np.zeros((len(cells) + 7) // 8, dtype=np.int64)
+    for i in np.nonzero(cells)[0]:
+        bitmap[i >> 3] |= 1 << (i & 7)
+
+    with open(os.path.join(out_dir, f"{name}.h"), "w") as f:
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n")
+        f.write("#include \"halo_iklut.h\"\n\n")
+        f.write(f"// {'Elbow-up' if t['elbow_up'] else 'Elbow-down'} IK table for the L1 = {L1:g}, "
+                f"L2 = {L2:g} arm, {t['step']:g} cm grid,\n")
+        f.write(f"// |err| <= {t['max_err']:.3f} deg over {100.0 * t['coverage']:.1f}% "
+                f"of the servo-window workspace\n")
+        f.write(f"extern const halo_iklut_t {name};\n\n")
+        f.write(f"#endif // {guard}\n")
+
+    with open(os.path.join(out_dir, f"{name}.c"), "w") as f:
+        f.write(f"#include \"{name}.h\"\n\n")
+        f.write("// ----------------------------\n")
+        f.write(f"// Generated by generate_iklut.py --step {t['step']:g}"
+                f"{' --elbow-up' if t['elbow_up'] else ''} (do not edit)\n")
+        f.write("// ----------------------------\n\n")
+        f.write(f"static const short {name}_theta[{nx * ny}][2] = {{\n")
+        for iy in range(ny):
+            f.write(f"    // y = {t['y0'] + iy * t['step']:g}\n")
+            row = [f"{{ {t['q1'][iy, ix]}, {t['q2'][iy, ix]} }}" for ix in range(nx)]
+            for i in range(0, nx, 6):
+                f.write("    " + ", ".join(row[i:i + 6]) + ",\n")
+        f.write("};\n\n")
+        f.write(f"static const unsigned char {name}_cells[{len(bitmap)}] = {{\n")
+        for i in range(0, len(bitmap), 16):
+            f.write("    " + ", ".join(f"0x{b:02X}" for b in bitmap[i:i + 16]) + ",\n")
+        f.write("};\n\n")
+        f.write(f"const halo_iklut_t {name} = {{\n")
+        f.write(f"    {name}_theta, {name}_cells, {nx}, {ny},\n")
+        f.write(f"    {t['x0']:.4f}f, {t['y0']:.4f}f, {1.0 / t['step']:.6f}f, "
+                f"{int(t['elbow_up'])}, {t['max_err']:.4f}f\n")
+        f.write("};\n")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n")[2].strip())
+    ap.add_argument("--step", type=float, default=0.5, help="grid step in cm")
+    ap.add_argument("--tol", type=float, default=0.18,
+                    help="max bilinear error per cell in deg (0.18 = one servo microsecond)")
+    ap.add_argument("--elbow-up", action="store_true")
+    ap.add_argument("--name", default="halo_iklut_2dof")
+    ap.add_argument("--sweep", action="store_true", help="report several steps, write nothing")
+    args = ap.parse_args()
+
+    if args.sweep:
+        print(f"tolerance {args.tol:g} deg")
+        print(" step cm   max err deg   coverage   bytes")
+        for step in (2.0, 1.0, 0.5, 0.25):
+            try:
+                t = build(step, args.tol, args.elbow_up)
+            except ValueError:
+                print(f"  {step:5.2f}      no cell within tolerance")
+                continue
+            print(f"  {step:5.2f}      {t['max_err']:.4f}     {100.0 * t['coverage']:5.1f}%   {table_bytes(t):6d}")
+        return
+
+    t = build(args.step, args.tol, args.elbow_up)
+    write_table(SCRIPT_DIR, args.name, t)
+    print(f"Saved {args.name}.c: {t['nx']}x{t['ny']} nodes, {table_bytes(t)} bytes, "
+          f"|err| <= {t['max_err']:.4f} deg, {100.0 * t['coverage']:.1f}% coverage")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,91 @@
+/**
+ * @file    halo_iklut.c
+ * @brief   Bilinear lookup in a generated workspace IK table.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - The cell index comes from one multiply per axis (inv_step), so a
+ *   lookup never divides
+ * - Out-of-table and invalid cells fall back to the exact solver, so the
+ *   results match halo_ik_solve() to within the table's max_err_deg plus
+ *   the solver's own 0.004°
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_iklut.h"
+
+// ---------- Lookup ----------
+
+int halo_iklut_lookup(const halo_iklut_t* lut, float x, float y,
+                      float* theta1_deg, float* theta2_deg)
+{
+    float gx = (x - lut->x0) * lut->inv_step;
+    float gy = (y - lut->y0) * lut->inv_step;
+
+    // Written so that NaN also fails
+    if (!(gx >= 0.0f && gy >= 0.0f))
+        return 0;
+
+    int ix = (int)gx;
+    int iy = (int)gy;
+    if (ix >= lut->nx - 1 || iy >= lut->ny - 1)
+        return 0;
+
+    int cell = iy * (lut->nx - 1) + ix;
+    if (!((lut->cells[cell >> 3] >> (cell & 7)) & 1))
+        return 0;
+
+    float fx = gx - (float)ix;
+    float fy = gy - (float)iy;
+
+    const short* p00 = lut->theta[iy * lut->nx + ix];
+    const short* p10 = p00 + 2;
+    const short* p01 = lut->theta[(iy + 1) * lut->nx + ix];
+    const short* p11 = p01 + 2;
+
+    for (int j = 0; j < 2; j++)
+    {
+        float a = p00[j] + fx * (float)(p10[j] - p00[j]);
+        float b = p01[j] + fx * (float)(p11[j] - p01[j]);
+        float t = (a + fy * (b - a)) * HALO_IKLUT_UNIT_DEG;
+
+        if (j == 0) *theta1_deg = t;
+        else        *theta2_deg = t;
+    }
+
+    return 1;
+}
+
+// ---------- Solve with fallback ----------
+
+int halo_iklut_solve(const halo_iklut_t* lut, const halo_arm_t* arm,
+                     float x, float y, int elbow_up,
+                     float* theta1_deg, float* theta2_deg)
+{
+    if (elbow_up == lut->elbow_up && halo_iklut_lookup(lut, x, y, theta1_deg, theta2_deg))
+        return 1;
+
+    return halo_ik_solve(arm, x, y, elbow_up, theta1_deg, theta2_deg);
+}
+
+int halo_iklut_solve_batch(const halo_iklut_t* lut, const halo_arm_t* arm,
+                           const float (*xy)[2], float (*theta_deg)[2],
+                           unsigned char* reachable, int n, int elbow_up)
+{
+    int count = 0;
+
+    for (int i = 0; i < n; i++)
+    {
+        int ok = halo_iklut_solve(lut, arm, xy[i][0], xy[i][1], elbow_up,
+                                  &theta_deg[i][0], &theta_deg[i][1]);
+        if (reachable)
+            reachable[i] = (unsigned char)ok;
+        count += ok;
+    }
+
+    return count;
+}
@@ -0,0 +1,77 @@
+#ifndef HALO_IKLUT_H
+#define HALO_IKLUT_H
+
+/**
+ * @file    halo_iklut.h
+ * @brief   Workspace lookup-table IK with bilinear interpolation.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - generate_iklut.py samples the exact IK on a square Cartesian grid and
+ *   stores { theta1, theta2 } per node as int16 centidegrees
+ * - A query is two index computations, four node loads per joint and a
+ *   bilinear blend: no trig, no sqrt, no division, constant time
+ * - Every cell was checked against the exact solver at generation time;
+ *   cells whose blend exceeds the tolerance, or that leave the 0-180°
+ *   servo window, are marked invalid and the query falls back to
+ *   halo_ik_solve() there (near full stretch and around the base, where
+ *   the IK is too curved for a bilinear blend)
+ *
+ * Resolutions for the L1 = L2 = 10 arm, elbow-down, tolerance 0.18° (one
+ * servo microsecond); regenerate with --step / --tol, see --sweep:
+ * - 1.0 cm  : |err| <= 0.175°, 45% of the servo-window workspace,  1.8 KB
+ * - 0.5 cm  : |err| <= 0.177°, 80%,                               11.1 KB
+ * - 0.25 cm : |err| <= 0.180°, 92%,                               49.8 KB
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - halo_iklut_2dof.c is generated (0.5 cm, elbow-down); do not edit
+ */
+
+#include "halo_kinematics.h"
+
+#define HALO_IKLUT_UNIT_DEG 0.01f   // node angle unit
+
+typedef struct
+{
+    const short (*theta)[2];        // [ny * nx] { theta1, theta2 }, row-major in y
+    const unsigned char* cells;     // valid-cell bitmap, (nx - 1) * (ny - 1) bits
+    short nx;                       // nodes along x
+    short ny;                       // nodes along y
+    float x0;                       // grid origin, cm
+    float y0;
+    float inv_step;                 // 1 / grid step, 1/cm
+    int   elbow_up;                 // branch the table was solved for
+    float max_err_deg;              // worst blend error of the valid cells
+} halo_iklut_t;
+
+/**
+ * @brief Looks up the joint angles of (x, y) in the table.
+ *
+ * @return 1 if (x, y) falls in a valid cell, 0 otherwise (outputs untouched)
+ */
+int halo_iklut_lookup(const halo_iklut_t* lut, float x, float y,
+                      float* theta1_deg, float* theta2_deg);
+
+/**
+ * @brief Drop-in for halo_ik_solve(): table lookup where the table is
+ *        valid for the requested branch, exact solve everywhere else.
+ *
+ * @return 1 if reachable, 0 otherwise
+ */
+int halo_iklut_solve(const halo_iklut_t* lut, const halo_arm_t* arm,
+                     float x, float y, int elbow_up,
+                     float* theta1_deg, float* theta2_deg);
+
+/**
+ * @brief Drop-in for halo_ik_solve_batch() with the same table fallback.
+ *
+ * @return Number of reachable points
+ */
+int halo_iklut_solve_batch(const halo_iklut_t* lut, const halo_arm_t* arm,
+                           const float (*xy)[2], float (*theta_deg)[2],
+                           unsigned char* reachable, int n, int elbow_up);
+
+#endif // HALO_IKLUT_H
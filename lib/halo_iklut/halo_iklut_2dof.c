@@ -0,0 +1,531 @@
+#include "halo_iklut_2dof.h"
+
+// ----------------------------
+// Generated by generate_iklut.py --step 0.5 (do not edit)
+// ----------------------------
+
+static const short halo_iklut_2dof_theta[2698][2] = {
+    // y = 0
+    { 15767, 4466 }, { 15416, 5168 }, { 15104, 5791 }, { 14821, 6358 }, { 14559, 6882 }, { 14313, 7374 },
+    { 14081, 7839 }, { 13859, 8282 }, { 13647, 8706 }, { 13443, 9115 }, { 13245, 9509 }, { 13054, 9892 },
+    { 12868, 10264 }, { 12687, 10626 }, { 12510, 10980 }, { 12337, 11327 }, { 12167, 11666 }, { 12000, 12000 },
+    { 11836, 12328 }, { 11674, 12651 }, { 11515, 12970 }, { 11358, 13284 }, { 11202, 13595 }, { 11049, 13903 },
+    { 10897, 14207 }, { 10746, 14508 }, { 10596, 14808 }, { 10448, 15104 }, { 10300, 15399 }, { 10154, 15693 },
+    { 10008, 15984 }, { 9863, 16275 }, { 9718, 16564 }, { 9574, 16852 }, { 9430, 17140 }, { 9287, 17427 },
+    { 9143, 17713 }, { -9000, 18000 }, { -8857, 17713 }, { -8713, 17427 }, { -8570, 17140 }, { -8426, 16852 },
+    { -8282, 16564 }, { -8137, 16275 }, { -7992, 15984 }, { -7846, 15693 }, { -7700, 15399 }, { -7552, 15104 },
+    { -7404, 14808 }, { -7254, 14508 }, { -7103, 14207 }, { -6951, 13903 }, { -6798, 13595 }, { -6642, 13284 },
+    { -6485, 12970 }, { -6326, 12651 }, { -6164, 12328 }, { -6000, 12000 }, { -5833, 11666 }, { -5663, 11327 },
+    { -5490, 10980 }, { -5313, 10626 }, { -5132, 10264 }, { -4946, 9892 }, { -4755, 9509 }, { -4557, 9115 },
+    { -4353, 8706 }, { -4141, 8282 }, { -3919, 7839 }, { -3687, 7374 }, { -3441, 6882 },
+    // y = 0.5
+    { 15617, 4456 }, { 15261, 5159 }, { 14945, 5783 }, { 14657, 6350 }, { 14389, 6875 }, { 14138, 7367 },
+    { 13899, 7832 }, { 13672, 8275 }, { 13453, 8699 }, { 13242, 9107 }, { 13037, 9502 }, { 12838, 9884 },
+    { 12643, 10256 }, { 12452, 10619 }, { 12265, 10972 }, { 12080, 11319 }, { 11898, 11658 }, { 11718, 11992 },
+    { 11539, 12320 }, { 11361, 12642 }, { 11183, 12961 }, { 11005, 13275 }, { 10826, 13585 }, { 10646, 13892 },
+    { 10463, 14195 }, { 10276, 14496 }, { 10084, 14794 }, { 9884, 15090 }, { 9674, 15383 }, { 9450, 15674 },
+    { 9205, 15964 }, { 8928, 16251 }, { 8601, 16535 }, { 8188, 16817 }, { 7610, 17093 }, { 6664, 17359 },
+    { 4703, 17595 }, { 143, 17713 }, { -4297, 17595 }, { -6023, 17359 }, { -6703, 17093 }, { -7005, 16817 },
+    { -7137, 16535 }, { -7179, 16251 }, { -7169, 15964 }, { -7125, 15674 }, { -7058, 15383 }, { -6974, 15090 },
+    { -6878, 14794 }, { -6772, 14496 }, { -6658, 14195 }, { -6537, 13892 }, { -6411, 13585 }, { -6280, 13275 },
+    { -6144, 12961 }, { -6003, 12642 }, { -5859, 12320 }, { -5710, 11992 }, { -5557, 11658 }, { -5399, 11319 },
+    { -5237, 10972 }, { -5071, 10619 }, { -4899, 10256 }, { -4722, 9884 }, { -4539, 9502 }, { -4349, 9107 },
+    { -4152, 8699 }, { -3946, 8275 }, { -3731, 7832 }, { -3504, 7367 }, { -3264, 6875 },
+    // y = 1
+    { 15478, 4425 }, { 15116, 5132 }, { 14794, 5757 }, { 14501, 6326 }, { 14227, 6852 }, { 13970, 7344 },
+    { 13726, 7810 }, { 13492, 8253 }, { 13267, 8678 }, { 13048, 9086 }, { 12836, 9480 }, { 12629, 9863 },
+    { 12425, 10234 }, { 12226, 10596 }, { 12028, 10950 }, { 11833, 11295 }, { 11639, 11634 }, { 11445, 11967 },
+    { 11252, 12294 }, { 11058, 12616 }, { 10863, 12933 }, { 10665, 13245 }, { 10463, 13554 }, { 10257, 13859 },
+    { 10045, 14161 }, { 9824, 14459 }, { 9593, 14754 }, { 9346, 15046 }, { 9080, 15335 }, { 8786, 15621 },
+    { 8454, 15903 }, { 8066, 16181 }, { 7594, 16453 }, { 6985, 16716 }, { 6148, 16966 }, { 4905, 17189 },
+    { 2977, 17359 }, { 287, 17427 }, { -2336, 17359 }, { -4095, 17189 }, { -5114, 16966 }, { -5702, 16716 },
+    { -6046, 16453 }, { -6247, 16181 }, { -6357, 15903 }, { -6407, 15621 }, { -6415, 15335 }, { -6392, 15046 },
+    { -6346, 14754 }, { -6283, 14459 }, { -6206, 14161 }, { -6117, 13859 }, { -6018, 13554 }, { -5910, 13245 },
+    { -5795, 12933 }, { -5674, 12616 }, { -5546, 12294 }, { -5412, 11967 }, { -5273, 11634 }, { -5128, 11295 },
+    { -4978, 10950 }, { -4822, 10596 }, { -4660, 10234 }, { -4491, 9863 }, { -4317, 9480 }, { -4134, 9086 },
+    { -3944, 8678 }, { -3745, 8253 }, { -3536, 7810 }, { -3314, 7344 }, { -3079, 6852 },
+    // y = 1.5
+    { 15350, 4374 }, { 14981, 5086 }, { 14653, 5715 }, { 14353, 6285 }, { 14074, 6813 }, { 13811, 7307 },
+    { 13561, 7773 }, { 13320, 8217 }, { 13089, 8642 }, { 12863, 9050 }, { 12644, 9444 }, { 12429, 9826 },
+    { 12217, 10198 }, { 12008, 10559 }, { 11801, 10912 }, { 11595, 11257 }, { 11390, 11594 }, { 11184, 11926 },
+    { 10977, 12251 }, { 10768, 12571 }, { 10556, 12887 }, { 10340, 13197 }, { 10117, 13503 }, { 9888, 13805 },
+    { 9649, 14103 }, { 9398, 14397 }, { 9131, 14688 }, { 8843, 14974 }, { 8528, 15256 }, { 8178, 15533 },
+    { 7778, 15805 }, { 7309, 16069 }, { 6742, 16324 }, { 6031, 16564 }, { 5109, 16782 }, { 3886, 16966 },
+    { 2297, 17093 }, { 430, 17140 }, { -1390, 17093 }, { -2852, 16966 }, { -3891, 16782 }, { -4595, 16564 },
+    { -5065, 16324 }, { -5378, 16069 }, { -5583, 15805 }, { -5711, 15533 }, { -5785, 15256 }, { -5817, 14974 },
+    { -5818, 14688 }, { -5795, 14397 }, { -5752, 14103 }, { -5693, 13805 }, { -5621, 13503 }, { -5537, 13197 },
+    { -5442, 12887 }, { -5340, 12571 }, { -5228, 12251 }, { -5110, 11926 }, { -4984, 11594 }, { -4852, 11257 },
+    { -4713, 10912 }, { -4567, 10559 }, { -4415, 10198 }, { -4255, 9826 }, { -4088, 9444 }, { -3914, 9050 },
+    { -3730, 8642 }, { -3537, 8217 }, { -3334, 7773 }, { -3118, 7307 }, { -2887, 6813 },
+    // y = 2
+    { 15233, 4301 }, { 14856, 5021 }, { 14521, 5655 }, { 14215, 6229 }, { 13929, 6759 }, { 13660, 7254 },
+    { 13404, 7722 }, { 13157, 8166 }, { 12919, 8591 }, { 12687, 9000 }, { 12460, 9394 }, { 12237, 9776 },
+    { 12018, 10146 }, { 11800, 10507 }, { 11584, 10859 }, { 11368, 11202 }, { 11152, 11539 }, { 10935, 11869 },
+    { 10715, 12192 }, { 10492, 12510 }, { 10265, 12822 }, { 10031, 13130 }, { 9791, 13433 }, { 9540, 13731 },
+    { 9278, 14024 }, { 9000, 14313 }, { 8703, 14597 }, { 8382, 14876 }, { 8029, 15149 }, { 7636, 15416 },
+    { 7188, 15674 }, { 6670, 15923 }, { 6055, 16158 }, { 5313, 16374 }, { 4405, 16564 }, { 3298, 16716 },
+    { 1995, 16817 }, { 574, 16852 }, { -812, 16817 }, { -2015, 16716 }, { -2969, 16564 }, { -3687, 16374 },
+    { -4213, 16158 }, { -4592, 15923 }, { -4863, 15674 }, { -5051, 15416 }, { -5178, 15149 }, { -5258, 14876 },
+    { -5300, 14597 }, { -5313, 14313 }, { -5302, 14024 }, { -5271, 13731 }, { -5223, 13433 }, { -5161, 13130 },
+    { -5087, 12822 }, { -5002, 12510 }, { -4907, 12192 }, { -4803, 11869 }, { -4691, 11539 }, { -4571, 11202 },
+    { -4443, 10859 }, { -4307, 10507 }, { -4164, 10146 }, { -4013, 9776 }, { -3854, 9394 }, { -3687, 9000 },
+    { -3510, 8591 }, { -3324, 8166 }, { -3126, 7722 }, { -2915, 7254 }, { -2688, 6759 },
+    // y = 2.5
+    { 15128, 4206 }, { 14741, 4936 }, { 14398, 5577 }, { 14085, 6156 }, { 13794, 6689 }, { 13519, 7187 },
+    { 13256, 7656 }, { 13003, 8101 }, { 12758, 8527 }, { 12520, 8936 }, { 12286, 9330 }, { 12056, 9711 },
+    { 11829, 10081 }, { 11603, 10440 }, { 11378, 10791 }, { 11153, 11133 }, { 10927, 11468 }, { 10699, 11795 },
+    { 10467, 12116 }, { 10232, 12432 }, { 9991, 12741 }, { 9742, 13045 }, { 9485, 13343 }, { 9216, 13636 },
+    { 8934, 13924 }, { 8635, 14207 }, { 8314, 14484 }, { 7967, 14754 }, { 7586, 15017 }, { 7164, 15272 },
+    { 6688, 15516 }, { 6145, 15748 }, { 5518, 15964 }, { 4787, 16158 }, { 3935, 16324 }, { 2954, 16453 },
+    { 1863, 16535 }, { 718, 16564 }, { -399, 16535 }, { -1406, 16453 }, { -2258, 16324 }, { -2945, 16158 },
+    { -3482, 15964 }, { -3893, 15748 }, { -4204, 15516 }, { -4435, 15272 }, { -4603, 15017 }, { -4720, 14754 },
+    { -4797, 14484 }, { -4841, 14207 }, { -4858, 13924 }, { -4853, 13636 }, { -4828, 13343 }, { -4787, 13045 },
+    { -4731, 12741 }, { -4663, 12432 }, { -4584, 12116 }, { -4494, 11795 }, { -4395, 11468 }, { -4286, 11133 },
+    { -4169, 10791 }, { -4043, 10440 }, { -3909, 10081 }, { -3767, 9711 }, { -3616, 9330 }, { -3455, 8936 },
+    { -3285, 8527 }, { -3104, 8101 }, { -2912, 7656 }, { -2705, 7187 }, { -2483, 6689 },
+    // y = 3
+    { 15036, 4087 }, { 14638, 4832 }, { 14287, 5481 }, { 13966, 6066 }, { 13668, 6603 }, { 13386, 7103 },
+    { 13117, 7574 }, { 12858, 8021 }, { 12607, 8448 }, { 12362, 8857 }, { 12122, 9251 }, { 11885, 9632 },
+    { 11650, 10001 }, { 11417, 10359 }, { 11184, 10708 }, { 10950, 11049 }, { 10715, 11381 }, { 10477, 11706 },
+    { 10235, 12025 }, { 9988, 12337 }, { 9735, 12642 }, { 9473, 12942 }, { 9202, 13236 }, { 8918, 13523 },
+    { 8620, 13805 }, { 8303, 14081 }, { 7964, 14349 }, { 7599, 14610 }, { 7200, 14862 }, { 6761, 15104 },
+    { 6272, 15335 }, { 5725, 15551 }, { 5107, 15748 }, { 4408, 15923 }, { 3622, 16069 }, { 2753, 16181 },
+    { 1821, 16251 }, { 863, 16275 }, { -72, 16251 }, { -934, 16181 }, { -1691, 16069 }, { -2330, 15923 },
+    { -2855, 15748 }, { -3275, 15551 }, { -3607, 15335 }, { -3865, 15104 }, { -4062, 14862 }, { -4209, 14610 },
+    { -4313, 14349 }, { -4384, 14081 }, { -4425, 13805 }, { -4442, 13523 }, { -4438, 13236 }, { -4415, 12942 },
+    { -4377, 12642 }, { -4325, 12337 }, { -4260, 12025 }, { -4183, 11706 }, { -4096, 11381 }, { -3999, 11049 },
+    { -3892, 10708 }, { -3776, 10359 }, { -3651, 10001 }, { -3516, 9632 }, { -3372, 9251 }, { -3219, 8857 },
+    { -3055, 8448 }, { -2880, 8021 }, { -2692, 7574 }, { -2490, 7103 }, { -2271, 6603 },
+    // y = 3.5
+    { 14958, 3942 }, { 14547, 4706 }, { 14186, 5367 }, { 13857, 5959 }, { 13552, 6501 }, { 13264, 7005 },
+    { 12988, 7478 }, { 12723, 7927 }, { 12466, 8354 }, { 12215, 8764 }, { 11968, 9158 }, { 11724, 9538 },
+    { 11483, 9906 }, { 11242, 10264 }, { 11002, 10611 }, { 10760, 10950 }, { 10517, 11280 }, { 10270, 11602 },
+    { 10019, 11918 }, { 9762, 12226 }, { 9498, 12527 }, { 9226, 12822 }, { 8943, 13111 }, { 8647, 13393 },
+    { 8336, 13668 }, { 8007, 13935 }, { 7655, 14195 }, { 7278, 14446 }, { 6869, 14688 }, { 6423, 14918 },
+    { 5933, 15134 }, { 5393, 15335 }, { 4796, 15516 }, { 4137, 15674 }, { 3417, 15805 }, { 2643, 15903 },
+    { 1831, 15964 }, { 1008, 15984 }, { 205, 15964 }, { -546, 15903 }, { -1222, 15805 }, { -1812, 15674 },
+    { -2312, 15516 }, { -2728, 15335 }, { -3067, 15134 }, { -3340, 14918 }, { -3556, 14688 }, { -3724, 14446 },
+    { -3851, 14195 }, { -3942, 13935 }, { -4004, 13668 }, { -4040, 13393 }, { -4054, 13111 }, { -4048, 12822 },
+    { -4026, 12527 }, { -3988, 12226 }, { -3936, 11918 }, { -3872, 11602 }, { -3796, 11280 }, { -3710, 10950 },
+    { -3613, 10611 }, { -3506, 10264 }, { -3389, 9906 }, { -3262, 9538 }, { -3125, 9158 }, { -2978, 8764 },
+    { -2820, 8354 }, { -2650, 7927 }, { -2467, 7478 }, { -2268, 7005 }, { -2053, 6501 },
+    // y = 4
+    { 14895, 3770 }, { 14468, 4557 }, { 14096, 5232 }, { 13759, 5833 }, { 13446, 6382 }, { 13151, 6890 },
+    { 12870, 7367 }, { 12598, 7817 }, { 12335, 8246 }, { 12077, 8656 }, { 11824, 9050 }, { 11575, 9430 },
+    { 11327, 9798 }, { 11080, 10154 }, { 10832, 10500 }, { 10584, 10836 }, { 10333, 11164 }, { 10078, 11483 },
+    { 9819, 11795 }, { 9554, 12100 }, { 9281, 12397 }, { 9000, 12687 }, { 8708, 12970 }, { 8403, 13245 },
+    { 8083, 13513 }, { 7744, 13773 }, { 7385, 14024 }, { 7001, 14266 }, { 6589, 14496 }, { 6143, 14714 },
+    { 5660, 14918 }, { 5135, 15104 }, { 4565, 15272 }, { 3949, 15416 }, { 3289, 15533 }, { 2593, 15621 },
+    { 1875, 15674 }, { 1154, 15693 }, { 450, 15674 }, { -214, 15621 }, { -822, 15533 }, { -1364, 15416 },
+    { -1836, 15272 }, { -2239, 15104 }, { -2577, 14918 }, { -2857, 14714 }, { -3085, 14496 }, { -3267, 14266 },
+    { -3409, 14024 }, { -3518, 13773 }, { -3596, 13513 }, { -3648, 13245 }, { -3678, 12970 }, { -3687, 12687 },
+    { -3678, 12397 }, { -3654, 12100 }, { -3614, 11795 }, { -3562, 11483 }, { -3496, 11164 }, { -3420, 10836 },
+    { -3332, 10500 }, { -3233, 10154 }, { -3124, 9798 }, { -3005, 9430 }, { -2875, 9050 }, { -2733, 8656 },
+    { -2581, 8246 }, { -2415, 7817 }, { -2236, 7367 }, { -2041, 6890 }, { -1828, 6382 },
+    // y = 4.5
+    { 14850, 3566 }, { 14404, 4384 }, { 14020, 5077 }, { 13673, 5689 }, { 13352, 6245 }, { 13050, 6759 },
+    { 12761, 7239 }, { 12484, 7692 }, { 12214, 8123 }, { 11951, 8534 }, { 11692, 8928 }, { 11437, 9308 },
+    { 11183, 9675 }, { 10930, 10030 }, { 10676, 10374 }, { 10421, 10708 }, { 10163, 11033 }, { 9902, 11350 },
+    { 9636, 11658 }, { 9364, 11959 }, { 9085, 12251 }, { 8796, 12536 }, { 8497, 12813 }, { 8185, 13082 },
+    { 7859, 13343 }, { 7515, 13595 }, { 7152, 13837 }, { 6767, 14069 }, { 6355, 14289 }, { 5915, 14496 },
+    { 5444, 14688 }, { 4938, 14862 }, { 4397, 15017 }, { 3822, 15149 }, { 3215, 15256 }, { 2585, 15335 },
+    { 1942, 15383 }, { 1300, 15399 }, { 674, 15383 }, { 80, 15335 }, { -472, 15256 }, { -971, 15149 },
+    { -1414, 15017 }, { -1800, 14862 }, { -2131, 14688 }, { -2411, 14496 }, { -2645, 14289 }, { -2836, 14069 },
+    { -2990, 13837 }, { -3111, 13595 }, { -3202, 13343 }, { -3268, 13082 }, { -3310, 12813 }, { -3332, 12536 },
+    { -3336, 12251 }, { -3323, 11959 }, { -3295, 11658 }, { -3252, 11350 }, { -3197, 11033 }, { -3129, 10708 },
+    { -3050, 10374 }, { -2959, 10030 }, { -2858, 9675 }, { -2745, 9308 }, { -2621, 8928 }, { -2485, 8534 },
+    { -2337, 8123 }, { -2176, 7692 }, { -2001, 7239 }, { -1809, 6759 }, { -1597, 6245 },
+    // y = 5
+    { 14825, 3325 }, { 14356, 4184 }, { 13956, 4899 }, { 13599, 5525 }, { 13269, 6091 }, { 12959, 6611 },
+    { 12664, 7096 }, { 12380, 7552 }, { 12105, 7985 }, { 11836, 8397 }, { 11572, 8792 }, { 11310, 9172 },
+    { 11051, 9538 }, { 10792, 9892 }, { 10533, 10234 }, { 10272, 10566 }, { 10009, 10889 }, { 9742, 11202 },
+    { 9471, 11507 }, { 9193, 11803 }, { 8908, 12091 }, { 8614, 12371 }, { 8310, 12642 }, { 7994, 12905 },
+    { 7664, 13159 }, { 7318, 13403 }, { 6954, 13636 }, { 6570, 13859 }, { 6164, 14069 }, { 5733, 14266 },
+    { 5276, 14446 }, { 4791, 14610 }, { 4280, 14754 }, { 3742, 14876 }, { 3183, 14974 }, { 2608, 15046 },
+    { 2026, 15090 }, { 1448, 15104 }, { 884, 15090 }, { 346, 15046 }, { -157, 14974 }, { -618, 14876 },
+    { -1033, 14754 }, { -1401, 14610 }, { -1722, 14446 }, { -1999, 14266 }, { -2233, 14069 }, { -2430, 13859 },
+    { -2591, 13636 }, { -2721, 13403 }, { -2822, 13159 }, { -2899, 12905 }, { -2952, 12642 }, { -2985, 12371 },
+    { -2999, 12091 }, { -2996, 11803 }, { -2978, 11507 }, { -2945, 11202 }, { -2898, 10889 }, { -2839, 10566 },
+    { -2767, 10234 }, { -2684, 9892 }, { -2589, 9538 }, { -2482, 9172 }, { -2364, 8792 }, { -2233, 8397 },
+    { -2090, 7985 }, { -1933, 7552 }, { -1760, 7096 }, { -1570, 6611 }, { -1359, 6091 },
+    // y = 5.5
+    { 14824, 3040 }, { 14324, 3953 }, { 13907, 4696 }, { 13537, 5340 }, { 13198, 5917 }, { 12880, 6445 },
+    { 12578, 6936 }, { 12288, 7396 }, { 12007, 7832 }, { 11732, 8246 }, { 11463, 8642 }, { 11196, 9021 },
+    { 10932, 9387 }, { 10668, 9740 }, { 10404, 10081 }, { 10138, 10411 }, { 9870, 10731 }, { 9598, 11041 },
+    { 9322, 11342 }, { 9040, 11634 }, { 8751, 11918 }, { 8453, 12192 }, { 8146, 12458 }, { 7827, 12714 },
+    { 7496, 12961 }, { 7150, 13197 }, { 6789, 13423 }, { 6409, 13636 }, { 6010, 13837 }, { 5591, 14024 },
+    { 5149, 14195 }, { 4687, 14349 }, { 4203, 14484 }, { 3700, 14597 }, { 3182, 14688 }, { 2654, 14754 },
+    { 2122, 14794 }, { 1596, 14808 }, { 1084, 14794 }, { 593, 14754 }, { 131, 14688 }, { -297, 14597 },
+    { -686, 14484 }, { -1036, 14349 }, { -1345, 14195 }, { -1615, 14024 }, { -1848, 13837 }, { -2046, 13636 },
+    { -2211, 13423 }, { -2347, 13197 }, { -2457, 12961 }, { -2541, 12714 }, { -2603, 12458 }, { -2645, 12192 },
+    { -2668, 11918 }, { -2674, 11634 }, { -2664, 11342 }, { -2639, 11041 }, { -2601, 10731 }, { -2549, 10411 },
+    { -2484, 10081 }, { -2408, 9740 }, { -2319, 9387 }, { -2218, 9021 }, { -2104, 8642 }, { -1978, 8246 },
+    { -1839, 7832 }, { -1685, 7396 }, { -1514, 6936 }, { -1326, 6445 }, { -1115, 5917 },
+    // y = 6
+    { 14855, 2697 }, { 14313, 3687 }, { 13874, 4466 }, { 13490, 5132 }, { 13140, 5723 }, { 12814, 6261 },
+    { 12504, 6759 }, { 12208, 7224 }, { 11921, 7663 }, { 11640, 8079 }, { 11366, 8476 }, { 11094, 8857 },
+    { 10825, 9222 }, { 10557, 9574 }, { 10288, 9913 }, { 10018, 10242 }, { 9746, 10559 }, { 9470, 10866 },
+    { 9191, 11164 }, { 8905, 11452 }, { 8613, 11731 }, { 8313, 12000 }, { 8004, 12260 }, { 7685, 12510 },
+    { 7354, 12750 }, { 7010, 12979 }, { 6653, 13197 }, { 6279, 13403 }, { 5889, 13595 }, { 5482, 13773 },
+    { 5058, 13935 }, { 4616, 14081 }, { 4159, 14207 }, { 3687, 14313 }, { 3205, 14397 }, { 2717, 14459 },
+    { 2228, 14496 }, { 1746, 14508 }, { 1276, 14496 }, { 824, 14459 }, { 398, 14397 }, { 0, 14313 },
+    { -365, 14207 }, { -697, 14081 }, { -993, 13935 }, { -1256, 13773 }, { -1485, 13595 }, { -1682, 13403 },
+    { -1850, 13197 }, { -1990, 12979 }, { -2104, 12750 }, { -2195, 12510 }, { -2264, 12260 }, { -2313, 12000 },
+    { -2344, 11731 }, { -2357, 11452 }, { -2354, 11164 }, { -2337, 10866 }, { -2305, 10559 }, { -2260, 10242 },
+    { -2201, 9913 }, { -2130, 9574 }, { -2047, 9222 }, { -1951, 8857 }, { -1842, 8476 }, { -1720, 8079 },
+    { -1584, 7663 }, { -1432, 7224 }, { -1263, 6759 }, { -1075, 6261 }, { -863, 5723 },
+    // y = 6.5
+    { 14929, 2271 }, { 14326, 3377 }, { 13860, 4206 }, { 13458, 4899 }, { 13096, 5508 }, { 12760, 6058 },
+    { 12443, 6564 }, { 12140, 7035 }, { 11846, 7478 }, { 11561, 7897 }, { 11281, 8296 }, { 11005, 8678 },
+    { 10731, 9043 }, { 10459, 9394 }, { 10186, 9733 }, { 9913, 10059 }, { 9637, 10374 }, { 9358, 10678 },
+    { 9076, 10972 }, { 8788, 11257 }, { 8494, 11531 }, { 8193, 11795 }, { 7884, 12050 }, { 7565, 12294 },
+    { 7236, 12527 }, { 6896, 12750 }, { 6543, 12961 }, { 6178, 13159 }, { 5798, 13343 }, { 5404, 13513 },
+    { 4996, 13668 }, { 4575, 13805 }, { 4142, 13924 }, { 3698, 14024 }, { 3248, 14103 }, { 2794, 14161 },
+    { 2342, 14195 }, { 1897, 14207 }, { 1463, 14195 }, { 1045, 14161 }, { 649, 14103 }, { 278, 14024 },
+    { -66, 13924 }, { -380, 13805 }, { -664, 13668 }, { -917, 13513 }, { -1141, 13343 }, { -1336, 13159 },
+    { -1504, 12961 }, { -1646, 12750 }, { -1764, 12527 }, { -1859, 12294 }, { -1933, 12050 }, { -1988, 11795 },
+    { -2025, 11531 }, { -2045, 11257 }, { -2048, 10972 }, { -2037, 10678 }, { -2011, 10374 }, { -1971, 10059 },
+    { -1919, 9733 }, { -1853, 9394 }, { -1774, 9043 }, { -1682, 8678 }, { -1577, 8296 }, { -1458, 7897 },
+    { -1325, 7478 }, { -1175, 7035 }, { -1007, 6564 }, { -818, 6058 }, { -604, 5508 },
+    // y = 7
+    { 15077, 1701 }, { 14369, 3012 }, { 13866, 3908 }, { 13443, 4637 }, { 13067, 5268 }, { 12720, 5833 },
+    { 12395, 6350 }, { 12084, 6828 }, { 11785, 7277 }, { 11494, 7700 }, { 11209, 8101 }, { 10928, 8484 },
+    { 10650, 8850 }, { 10374, 9201 }, { 10098, 9538 }, { 9822, 9863 }, { 9543, 10176 }, { 9262, 10477 },
+    { 8977, 10768 }, { 8688, 11049 }, { 8393, 11319 }, { 8092, 11579 }, { 7784, 11828 }, { 7467, 12066 },
+    { 7141, 12294 }, { 6805, 12510 }, { 6459, 12714 }, { 6101, 12905 }, { 5732, 13082 }, { 5352, 13245 },
+    { 4960, 13393 }, { 4558, 13523 }, { 4147, 13636 }, { 3729, 13731 }, { 3307, 13805 }, { 2883, 13859 },
+    { 2463, 13892 }, { 2049, 13903 }, { 1646, 13892 }, { 1257, 13859 }, { 888, 13805 }, { 540, 13731 },
+    { 216, 13636 }, { -82, 13523 }, { -353, 13393 }, { -597, 13245 }, { -815, 13082 }, { -1006, 12905 },
+    { -1173, 12714 }, { -1315, 12510 }, { -1435, 12294 }, { -1533, 12066 }, { -1611, 11828 }, { -1671, 11579 },
+    { -1712, 11319 }, { -1737, 11049 }, { -1746, 10768 }, { -1739, 10477 }, { -1719, 10176 }, { -1684, 9863 },
+    { -1636, 9538 }, { -1575, 9201 }, { -1500, 8850 }, { -1412, 8484 }, { -1310, 8101 }, { -1193, 7700 },
+    { -1061, 7277 }, { -913, 6828 }, { -744, 6350 }, { -554, 5833 }, { -335, 5268 },
+    // y = 7.5
+    { 15442, 702 }, { 14454, 2568 }, { 13897, 3566 }, { 13448, 4343 }, { 13055, 5002 }, { 12696, 5586 },
+    { 12360, 6115 }, { 12042, 6603 }, { 11736, 7058 }, { 11439, 7486 }, { 11149, 7890 }, { 10864, 8275 },
+    { 10583, 8642 }, { 10303, 8993 }, { 10024, 9330 }, { 9745, 9653 }, { 9464, 9964 }, { 9181, 10264 },
+    { 8895, 10552 }, { 8605, 10829 }, { 8310, 11095 }, { 8010, 11350 }, { 7703, 11594 }, { 7389, 11828 },
+    { 7067, 12050 }, { 6736, 12260 }, { 6397, 12458 }, { 6048, 12642 }, { 5690, 12813 }, { 5322, 12970 },
+    { 4946, 13111 }, { 4562, 13236 }, { 4172, 13343 }, { 3777, 13433 }, { 3379, 13503 }, { 2982, 13554 },
+    { 2589, 13585 }, { 2202, 13595 }, { 1826, 13585 }, { 1463, 13554 }, { 1117, 13503 }, { 791, 13433 },
+    { 485, 13343 }, { 202, 13236 }, { -57, 13111 }, { -292, 12970 }, { -503, 12813 }, { -690, 12642 },
+    { -854, 12458 }, { -996, 12260 }, { -1116, 12050 }, { -1216, 11828 }, { -1297, 11594 }, { -1360, 11350 },
+    { -1405, 11095 }, { -1434, 10829 }, { -1447, 10552 }, { -1445, 10264 }, { -1428, 9964 }, { -1398, 9653 },
+    { -1354, 9330 }, { -1296, 8993 }, { -1224, 8642 }, { -1139, 8275 }, { -1040, 7890 }, { -925, 7486 },
+    { -794, 7058 }, { -645, 6603 }, { -475, 6115 }, { -281, 5586 }, { -57, 5002 },
+    // y = 8
+    { 15661, 0 }, { 14606, 1995 }, { 13961, 3165 }, { 13475, 4009 }, { 13060, 4706 }, { 12687, 5313 },
+    { 12341, 5858 }, { 12014, 6358 }, { 11701, 6821 }, { 11398, 7254 }, { 11103, 7663 }, { 10814, 8050 },
+    { 10529, 8419 }, { 10246, 8771 }, { 9964, 9107 }, { 9682, 9430 }, { 9400, 9740 }, { 9116, 10037 },
+    { 8829, 10322 }, { 8539, 10596 }, { 8244, 10859 }, { 7945, 11110 }, { 7640, 11350 }, { 7329, 11579 },
+    { 7012, 11795 }, { 6687, 12000 }, { 6355, 12192 }, { 6015, 12371 }, { 5668, 12536 }, { 5313, 12687 },
+    { 4952, 12822 }, { 4585, 12942 }, { 4213, 13045 }, { 3839, 13130 }, { 3463, 13197 }, { 3090, 13245 },
+    { 2720, 13275 }, { 2358, 13284 }, { 2005, 13275 }, { 1665, 13245 }, { 1340, 13197 }, { 1031, 13130 },
+    { 742, 13045 }, { 473, 12942 }, { 226, 12822 }, { 0, 12687 }, { -204, 12536 }, { -386, 12371 },
+    { -547, 12192 }, { -687, 12000 }, { -807, 11795 }, { -908, 11579 }, { -990, 11350 }, { -1055, 11110 },
+    { -1103, 10859 }, { -1135, 10596 }, { -1151, 10322 }, { -1153, 10037 }, { -1139, 9740 }, { -1112, 9430 },
+    { -1071, 9107 }, { -1016, 8771 }, { -948, 8419 }, { -864, 8050 }, { -766, 7663 }, { -653, 7254 },
+    { -522, 6821 }, { -372, 6358 }, { -199, 5858 }, { 0, 5313 }, { 234, 4706 },
+    // y = 8.5
+    { 15532, 0 }, { 14917, 1111 }, { 14069, 2681 }, { 13530, 3627 }, { 13088, 4374 }, { 12696, 5011 },
+    { 12337, 5577 }, { 12001, 6091 }, { 11680, 6564 }, { 11371, 7005 }, { 11071, 7419 }, { 10777, 7810 },
+    { 10488, 8181 }, { 10202, 8534 }, { 9918, 8871 }, { 9634, 9193 }, { 9350, 9502 }, { 9065, 9798 },
+    { 8778, 10081 }, { 8488, 10352 }, { 8194, 10611 }, { 7897, 10859 }, { 7595, 11095 }, { 7288, 11319 },
+    { 6975, 11531 }, { 6656, 11731 }, { 6332, 11918 }, { 6001, 12091 }, { 5664, 12251 }, { 5322, 12397 },
+    { 4974, 12527 }, { 4623, 12642 }, { 4269, 12741 }, { 3913, 12822 }, { 3558, 12887 }, { 3205, 12933 },
+    { 2856, 12961 }, { 2515, 12970 }, { 2183, 12961 }, { 1863, 12933 }, { 1556, 12887 }, { 1265, 12822 },
+    { 991, 12741 }, { 735, 12642 }, { 498, 12527 }, { 281, 12397 }, { 85, 12251 }, { -92, 12091 },
+    { -249, 11918 }, { -387, 11731 }, { -506, 11531 }, { -607, 11319 }, { -690, 11095 }, { -756, 10859 },
+    { -806, 10611 }, { -840, 10352 }, { -858, 10081 }, { -862, 9798 }, { -852, 9502 }, { -827, 9193 },
+    { -789, 8871 }, { -736, 8534 }, { -669, 8181 }, { -587, 7810 }, { -490, 7419 }, { -376, 7005 },
+    { -244, 6564 }, { -91, 6091 }, { 85, 5577 }, { 292, 5011 }, { 539, 4374 },
+    // y = 9
+    { 15406, 0 }, { 15343, 0 }, { 14250, 2057 }, { 13621, 3179 }, { 13140, 3998 }, { 12726, 4676 },
+    { 12352, 5268 }, { 12004, 5799 }, { 11675, 6285 }, { 11359, 6736 }, { 11053, 7156 }, { 10754, 7552 },
+    { 10461, 7927 }, { 10172, 8282 }, { 9885, 8620 }, { 9600, 8943 }, { 9314, 9251 }, { 9029, 9545 },
+    { 8742, 9826 }, { 8452, 10095 }, { 8160, 10352 }, { 7865, 10596 }, { 7566, 10829 }, { 7263, 11049 },
+    { 6955, 11257 }, { 6643, 11452 }, { 6326, 11634 }, { 6004, 11803 }, { 5677, 11959 }, { 5346, 12100 },
+    { 5012, 12226 }, { 4675, 12337 }, { 4337, 12432 }, { 3998, 12510 }, { 3660, 12571 }, { 3326, 12616 },
+    { 2997, 12642 }, { 2674, 12651 }, { 2361, 12642 }, { 2058, 12616 }, { 1768, 12571 }, { 1492, 12510 },
+    { 1232, 12432 }, { 988, 12337 }, { 762, 12226 }, { 554, 12100 }, { 364, 11959 }, { 193, 11803 },
+    { 40, 11634 }, { -95, 11452 }, { -212, 11257 }, { -312, 11049 }, { -395, 10829 }, { -461, 10596 },
+    { -512, 10352 }, { -548, 10095 }, { -568, 9826 }, { -574, 9545 }, { -565, 9251 }, { -542, 8943 },
+    { -505, 8620 }, { -454, 8282 }, { -388, 7927 }, { -307, 7552 }, { -209, 7156 }, { -94, 6736 },
+    { 40, 6285 }, { 197, 5799 }, { 380, 5268 }, { 598, 4676 }, { 862, 3998 },
+    // y = 9.5
+    { 15282, 0 }, { 15218, 0 }, { 14614, 1073 }, { 13764, 2633 }, { 13224, 3566 }, { 12780, 4301 },
+    { 12386, 4927 }, { 12025, 5481 }, { 11685, 5983 }, { 11361, 6445 }, { 11049, 6875 }, { 10746, 7277 },
+    { 10449, 7656 }, { 10156, 8014 }, { 9867, 8354 }, { 9580, 8678 }, { 9293, 8986 }, { 9007, 9279 },
+    { 8720, 9560 }, { 8432, 9826 }, { 8142, 10081 }, { 7849, 10322 }, { 7553, 10552 }, { 7254, 10768 },
+    { 6952, 10972 }, { 6646, 11164 }, { 6336, 11342 }, { 6022, 11507 }, { 5705, 11658 }, { 5386, 11795 },
+    { 5064, 11918 }, { 4740, 12025 }, { 4416, 12116 }, { 4093, 12192 }, { 3772, 12251 }, { 3454, 12294 },
+    { 3141, 12320 }, { 2836, 12328 }, { 2539, 12320 }, { 2252, 12294 }, { 1977, 12251 }, { 1715, 12192 },
+    { 1467, 12116 }, { 1235, 12025 }, { 1019, 11918 }, { 819, 11795 }, { 636, 11658 }, { 471, 11507 },
+    { 322, 11342 }, { 191, 11164 }, { 76, 10972 }, { -23, 10768 }, { -105, 10552 }, { -171, 10322 },
+    { -222, 10081 }, { -258, 9826 }, { -280, 9560 }, { -287, 9279 }, { -279, 8986 }, { -257, 8678 },
+    { -221, 8354 }, { -170, 8014 }, { -104, 7656 }, { -23, 7277 }, { 76, 6875 }, { 193, 6445 },
+    { 331, 5983 }, { 494, 5481 }, { 687, 4927 }, { 920, 4301 }, { 1210, 3566 },
+    // y = 10
+    { 15161, 0 }, { 15095, 0 }, { 15026, 0 }, { 13999, 1909 }, { 13351, 3054 }, { 12862, 3874 },
+    { 12444, 4547 }, { 12065, 5132 }, { 11713, 5655 }, { 11381, 6131 }, { 11061, 6572 }, { 10752, 6982 },
+    { 10451, 7367 }, { 10155, 7729 }, { 9863, 8072 }, { 9574, 8397 }, { 9287, 8706 }, { 9000, 9000 },
+    { 8713, 9279 }, { 8426, 9545 }, { 8138, 9798 }, { 7847, 10037 }, { 7555, 10264 }, { 7261, 10477 },
+    { 6963, 10678 }, { 6663, 10866 }, { 6361, 11041 }, { 6055, 11202 }, { 5748, 11350 }, { 5438, 11483 },
+    { 5128, 11602 }, { 4817, 11706 }, { 4506, 11795 }, { 4197, 11869 }, { 3890, 11926 }, { 3588, 11967 },
+    { 3290, 11992 }, { 3000, 12000 }, { 2718, 11992 }, { 2445, 11967 }, { 2184, 11926 }, { 1935, 11869 },
+    { 1699, 11795 }, { 1477, 11706 }, { 1270, 11602 }, { 1078, 11483 }, { 902, 11350 }, { 742, 11202 },
+    { 598, 11041 }, { 470, 10866 }, { 358, 10678 }, { 262, 10477 }, { 181, 10264 }, { 116, 10037 },
+    { 65, 9798 }, { 29, 9545 }, { 7, 9279 }, { 0, 9000 }, { 7, 8706 }, { 29, 8397 },
+    { 65, 8072 }, { 116, 7729 }, { 183, 7367 }, { 266, 6982 }, { 367, 6572 }, { 488, 6131 },
+    { 632, 5655 }, { 803, 5132 }, { 1009, 4547 }, { 1264, 3874 }, { 1595, 3054 },
+    // y = 10.5
+    { 15042, 0 }, { 14974, 0 }, { 14904, 0 }, { 14582, 496 }, { 13546, 2415 }, { 12984, 3377 },
+    { 12529, 4119 }, { 12128, 4745 }, { 11761, 5295 }, { 11418, 5791 }, { 11090, 6245 }, { 10774, 6666 },
+    { 10468, 7058 }, { 10168, 7426 }, { 9874, 7773 }, { 9583, 8101 }, { 9294, 8412 }, { 9007, 8706 },
+    { 8721, 8986 }, { 8435, 9251 }, { 8148, 9502 }, { 7861, 9740 }, { 7572, 9964 }, { 7281, 10176 },
+    { 6989, 10374 }, { 6695, 10559 }, { 6399, 10731 }, { 6102, 10889 }, { 5803, 11033 }, { 5504, 11164 },
+    { 5204, 11280 }, { 4904, 11381 }, { 4605, 11468 }, { 4309, 11539 }, { 4016, 11594 }, { 3727, 11634 },
+    { 3443, 11658 }, { 3167, 11666 }, { 2898, 11658 }, { 2639, 11634 }, { 2390, 11594 }, { 2152, 11539 },
+    { 1927, 11468 }, { 1715, 11381 }, { 1517, 11280 }, { 1333, 11164 }, { 1163, 11033 }, { 1009, 10889 },
+    { 870, 10731 }, { 746, 10559 }, { 637, 10374 }, { 543, 10176 }, { 464, 9964 }, { 400, 9740 },
+    { 350, 9502 }, { 314, 9251 }, { 293, 8986 }, { 287, 8706 }, { 294, 8412 }, { 316, 8101 },
+    { 353, 7773 }, { 406, 7426 }, { 474, 7058 }, { 560, 6666 }, { 665, 6245 }, { 791, 5791 },
+    { 943, 5295 }, { 1127, 4745 }, { 1352, 4119 }, { 1639, 3377 }, { 2040, 2415 },
+    // y = 11
+    { 14926, 0 }, { 14857, 0 }, { 14785, 0 }, { 14709, 0 }, { 13885, 1493 }, { 13162, 2775 },
+    { 12650, 3627 }, { 12219, 4311 }, { 11832, 4899 }, { 11474, 5420 }, { 11137, 5892 }, { 10814, 6326 },
+    { 10501, 6728 }, { 10197, 7103 }, { 9899, 7456 }, { 9606, 7788 }, { 9316, 8101 }, { 9029, 8397 },
+    { 8743, 8678 }, { 8458, 8943 }, { 8173, 9193 }, { 7888, 9430 }, { 7602, 9653 }, { 7316, 9863 },
+    { 7029, 10059 }, { 6740, 10242 }, { 6451, 10411 }, { 6161, 10566 }, { 5871, 10708 }, { 5580, 10836 },
+    { 5290, 10950 }, { 5001, 11049 }, { 4714, 11133 }, { 4429, 11202 }, { 4148, 11257 }, { 3872, 11295 },
+    { 3601, 11319 }, { 3337, 11327 }, { 3080, 11319 }, { 2833, 11295 }, { 2595, 11257 }, { 2368, 11202 },
+    { 2153, 11133 }, { 1950, 11049 }, { 1760, 10950 }, { 1584, 10836 }, { 1421, 10708 }, { 1272, 10566 },
+    { 1138, 10411 }, { 1018, 10242 }, { 913, 10059 }, { 822, 9863 }, { 745, 9653 }, { 682, 9430 },
+    { 634, 9193 }, { 600, 8943 }, { 580, 8678 }, { 574, 8397 }, { 583, 8101 }, { 606, 7788 },
+    { 645, 7456 }, { 699, 7103 }, { 771, 6728 }, { 861, 6326 }, { 971, 5892 }, { 1106, 5420 },
+    { 1269, 4899 }, { 1470, 4311 }, { 1723, 3627 }, { 2063, 2775 }, { 2623, 1493 },
+    // y = 11.5
+    { 14813, 0 }, { 14743, 0 }, { 14669, 0 }, { 14592, 0 }, { 14512, 0 }, { 13442, 1974 },
+    { 12823, 3040 }, { 12344, 3816 }, { 11930, 4456 }, { 11554, 5011 }, { 11204, 5508 }, { 10871, 5959 },
+    { 10552, 6374 }, { 10242, 6759 }, { 9941, 7119 }, { 9645, 7456 }, { 9353, 7773 }, { 9065, 8072 },
+    { 8779, 8354 }, { 8495, 8620 }, { 8211, 8871 }, { 7929, 9107 }, { 7646, 9330 }, { 7364, 9538 },
+    { 7081, 9733 }, { 6799, 9913 }, { 6516, 10081 }, { 6233, 10234 }, { 5950, 10374 }, { 5668, 10500 },
+    { 5387, 10611 }, { 5108, 10708 }, { 4831, 10791 }, { 4557, 10859 }, { 4287, 10912 }, { 4022, 10950 },
+    { 3763, 10972 }, { 3510, 10980 }, { 3265, 10972 }, { 3028, 10950 }, { 2801, 10912 }, { 2584, 10859 },
+    { 2378, 10791 }, { 2184, 10708 }, { 2002, 10611 }, { 1832, 10500 }, { 1676, 10374 }, { 1533, 10234 },
+    { 1404, 10081 }, { 1288, 9913 }, { 1186, 9733 }, { 1098, 9538 }, { 1024, 9330 }, { 964, 9107 },
+    { 918, 8871 }, { 885, 8620 }, { 867, 8354 }, { 863, 8072 }, { 874, 7773 }, { 899, 7456 },
+    { 941, 7119 }, { 999, 6759 }, { 1075, 6374 }, { 1170, 5959 }, { 1289, 5508 }, { 1434, 5011 },
+    { 1614, 4456 }, { 1839, 3816 }, { 2137, 3040 }, { 2584, 1974 }, { 3488, 0 },
+    // y = 12
+    { 14703, 0 }, { 14631, 0 }, { 14556, 0 }, { 14478, 0 }, { 14397, 0 }, { 14313, 0 },
+    { 13081, 2289 }, { 12518, 3233 }, { 12062, 3953 }, { 11661, 4557 }, { 11294, 5086 }, { 10949, 5560 },
+    { 10621, 5992 }, { 10305, 6390 }, { 9999, 6759 }, { 9699, 7103 }, { 9406, 7426 }, { 9116, 7729 },
+    { 8830, 8014 }, { 8546, 8282 }, { 8264, 8534 }, { 7984, 8771 }, { 7704, 8993 }, { 7425, 9201 },
+    { 7147, 9394 }, { 6870, 9574 }, { 6592, 9740 }, { 6316, 9892 }, { 6041, 10030 }, { 5767, 10154 },
+    { 5494, 10264 }, { 5224, 10359 }, { 4957, 10440 }, { 4693, 10507 }, { 4433, 10559 }, { 4178, 10596 },
+    { 3929, 10619 }, { 3687, 10626 }, { 3452, 10619 }, { 3226, 10596 }, { 3008, 10559 }, { 2800, 10507 },
+    { 2603, 10440 }, { 2417, 10359 }, { 2242, 10264 }, { 2080, 10154 }, { 1930, 10030 }, { 1792, 9892 },
+    { 1668, 9740 }, { 1557, 9574 }, { 1459, 9394 }, { 1374, 9201 }, { 1303, 8993 }, { 1246, 8771 },
+    { 1202, 8534 }, { 1172, 8282 }, { 1156, 8014 }, { 1155, 7729 }, { 1168, 7426 }, { 1197, 7103 },
+    { 1242, 6759 }, { 1305, 6390 }, { 1387, 5992 }, { 1491, 5560 }, { 1620, 5086 }, { 1781, 4557 },
+    { 1984, 3953 }, { 2250, 3233 }, { 2630, 2289 }, { 3687, 0 }, { 3603, 0 },
+    // y = 12.5
+    { 14595, 0 }, { 14522, 0 }, { 14446, 0 }, { 14367, 0 }, { 14285, 0 }, { 14200, 0 },
+    { 13575, 1073 }, { 12769, 2501 }, { 12241, 3364 }, { 11803, 4043 }, { 11412, 4617 }, { 11051, 5123 },
+    { 10711, 5577 }, { 10387, 5992 }, { 10075, 6374 }, { 9771, 6728 }, { 9474, 7058 }, { 9183, 7367 },
+    { 8896, 7656 }, { 8612, 7927 }, { 8331, 8181 }, { 8052, 8419 }, { 7776, 8642 }, { 7500, 8850 },
+    { 7226, 9043 }, { 6953, 9222 }, { 6681, 9387 }, { 6411, 9538 }, { 6142, 9675 }, { 5876, 9798 },
+    { 5611, 9906 }, { 5349, 10001 }, { 5091, 10081 }, { 4836, 10146 }, { 4585, 10198 }, { 4340, 10234 },
+    { 4101, 10256 }, { 3868, 10264 }, { 3643, 10256 }, { 3425, 10234 }, { 3217, 10198 }, { 3018, 10146 },
+    { 2829, 10081 }, { 2650, 10001 }, { 2483, 9906 }, { 2327, 9798 }, { 2183, 9675 }, { 2051, 9538 },
+    { 1932, 9387 }, { 1825, 9222 }, { 1731, 9043 }, { 1650, 8850 }, { 1583, 8642 }, { 1529, 8419 },
+    { 1488, 8181 }, { 1461, 7927 }, { 1449, 7656 }, { 1451, 7367 }, { 1468, 7058 }, { 1501, 6728 },
+    { 1552, 6374 }, { 1621, 5992 }, { 1711, 5577 }, { 1826, 5123 }, { 1971, 4617 }, { 2155, 4043 },
+    { 2394, 3364 }, { 2730, 2501 }, { 3352, 1073 }, { 3800, 0 }, { 3715, 0 },
+    // y = 13
+    { 14490, 0 }, { 14416, 0 }, { 14339, 0 }, { 14259, 0 }, { 14177, 0 }, { 14091, 0 },
+    { 14001, 0 }, { 13205, 1407 }, { 12496, 2633 }, { 11992, 3441 }, { 11565, 4087 }, { 11182, 4637 },
+    { 10826, 5123 }, { 10491, 5560 }, { 10170, 5959 }, { 9861, 6326 }, { 9560, 6666 }, { 9266, 6982 },
+    { 8977, 7277 }, { 8693, 7552 }, { 8413, 7810 }, { 8136, 8050 }, { 7861, 8275 }, { 7588, 8484 },
+    { 7318, 8678 }, { 7049, 8857 }, { 6782, 9021 }, { 6518, 9172 }, { 6255, 9308 }, { 5995, 9430 },
+    { 5738, 9538 }, { 5484, 9632 }, { 5233, 9711 }, { 4987, 9776 }, { 4745, 9826 }, { 4509, 9863 },
+    { 4278, 9884 }, { 4054, 9892 }, { 3838, 9884 }, { 3629, 9863 }, { 3429, 9826 }, { 3237, 9776 },
+    { 3056, 9711 }, { 2885, 9632 }, { 2724, 9538 }, { 2575, 9430 }, { 2437, 9308 }, { 2310, 9172 },
+    { 2196, 9021 }, { 2094, 8857 }, { 2005, 8678 }, { 1928, 8484 }, { 1864, 8275 }, { 1814, 8050 },
+    { 1777, 7810 }, { 1754, 7552 }, { 1746, 7277 }, { 1752, 6982 }, { 1774, 6666 }, { 1814, 6326 },
+    { 1871, 5959 }, { 1949, 5560 }, { 2051, 5123 }, { 2182, 4637 }, { 2349, 4087 }, { 2567, 3441 },
+    { 2871, 2633 }, { 3388, 1407 }, { 3999, 0 }, { 3909, 0 }, { 3823, 0 },
+    // y = 13.5
+    { 14388, 0 }, { 14313, 0 }, { 14235, 0 }, { 14155, 0 }, { 14071, 0 }, { 13984, 0 },
+    { 13895, 0 }, { 13801, 0 }, { 12918, 1574 }, { 12256, 2697 }, { 11767, 3466 }, { 11349, 4087 },
+    { 10971, 4617 }, { 10620, 5086 }, { 10289, 5508 }, { 9971, 5892 }, { 9665, 6245 }, { 9367, 6572 },
+    { 9076, 6875 }, { 8791, 7156 }, { 8510, 7419 }, { 8234, 7663 }, { 7960, 7890 }, { 7690, 8101 },
+    { 7423, 8296 }, { 7158, 8476 }, { 6896, 8642 }, { 6636, 8792 }, { 6379, 8928 }, { 6125, 9050 },
+    { 5875, 9158 }, { 5628, 9251 }, { 5384, 9330 }, { 5146, 9394 }, { 4912, 9444 }, { 4683, 9480 },
+    { 4461, 9502 }, { 4245, 9509 }, { 4037, 9502 }, { 3836, 9480 }, { 3644, 9444 }, { 3460, 9394 },
+    { 3286, 9330 }, { 3122, 9251 }, { 2968, 9158 }, { 2824, 9050 }, { 2692, 8928 }, { 2572, 8792 },
+    { 2463, 8642 }, { 2366, 8476 }, { 2281, 8296 }, { 2209, 8101 }, { 2149, 7890 }, { 2103, 7663 },
+    { 2071, 7419 }, { 2053, 7156 }, { 2049, 6875 }, { 2061, 6572 }, { 2090, 6245 }, { 2137, 5892 },
+    { 2204, 5508 }, { 2294, 5086 }, { 2412, 4617 }, { 2565, 4087 }, { 2767, 3466 }, { 3047, 2697 },
+    { 3508, 1574 }, { 4199, 0 }, { 4105, 0 }, { 4016, 0 }, { 3929, 0 },
+    // y = 14
+    { 14288, 0 }, { 14213, 0 }, { 14134, 0 }, { 14053, 0 }, { 13969, 0 }, { 13881, 0 },
+    { 13791, 0 }, { 13697, 0 }, { 13601, 0 }, { 12687, 1626 }, { 12047, 2697 }, { 11567, 3441 },
+    { 11155, 4043 }, { 10781, 4557 }, { 10434, 5011 }, { 10106, 5420 }, { 9791, 5791 }, { 9488, 6131 },
+    { 9193, 6445 }, { 8906, 6736 }, { 8624, 7005 }, { 8347, 7254 }, { 8075, 7486 }, { 7807, 7700 },
+    { 7542, 7897 }, { 7280, 8079 }, { 7022, 8246 }, { 6767, 8397 }, { 6515, 8534 }, { 6267, 8656 },
+    { 6022, 8764 }, { 5781, 8857 }, { 5545, 8936 }, { 5313, 9000 }, { 5086, 9050 }, { 4866, 9086 },
+    { 4651, 9107 }, { 4443, 9115 }, { 4242, 9107 }, { 4048, 9086 }, { 3863, 9050 }, { 3687, 9000 },
+    { 3520, 8936 }, { 3362, 8857 }, { 3215, 8764 }, { 3077, 8656 }, { 2951, 8534 }, { 2836, 8397 },
+    { 2732, 8246 }, { 2640, 8079 }, { 2561, 7897 }, { 2494, 7700 }, { 2439, 7486 }, { 2398, 7254 },
+    { 2371, 7005 }, { 2359, 6736 }, { 2361, 6445 }, { 2381, 6131 }, { 2418, 5791 }, { 2474, 5420 },
+    { 2554, 5011 }, { 2661, 4557 }, { 2803, 4043 }, { 2992, 3441 }, { 3256, 2697 }, { 3687, 1626 },
+    { 4399, 0 }, { 4303, 0 }, { 4209, 0 }, { 4119, 0 }, { 4031, 0 },
+    // y = 14.5
+    { 14191, 0 }, { 14115, 0 }, { 14036, 0 }, { 13954, 0 }, { 13869, 0 }, { 13782, 0 },
+    { 13691, 0 }, { 13597, 0 }, { 13500, 0 }, { 13399, 0 }, { 12508, 1574 }, { 11871, 2633 },
+    { 11394, 3364 }, { 10984, 3953 }, { 10614, 4456 }, { 10269, 4899 }, { 9943, 5295 }, { 9632, 5655 },
+    { 9331, 5983 }, { 9040, 6285 }, { 8756, 6564 }, { 8478, 6821 }, { 8206, 7058 }, { 7939, 7277 },
+    { 7675, 7478 }, { 7416, 7663 }, { 7161, 7832 }, { 6910, 7985 }, { 6663, 8123 }, { 6419, 8246 },
+    { 6180, 8354 }, { 5945, 8448 }, { 5715, 8527 }, { 5490, 8591 }, { 5270, 8642 }, { 5056, 8678 },
+    { 4848, 8699 }, { 4647, 8706 }, { 4453, 8699 }, { 4267, 8678 }, { 4089, 8642 }, { 3919, 8591 },
+    { 3758, 8527 }, { 3607, 8448 }, { 3466, 8354 }, { 3335, 8246 }, { 3214, 8123 }, { 3105, 7985 },
+    { 3007, 7832 }, { 2921, 7663 }, { 2846, 7478 }, { 2785, 7277 }, { 2736, 7058 }, { 2701, 6821 },
+    { 2680, 6564 }, { 2675, 6285 }, { 2685, 5983 }, { 2713, 5655 }, { 2761, 5295 }, { 2832, 4899 },
+    { 2930, 4456 }, { 3062, 3953 }, { 3241, 3364 }, { 3496, 2633 }, { 3918, 1574 }, { 4601, 0 },
+    { 4500, 0 }, { 4403, 0 }, { 4309, 0 }, { 4218, 0 }, { 4131, 0 },
+    // y = 15
+    { 14096, 0 }, { 14019, 0 }, { 13940, 0 }, { 13858, 0 }, { 13773, 0 }, { 13685, 0 },
+    { 13594, 0 }, { 13500, 0 }, { 13403, 0 }, { 13303, 0 }, { 13199, 0 }, { 12388, 1407 },
+    { 11730, 2501 }, { 11250, 3233 }, { 10839, 3816 }, { 10470, 4311 }, { 10127, 4745 }, { 9803, 5132 },
+    { 9494, 5481 }, { 9197, 5799 }, { 8909, 6091 }, { 8628, 6358 }, { 8355, 6603 }, { 8087, 6828 },
+    { 7825, 7035 }, { 7568, 7224 }, { 7315, 7396 }, { 7067, 7552 }, { 6824, 7692 }, { 6585, 7817 },
+    { 6350, 7927 }, { 6120, 8021 }, { 5896, 8101 }, { 5676, 8166 }, { 5463, 8217 }, { 5255, 8253 },
+    { 5054, 8275 }, { 4859, 8282 }, { 4672, 8275 }, { 4492, 8253 }, { 4320, 8217 }, { 4157, 8166 },
+    { 4003, 8101 }, { 3858, 8021 }, { 3723, 7927 }, { 3598, 7817 }, { 3484, 7692 }, { 3380, 7552 },
+    { 3288, 7396 }, { 3208, 7224 }, { 3140, 7035 }, { 3084, 6828 }, { 3042, 6603 }, { 3014, 6358 },
+    { 3001, 6091 }, { 3004, 5799 }, { 3025, 5481 }, { 3065, 5132 }, { 3128, 4745 }, { 3219, 4311 },
+    { 3344, 3816 }, { 3518, 3233 }, { 3769, 2501 }, { 4205, 1407 }, { 4801, 0 }, { 4697, 0 },
+    { 4597, 0 }, { 4500, 0 }, { 4406, 0 }, { 4315, 0 }, { 4227, 0 },
+    // y = 15.5
+    { 14004, 0 }, { 13927, 0 }, { 13847, 0 }, { 13764, 0 }, { 13679, 0 }, { 13591, 0 },
+    { 13500, 0 }, { 13406, 0 }, { 13309, 0 }, { 13209, 0 }, { 13105, 0 }, { 12999, 0 },
+    { 12352, 1073 }, { 11630, 2289 }, { 11137, 3040 }, { 10723, 3627 }, { 10352, 4119 }, { 10009, 4547 },
+    { 9687, 4927 }, { 9380, 5268 }, { 9085, 5577 }, { 8801, 5858 }, { 8525, 6115 }, { 8256, 6350 },
+    { 7993, 6564 }, { 7737, 6759 }, { 7486, 6936 }, { 7240, 7096 }, { 6999, 7239 }, { 6764, 7367 },
+    { 6533, 7478 }, { 6308, 7574 }, { 6088, 7656 }, { 5874, 7722 }, { 5666, 7773 }, { 5464, 7810 },
+    { 5269, 7832 }, { 5081, 7839 }, { 4899, 7832 }, { 4726, 7810 }, { 4561, 7773 }, { 4404, 7722 },
+    { 4256, 7656 }, { 4117, 7574 }, { 3988, 7478 }, { 3870, 7367 }, { 3761, 7239 }, { 3664, 7096 },
+    { 3578, 6936 }, { 3504, 6759 }, { 3443, 6564 }, { 3395, 6350 }, { 3360, 6115 }, { 3341, 5858 },
+    { 3337, 5577 }, { 3352, 5268 }, { 3386, 4927 }, { 3444, 4547 }, { 3529, 4119 }, { 3650, 3627 },
+    { 3823, 3040 }, { 4081, 2289 }, { 4575, 1073 }, { 5001, 0 }, { 4895, 0 }, { 4791, 0 },
+    { 4691, 0 }, { 4594, 0 }, { 4500, 0 }, { 4409, 0 }, { 4321, 0 },
+    // y = 16
+    { 13914, 0 }, { 13837, 0 }, { 13756, 0 }, { 13674, 0 }, { 13588, 0 }, { 13500, 0 },
+    { 13409, 0 }, { 13315, 0 }, { 13218, 0 }, { 13119, 0 }, { 13016, 0 }, { 12909, 0 },
+    { 12800, 0 }, { 12687, 0 }, { 11584, 1974 }, { 11063, 2775 }, { 10639, 3377 }, { 10264, 3874 },
+    { 9920, 4301 }, { 9598, 4676 }, { 9292, 5011 }, { 9000, 5313 }, { 8719, 5586 }, { 8446, 5833 },
+    { 8182, 6058 }, { 7925, 6261 }, { 7674, 6445 }, { 7430, 6611 }, { 7191, 6759 }, { 6959, 6890 },
+    { 6732, 7005 }, { 6510, 7103 }, { 6295, 7187 }, { 6085, 7254 }, { 5882, 7307 }, { 5686, 7344 },
+    { 5496, 7367 }, { 5313, 7374 }, { 5138, 7367 }, { 4970, 7344 }, { 4811, 7307 }, { 4660, 7254 },
+    { 4519, 7187 }, { 4386, 7103 }, { 4264, 7005 }, { 4151, 6890 }, { 4050, 6759 }, { 3959, 6611 },
+    { 3880, 6445 }, { 3814, 6261 }, { 3760, 6058 }, { 3720, 5833 }, { 3696, 5586 }, { 3687, 5313 },
+    { 3696, 5011 }, { 3726, 4676 }, { 3780, 4301 }, { 3862, 3874 }, { 3984, 3377 }, { 4162, 2775 },
+    { 4442, 1974 }, { 5313, 0 }, { 5200, 0 }, { 5091, 0 }, { 4984, 0 }, { 4881, 0 },
+    { 4782, 0 }, { 4685, 0 }, { 4591, 0 }, { 4500, 0 }, { 4412, 0 },
+    // y = 16.5
+    { 13827, 0 }, { 13749, 0 }, { 13668, 0 }, { 13586, 0 }, { 13500, 0 }, { 13412, 0 },
+    { 13321, 0 }, { 13227, 0 }, { 13131, 0 }, { 13031, 0 }, { 12929, 0 }, { 12823, 0 },
+    { 12715, 0 }, { 12603, 0 }, { 12488, 0 }, { 11623, 1493 }, { 11040, 2415 }, { 10595, 3054 },
+    { 10210, 3566 }, { 9862, 3998 }, { 9539, 4374 }, { 9234, 4706 }, { 8943, 5002 }, { 8665, 5268 },
+    { 8396, 5508 }, { 8137, 5723 }, { 7885, 5917 }, { 7641, 6091 }, { 7403, 6245 }, { 7172, 6382 },
+    { 6947, 6501 }, { 6729, 6603 }, { 6517, 6689 }, { 6312, 6759 }, { 6113, 6813 }, { 5921, 6852 },
+    { 5736, 6875 }, { 5559, 6882 }, { 5389, 6875 }, { 5227, 6852 }, { 5074, 6813 }, { 4929, 6759 },
+    { 4794, 6689 }, { 4668, 6603 }, { 4552, 6501 }, { 4446, 6382 }, { 4352, 6245 }, { 4269, 6091 },
+    { 4198, 5917 }, { 4140, 5723 }, { 4096, 5508 }, { 4067, 5268 }, { 4055, 5002 }, { 4060, 4706 },
+    { 4088, 4374 }, { 4140, 3998 }, { 4224, 3566 }, { 4351, 3054 }, { 4546, 2415 }, { 4885, 1493 },
+    { 5512, 0 }, { 5397, 0 }, { 5285, 0 }, { 5177, 0 }, { 5071, 0 }, { 4969, 0 },
+    { 4869, 0 }, { 4773, 0 }, { 4679, 0 }, { 4588, 0 }, { 4500, 0 },
+    // y = 17
+    { 13742, 0 }, { 13664, 0 }, { 13583, 0 }, { 13500, 0 }, { 13414, 0 }, { 13326, 0 },
+    { 13236, 0 }, { 13142, 0 }, { 13046, 0 }, { 12947, 0 }, { 12845, 0 }, { 12741, 0 },
+    { 12633, 0 }, { 12522, 0 }, { 12408, 0 }, { 12291, 0 }, { 11922, 496 }, { 11092, 1909 },
+    { 10603, 2633 }, { 10200, 3179 }, { 9843, 3627 }, { 9515, 4009 }, { 9209, 4343 }, { 8920, 4637 },
+    { 8643, 4899 }, { 8378, 5132 }, { 8123, 5340 }, { 7876, 5525 }, { 7638, 5689 }, { 7407, 5833 },
+    { 7184, 5959 }, { 6968, 6066 }, { 6759, 6156 }, { 6556, 6229 }, { 6362, 6285 }, { 6174, 6326 },
+    { 5994, 6350 }, { 5821, 6358 }, { 5657, 6350 }, { 5501, 6326 }, { 5353, 6285 }, { 5215, 6229 },
+    { 5085, 6156 }, { 4966, 6066 }, { 4857, 5959 }, { 4759, 5833 }, { 4673, 5689 }, { 4599, 5525 },
+    { 4537, 5340 }, { 4490, 5132 }, { 4458, 4899 }, { 4443, 4637 }, { 4448, 4343 }, { 4475, 4009 },
+    { 4530, 3627 }, { 4621, 3179 }, { 4764, 2633 }, { 4999, 1909 }, { 5582, 496 }, { 5709, 0 },
+    { 5592, 0 }, { 5478, 0 }, { 5367, 0 }, { 5259, 0 }, { 5155, 0 }, { 5053, 0 },
+    { 4954, 0 }, { 4858, 0 }, { 4764, 0 }, { 4674, 0 }, { 4586, 0 },
+    // y = 17.5
+    { 13659, 0 }, { 13581, 0 }, { 13500, 0 }, { 13417, 0 }, { 13332, 0 }, { 13244, 0 },
+    { 13153, 0 }, { 13060, 0 }, { 12964, 0 }, { 12866, 0 }, { 12765, 0 }, { 12661, 0 },
+    { 12554, 0 }, { 12444, 0 }, { 12331, 0 }, { 12215, 0 }, { 12096, 0 }, { 11974, 0 },
+    { 11313, 1073 }, { 10693, 2057 }, { 10250, 2681 }, { 9874, 3165 }, { 9537, 3566 }, { 9226, 3908 },
+    { 8935, 4206 }, { 8659, 4466 }, { 8397, 4696 }, { 8145, 4899 }, { 7904, 5077 }, { 7671, 5232 },
+    { 7448, 5367 }, { 7232, 5481 }, { 7024, 5577 }, { 6825, 5655 }, { 6633, 5715 }, { 6448, 5757 },
+    { 6272, 5783 }, { 6104, 5791 }, { 5945, 5783 }, { 5794, 5757 }, { 5653, 5715 }, { 5521, 5655 },
+    { 5398, 5577 }, { 5287, 5481 }, { 5186, 5367 }, { 5096, 5232 }, { 5020, 5077 }, { 4956, 4899 },
+    { 4907, 4696 }, { 4874, 4466 }, { 4860, 4206 }, { 4866, 3908 }, { 4897, 3566 }, { 4961, 3165 },
+    { 5069, 2681 }, { 5250, 2057 }, { 5614, 1073 }, { 6026, 0 }, { 5904, 0 }, { 5785, 0 },
+    { 5669, 0 }, { 5556, 0 }, { 5446, 0 }, { 5339, 0 }, { 5235, 0 }, { 5134, 0 },
+    { 5036, 0 }, { 4940, 0 }, { 4847, 0 }, { 4756, 0 }, { 4668, 0 },
+    // y = 18
+    { 13578, 0 }, { 13500, 0 }, { 13419, 0 }, { 13336, 0 }, { 13251, 0 }, { 13163, 0 },
+    { 13073, 0 }, { 12981, 0 }, { 12885, 0 }, { 12787, 0 }, { 12687, 0 }, { 12584, 0 },
+    { 12478, 0 }, { 12369, 0 }, { 12257, 0 }, { 12143, 0 }, { 12026, 0 }, { 11905, 0 },
+    { 11782, 0 }, { 11657, 0 }, { 10972, 1111 }, { 10399, 1995 }, { 9978, 2568 }, { 9619, 3012 },
+    { 9297, 3377 }, { 9000, 3687 }, { 8722, 3953 }, { 8460, 4184 }, { 8212, 4384 }, { 7974, 4557 },
+    { 7747, 4706 }, { 7530, 4832 }, { 7323, 4936 }, { 7124, 5021 }, { 6933, 5086 }, { 6752, 5132 },
+    { 6579, 5159 }, { 6416, 5168 }, { 6261, 5159 }, { 6116, 5132 }, { 5981, 5086 }, { 5856, 5021 },
+    { 5741, 4936 }, { 5638, 4832 }, { 5547, 4706 }, { 5468, 4557 }, { 5404, 4384 }, { 5356, 4184 },
+    { 5324, 3953 }, { 5313, 3687 }, { 5326, 3377 }, { 5369, 3012 }, { 5454, 2568 }, { 5606, 1995 },
+    { 5917, 1111 }, { 6343, 0 }, { 6218, 0 }, { 6095, 0 }, { 5974, 0 }, { 5857, 0 },
+    { 5743, 0 }, { 5631, 0 }, { 5522, 0 }, { 5416, 0 }, { 5313, 0 }, { 5213, 0 },
+    { 5115, 0 }, { 5019, 0 }, { 4927, 0 }, { 4837, 0 }, { 4749, 0 },
+    // y = 18.5
+    { 13500, 0 }, { 13422, 0 }, { 13341, 0 }, { 13258, 0 }, { 13173, 0 }, { 13086, 0 },
+    { 12996, 0 }, { 12904, 0 }, { 12809, 0 }, { 12712, 0 }, { 12612, 0 }, { 12510, 0 },
+    { 12405, 0 }, { 12297, 0 }, { 12187, 0 }, { 12074, 0 }, { 11958, 0 }, { 11839, 0 },
+    { 11718, 0 }, { 11594, 0 }, { 11468, 0 }, { 11339, 0 }, { 10856, 702 }, { 10222, 1701 },
+    { 9801, 2271 }, { 9448, 2697 }, { 9136, 3040 }, { 8850, 3325 }, { 8584, 3566 }, { 8335, 3770 },
+    { 8100, 3942 }, { 7878, 4087 }, { 7667, 4206 }, { 7467, 4301 }, { 7277, 4374 }, { 7097, 4425 },
+    { 6927, 4456 }, { 6767, 4466 }, { 6617, 4456 }, { 6478, 4425 }, { 6350, 4374 }, { 6233, 4301 },
+    { 6128, 4206 }, { 6036, 4087 }, { 5958, 3942 }, { 5895, 3770 }, { 5850, 3566 }, { 5825, 3325 },
+    { 5824, 3040 }, { 5855, 2697 }, { 5929, 2271 }, { 6077, 1701 }, { 6442, 702 }, { 6661, 0 },
+    { 6532, 0 }, { 6406, 0 }, { 6282, 0 }, { 6161, 0 }, { 6042, 0 }, { 5926, 0 },
+    { 5813, 0 }, { 5703, 0 }, { 5595, 0 }, { 5490, 0 }, { 5388, 0 }, { 5288, 0 },
+    { 5191, 0 }, { 5096, 0 }, { 5004, 0 }, { 4914, 0 }, { 4827, 0 },
+};
+
+static const unsigned char halo_iklut_2dof_cells[324] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
+    0x00, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x0C, 0xFE, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x3C, 0xC0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xC0, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xE0,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
+    0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x3F,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
+    0x07, 0x00, 0x00, 0x00,
+};
+
+const halo_iklut_t halo_iklut_2dof = {
+    halo_iklut_2dof_theta, halo_iklut_2dof_cells, 71, 38,
+    -18.5000f, 0.0000f, 2.000000f, 0, 0.1774f
+};
@@ -0,0 +1,10 @@
+#ifndef HALO_IKLUT_2DOF_H
+#define HALO_IKLUT_2DOF_H
+
+#include "halo_iklut.h"
+
+// Elbow-down IK table for the L1 = 10, L2 = 10 arm, 0.5 cm grid,
+// |err| <= 0.177 deg over 79.7% of the servo-window workspace
+extern const halo_iklut_t halo_iklut_2dof;
+
+#endif // HALO_IKLUT_2DOF_H
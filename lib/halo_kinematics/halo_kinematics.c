@@ -0,0 +1,331 @@
+/**
+ * @file    halo_kinematics.c
+ * @brief   Shared inverse kinematics for the 2-DOF planar arm.
+ *          Replaces the per-example computeIK copies with one single-point
+ *          and one batch solver built on polynomial acos/atan2.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Reachability is tested on r^2 against (L1 ± L2)^2, so no sqrt is spent
+ *   on the radius
+ * - sin(theta2) is taken as ±sqrt(1 - c2^2) instead of sinf(acosf(c2))
+ * - Every per-point decision is a select, so the batch loop stays
+ *   branch-free and the compiler can vectorise it
+ * - HALO_KINEMATICS_FIXED swaps the float core for the Q16 solver
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Link lengths: L1 = 10.0, L2 = 10.0 (HALO_ARM_2DOF)
+ */
+
+#include "halo_kinematics.h"
+
+// ---------- Solver core ----------
+
+// Loop invariants derived from the arm geometry
+typedef struct
+{
+    float l1;
+    float l2;
+    float r2_min;       // (L1 - L2)^2
+    float r2_max;       // (L1 + L2)^2
+    float len_sq_sum;   // L1^2 + L2^2
+    float inv_2l1l2;    // 1 / (2 * L1 * L2)
+    float sign;         // +1 elbow-down, -1 elbow-up
+#ifdef HALO_KINEMATICS_FIXED
+    halo_arm_q16_t q16;
+    int elbow_up;
+#endif
+} ik_consts_t;
+
+static inline ik_consts_t ik_consts(const halo_arm_t* arm, int elbow_up)
+{
+    ik_consts_t k;
+    float d = arm->l1 - arm->l2;
+    float s = arm->l1 + arm->l2;
+
+    k.l1         = arm->l1;
+    k.l2         = arm->l2;
+    k.r2_min     = d * d;
+    k.r2_max     = s * s;
+    k.len_sq_sum = arm->l1 * arm->l1 + arm->l2 * arm->l2;
+    k.inv_2l1l2  = 1.0f / (2.0f * arm->l1 * arm->l2);
+    k.sign       = elbow_up ? -1.0f : 1.0f;
+#ifdef HALO_KINEMATICS_FIXED
+    halo_arm_q16_init(&k.q16, arm);
+    k.elbow_up = elbow_up;
+#endif
+    return k;
+}
+
+#ifdef HALO_KINEMATICS_FIXED
+
+static inline int ik_point(const ik_consts_t* k, float x, float y,
+                           float* theta1_deg, float* theta2_deg)
+{
+    int t1, t2;
+    int ok = halo_ik_solve_q16(&k->q16, HALO_Q16(x), HALO_Q16(y), k->elbow_up, &t1, &t2);
+
+    *theta1_deg = HALO_Q16_TO_F(t1);
+    *theta2_deg = HALO_Q16_TO_F(t2);
+    return ok;
+}
+
+#else
+
+static inline int ik_point(const ik_consts_t* k, float x, float y,
+                           float* theta1_deg, float* theta2_deg)
+{
+    float r2 = x * x + y * y;
+
+    float c2 = (r2 - k->len_sq_sum) * k->inv_2l1l2;
+    c2 = (c2 < -1.0f) ? -1.0f : c2;
+    c2 = (c2 >  1.0f) ?  1.0f : c2;
+
+    float s2   = k->sign * sqrtf(1.0f - c2 * c2);
+    float ang2 = k->sign * halo_acosf(c2);
+    float ang1 = halo_atan2f(y, x) - halo_atan2f(k->l2 * s2, k->l1 + k->l2 * c2);
+
+    *theta1_deg = ang1 * HALO_RAD_TO_DEG_F;
+    *theta2_deg = ang2 * HALO_RAD_TO_DEG_F;
+
+    return (r2 <= k->r2_max) & (r2 >= k->r2_min);
+}
+
+#endif // HALO_KINEMATICS_FIXED
+
+// ---------- Public API ----------
+
+int halo_ik_solve(const halo_arm_t* arm, float x, float y, int elbow_up,
+                  float* theta1_deg, float* theta2_deg)
+{
+    ik_consts_t k = ik_consts(arm, elbow_up);
+    return ik_point(&k, x, y, theta1_deg, theta2_deg);
+}
+
+int halo_ik_solve_batch(const halo_arm_t* arm, const float (*xy)[2],
+                        float (*theta_deg)[2], unsigned char* reachable,
+                        int n, int elbow_up)
+{
+    ik_consts_t k = ik_consts(arm, elbow_up);
+    int count = 0;
+
+    if (reachable)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            int ok = ik_point(&k, xy[i][0], xy[i][1], &theta_deg[i][0], &theta_deg[i][1]);
+            reachable[i] = (unsigned char)ok;
+            count += ok;
+        }
+    }
+    else
+    {
+        for (int i = 0; i < n; i++)
+            count += ik_point(&k, xy[i][0], xy[i][1], &theta_deg[i][0], &theta_deg[i][1]);
+    }
+
+    return count;
+}
+
+// ---------- Fixed-point solver ----------
+
+void halo_arm_q16_init(halo_arm_q16_t* arm_q16, const halo_arm_t* arm)
+{
+    long long l1 = HALO_Q16(arm->l1);
+    long long l2 = HALO_Q16(arm->l2);
+
+    arm_q16->l1_q16         = (int)l1;
+    arm_q16->l2_q16         = (int)l2;
+    arm_q16->r2_min_q16     = ((l1 - l2) * (l1 - l2)) >> 16;
+    arm_q16->r2_max_q16     = ((l1 + l2) * (l1 + l2)) >> 16;
+    arm_q16->len_sq_sum_q16 = (l1 * l1 + l2 * l2) >> 16;
+    arm_q16->two_l1l2_q16   = (2 * l1 * l2) >> 16;
+}
+
+int halo_ik_solve_q16(const halo_arm_q16_t* arm, int x_q16, int y_q16, int elbow_up,
+                      int* theta1_q16_deg, int* theta2_q16_deg)
+{
+    long long r2 = ((long long)x_q16 * x_q16 + (long long)y_q16 * y_q16 + (1 << 15)) >> 16;
+
+    // cos(theta2) = n / d, kept as the exact ratio instead of a rounded
+    // Q16 value: near full stretch or full fold one LSB of c2 alone would
+    // be 0.3° of theta2. Clamped to [-1, 1].
+    long long d = arm->two_l1l2_q16;
+    long long n = r2 - arm->len_sq_sum_q16;
+    if (n < -d) n = -d;
+    if (n >  d) n =  d;
+
+    // sin(theta2) * d = sqrt((d - n) * (d + n)), also Q16
+    long long s = halo_isqrt64((unsigned long long)((d - n) * (d + n)));
+    if (elbow_up)
+        s = -s;
+
+    // theta2 = ±acos(c2); atan2 only needs the common scale d
+    int ang2 = halo_atan2_q16_64(s, n);
+
+    // theta1 = atan2(y, x) - atan2(L2 * s2, L1 + L2 * c2), scaled by d
+    long long k1 = arm->l1_q16 * d + arm->l2_q16 * n;
+    long long k2 = arm->l2_q16 * s;
+    int ang1 = halo_atan2_q16(y_q16, x_q16) - halo_atan2_q16_64(k2, k1);
+
+    *theta1_q16_deg = ang1;
+    *theta2_q16_deg = ang2;
+
+    return (r2 <= arm->r2_max_q16) & (r2 >= arm->r2_min_q16);
+}
+
+// ---------- Incremental (resolved-rate) IK ----------
+
+// Advances (s, c) = (sin a, cos a) to a + d for a small d (|d| < 0.1 rad):
+// Taylor terms to d^4, then one Newton step back onto the unit circle
+static inline void rotate_small(float* s, float* c, float d)
+{
+    float d2 = d * d;
+    float sd = d * (1.0f - d2 * (1.0f / 6.0f));
+    float cd = 1.0f - d2 * (0.5f - d2 * (1.0f / 24.0f));
+
+    float ns = *s * cd + *c * sd;
+    float nc = *c * cd - *s * sd;
+    float k  = 1.5f - 0.5f * (ns * ns + nc * nc);
+
+    *s = ns * k;
+    *c = nc * k;
+}
+
+static inline void track_fk(halo_ik_tracker_t* tr)
+{
+    tr->s12 = tr->s1 * tr->c2 + tr->c1 * tr->s2;
+    tr->c12 = tr->c1 * tr->c2 - tr->s1 * tr->s2;
+
+    tr->px = tr->arm.l1 * tr->c1 + tr->arm.l2 * tr->c12;
+    tr->py = tr->arm.l1 * tr->s1 + tr->arm.l2 * tr->s12;
+}
+
+// Joint step J^-1 * (ex, ey) at the current pose, det J = L1 * L2 * sin(theta2)
+static inline void track_delta(const halo_ik_tracker_t* tr, float ex, float ey,
+                               float* d1, float* d2)
+{
+    *d1 =  (tr->c12 * ex + tr->s12 * ey) * tr->inv_s2 * tr->inv_l1;
+    *d2 = -(tr->px * ex + tr->py * ey) * tr->inv_s2 * tr->inv_l1l2;
+}
+
+static int track_anchor(halo_ik_tracker_t* tr, float x, float y)
+{
+    float t1_deg, t2_deg;
+    if (!halo_ik_solve(&tr->arm, x, y, tr->elbow_up, &t1_deg, &t2_deg))
+    {
+        tr->anchored = 0;
+        return 0;
+    }
+
+    float l1 = tr->arm.l1;
+    float l2 = tr->arm.l2;
+    float r2 = x * x + y * y;
+
+    // sin/cos without trig: theta2 from the law of cosines, theta1 by
+    // rotating (x, y) back by atan2(k2, k1), where |(k1, k2)| = r
+    float c2 = (r2 - l1 * l1 - l2 * l2) / (2.0f * l1 * l2);
+    c2 = (c2 < -1.0f) ? -1.0f : (c2 > 1.0f) ? 1.0f : c2;
+    float s2 = sqrtf(1.0f - c2 * c2);
+    if (tr->elbow_up)
+        s2 = -s2;
+
+    float k1 = l1 + l2 * c2;
+    float k2 = l2 * s2;
+
+    if (r2 > 0.0f)
+    {
+        float inv_r2 = 1.0f / r2;
+        tr->c1 = (x * k1 + y * k2) * inv_r2;
+        tr->s1 = (y * k1 - x * k2) * inv_r2;
+    }
+    else
+    {
+        tr->c1 = 1.0f;
+        tr->s1 = 0.0f;
+    }
+    tr->c2     = c2;
+    tr->s2     = s2;
+    tr->inv_s2 = (s2 != 0.0f) ? 1.0f / s2 : 0.0f;
+    tr->t1 = t1_deg * HALO_DEG_TO_RAD_F;
+    tr->t2 = t2_deg * HALO_DEG_TO_RAD_F;
+    track_fk(tr);
+
+    tr->anchored     = 1;
+    tr->since_anchor = 0;
+    tr->anchors++;
+    return 1;
+}
+
+void halo_ik_track_init(halo_ik_tracker_t* tr, const halo_arm_t* arm, int elbow_up,
+                        int reanchor_every, float max_drift_deg)
+{
+    tr->arm            = *arm;
+    tr->elbow_up       = elbow_up;
+    tr->reanchor_every = reanchor_every;
+    tr->max_drift_rad  = max_drift_deg * HALO_DEG_TO_RAD_F;
+    tr->inv_l1         = 1.0f / arm->l1;
+    tr->inv_l1l2       = 1.0f / (arm->l1 * arm->l2);
+    tr->anchored       = 0;
+    tr->since_anchor   = 0;
+    tr->steps          = 0;
+    tr->anchors        = 0;
+}
+
+int halo_ik_track(halo_ik_tracker_t* tr, float x, float y,
+                  float* theta1_deg, float* theta2_deg)
+{
+    float l1 = tr->arm.l1;
+    float l2 = tr->arm.l2;
+    float r2 = x * x + y * y;
+
+    if (r2 > (l1 + l2) * (l1 + l2) || r2 < (l1 - l2) * (l1 - l2))
+    {
+        tr->anchored = 0;
+        return 0;
+    }
+
+    float ex = x - tr->px;
+    float ey = y - tr->py;
+
+    int ok = tr->anchored &&
+             tr->since_anchor < tr->reanchor_every &&
+             ex * ex + ey * ey <= HALO_IK_TRACK_MAX_STEP_CM * HALO_IK_TRACK_MAX_STEP_CM &&
+             fabsf(tr->s2) >= HALO_IK_TRACK_MIN_SIN2;
+
+    if (ok)
+    {
+        float d1, d2;
+        track_delta(tr, ex, ey, &d1, &d2);
+
+        rotate_small(&tr->s1, &tr->c1, d1);
+        rotate_small(&tr->s2, &tr->c2, d2);
+        tr->t1 += d1;
+        tr->t2 += d2;
+        track_fk(tr);
+
+        // sin(theta2) moved a little: one Newton step keeps 1/sin(theta2)
+        // converged without a division
+        tr->inv_s2 *= 2.0f - tr->s2 * tr->inv_s2;
+
+        tr->since_anchor++;
+        tr->steps++;
+
+        // Re-solve if the update left the branch, or if the joint error
+        // left behind (the next Newton step for the same target) is too large
+        float r1, r2j;
+        track_delta(tr, x - tr->px, y - tr->py, &r1, &r2j);
+        ok = (tr->elbow_up ? tr->s2 <= 0.0f : tr->s2 >= 0.0f) &&
+             fabsf(r1) <= tr->max_drift_rad && fabsf(r2j) <= tr->max_drift_rad;
+    }
+
+    if (!ok && !track_anchor(tr, x, y))
+        return 0;
+
+    *theta1_deg = tr->t1 * HALO_RAD_TO_DEG_F;
+    *theta2_deg = tr->t2 * HALO_RAD_TO_DEG_F;
+    return 1;
+}
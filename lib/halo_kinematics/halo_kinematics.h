@@ -0,0 +1,212 @@
+#ifndef HALO_KINEMATICS_H
+#define HALO_KINEMATICS_H
+
+/**
+ * @file    halo_kinematics.h
+ * @brief   Shared inverse kinematics for the 2-DOF planar arm.
+ *
+ * @details
+ * - Single-point and batch (N points → N joint pairs) IK solvers
+ * - Incremental Jacobian tracker for dense paths (halo_ik_track)
+ * - acos/atan2 are replaced by short polynomial approximations that
+ *   compile to straight-line code, so the batch loop has no branches and
+ *   vectorises with SSE/AVX/NEON (build with -O3 -fno-math-errno)
+ * - Angles are returned in degrees, matching the examples' servo code
+ *
+ * Error bounds (measured against double-precision libm):
+ * - halo_acosf  : |err| <= 7e-5 rad   (A&S 4.4.45)
+ * - halo_atan2f : |err| <= 1.2e-5 rad (A&S 4.4.47)
+ * - theta1/theta2 from the IK solvers: |err| <= 0.004 deg over the whole
+ *   reachable workspace, well below the 0.18 deg of one servo microsecond.
+ *
+ * Fixed-point option:
+ * - halo_ik_solve_q16() solves in Q16 with the integer CORDIC/sqrt of
+ *   halo_math (no libm, no float, fixed cost per point)
+ * - Build with -DHALO_KINEMATICS_FIXED to route halo_ik_solve() and
+ *   halo_ik_solve_batch() through it, so every example that uses this
+ *   module switches without code changes
+ */
+
+#include <math.h>
+#include "halo_math.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// 2-link planar arm geometry (link lengths in cm)
+typedef struct
+{
+    float l1;
+    float l2;
+} halo_arm_t;
+
+// HALO 2-DOF arm: L1 = L2 = 10 cm
+#define HALO_ARM_2DOF { 10.0f, 10.0f }
+
+// Elbow branch, same meaning as the elbowUp flag used in the examples
+#define HALO_ELBOW_DOWN 0   // theta2 = +acos(c2)
+#define HALO_ELBOW_UP   1   // theta2 = -acos(c2)
+
+#define HALO_PI_F         3.14159265f
+#define HALO_HALF_PI_F    1.57079633f
+#define HALO_RAD_TO_DEG_F 57.2957795f
+#define HALO_DEG_TO_RAD_F 0.0174532925f
+
+// ---------- Polynomial approximations ----------
+
+// acos(x) for x in [-1, 1], |err| <= 7e-5 rad
+static inline float halo_acosf(float x)
+{
+    float ax = (x < 0.0f) ? -x : x;
+    float p  = ((-0.0187293f * ax + 0.0742610f) * ax - 0.2121144f) * ax + 1.5707288f;
+    float r  = sqrtf(1.0f - ax) * p;
+    return (x < 0.0f) ? HALO_PI_F - r : r;
+}
+
+// atan2(y, x) in (-pi, pi], |err| <= 1.2e-5 rad, returns 0 for (0, 0)
+static inline float halo_atan2f(float y, float x)
+{
+    float ax = (x < 0.0f) ? -x : x;
+    float ay = (y < 0.0f) ? -y : y;
+    float mx = (ax > ay) ? ax : ay;
+    float mn = (ax > ay) ? ay : ax;
+    float z  = mn / ((mx > 0.0f) ? mx : 1.0f);
+    float z2 = z * z;
+
+    float r = z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f +
+                   z2 * (-0.0851330f + z2 * 0.0208351f))));
+
+    r = (ay > ax)  ? HALO_HALF_PI_F - r : r;
+    r = (x < 0.0f) ? HALO_PI_F - r : r;
+    return (y < 0.0f) ? -r : r;
+}
+
+// ---------- Inverse Kinematics ----------
+
+/**
+ * @brief Solves IK for one Cartesian point.
+ *
+ * Angles are always written (an out-of-reach target gives the clamped,
+ * fully stretched/folded pose), the return value says whether the target
+ * lies inside the reachable annulus. No servo range check is applied.
+ *
+ * @return 1 if reachable, 0 otherwise
+ */
+int halo_ik_solve(const halo_arm_t* arm, float x, float y, int elbow_up,
+                  float* theta1_deg, float* theta2_deg);
+
+/**
+ * @brief Solves IK for n Cartesian points in one branch-free pass.
+ *
+ * @param xy         Input points, xy[i] = { x, y } in cm
+ * @param theta_deg  Output joint pairs, theta_deg[i] = { theta1, theta2 }
+ * @param reachable  Optional per-point reachability flags (may be NULL)
+ * @return Number of reachable points
+ */
+int halo_ik_solve_batch(const halo_arm_t* arm, const float (*xy)[2],
+                        float (*theta_deg)[2], unsigned char* reachable,
+                        int n, int elbow_up);
+
+// ---------- Fixed-point Inverse Kinematics ----------
+
+// Arm geometry pre-converted for the Q16 solver (lengths in cm, Q16)
+typedef struct
+{
+    int                l1_q16;
+    int                l2_q16;
+    long long          r2_min_q16;      // (L1 - L2)^2
+    long long          r2_max_q16;      // (L1 + L2)^2
+    long long          len_sq_sum_q16;  // L1^2 + L2^2
+    long long          two_l1l2_q16;    // 2 * L1 * L2
+} halo_arm_q16_t;
+
+/**
+ * @brief Converts the arm geometry once (the only float math of the
+ *        fixed-point path).
+ */
+void halo_arm_q16_init(halo_arm_q16_t* arm_q16, const halo_arm_t* arm);
+
+/**
+ * @brief Solves IK for one point in Q16 integer arithmetic.
+ *
+ * Same conventions and clamping as halo_ik_solve(); coordinates are Q16 cm,
+ * angles Q16 degrees. |err| <= 0.002 deg against double precision for
+ * the same Q16 inputs (~340 ns per point on the host, one isqrt64 and
+ * three CORDIC atan2).
+ *
+ * @return 1 if reachable, 0 otherwise
+ */
+int halo_ik_solve_q16(const halo_arm_q16_t* arm, int x_q16, int y_q16, int elbow_up,
+                      int* theta1_q16_deg, int* theta2_q16_deg);
+
+// ---------- Incremental (resolved-rate) IK ----------
+
+/**
+ * Tracks a dense path from its previous joint solution: each step is one
+ * forward-kinematics evaluation and a 2x2 Jacobian-inverse update, with
+ * sin/cos of the joint angles advanced by small-angle rotation and
+ * 1/sin(theta2) refined by one Newton step, so a step costs ~50
+ * multiply/adds and no division, sqrt or trig.
+ *
+ * The tracker re-anchors with the closed-form halo_ik_solve():
+ * - on the first point, and every reanchor_every steps
+ * - when the joint error left after a step, estimated as J^-1 times the
+ *   residual FK(theta) - target, exceeds max_drift_deg
+ * - when a target jumps more than HALO_IK_TRACK_MAX_STEP_CM
+ * - near the stretched/folded singularity (|sin theta2| below
+ *   HALO_IK_TRACK_MIN_SIN2, theta2 within 14.5° of 0° or 180°, where a
+ *   linear step is too coarse), or when a target leaves the reachable
+ *   annulus
+ *
+ * Between anchors theta1 is continuous along the path; halo_ik_solve()
+ * wraps it where the path crosses the -x axis, which is outside the servo
+ * window of the examples.
+ */
+#define HALO_IK_TRACK_MAX_STEP_CM 1.0f
+#define HALO_IK_TRACK_MIN_SIN2    0.25f
+
+typedef struct
+{
+    halo_arm_t arm;
+    int   elbow_up;
+    int   reanchor_every;       // closed-form re-solve period, in steps
+    float max_drift_rad;        // joint error that forces a re-solve
+    float inv_l1;               // 1 / L1
+    float inv_l1l2;             // 1 / (L1 * L2)
+
+    int   anchored;             // 0 until the first closed-form solve
+    int   since_anchor;         // steps since the last closed-form solve
+    float t1, t2;               // joint angles, rad
+    float s1, c1;               // sin/cos theta1
+    float s2, c2;               // sin/cos theta2
+    float s12, c12;             // sin/cos (theta1 + theta2)
+    float inv_s2;               // 1 / sin theta2
+    float px, py;               // FK of (t1, t2)
+
+    unsigned long steps;        // incremental updates
+    unsigned long anchors;      // closed-form solves
+} halo_ik_tracker_t;
+
+/**
+ * @brief Sets up a tracker; the next halo_ik_track() call anchors.
+ */
+void halo_ik_track_init(halo_ik_tracker_t* tr, const halo_arm_t* arm, int elbow_up,
+                        int reanchor_every, float max_drift_deg);
+
+/**
+ * @brief Solves the next point of a path from the previous solution.
+ *
+ * Same conventions as halo_ik_solve(); angles are only written for
+ * reachable targets.
+ *
+ * @return 1 if reachable, 0 otherwise
+ */
+int halo_ik_track(halo_ik_tracker_t* tr, float x, float y,
+                  float* theta1_deg, float* theta2_deg);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HALO_KINEMATICS_H
@@ -0,0 +1,291 @@
+#ifndef HALO_KINEMATICS_HPP
+#define HALO_KINEMATICS_HPP
+
+/**
+ * @file    halo_kinematics.hpp
+ * @brief   Header-only C++17 kinematics over compile-time link descriptions.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - An arm is a type with static constexpr link lengths and a layout tag;
+ *   halo::kinematics<Links> picks the solver for that layout
+ * - Every term that only depends on the links (L1^2 + L2^2,
+ *   1 / (2 L1 L2), reach limits) is a static constexpr member, so it is
+ *   folded into the generated code; the elbow branch is a template
+ *   argument, so its sign folds too
+ * - Solvers use the polynomial acos/atan2 of halo_kinematics.h with
+ *   every select done as a bit-mask blend, so the generated code has no
+ *   jumps at -O2 with -fno-math-errno, and give the same results as
+ *   halo_ik_solve() for the same arm
+ * - Angles in degrees, lengths in cm, as in the C API
+ * - planar_3r and scara take one sinf/cosf of the requested tool angle;
+ *   fk() uses libm trig (it is for checks and previews, not the loop)
+ * - Float only: HALO_KINEMATICS_FIXED does not affect these templates
+ *
+ * Layouts:
+ * - planar_2r : q = { theta1, theta2 }, pose = { x, y }
+ * - planar_3r : q = { theta1, theta2, theta3 }, pose = { x, y, phi }
+ *               (phi = tool angle, theta1 + theta2 + theta3)
+ * - scara     : q = { theta1, theta2, d3, theta4 }, pose = { x, y, z, phi }
+ *               (d3 = quill extension downwards from z0, phi = tool yaw)
+ *
+ * Usage:
+ * @code
+ * struct my_3link
+ * {
+ *     static constexpr halo::layout kind = halo::layout::planar_3r;
+ *     static constexpr float l1 = 10.0f, l2 = 8.0f, l3 = 4.0f;
+ * };
+ * using arm = halo::kinematics<my_3link>;
+ *
+ * arm::joints q;
+ * int ok = arm::ik<HALO_ELBOW_DOWN>({ 12.0f, 6.0f, 90.0f }, q);
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - C++17 or later; the C API in halo_kinematics.h is unchanged
+ * - Needs lib/halo_kinematics and lib/halo_math on the include path, and
+ *   the C objects of both linked in (see
+ *   examples/robotics/2DOF/2dof_cpp_kinematics)
+ */
+
+#include "halo_kinematics.h"
+
+#include <cstring>
+
+namespace halo
+{
+
+enum class layout
+{
+    planar_2r,
+    planar_3r,
+    scara,
+};
+
+// HALO 2-DOF arm: L1 = L2 = 10 cm (same as HALO_ARM_2DOF)
+struct arm_2dof
+{
+    static constexpr layout kind = layout::planar_2r;
+    static constexpr float  l1   = 10.0f;
+    static constexpr float  l2   = 10.0f;
+};
+
+template <int N>
+struct vec
+{
+    float v[N];
+
+    constexpr float  operator[](int i) const { return v[i]; }
+    constexpr float& operator[](int i)       { return v[i]; }
+};
+
+namespace detail
+{
+
+// c ? a : b as a bit-mask blend, so no comparison ever becomes a jump
+static inline float select(bool c, float a, float b)
+{
+    unsigned ua, ub;
+    std::memcpy(&ua, &a, sizeof ua);
+    std::memcpy(&ub, &b, sizeof ub);
+
+    unsigned m  = 0u - (unsigned)c;
+    unsigned ur = (ua & m) | (ub & ~m);
+
+    float r;
+    std::memcpy(&r, &ur, sizeof r);
+    return r;
+}
+
+// halo_acosf() with selects (same polynomial, same results)
+static inline float acos_poly(float x)
+{
+    float ax = fabsf(x);
+    float p  = ((-0.0187293f * ax + 0.0742610f) * ax - 0.2121144f) * ax + 1.5707288f;
+    float r  = sqrtf(1.0f - ax) * p;
+    return select(x < 0.0f, HALO_PI_F - r, r);
+}
+
+// halo_atan2f() with selects (same polynomial, same results)
+static inline float atan2_poly(float y, float x)
+{
+    float ax = fabsf(x);
+    float ay = fabsf(y);
+    bool  sw = ay > ax;
+    float mx = select(sw, ay, ax);
+    float mn = select(sw, ax, ay);
+    float z  = mn / (mx + (float)(mx <= 0.0f));
+    float z2 = z * z;
+
+    float r = z * (0.9998660f + z2 * (-0.3302995f + z2 * (0.1801410f +
+                   z2 * (-0.0851330f + z2 * 0.0208351f))));
+
+    r = select(sw, HALO_HALF_PI_F - r, r);
+    r = select(x < 0.0f, HALO_PI_F - r, r);
+    return select(y < 0.0f, -r, r);
+}
+
+// Shared 2-link core: constants fold per link pair, branch selected at compile time
+template <class Links, int ElbowUp>
+struct two_link
+{
+    static constexpr float l1         = Links::l1;
+    static constexpr float l2         = Links::l2;
+    static constexpr float r2_min     = (l1 - l2) * (l1 - l2);
+    static constexpr float r2_max     = (l1 + l2) * (l1 + l2);
+    static constexpr float len_sq_sum = l1 * l1 + l2 * l2;
+    static constexpr float inv_2l1l2  = 1.0f / (2.0f * l1 * l2);
+    static constexpr float sign       = ElbowUp ? -1.0f : 1.0f;
+
+    // Radians out; returns 1 if (x, y) lies in the reachable annulus
+    static inline int solve(float x, float y, float& ang1, float& ang2)
+    {
+        float r2 = x * x + y * y;
+
+        float c2 = (r2 - len_sq_sum) * inv_2l1l2;
+        c2 = select(c2 < -1.0f, -1.0f, c2);
+        c2 = select(c2 >  1.0f,  1.0f, c2);
+
+        float s2 = sign * sqrtf(1.0f - c2 * c2);
+        ang2 = sign * acos_poly(c2);
+        ang1 = atan2_poly(y, x) - atan2_poly(l2 * s2, l1 + l2 * c2);
+
+        return (r2 <= r2_max) & (r2 >= r2_min);
+    }
+};
+
+} // namespace detail
+
+// Primary template: only the layouts below are defined
+template <class Links, layout Kind = Links::kind>
+struct kinematics;
+
+// ---------- 2R planar ----------
+
+template <class Links>
+struct kinematics<Links, layout::planar_2r>
+{
+    static constexpr int dof = 2;
+    using joints = vec<2>;      // theta1, theta2 (deg)
+    using pose   = vec<2>;      // x, y (cm)
+
+    static constexpr float reach_min = (Links::l1 > Links::l2) ? Links::l1 - Links::l2
+                                                               : Links::l2 - Links::l1;
+    static constexpr float reach_max = Links::l1 + Links::l2;
+
+    static inline pose fk(const joints& q)
+    {
+        float a1  = q[0] * HALO_DEG_TO_RAD_F;
+        float a12 = a1 + q[1] * HALO_DEG_TO_RAD_F;
+        return { { Links::l1 * cosf(a1) + Links::l2 * cosf(a12),
+                   Links::l1 * sinf(a1) + Links::l2 * sinf(a12) } };
+    }
+
+    template <int ElbowUp = HALO_ELBOW_DOWN>
+    static inline int ik(const pose& p, joints& q)
+    {
+        float a1, a2;
+        int ok = detail::two_link<Links, ElbowUp>::solve(p[0], p[1], a1, a2);
+        q[0] = a1 * HALO_RAD_TO_DEG_F;
+        q[1] = a2 * HALO_RAD_TO_DEG_F;
+        return ok;
+    }
+
+    // Batch form of ik(): no branches in the loop body
+    template <int ElbowUp = HALO_ELBOW_DOWN>
+    static inline int ik_batch(const pose* p, joints* q, unsigned char* reachable, int n)
+    {
+        int count = 0;
+        for (int i = 0; i < n; i++)
+        {
+            int ok = ik<ElbowUp>(p[i], q[i]);
+            reachable[i] = (unsigned char)ok;
+            count += ok;
+        }
+        return count;
+    }
+};
+
+// ---------- 3R planar ----------
+
+template <class Links>
+struct kinematics<Links, layout::planar_3r>
+{
+    static constexpr int dof = 3;
+    using joints = vec<3>;      // theta1, theta2, theta3 (deg)
+    using pose   = vec<3>;      // x, y (cm), phi (deg)
+
+    static inline pose fk(const joints& q)
+    {
+        float a1   = q[0] * HALO_DEG_TO_RAD_F;
+        float a12  = a1 + q[1] * HALO_DEG_TO_RAD_F;
+        float phi  = q[0] + q[1] + q[2];
+        float a123 = phi * HALO_DEG_TO_RAD_F;
+        return { { Links::l1 * cosf(a1) + Links::l2 * cosf(a12) + Links::l3 * cosf(a123),
+                   Links::l1 * sinf(a1) + Links::l2 * sinf(a12) + Links::l3 * sinf(a123),
+                   phi } };
+    }
+
+    // Wrist point = target - L3 * (cos phi, sin phi), then the 2R core
+    template <int ElbowUp = HALO_ELBOW_DOWN>
+    static inline int ik(const pose& p, joints& q)
+    {
+        float phi = p[2] * HALO_DEG_TO_RAD_F;
+        float wx  = p[0] - Links::l3 * cosf(phi);
+        float wy  = p[1] - Links::l3 * sinf(phi);
+
+        float a1, a2;
+        int ok = detail::two_link<Links, ElbowUp>::solve(wx, wy, a1, a2);
+        q[0] = a1 * HALO_RAD_TO_DEG_F;
+        q[1] = a2 * HALO_RAD_TO_DEG_F;
+        q[2] = p[2] - q[0] - q[1];
+        return ok;
+    }
+};
+
+// ---------- SCARA ----------
+
+template <class Links>
+struct kinematics<Links, layout::scara>
+{
+    static constexpr int dof = 4;
+    using joints = vec<4>;      // theta1, theta2 (deg), d3 (cm), theta4 (deg)
+    using pose   = vec<4>;      // x, y, z (cm), phi (deg)
+
+    static inline pose fk(const joints& q)
+    {
+        float a1  = q[0] * HALO_DEG_TO_RAD_F;
+        float a12 = a1 + q[1] * HALO_DEG_TO_RAD_F;
+        return { { Links::l1 * cosf(a1) + Links::l2 * cosf(a12),
+                   Links::l1 * sinf(a1) + Links::l2 * sinf(a12),
+                   Links::z0 - q[2],
+                   q[0] + q[1] + q[3] } };
+    }
+
+    // Arm in the plane, quill along z; d3 is clamped to [0, d3_max]
+    template <int ElbowUp = HALO_ELBOW_DOWN>
+    static inline int ik(const pose& p, joints& q)
+    {
+        float a1, a2;
+        int ok = detail::two_link<Links, ElbowUp>::solve(p[0], p[1], a1, a2);
+
+        float d3 = Links::z0 - p[2];
+        int   in_z = (d3 >= 0.0f) & (d3 <= Links::d3_max);
+        d3 = detail::select(d3 < 0.0f, 0.0f, d3);
+        d3 = detail::select(d3 > Links::d3_max, Links::d3_max, d3);
+
+        q[0] = a1 * HALO_RAD_TO_DEG_F;
+        q[1] = a2 * HALO_RAD_TO_DEG_F;
+        q[2] = d3;
+        q[3] = p[3] - q[0] - q[1];
+        return ok & in_z;
+    }
+};
+
+} // namespace halo
+
+#endif // HALO_KINEMATICS_HPP
@@ -0,0 +1,85 @@
+/**
+ * @file    halo_loop.c
+ * @brief   Deadline-driven fixed-rate loop with jitter statistics.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Deadlines advance by exactly one period, so work time and wake-up
+ *   latency never accumulate into drift
+ * - dt is measured wake-to-wake on the TIMER uptime clock
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_loop.h"
+#include "halo_timer.h"
+
+void halo_loop_init(halo_loop_t* loop, unsigned int period_us, unsigned int bin_us)
+{
+    loop->period_us = period_us;
+    loop->bin_us    = bin_us ? bin_us : 1;
+    loop->last_wake = halo_timer_uptime_us();
+    loop->deadline  = loop->last_wake + period_us;
+    halo_loop_reset_stats(loop);
+}
+
+void halo_loop_reset_stats(halo_loop_t* loop)
+{
+    loop->count    = 0;
+    loop->min_us   = 0xFFFFFFFFu;
+    loop->max_us   = 0;
+    loop->sum_us   = 0;
+    loop->overruns = 0;
+    for (int i = 0; i < HALO_LOOP_HIST_BINS; i++)
+        loop->hist[i] = 0;
+}
+
+static void record(halo_loop_t* loop, unsigned int dt_us)
+{
+    unsigned int dev = (dt_us > loop->period_us) ? dt_us - loop->period_us
+                                                 : loop->period_us - dt_us;
+    unsigned int bin = dev / loop->bin_us;
+
+    if (bin >= HALO_LOOP_HIST_BINS)
+        bin = HALO_LOOP_HIST_BINS - 1;
+
+    loop->hist[bin]++;
+    loop->count++;
+    loop->sum_us += dt_us;
+    if (dt_us < loop->min_us) loop->min_us = dt_us;
+    if (dt_us > loop->max_us) loop->max_us = dt_us;
+}
+
+float halo_loop_wait(halo_loop_t* loop)
+{
+    unsigned long long now = halo_timer_uptime_us();
+
+    if (now >= loop->deadline)
+    {
+        loop->overruns++;
+
+        // Skip deadlines that were missed entirely
+        while (loop->deadline + loop->period_us <= now)
+            loop->deadline += loop->period_us;
+    }
+    else
+    {
+        halo_timer_sleep_until(loop->deadline);
+        now = halo_timer_uptime_us();
+    }
+
+    unsigned int dt_us = (unsigned int)(now - loop->last_wake);
+    record(loop, dt_us);
+
+    loop->last_wake = now;
+    loop->deadline += loop->period_us;
+    return dt_us * 1e-6f;
+}
+
+unsigned int halo_loop_mean_us(const halo_loop_t* loop)
+{
+    return loop->count ? (unsigned int)(loop->sum_us / loop->count) : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef HALO_LOOP_H
+#define HALO_LOOP_H
+
+/**
+ * @file    halo_loop.h
+ * @brief   Fixed-rate loop: sleep until an absolute deadline, measured dt
+ *          and period/jitter statistics.
+ *
+ * @details
+ * A loop that does its work and then calls delay_us(period) runs at
+ * period + work time, and the error builds up in any integrator that
+ * assumes the nominal period. halo_loop_wait() instead sleeps until the
+ * next deadline on a fixed timeline (start + k * period) and returns the
+ * time actually elapsed since the previous wake, so controllers can
+ * integrate with the real dt.
+ *
+ * Usage:
+ * @code
+ * halo_loop_t loop;
+ * halo_loop_init(&loop, 20000, 50);
+ * while (1) {
+ *     float dt = halo_loop_wait(&loop);
+ *     ... control step using dt ...
+ * }
+ * @endcode
+ */
+
+// Histogram of |period - nominal|; the last bin collects everything beyond
+#define HALO_LOOP_HIST_BINS 16
+
+typedef struct
+{
+    unsigned int       period_us;       // nominal period
+    unsigned int       bin_us;          // histogram bin width
+    unsigned long long deadline;        // next wake-up (uptime, µs)
+    unsigned long long last_wake;       // previous wake-up (uptime, µs)
+
+    // Statistics over measured periods
+    unsigned long      count;
+    unsigned int       min_us;
+    unsigned int       max_us;
+    unsigned long long sum_us;
+    unsigned long      overruns;        // deadlines already past when waiting
+    unsigned long      hist[HALO_LOOP_HIST_BINS];
+} halo_loop_t;
+
+/**
+ * @brief Starts the timeline; the first deadline is one period from now.
+ */
+void halo_loop_init(halo_loop_t* loop, unsigned int period_us, unsigned int bin_us);
+
+/**
+ * @brief Sleeps until the next deadline and records the period.
+ *
+ * If the deadline has already passed the call returns at once and counts
+ * an overrun; deadlines that were missed entirely are skipped so the
+ * timeline keeps its phase.
+ *
+ * @return Time since the previous wake-up, in seconds
+ */
+float halo_loop_wait(halo_loop_t* loop);
+
+// Mean measured period in µs (0 before the first period)
+unsigned int halo_loop_mean_us(const halo_loop_t* loop);
+
+// Clears the statistics, keeps the timeline
+void halo_loop_reset_stats(halo_loop_t* loop);
+
+#endif // HALO_LOOP_H
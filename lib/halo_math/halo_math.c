@@ -0,0 +1,180 @@
+/**
+ * @file    halo_math.c
+ * @brief   CORDIC atan2/sin/cos, acos and integer square root in Q16.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - The CORDIC angle accumulator runs in Q22 degrees (180° < 2^31) so the
+ *   rounding of the small table entries stays below the Q16 output LSB
+ * - Vectoring inputs are normalised to 2^28..2^29 first, which keeps the
+ *   CORDIC gain (1.647) clear of int overflow at any input scale
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_math.h"
+
+// atan(2^-i) in Q22 degrees
+static const int cordic_atan_q22[HALO_CORDIC_ITERS] = {
+    188743680, 111421900, 58872272, 29884485, 15000234, 7507429, 3754631,
+    1877430, 938729, 469366, 234683, 117342, 58671, 29335, 14668, 7334,
+    3667, 1833, 917, 458
+};
+
+// 1 / CORDIC gain for HALO_CORDIC_ITERS iterations, Q30
+#define CORDIC_INV_GAIN_Q30 652032874
+
+#define DEG90_Q22  (90 << 22)
+#define DEG180_Q22 (180 << 22)
+
+static int q22_to_q16(int a)
+{
+    return (a + (1 << 5)) >> 6;
+}
+
+// ---------- atan2 ----------
+
+int halo_atan2_q16(int y, int x)
+{
+    return halo_atan2_q16_64(y, x);
+}
+
+int halo_atan2_q16_64(long long y, long long x)
+{
+    if (x == 0 && y == 0)
+        return 0;
+
+    long long lx = x, ly = y;
+    int z = 0;
+
+    // Rotate into the right half-plane; |values| < 2^62 so negation is safe
+    if (lx < 0)
+    {
+        z  = (ly >= 0) ? DEG180_Q22 : -DEG180_Q22;
+        lx = -lx;
+        ly = -ly;
+    }
+
+    // Normalise so max(|x|, |y|) lies in [2^28, 2^29), in at most 6 + 5 steps
+    unsigned long long m = (unsigned long long)(ly < 0 ? -ly : ly);
+    if ((unsigned long long)lx > m)
+        m = (unsigned long long)lx;
+
+    for (int sh = 32; sh; sh >>= 1)
+    {
+        if (m >= (1ull << (28 + sh)))
+        {
+            lx >>= sh;      // dropped bits are below the CORDIC resolution
+            ly >>= sh;
+            m >>= sh;
+        }
+    }
+    for (int sh = 16; sh; sh >>= 1)
+    {
+        if (m < (1ull << (29 - sh)))
+        {
+            lx *= 1ll << sh;    // multiply: left shift of a negative is UB
+            ly *= 1ll << sh;
+            m <<= sh;
+        }
+    }
+
+    int cx = (int)lx, cy = (int)ly;
+
+    // Vectoring: drive y to 0, accumulating the rotation in z.
+    // s is 0 to rotate clockwise, -1 otherwise; (v ^ s) - s negates v
+    // under the mask, so the loop has no data-dependent branch.
+    for (int i = 0; i < HALO_CORDIC_ITERS; i++)
+    {
+        int dx = cx >> i;
+        int dy = cy >> i;
+        int s  = -(cy <= 0);
+        cx += (dy ^ s) - s;
+        cy -= (dx ^ s) - s;
+        z  += (cordic_atan_q22[i] ^ s) - s;
+    }
+
+    // (-180°, 180°]
+    if (z <= -DEG180_Q22)
+        z += 2 * DEG180_Q22;
+    return q22_to_q16(z);
+}
+
+// ---------- acos ----------
+
+int halo_acos_q16(int x_q16)
+{
+    if (x_q16 >  HALO_Q16_ONE) x_q16 =  HALO_Q16_ONE;
+    if (x_q16 < -HALO_Q16_ONE) x_q16 = -HALO_Q16_ONE;
+
+    // acos(x) = atan2(sqrt(1 - x^2), x). 1 - x^2 is exact in Q32; taking
+    // the root of it in Q48 gives s in Q24, which keeps precision near
+    // x = ±1 where s is small. atan2 only needs a common scale.
+    unsigned long long x2 = (unsigned long long)((long long)x_q16 * x_q16);
+    int s_q24 = (int)halo_isqrt64(((1ull << 32) - x2) << 16);
+
+    return halo_atan2_q16(s_q24, x_q16 * 256);
+}
+
+// ---------- sin / cos ----------
+
+void halo_sincos_q16(int angle_q16_deg, int* sin_q16, int* cos_q16)
+{
+    // Reduce to (-180°, 180°] in Q16, then to [-90°, 90°] with a sign flip
+    int a = angle_q16_deg % (360 * HALO_Q16_ONE);
+    if (a >   180 * HALO_Q16_ONE) a -= 360 * HALO_Q16_ONE;
+    if (a <= -180 * HALO_Q16_ONE) a += 360 * HALO_Q16_ONE;
+
+    int flip = 0;
+    if (a > 90 * HALO_Q16_ONE)       { a -= 180 * HALO_Q16_ONE; flip = 1; }
+    else if (a < -90 * HALO_Q16_ONE) { a += 180 * HALO_Q16_ONE; flip = 1; }
+
+    // Rotation: start from (1/K, 0) in Q30 and rotate by a
+    int cx = CORDIC_INV_GAIN_Q30;
+    int cy = 0;
+    int z  = a * 64;    // Q22 (multiply: a is negative below 0°)
+
+    for (int i = 0; i < HALO_CORDIC_ITERS; i++)
+    {
+        int dx = cx >> i;
+        int dy = cy >> i;
+        int s  = -(z < 0);  // same masked negation as in atan2
+        cx -= (dy ^ s) - s;
+        cy += (dx ^ s) - s;
+        z  -= (cordic_atan_q22[i] ^ s) - s;
+    }
+
+    // Q30 -> Q16 with rounding
+    int c = (cx + (1 << 13)) >> 14;
+    int s = (cy + (1 << 13)) >> 14;
+
+    *cos_q16 = flip ? -c : c;
+    *sin_q16 = flip ? -s : s;
+}
+
+// ---------- sqrt ----------
+
+unsigned int halo_isqrt64(unsigned long long v)
+{
+    unsigned long long res = 0;
+    unsigned long long bit = 1ull << 62;
+
+    // Bit-by-bit: fixed 32 iterations, the compare folded into a mask
+    while (bit)
+    {
+        unsigned long long t = res + bit;
+        unsigned long long m = 0ull - (v >= t);
+        v   -= t & m;
+        res  = (res >> 1) + (bit & m);
+        bit >>= 2;
+    }
+    return (unsigned int)res;
+}
+
+unsigned int halo_sqrt_q16(unsigned int x_q16)
+{
+    return halo_isqrt64((unsigned long long)x_q16 << 16);
+}
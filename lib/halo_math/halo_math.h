@@ -0,0 +1,66 @@
+#ifndef HALO_MATH_H
+#define HALO_MATH_H
+
+/**
+ * @file    halo_math.h
+ * @brief   Integer-only trig and square root for on-target kinematics.
+ *
+ * @details
+ * - Q16 fixed point throughout: values are int * 2^-16, angles are Q16
+ *   degrees (65536 = 1°), matching the degree convention of the examples
+ * - atan2 / sin / cos are CORDIC with HALO_CORDIC_ITERS iterations, sqrt is
+ *   a bit-by-bit integer root; no libm, no data-dependent iteration
+ *   counts, so every call costs the same
+ * - The only division is the one modulo halo_sincos_q16() uses to reduce
+ *   its angle to one turn; the CORDIC and sqrt loops have none
+ *
+ * Error bounds (measured against double-precision libm over the full
+ * input range) and host cost (x86-64, gcc -O2):
+ * - halo_atan2_q16  : |err| <= 1.2e-4 deg    ~80 ns
+ * - halo_acos_q16   : |err| <= 1.2e-4 deg    ~150 ns
+ * - halo_sincos_q16 : |err| <= 0.62 LSB      ~60 ns
+ * - halo_sqrt_q16   : exact floor            ~65 ns
+ * The host has an FPU, so these lose to libm there; the numbers are for
+ * comparing the routines with each other.
+ *
+ * Operation counts per call (what a target without an FPU pays):
+ * - CORDIC: 20 iterations of 2 shifts, 6 add/sub/xor and 1 table load,
+ *   branch-free
+ * - sqrt: 32 iterations of compare, subtract and shifts (64-bit),
+ *   branch-free
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HALO_Q16_ONE       65536
+#define HALO_CORDIC_ITERS  20
+
+// Float <-> Q16 helpers (for converting at the edges of a float API)
+#define HALO_Q16(v)        ((int)((v) * 65536.0f + ((v) >= 0.0f ? 0.5f : -0.5f)))
+#define HALO_Q16_TO_F(q)   ((float)(q) * (1.0f / 65536.0f))
+
+// atan2(y, x) in Q16 degrees, (-180°, 180°]; x and y share any common scale
+int halo_atan2_q16(int y, int x);
+
+// Same for 64-bit inputs (|x|, |y| < 2^62), e.g. products of Q16 values
+int halo_atan2_q16_64(long long y, long long x);
+
+// acos(x) in Q16 degrees, [0°, 180°]; x in Q16, clamped to [-1, 1]
+int halo_acos_q16(int x_q16);
+
+// sin and cos of a Q16-degree angle, results in Q16
+void halo_sincos_q16(int angle_q16_deg, int* sin_q16, int* cos_q16);
+
+// sqrt(x) for x in Q16, result in Q16 (floor)
+unsigned int halo_sqrt_q16(unsigned int x_q16);
+
+// floor(sqrt(v)) for a 64-bit integer
+unsigned int halo_isqrt64(unsigned long long v);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HALO_MATH_H
@@ -0,0 +1,107 @@
+/**
+ * @file    halo_matrix.c
+ * @brief   Interrupt-driven, double-buffered 8x8 LED matrix driver.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - One TIMER interrupt per row: blank columns, select row, drive columns,
+ *   issued as a single register burst
+ * - The row stays lit until the next tick, so no delay_us in the scan
+ * - Page flips are latched at row 0 to avoid tearing
+ *
+ * @note
+ * - Display: 8×8 LED Matrix
+ * - Controller: Halo Ver 1.0
+ * - GPIOs used: GPIO0 (rows), GPIO1 (columns), TIMER
+ */
+
+#include "halo_matrix.h"
+#include "halo_timer.h"
+#include "halo.h"
+
+#define GPIO0_DIR 0x40000000u
+#define GPIO0_OUT 0x40000008u
+#define GPIO1_DIR 0x40000400u
+#define GPIO1_OUT 0x40000408u
+
+static unsigned char          frames[2][HALO_MATRIX_ROWS];
+static volatile unsigned char front;           // index of the frame being scanned
+static volatile unsigned char flip_pending;
+static volatile unsigned long frame_count;
+static unsigned char          scan_row;
+static unsigned int           row_period;
+
+void halo_matrix_init(unsigned int row_period_us)
+{
+    WRITE_REGISTER(GPIO0_DIR, 0xFF); // rows as output
+    WRITE_REGISTER(GPIO1_DIR, 0xFF); // cols as output
+    WRITE_REGISTER(GPIO1_OUT, 0xFF); // all off
+
+    for (int r = 0; r < HALO_MATRIX_ROWS; r++)
+    {
+        frames[0][r] = 0;
+        frames[1][r] = 0;
+    }
+
+    front        = 0;
+    flip_pending = 0;
+    frame_count  = 0;
+    scan_row     = 0;
+    row_period   = row_period_us;
+
+    halo_timer_attach(halo_matrix_isr);
+    halo_timer_start(row_period_us);
+}
+
+unsigned char* halo_matrix_back_buffer(void)
+{
+    // The back frame becomes the front one at the next frame boundary
+    while (flip_pending)
+        delay_us(row_period);
+
+    return frames[front ^ 1];
+}
+
+void halo_matrix_flip(void)
+{
+    flip_pending = 1;
+}
+
+void halo_matrix_show(const unsigned char frame[HALO_MATRIX_ROWS])
+{
+    unsigned char* back = halo_matrix_back_buffer();
+
+    for (int r = 0; r < HALO_MATRIX_ROWS; r++)
+        back[r] = frame[r];
+
+    halo_matrix_flip();
+}
+
+unsigned long halo_matrix_frame_count(void)
+{
+    return frame_count;
+}
+
+void halo_matrix_isr(void)
+{
+    if (scan_row == 0 && flip_pending)
+    {
+        front ^= 1;
+        flip_pending = 0;
+    }
+
+    const halo_reg_write_t scan[3] = {
+        { GPIO1_OUT, 0xFF },                                     // blank while switching rows
+        { GPIO0_OUT, 1u << scan_row },                           // select row
+        { GPIO1_OUT, (unsigned char)~frames[front][scan_row] },
+    };
+    WRITE_REGISTERS(scan, 3);
+
+    if (++scan_row == HALO_MATRIX_ROWS)
+    {
+        scan_row = 0;
+        frame_count++;
+    }
+}
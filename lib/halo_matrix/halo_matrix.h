@@ -0,0 +1,52 @@
+#ifndef HALO_MATRIX_H
+#define HALO_MATRIX_H
+
+/**
+ * @file    halo_matrix.h
+ * @brief   Frame-buffer driver for the 8x8 LED matrix.
+ *
+ * @details
+ * The driver owns two 8-byte frames (bit c of byte r = LED at row r,
+ * column c). The TIMER tick scans one row per interrupt from the front
+ * frame; the application draws into the back frame and flips. Flips take
+ * effect at the next frame boundary, so a frame is never shown half-drawn.
+ *
+ * @note
+ * - Rows on GPIO0 (0x40000008, active high), columns on GPIO1
+ *   (0x40000408, active low)
+ */
+
+#define HALO_MATRIX_ROWS 8
+
+/**
+ * @brief Configures the GPIOs, clears both frames and starts row scanning
+ *        at one row per row_period_us.
+ */
+void halo_matrix_init(unsigned int row_period_us);
+
+/**
+ * @brief Frame to draw into. Waits for a pending flip to complete first.
+ */
+unsigned char* halo_matrix_back_buffer(void);
+
+/**
+ * @brief Shows the back frame from the next frame boundary on.
+ */
+void halo_matrix_flip(void);
+
+/**
+ * @brief Copies a frame into the back buffer and flips.
+ */
+void halo_matrix_show(const unsigned char frame[HALO_MATRIX_ROWS]);
+
+/**
+ * @brief Number of complete frames scanned since init.
+ */
+unsigned long halo_matrix_frame_count(void);
+
+/**
+ * @brief Scans one row. Attached to the TIMER tick by halo_matrix_init().
+ */
+void halo_matrix_isr(void);
+
+#endif // HALO_MATRIX_H
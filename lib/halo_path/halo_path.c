@@ -0,0 +1,66 @@
+/**
+ * @file    halo_path.c
+ * @brief   Streaming decoder for delta-encoded path tables.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Tables are emitted by the pattern generators (halo_pattern.py)
+ * - Decoding a point is two byte loads and two adds; escapes are rare
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_path.h"
+
+void halo_path_begin(halo_path_reader_t* r, const halo_path_t* path)
+{
+    r->path  = path;
+    r->p     = path->data;
+    r->index = 0;
+    r->x     = path->x0;
+    r->y     = path->y0;
+}
+
+int halo_path_next_raw(halo_path_reader_t* r, short* x, short* y)
+{
+    if (r->index >= r->path->count)
+        return 0;
+
+    if (r->index > 0)
+    {
+        signed char dx = r->p[0];
+
+        if (dx == HALO_PATH_ESCAPE)
+        {
+            const unsigned char* b = (const unsigned char*)r->p + 1;
+            r->x = (short)(b[0] | (b[1] << 8));
+            r->y = (short)(b[2] | (b[3] << 8));
+            r->p += 5;
+        }
+        else
+        {
+            r->x = (short)(r->x + dx);
+            r->y = (short)(r->y + r->p[1]);
+            r->p += 2;
+        }
+    }
+
+    r->index++;
+    *x = r->x;
+    *y = r->y;
+    return 1;
+}
+
+int halo_path_next(halo_path_reader_t* r, float* x_cm, float* y_cm)
+{
+    short x, y;
+    if (!halo_path_next_raw(r, &x, &y))
+        return 0;
+
+    *x_cm = x * HALO_PATH_UNIT_CM;
+    *y_cm = y * HALO_PATH_UNIT_CM;
+    return 1;
+}
@@ -0,0 +1,58 @@
+#ifndef HALO_PATH_H
+#define HALO_PATH_H
+
+/**
+ * @file    halo_path.h
+ * @brief   Compact fixed-point, delta-encoded Cartesian paths.
+ *
+ * @details
+ * Coordinates are int16 in 0.01 cm (HALO_PATH_UNIT_CM), so tables written
+ * with two decimals are stored losslessly. Encoding of the data stream:
+ * - The first point is stored in the halo_path_t header (x0, y0)
+ * - Every following point is one byte dx and one byte dy (int8, ±1.27 cm)
+ * - A dx byte equal to HALO_PATH_ESCAPE is followed by an absolute point:
+ *   4 bytes, x then y, int16 little-endian (used for jumps between contours)
+ *
+ * A typical pattern costs ~2 bytes per point instead of 8 for float[2],
+ * and the table is const, so it stays in flash.
+ */
+
+#define HALO_PATH_UNIT_CM 0.01f
+#define HALO_PATH_ESCAPE  (-128)
+
+typedef struct
+{
+    const signed char* data;    // delta stream (points 1..count-1)
+    int   count;                // total number of points
+    short x0;                   // first point, 0.01 cm
+    short y0;
+} halo_path_t;
+
+// Streaming decoder state
+typedef struct
+{
+    const halo_path_t* path;
+    const signed char* p;
+    int   index;                // index of the next point to return
+    short x;                    // last decoded point, 0.01 cm
+    short y;
+} halo_path_reader_t;
+
+/**
+ * @brief Rewinds the reader to the first point of the path.
+ */
+void halo_path_begin(halo_path_reader_t* r, const halo_path_t* path);
+
+/**
+ * @brief Decodes the next point in fixed point (0.01 cm).
+ * @return 1 if a point was returned, 0 at the end of the path
+ */
+int halo_path_next_raw(halo_path_reader_t* r, short* x, short* y);
+
+/**
+ * @brief Decodes the next point in cm.
+ * @return 1 if a point was returned, 0 at the end of the path
+ */
+int halo_path_next(halo_path_reader_t* r, float* x_cm, float* y_cm);
+
+#endif // HALO_PATH_H
@@ -0,0 +1,142 @@
+/**
+ * @file    halo_pi.c
+ * @brief   Fixed-point multi-channel PI engine and its float reference.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Per channel and step: 3 multiplies (16 x 16 -> 32 bit), one 32 x 16
+ *   multiply for the anti-windup term, two more to scale the integral and
+ *   anti-windup steps by the measured dt, adds and clamps; no division
+ * - Proportional and integral terms are summed in 64 bits so large
+ *   errors cannot wrap before saturation
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_pi.h"
+
+// ---------- Helpers ----------
+
+static short gain_q15(float g, int shift)
+{
+    float v = g / (float)(1 << shift) * 32768.0f;
+    if (v > 32767.0f)  v = 32767.0f;
+    if (v < -32768.0f) v = -32768.0f;
+    return (short)(v + (v >= 0.0f ? 0.5f : -0.5f));
+}
+
+static long long clamp64(long long v, long long lo, long long hi)
+{
+    return v < lo ? lo : (v > hi ? hi : v);
+}
+
+// ---------- Fixed-point engine ----------
+
+void halo_pi_init(halo_pi_t* pi, int n, const halo_pi_gains_t* gains,
+                  float full_scale, float dt_s)
+{
+    if (n > HALO_PI_MAX_CH)
+        n = HALO_PI_MAX_CH;
+    pi->n = n;
+
+    // Smallest shift that brings every gain below 1.0
+    float g_max = 0.0f;
+    for (int i = 0; i < n; i++)
+    {
+        float g[3] = { gains[i].kp, gains[i].ki * dt_s, gains[i].kaw * dt_s };
+        for (int k = 0; k < 3; k++)
+        {
+            float a = g[k] < 0.0f ? -g[k] : g[k];
+            if (a > g_max)
+                g_max = a;
+        }
+    }
+    pi->shift = 0;
+    while (pi->shift < 15 && g_max >= (float)(1 << pi->shift))
+        pi->shift++;
+
+    for (int i = 0; i < n; i++)
+    {
+        pi->target[i]  = 0;
+        pi->kp[i]      = gain_q15(gains[i].kp, pi->shift);
+        pi->ki_dt[i]   = gain_q15(gains[i].ki * dt_s, pi->shift);
+        pi->kaw_dt[i]  = gain_q15(gains[i].kaw * dt_s, pi->shift);
+        pi->out_min[i] = HALO_PI_Q15(gains[i].out_min, full_scale);
+        pi->out_max[i] = HALO_PI_Q15(gains[i].out_max, full_scale);
+        pi->integ[i]   = 0;
+    }
+}
+
+void halo_pi_reset(halo_pi_t* pi)
+{
+    for (int i = 0; i < pi->n; i++)
+        pi->integ[i] = 0;
+}
+
+void halo_pi_update(halo_pi_t* pi, int dt_q15, const short* meas, const short* ff, short* out)
+{
+    const int       s     = pi->shift;
+    const long long scale = 2ll << s;   // Q30 -> Q31, times the gain scale
+
+    if (dt_q15 < 0)                  dt_q15 = 0;
+    if (dt_q15 > HALO_PI_DT_MAX_Q15) dt_q15 = HALO_PI_DT_MAX_Q15;
+
+    for (int i = 0; i < pi->n; i++)
+    {
+        int e = pi->target[i] - meas[i];                    // Q15, |e| < 2^16
+
+        // Q15 * Q15 = Q30; Q15 values are widened to Q31 with * 65536
+        long long p   = (long long)(pi->kp[i] * e) * scale;
+        long long inc = (((long long)(pi->ki_dt[i] * e) * dt_q15) >> 15) * scale;
+        long long u   = p + pi->integ[i] + (ff ? ff[i] * 65536ll : 0);
+
+        long long lo = pi->out_min[i] * 65536ll;
+        long long hi = pi->out_max[i] * 65536ll;
+        long long u_sat = clamp64(u, lo, hi);
+
+        // Back-calculation: bleed the integrator by the saturation excess.
+        // The step is bounded to 2^45 (far past the Q31 integrator range)
+        // so scaling it by dt cannot overflow
+        long long aw = clamp64(((u_sat - u) * pi->kaw_dt[i]) >> (15 - s), -(1ll << 45), 1ll << 45);
+        aw = (aw * dt_q15) >> 15;
+
+        pi->integ[i] = (int)clamp64(pi->integ[i] + inc + aw, -0x7FFFFFFFll - 1, 0x7FFFFFFFll);
+        out[i] = (short)(u_sat >> 16);
+    }
+}
+
+// ---------- Float reference ----------
+
+void halo_pi_ref_init(halo_pi_ref_t* pi, int n, const halo_pi_gains_t* gains)
+{
+    if (n > HALO_PI_MAX_CH)
+        n = HALO_PI_MAX_CH;
+    pi->n = n;
+
+    for (int i = 0; i < n; i++)
+    {
+        pi->target[i] = 0.0f;
+        pi->integ[i]  = 0.0f;
+        pi->gains[i]  = gains[i];
+    }
+}
+
+void halo_pi_ref_update(halo_pi_ref_t* pi, float dt_s, const float* meas, const float* ff, float* out)
+{
+    for (int i = 0; i < pi->n; i++)
+    {
+        const halo_pi_gains_t* g = &pi->gains[i];
+        float e = pi->target[i] - meas[i];
+        float u = g->kp * e + pi->integ[i] + (ff ? ff[i] : 0.0f);
+
+        float u_sat = u;
+        if (u_sat < g->out_min) u_sat = g->out_min;
+        if (u_sat > g->out_max) u_sat = g->out_max;
+
+        pi->integ[i] += g->ki * dt_s * e + g->kaw * dt_s * (u_sat - u);
+        out[i] = u_sat;
+    }
+}
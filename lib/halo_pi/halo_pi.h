@@ -0,0 +1,110 @@
+#ifndef HALO_PI_H
+#define HALO_PI_H
+
+/**
+ * @file    halo_pi.h
+ * @brief   Fixed-point multi-channel PI controller engine.
+ *
+ * @details
+ * - Up to 8 channels (one per PWM channel), state kept as contiguous
+ *   per-field arrays and updated in one pass
+ * - Values are Q15 fractions of a full-scale range chosen at init
+ *   (e.g. 180 deg = 1.0), the integrator is Q31
+ * - Gains are Q15 with a shared power-of-two scale, so gains >= 1 work;
+ *   ki and kaw are pre-multiplied by the nominal loop period, and each
+ *   update scales them by the measured dt as a Q15 ratio to that period
+ * - Output saturation with back-calculation anti-windup:
+ *     u     = ff + kp * e + I
+ *     u_sat = clamp(u, out_min, out_max)
+ *     I    += ki * dt * e + kaw * dt * (u_sat - u)
+ * - No floating point in halo_pi_update(); floats are only used by
+ *   halo_pi_init() to convert the gains
+ * - halo_pi_ref_* runs the same equations in float, for validating the
+ *   fixed-point path against a reference
+ *
+ * Usage with halo_loop, which returns the measured wake-to-wake dt:
+ * @code
+ * float dt = halo_loop_wait(&loop);
+ * halo_pi_update(&pi, HALO_PI_DT_Q15(dt, 0.02f), meas, ff, out);
+ * @endcode
+ */
+
+#define HALO_PI_MAX_CH 8
+
+// Float value -> Q15 fraction of full_scale (saturating)
+#define HALO_PI_Q15(v, full_scale) \
+    ((short)(((v) / (full_scale)) >= 1.0f ? 32767 : \
+             ((v) / (full_scale)) <= -1.0f ? -32768 : (int)(((v) / (full_scale)) * 32768.0f)))
+
+// Longest dt an update integrates over, as a Q15 ratio to the nominal period (4x)
+#define HALO_PI_DT_MAX_Q15 (4 << 15)
+
+// Measured dt / nominal dt -> Q15 ratio for halo_pi_update() (32768 = on time)
+#define HALO_PI_DT_Q15(dt_s, nominal_s) \
+    (((dt_s) / (nominal_s)) >= 4.0f ? HALO_PI_DT_MAX_Q15 : \
+     ((dt_s) <= 0.0f ? 0 : (int)(((dt_s) / (nominal_s)) * 32768.0f + 0.5f)))
+
+// Gains and limits of one channel, in the engineering units of full_scale
+typedef struct
+{
+    float kp;
+    float ki;                   // 1/s
+    float kaw;                  // anti-windup back-calculation gain, 1/s (0 = off)
+    float out_min;
+    float out_max;
+} halo_pi_gains_t;
+
+// ---------- Fixed-point engine ----------
+
+typedef struct
+{
+    int   n;
+    int   shift;                        // gains are scaled by 2^shift
+    short target[HALO_PI_MAX_CH];       // setpoints, Q15
+    short kp[HALO_PI_MAX_CH];           // Q15 >> shift
+    short ki_dt[HALO_PI_MAX_CH];        // Q15 >> shift
+    short kaw_dt[HALO_PI_MAX_CH];       // Q15 >> shift
+    short out_min[HALO_PI_MAX_CH];      // Q15
+    short out_max[HALO_PI_MAX_CH];      // Q15
+    int   integ[HALO_PI_MAX_CH];        // integrator, Q31
+} halo_pi_t;
+
+/**
+ * @brief Sets up n channels from per-channel gains and clears their state.
+ *
+ * @param full_scale  Engineering value that maps to Q15 1.0
+ * @param dt_s        Nominal loop period; the ki and kaw gains are scaled by it
+ */
+void halo_pi_init(halo_pi_t* pi, int n, const halo_pi_gains_t* gains,
+                  float full_scale, float dt_s);
+
+/**
+ * @brief Runs one control step on every channel.
+ *
+ * @param dt_q15  Time since the previous update as a Q15 ratio to the
+ *                nominal period (HALO_PI_DT_Q15), clamped to HALO_PI_DT_MAX_Q15
+ * @param meas    Measurements, Q15
+ * @param ff      Feed-forward added before saturation, Q15 (may be NULL)
+ * @param out     Saturated outputs, Q15
+ */
+void halo_pi_update(halo_pi_t* pi, int dt_q15, const short* meas, const short* ff, short* out);
+
+// Clears the integrators
+void halo_pi_reset(halo_pi_t* pi);
+
+// ---------- Float reference ----------
+
+typedef struct
+{
+    int             n;
+    float           target[HALO_PI_MAX_CH];
+    float           integ[HALO_PI_MAX_CH];
+    halo_pi_gains_t gains[HALO_PI_MAX_CH];
+} halo_pi_ref_t;
+
+void halo_pi_ref_init(halo_pi_ref_t* pi, int n, const halo_pi_gains_t* gains);
+
+// Same step as halo_pi_update, in engineering units, over dt_s seconds (ff may be NULL)
+void halo_pi_ref_update(halo_pi_ref_t* pi, float dt_s, const float* meas, const float* ff, float* out);
+
+#endif // HALO_PI_H
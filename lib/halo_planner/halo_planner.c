@@ -0,0 +1,212 @@
+/**
+ * @file    halo_planner.c
+ * @brief   Junction-deviation look-ahead over a ring of line segments.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Re-planning is O(buffer) and runs only when a segment is queued;
+ *   halo_planner_next() only samples the current trapezoid and tracks
+ *   the IK, so the per-period cost matches move_line()
+ * - The IK tracker runs across segment boundaries, so a blended corner
+ *   does not force a closed-form re-solve
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_planner.h"
+
+#define PLANNER_REANCHOR_STEPS 16
+#define PLANNER_MAX_DRIFT_DEG  0.05f
+#define PLANNER_MIN_LEN_CM     1e-3f
+
+static halo_plan_seg_t* seg_at(halo_planner_t* pl, int i)
+{
+    return &pl->seg[(pl->head + i) % HALO_PLANNER_BUFFER];
+}
+
+// ---------- Setup ----------
+
+void halo_planner_init(halo_planner_t* pl, const halo_arm_t* arm, int elbow_up,
+                       const halo_joint_limits_t lim[2], float deviation, float period_s)
+{
+    pl->arm       = arm;
+    pl->elbow_up  = elbow_up;
+    pl->lim[0]    = lim[0];
+    pl->lim[1]    = lim[1];
+    pl->deviation = deviation;
+    pl->period    = period_s;
+    pl->t1        = 0.0f;
+    pl->t2        = 0.0f;
+
+    halo_planner_start(pl, 0.0f, 0.0f);
+}
+
+void halo_planner_start(halo_planner_t* pl, float x, float y)
+{
+    pl->head    = 0;
+    pl->count   = 0;
+    pl->running = 0;
+    pl->t       = 0.0f;
+    pl->x       = x;
+    pl->y       = y;
+
+    halo_ik_track_init(&pl->tracker, pl->arm, pl->elbow_up,
+                       PLANNER_REANCHOR_STEPS, PLANNER_MAX_DRIFT_DEG);
+}
+
+// ---------- Planning ----------
+
+// Highest speed through the corner from prev into s within the deviation
+static float junction_speed(const halo_planner_t* pl, const halo_plan_seg_t* prev,
+                            const halo_plan_seg_t* s)
+{
+    float v_cap = (prev->v_max < s->v_max) ? prev->v_max : s->v_max;
+    float a     = (prev->a_max < s->a_max) ? prev->a_max : s->a_max;
+
+    // sin(θ/2) from the cosine of the turn; 1 = straight on
+    float cos_theta = -(prev->ux * s->ux + prev->uy * s->uy);
+    float sin_half  = sqrtf(0.5f * (1.0f - cos_theta));
+    if (sin_half > 0.9999f)
+        return v_cap;
+
+    float v = sqrtf(a * pl->deviation * sin_half / (1.0f - sin_half));
+    return (v < v_cap) ? v : v_cap;
+}
+
+static void replan(halo_planner_t* pl)
+{
+    int first = pl->running;    // the executing segment keeps its plan
+
+    // Backward: every entry must still allow a stop at the end of the buffer
+    float v_next = 0.0f;
+    for (int i = pl->count - 1; i >= first; i--)
+    {
+        halo_plan_seg_t* s = seg_at(pl, i);
+        float v = sqrtf(v_next * v_next + 2.0f * s->a_max * s->len);
+        s->v_entry = (s->v_junction < v) ? s->v_junction : v;
+        v_next = s->v_entry;
+    }
+
+    // Forward: entries the arm can actually reach
+    for (int i = first; i < pl->count; i++)
+    {
+        halo_plan_seg_t* s = seg_at(pl, i);
+        if (i == 0)
+        {
+            s->v_entry = 0.0f;
+        }
+        else if (i == first)
+        {
+            s->v_entry = seg_at(pl, i - 1)->prof.v_end;
+        }
+        else
+        {
+            const halo_plan_seg_t* p = seg_at(pl, i - 1);
+            float v = sqrtf(p->v_entry * p->v_entry + 2.0f * p->a_max * p->len);
+            if (v < s->v_entry)
+                s->v_entry = v;
+        }
+    }
+
+    for (int i = first; i < pl->count; i++)
+    {
+        halo_plan_seg_t* s = seg_at(pl, i);
+        float v_exit = (i + 1 < pl->count) ? seg_at(pl, i + 1)->v_entry : 0.0f;
+        halo_profile_plan_blend(&s->prof, s->len, s->v_entry, v_exit, s->v_max, s->a_max);
+    }
+}
+
+int halo_planner_line_to(halo_planner_t* pl, float x, float y)
+{
+    if (pl->count == HALO_PLANNER_BUFFER)
+        return 0;
+
+    float dx  = x - pl->x;
+    float dy  = y - pl->y;
+    float len = sqrtf(dx * dx + dy * dy);
+    if (len < PLANNER_MIN_LEN_CM)
+        return 1;
+
+    halo_plan_seg_t* s = seg_at(pl, pl->count);
+    s->x1  = pl->x;
+    s->y1  = pl->y;
+    s->dx  = dx;
+    s->dy  = dy;
+    s->len = len;
+    s->ux  = dx / len;
+    s->uy  = dy / len;
+
+    // Limits on s in [0, 1] scale to cm by the length
+    halo_joint_limits_t path;
+    halo_profile_line_limits(pl->arm, pl->x, pl->y, x, y, pl->elbow_up, pl->lim, 0, &path);
+    s->v_max = path.v_max * len;
+    s->a_max = path.a_max * len;
+
+    s->v_junction = (pl->count > 0) ? junction_speed(pl, seg_at(pl, pl->count - 1), s) : 0.0f;
+
+    pl->count++;
+    pl->x = x;
+    pl->y = y;
+
+    replan(pl);
+    return 1;
+}
+
+// ---------- Execution ----------
+
+int halo_planner_next(halo_planner_t* pl, float* theta1_deg, float* theta2_deg)
+{
+    if (pl->count == 0)
+        return 0;
+
+    if (!pl->running)
+    {
+        pl->running = 1;
+        pl->t = 0.0f;
+    }
+    pl->t += pl->period;
+
+    halo_plan_seg_t* s = seg_at(pl, 0);
+    float d;
+
+    while (pl->t >= s->prof.duration)
+    {
+        if (pl->count == 1)
+        {
+            // Last segment: land on its end and go idle
+            pl->count   = 0;
+            pl->running = 0;
+            pl->head    = (pl->head + 1) % HALO_PLANNER_BUFFER;
+            break;
+        }
+
+        pl->t -= s->prof.duration;
+        pl->head = (pl->head + 1) % HALO_PLANNER_BUFFER;
+        pl->count--;
+        s = seg_at(pl, 0);
+    }
+
+    d = pl->running ? halo_profile_pos(&s->prof, pl->t) / s->len : 1.0f;
+
+    float t1, t2;
+    if (halo_ik_track(&pl->tracker, s->x1 + d * s->dx, s->y1 + d * s->dy, &t1, &t2))
+    {
+        pl->t1 = t1;
+        pl->t2 = t2;
+    }
+
+    *theta1_deg = pl->t1;
+    *theta2_deg = pl->t2;
+    return 1;
+}
+
+float halo_planner_remaining(const halo_planner_t* pl)
+{
+    float t = pl->running ? -pl->t : 0.0f;
+    for (int i = 0; i < pl->count; i++)
+        t += pl->seg[(pl->head + i) % HALO_PLANNER_BUFFER].prof.duration;
+    return (t > 0.0f) ? t : 0.0f;
+}
@@ -0,0 +1,115 @@
+#ifndef HALO_PLANNER_H
+#define HALO_PLANNER_H
+
+/**
+ * @file    halo_planner.h
+ * @brief   Look-ahead planner that blends a polyline through its corners
+ *          (junction deviation) instead of stopping at each one.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * Segments are buffered as they are queued. For each junction the planner
+ * takes the highest speed that keeps the corner within the deviation
+ * tolerance: the speed of a circle of deviation δ touching both segments,
+ *
+ *   v² = a · δ · sin(θ/2) / (1 - sin(θ/2))
+ *
+ * (θ = angle between the segments; straight = no limit, reversal = 0).
+ * A backward pass then caps each entry speed so the arm can still stop at
+ * the end of the buffer, a forward pass caps it to what the arm can reach,
+ * and each segment gets a trapezoid from its entry to its exit speed.
+ *
+ * Per-segment speed and acceleration come from the joint limits through
+ * the IK sensitivity of that segment (halo_profile_line_limits()), so
+ * straight runs far from the base go faster than folded-arm moves.
+ *
+ * Setpoints are pulled one per period; the pulled stream is continuous
+ * across segments:
+ * @code
+ * halo_planner_init(&pl, &arm, HALO_ELBOW_DOWN, limits, 0.05f, 0.02f);
+ * halo_planner_start(&pl, x0, y0);
+ * ... halo_planner_line_to(&pl, x, y) for each corner ...
+ * while (halo_planner_next(&pl, &t1, &t2)) {
+ *     ... wait for the next period, write t1 / t2 ...
+ * }
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - The setpoint path still passes through every corner; δ bounds how much
+ *   the servos (which cannot turn instantly) round it off
+ * - The executing segment is never re-planned; queue segments ahead of it
+ *   or the arm stops at the end of what it has
+ */
+
+#include "halo_kinematics.h"
+#include "halo_profile.h"
+
+#define HALO_PLANNER_BUFFER 16  // segments of look-ahead
+
+typedef struct
+{
+    float x1, y1;               // start (cm)
+    float dx, dy;               // end - start
+    float len;                  // cm
+    float ux, uy;               // unit direction
+    float v_max;                // cm/s, from the joint limits
+    float a_max;                // cm/s^2, from the joint limits
+    float v_junction;           // max entry speed at the start corner
+    float v_entry;              // planned entry speed
+    halo_profile_t prof;        // trapezoid over len (cm)
+} halo_plan_seg_t;
+
+typedef struct
+{
+    const halo_arm_t*   arm;
+    int                 elbow_up;
+    halo_joint_limits_t lim[2];
+    float               deviation;      // junction deviation (cm)
+    float               period;         // setpoint period (s)
+
+    halo_plan_seg_t seg[HALO_PLANNER_BUFFER];
+    int             head;               // executing (or next) segment
+    int             count;              // queued segments
+    int             running;            // seg[head] has started
+    float           t;                  // time into seg[head] (s)
+
+    float x, y;                         // end of the last queued segment
+    float t1, t2;                       // last setpoint (deg)
+
+    halo_ik_tracker_t tracker;
+} halo_planner_t;
+
+/**
+ * @param lim        Limits for { shoulder, elbow }
+ * @param deviation  Corner tolerance (cm); 0 stops at every corner
+ * @param period_s   Setpoint period (normally HALO_PROFILE_SERVO_PERIOD_S)
+ */
+void halo_planner_init(halo_planner_t* pl, const halo_arm_t* arm, int elbow_up,
+                       const halo_joint_limits_t lim[2], float deviation, float period_s);
+
+// Sets the start point of the next segment (no motion); clears the queue
+void halo_planner_start(halo_planner_t* pl, float x, float y);
+
+/**
+ * @brief Queues a line from the end of the previous segment to (x, y)
+ *        and re-plans the segments that have not started.
+ * @return 1 if queued, 0 if the buffer is full (pull setpoints first)
+ */
+int halo_planner_line_to(halo_planner_t* pl, float x, float y);
+
+/**
+ * @brief Advances one period and returns the joint setpoint.
+ *
+ * Unreachable points hold the last reachable solution.
+ *
+ * @return 1 while moving, 0 once the queue has run out
+ */
+int halo_planner_next(halo_planner_t* pl, float* theta1_deg, float* theta2_deg);
+
+// Time left in the queue as planned now (s)
+float halo_planner_remaining(const halo_planner_t* pl);
+
+#endif // HALO_PLANNER_H
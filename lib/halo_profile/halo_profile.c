@@ -0,0 +1,339 @@
+/**
+ * @file    halo_profile.c
+ * @brief   Trapezoidal and S-curve profile planning and sampling.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Deceleration is an acceleration phase played backwards, so only the
+ *   acceleration shape is integrated; rest-to-rest profiles are symmetric
+ * - When the cruise speed is out of reach, the peak speed is found by
+ *   bisection on the (monotonic) distance of a rest-to-rest move
+ * - A trapezoid is the S-curve with t_j = 0; blended (non-zero entry or
+ *   exit speed) profiles are trapezoids
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_profile.h"
+
+#define PROFILE_LINE_SEGMENTS 16
+#define PROFILE_BISECT_ITERS  24
+
+// ---------- Acceleration phase ----------
+
+// Shapes the acceleration phase that takes 0 to v
+static void accel_phase(halo_profile_t* p, float v, float a_max, float j_max)
+{
+    p->v_peak = v;
+
+    if (j_max <= 0.0f)
+    {
+        p->jerk   = 0.0f;
+        p->a_peak = a_max;
+        p->t_j    = 0.0f;
+        p->t_acc  = v / a_max;
+    }
+    else if (v * j_max >= a_max * a_max)
+    {
+        // Reaches a_max: jerk up, hold, jerk down
+        p->jerk   = j_max;
+        p->a_peak = a_max;
+        p->t_j    = a_max / j_max;
+        p->t_acc  = v / a_max + p->t_j;
+    }
+    else
+    {
+        // Triangular acceleration
+        p->jerk   = j_max;
+        p->t_j    = sqrtf(v / j_max);
+        p->a_peak = j_max * p->t_j;
+        p->t_acc  = 2.0f * p->t_j;
+    }
+
+    p->s_acc = 0.5f * v * p->t_acc;
+    p->t_dec = p->t_acc;
+    p->s_dec = p->s_acc;
+}
+
+// Travel and speed gained t into a phase of length t_phase that starts at rest
+static void accel_sample(const halo_profile_t* p, float t, float t_phase, float* s, float* v)
+{
+    float j  = p->jerk;
+    float a  = p->a_peak;
+    float tj = p->t_j;
+    float th = t_phase - 2.0f * tj;     // constant-acceleration hold
+
+    if (t < tj)
+    {
+        *s = j * t * t * t * (1.0f / 6.0f);
+        *v = 0.5f * j * t * t;
+        return;
+    }
+
+    float v1 = 0.5f * j * tj * tj;
+    float s1 = j * tj * tj * tj * (1.0f / 6.0f);
+
+    t -= tj;
+    if (t < th)
+    {
+        *s = s1 + v1 * t + 0.5f * a * t * t;
+        *v = v1 + a * t;
+        return;
+    }
+
+    float v2 = v1 + a * th;
+    float s2 = s1 + v1 * th + 0.5f * a * th * th;
+
+    t -= th;
+    if (t > tj)
+        t = tj;
+    *s = s2 + v2 * t + 0.5f * a * t * t - j * t * t * t * (1.0f / 6.0f);
+    *v = v2 + a * t - 0.5f * j * t * t;
+}
+
+// ---------- Planning ----------
+
+void halo_profile_plan(halo_profile_t* p, float dist, float v_max, float a_max, float j_max)
+{
+    p->dist     = dist;
+    p->v_start  = 0.0f;
+    p->v_end    = 0.0f;
+    p->t_cruise = 0.0f;
+
+    if (!(dist > 0.0f) || !(v_max > 0.0f) || !(a_max > 0.0f))
+    {
+        p->dist = (dist > 0.0f) ? dist : 0.0f;
+        p->v_peak = p->a_peak = p->jerk = 0.0f;
+        p->t_j = p->t_acc = p->t_dec = p->s_acc = p->s_dec = p->duration = 0.0f;
+        return;
+    }
+
+    accel_phase(p, v_max, a_max, j_max);
+
+    if (2.0f * p->s_acc <= dist)
+    {
+        p->t_cruise = (dist - 2.0f * p->s_acc) / v_max;
+    }
+    else if (j_max <= 0.0f)
+    {
+        // Triangle: v^2 / a = dist
+        accel_phase(p, sqrtf(dist * a_max), a_max, j_max);
+    }
+    else
+    {
+        float lo = 0.0f;
+        float hi = v_max;
+        for (int i = 0; i < PROFILE_BISECT_ITERS; i++)
+        {
+            float mid = 0.5f * (lo + hi);
+            accel_phase(p, mid, a_max, j_max);
+            if (2.0f * p->s_acc > dist) hi = mid;
+            else                        lo = mid;
+        }
+        accel_phase(p, lo, a_max, j_max);
+        p->t_cruise = (dist - 2.0f * p->s_acc) / lo;
+    }
+
+    p->duration = 2.0f * p->t_acc + p->t_cruise;
+}
+
+void halo_profile_plan_blend(halo_profile_t* p, float dist, float v_start, float v_end,
+                             float v_max, float a_max)
+{
+    halo_profile_plan(p, dist, v_max, a_max, 0.0f);
+    if (!(p->a_peak > 0.0f))
+        return;
+
+    float inv_2a = 0.5f / a_max;
+    float vp     = v_max;
+
+    // Peak where the acceleration and deceleration ramps meet
+    if ((2.0f * vp * vp - v_start * v_start - v_end * v_end) * inv_2a > dist)
+        vp = sqrtf(a_max * dist + 0.5f * (v_start * v_start + v_end * v_end));
+    if (vp < v_start) vp = v_start;
+    if (vp < v_end)   vp = v_end;
+
+    p->v_start  = v_start;
+    p->v_end    = v_end;
+    p->v_peak   = vp;
+    p->t_acc    = (vp - v_start) / a_max;
+    p->t_dec    = (vp - v_end) / a_max;
+    p->s_acc    = (vp * vp - v_start * v_start) * inv_2a;
+    p->s_dec    = (vp * vp - v_end * v_end) * inv_2a;
+    p->t_cruise = (dist - p->s_acc - p->s_dec) / vp;
+    if (p->t_cruise < 0.0f)
+        p->t_cruise = 0.0f;
+    p->duration = p->t_acc + p->t_cruise + p->t_dec;
+}
+
+void halo_profile_joint_limits(const float* dq_ds, const float* d2q_ds2,
+                               const halo_joint_limits_t* lim, int n, int scurve,
+                               halo_joint_limits_t* path)
+{
+    float v = 0.0f;     // 0 = not limited yet
+    float a = 0.0f;
+    float j = 0.0f;
+
+    // Speed: q' s' <= v_j, and q'' s'^2 may take at most half of a_j
+    for (int i = 0; i < n; i++)
+    {
+        float k = fabsf(dq_ds[i]);
+        float c = d2q_ds2 ? fabsf(d2q_ds2[i]) : 0.0f;
+
+        if (k > 0.0f && (v == 0.0f || lim[i].v_max < v * k))
+            v = lim[i].v_max / k;
+        if (c > 0.0f)
+        {
+            float vc = sqrtf(0.5f * lim[i].a_max / c);
+            if (v == 0.0f || vc < v)
+                v = vc;
+        }
+    }
+
+    // Acceleration: q' s'' + q'' s'^2 <= a_j; jerk through q' only
+    for (int i = 0; i < n; i++)
+    {
+        float k = fabsf(dq_ds[i]);
+        float c = d2q_ds2 ? fabsf(d2q_ds2[i]) : 0.0f;
+        if (k <= 0.0f)
+            continue;
+
+        float ai = (lim[i].a_max - c * v * v) / k;
+        if (a == 0.0f || ai < a)
+            a = ai;
+
+        if (scurve && lim[i].j_max > 0.0f)
+        {
+            float ji = lim[i].j_max / k;
+            if (j == 0.0f || ji < j)
+                j = ji;
+        }
+    }
+
+    path->v_max = v;
+    path->a_max = a;
+    path->j_max = j;
+}
+
+void halo_profile_plan_joints(halo_profile_t* p, const float* dq_ds, const float* d2q_ds2,
+                              const halo_joint_limits_t* lim, int n, int scurve)
+{
+    halo_joint_limits_t path;
+    halo_profile_joint_limits(dq_ds, d2q_ds2, lim, n, scurve, &path);
+    halo_profile_plan(p, 1.0f, path.v_max, path.a_max, path.j_max);
+}
+
+int halo_profile_line_limits(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                             int elbow_up, const halo_joint_limits_t lim[2], int scurve,
+                             halo_joint_limits_t* path)
+{
+    const float n = (float)PROFILE_LINE_SEGMENTS;
+
+    float prev[2], diff[2] = { 0.0f, 0.0f };
+    float k[2] = { 0.0f, 0.0f };
+    float c[2] = { 0.0f, 0.0f };
+    int   run = 0;      // consecutive reachable samples ending here
+    int   all = 1;
+
+    for (int i = 0; i <= PROFILE_LINE_SEGMENTS; i++)
+    {
+        float s = (float)i / n;
+        float q[2];
+        if (!halo_ik_solve(arm, x1 + s * (x2 - x1), y1 + s * (y2 - y1), elbow_up, &q[0], &q[1]))
+        {
+            // Unreachable samples are skipped, as move_line() skips them
+            run = 0;
+            all = 0;
+            continue;
+        }
+
+        for (int j = 0; run > 0 && j < 2; j++)
+        {
+            // theta1 comes from atan2: take the short way across +-180
+            float d = q[j] - prev[j];
+            if (d >  180.0f) d -= 360.0f;
+            if (d < -180.0f) d += 360.0f;
+
+            if (fabsf(d) * n > k[j])
+                k[j] = fabsf(d) * n;
+            if (run > 1 && fabsf(d - diff[j]) * n * n > c[j])
+                c[j] = fabsf(d - diff[j]) * n * n;
+            diff[j] = d;
+        }
+        prev[0] = q[0];
+        prev[1] = q[1];
+        run++;
+    }
+
+    halo_profile_joint_limits(k, c, lim, 2, scurve, path);
+    return all;
+}
+
+int halo_profile_plan_line(halo_profile_t* p, const halo_arm_t* arm,
+                           float x1, float y1, float x2, float y2, int elbow_up,
+                           const halo_joint_limits_t lim[2], int scurve)
+{
+    halo_joint_limits_t path;
+    int all = halo_profile_line_limits(arm, x1, y1, x2, y2, elbow_up, lim, scurve, &path);
+    halo_profile_plan(p, 1.0f, path.v_max, path.a_max, path.j_max);
+    return all;
+}
+
+// ---------- Sampling ----------
+
+float halo_profile_pos(const halo_profile_t* p, float t)
+{
+    float s, v;
+
+    if (t <= 0.0f)
+        return 0.0f;
+    if (t >= p->duration)
+        return p->dist;
+
+    if (t < p->t_acc)
+    {
+        accel_sample(p, t, p->t_acc, &s, &v);
+        return p->v_start * t + s;
+    }
+    if (t < p->t_acc + p->t_cruise)
+        return p->s_acc + p->v_peak * (t - p->t_acc);
+
+    t = p->duration - t;
+    accel_sample(p, t, p->t_dec, &s, &v);
+    return p->dist - p->v_end * t - s;
+}
+
+float halo_profile_vel(const halo_profile_t* p, float t)
+{
+    float s, v;
+
+    if (t <= 0.0f)
+        return p->v_start;
+    if (t >= p->duration)
+        return p->v_end;
+
+    if (t < p->t_acc)
+    {
+        accel_sample(p, t, p->t_acc, &s, &v);
+        return p->v_start + v;
+    }
+    if (t < p->t_acc + p->t_cruise)
+        return p->v_peak;
+
+    accel_sample(p, p->duration - t, p->t_dec, &s, &v);
+    return p->v_end + v;
+}
+
+int halo_profile_steps(const halo_profile_t* p, float period_s)
+{
+    if (!(p->dist > 0.0f))
+        return 0;
+
+    int n = (int)(p->duration / period_s);
+    if ((float)n * period_s < p->duration)
+        n++;
+    return (n > 0) ? n : 1;
+}
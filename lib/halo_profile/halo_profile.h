@@ -0,0 +1,137 @@
+#ifndef HALO_PROFILE_H
+#define HALO_PROFILE_H
+
+/**
+ * @file    halo_profile.h
+ * @brief   Trapezoidal and jerk-limited S-curve motion profiles under
+ *          per-joint velocity, acceleration and jerk limits.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * A profile moves a path parameter s from 0 to dist in minimum time:
+ * - Trapezoid: constant acceleration, cruise, constant deceleration
+ * - S-curve: 7 phases, the acceleration ramps at j_max so it never steps
+ * Short moves that cannot reach v_max (or a_max) get the fastest
+ * triangular shape that fits.
+ *
+ * Joint limits are mapped onto s through the path's joint sensitivity
+ * (|dq/ds| and |d2q/ds2|), so one scalar profile keeps every joint
+ * within its limits and all joints arrive together. For a joint-space
+ * straight move dq/ds is simply the joint delta.
+ *
+ * Setpoints are sampled at the servo period:
+ * @code
+ * int n = halo_profile_steps(&prof, HALO_PROFILE_SERVO_PERIOD_S);
+ * for (int k = 1; k <= n; k++) {
+ *     float s = halo_profile_pos(&prof, k * HALO_PROFILE_SERVO_PERIOD_S);
+ *     ... solve and write the pose at s, then wait for the next period ...
+ * }
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_kinematics.h"
+
+#define HALO_PROFILE_SERVO_PERIOD_S 0.02f   // one setpoint per PWM period
+
+// Hobby servo limits; the host servo model slews at 600 deg/s
+#define HALO_PROFILE_SERVO_LIMITS { 600.0f, 4000.0f, 60000.0f }
+
+// Per-joint limits (deg/s, deg/s^2, deg/s^3); j_max <= 0 means no jerk limit
+typedef struct
+{
+    float v_max;
+    float a_max;
+    float j_max;
+} halo_joint_limits_t;
+
+// Planned profile
+typedef struct
+{
+    float dist;         // total travel of s
+    float v_start;      // entry speed (0 for rest-to-rest)
+    float v_end;        // exit speed (0 for rest-to-rest)
+    float v_peak;       // cruise speed actually reached
+    float a_peak;       // acceleration actually reached
+    float jerk;         // 0 for a trapezoid
+    float t_j;          // each jerk phase
+    float t_acc;        // whole acceleration phase
+    float t_cruise;
+    float t_dec;        // whole deceleration phase
+    float s_acc;        // travel during the acceleration phase
+    float s_dec;        // travel during the deceleration phase
+    float duration;
+} halo_profile_t;
+
+/**
+ * @brief Plans a minimum-time move over dist.
+ *
+ * @param j_max  Jerk limit; <= 0 plans a trapezoid
+ */
+void halo_profile_plan(halo_profile_t* p, float dist, float v_max, float a_max, float j_max);
+
+/**
+ * @brief Plans a trapezoid over dist that enters at v_start and leaves at
+ *        v_end (used to blend through corners).
+ *
+ * v_end must be reachable from v_start within dist at a_max; a planner
+ * that runs forward and backward passes over its segments ensures that.
+ */
+void halo_profile_plan_blend(halo_profile_t* p, float dist, float v_start, float v_end,
+                             float v_max, float a_max);
+
+/**
+ * @brief Limits on s in [0, 1] that keep n joints within their limits.
+ *
+ * @param dq_ds    max |dq_j/ds| along the path, per joint (deg)
+ * @param d2q_ds2  max |d2q_j/ds2| along the path (deg), or NULL for a
+ *                 joint-space straight move
+ * @param path     Limits on s (1/s, 1/s^2, 1/s^3); j_max = 0 unless scurve
+ * @param scurve   0 = trapezoid, 1 = S-curve
+ */
+void halo_profile_joint_limits(const float* dq_ds, const float* d2q_ds2,
+                               const halo_joint_limits_t* lim, int n, int scurve,
+                               halo_joint_limits_t* path);
+
+// halo_profile_joint_limits() followed by the plan over s in [0, 1]
+void halo_profile_plan_joints(halo_profile_t* p, const float* dq_ds, const float* d2q_ds2,
+                              const halo_joint_limits_t* lim, int n, int scurve);
+
+/**
+ * @brief Limits on s in [0, 1] along the Cartesian line (x1, y1) -> (x2, y2),
+ *        with the joint sensitivity sampled from the IK at 17 points.
+ *
+ * Unreachable samples are left out of the sensitivity, so the limits
+ * cover the reachable stretches of a line that leaves the workspace.
+ *
+ * @param lim  Limits for { shoulder, elbow }
+ * @return 1 if every sample is reachable, 0 otherwise (limits still set)
+ */
+int halo_profile_line_limits(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                             int elbow_up, const halo_joint_limits_t lim[2], int scurve,
+                             halo_joint_limits_t* path);
+
+/**
+ * @brief Plans the move along the Cartesian line (x1, y1) -> (x2, y2)
+ *        within the limits of halo_profile_line_limits().
+ *
+ * @return 1 if every sample is reachable, 0 otherwise (profile still set)
+ */
+int halo_profile_plan_line(halo_profile_t* p, const halo_arm_t* arm,
+                           float x1, float y1, float x2, float y2, int elbow_up,
+                           const halo_joint_limits_t lim[2], int scurve);
+
+// s at time t, clamped to [0, dist]
+float halo_profile_pos(const halo_profile_t* p, float t);
+
+// ds/dt at time t
+float halo_profile_vel(const halo_profile_t* p, float t);
+
+// Number of setpoints at period_s (the last one lands on dist)
+int halo_profile_steps(const halo_profile_t* p, float period_s);
+
+#endif // HALO_PROFILE_H
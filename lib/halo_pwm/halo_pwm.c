@@ -0,0 +1,119 @@
+/**
+ * @file    halo_pwm.c
+ * @brief   PWM channel setup and synchronous multi-channel duty update.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Duties go to SHADOW, then one COMMIT write latches every listed channel
+ *   at the next period boundary (see documentation/pwm)
+ * - The shadow writes and the commit are a single register burst
+ * - Streaming: duty frames are pushed into the per-channel FIFOs, the
+ *   peripheral loads one per period on its own
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_pwm.h"
+#include "halo.h"
+
+void halo_pwm_enable(int ch, unsigned int period_us)
+{
+    const halo_reg_write_t setup[2] = {
+        { HALO_PWM_PERIOD(ch), period_us },
+        { HALO_PWM_CTRL(ch),   HALO_PWM_CTRL_ENABLE },
+    };
+    WRITE_REGISTERS(setup, 2);
+}
+
+void halo_pwm_set_duty_sync(int first_ch, const unsigned int* duty_us, int n)
+{
+    halo_reg_write_t burst[HALO_PWM_CHANNELS + 1];
+    unsigned int mask = 0;
+
+    if (first_ch < 0 || first_ch >= HALO_PWM_CHANNELS || n <= 0)
+        return;
+    if (n > HALO_PWM_CHANNELS - first_ch)
+        n = HALO_PWM_CHANNELS - first_ch;
+
+    for (int i = 0; i < n; i++)
+    {
+        burst[i].addr  = HALO_PWM_SHADOW(first_ch + i);
+        burst[i].value = duty_us[i];
+        mask |= 1u << (first_ch + i);
+    }
+
+    burst[n].addr  = HALO_PWM_COMMIT;
+    burst[n].value = mask;
+    WRITE_REGISTERS(burst, n + 1);
+}
+
+unsigned int halo_pwm_commit_pending(void)
+{
+    return READ_REGISTER(HALO_PWM_COMMIT);
+}
+
+// ---------- Streaming ----------
+
+void halo_pwm_stream_enable(int first_ch, int n, int enable)
+{
+    halo_reg_write_t burst[2 * HALO_PWM_CHANNELS];
+    int w = 0;
+
+    if (first_ch < 0 || first_ch >= HALO_PWM_CHANNELS || n <= 0)
+        return;
+    if (n > HALO_PWM_CHANNELS - first_ch)
+        n = HALO_PWM_CHANNELS - first_ch;
+
+    for (int k = 0; k < n; k++)
+    {
+        int ch = first_ch + k;
+        burst[w].addr    = HALO_PWM_STREAM_CTRL(ch);
+        burst[w++].value = HALO_PWM_STREAM_FLUSH | (enable ? HALO_PWM_STREAM_ENABLE : 0u);
+        burst[w].addr    = HALO_PWM_STREAM_STATUS(ch);
+        burst[w++].value = HALO_PWM_STREAM_UNDERRUN | HALO_PWM_STREAM_OVERFLOW;
+    }
+
+    WRITE_REGISTERS(burst, w);
+}
+
+void halo_pwm_stream_push(int first_ch, int n, const unsigned short* duty_us, int count)
+{
+    halo_reg_write_t burst[HALO_PWM_STREAM_DEPTH * 2];
+    const int stride = n;               // values per frame in duty_us
+
+    if (first_ch < 0 || first_ch >= HALO_PWM_CHANNELS)
+        return;
+    if (n > HALO_PWM_CHANNELS - first_ch)
+        n = HALO_PWM_CHANNELS - first_ch;
+    if (n <= 0)
+        return;
+
+    int frames_per_burst = (int)(sizeof(burst) / sizeof(burst[0])) / n;
+
+    while (count > 0)
+    {
+        int frames = (count < frames_per_burst) ? count : frames_per_burst;
+        int w = 0;
+
+        for (int i = 0; i < frames; i++)
+        {
+            for (int k = 0; k < n; k++)
+            {
+                burst[w].addr    = HALO_PWM_STREAM_DATA(first_ch + k);
+                burst[w++].value = duty_us[i * stride + k];
+            }
+        }
+
+        WRITE_REGISTERS(burst, w);
+        duty_us += frames * stride;
+        count   -= frames;
+    }
+}
+
+int halo_pwm_stream_level(int ch)
+{
+    return (int)HALO_PWM_STREAM_LEVEL(READ_REGISTER(HALO_PWM_STREAM_STATUS(ch)));
+}
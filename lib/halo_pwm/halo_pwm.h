@@ -0,0 +1,113 @@
+#ifndef HALO_PWM_H
+#define HALO_PWM_H
+
+/**
+ * @file    halo_pwm.h
+ * @brief   PWM peripheral register map (see documentation/pwm) and
+ *          synchronous multi-channel duty update.
+ *
+ * @details
+ * Writing DUTY changes a channel at once, so two joints written one after
+ * the other can run one period with a mismatched pose. The SHADOW/COMMIT
+ * pair avoids that: duties are staged in SHADOW and COMMIT latches them
+ * into DUTY together on the next period boundary.
+ *
+ * For table playback each channel also has a 16-entry duty FIFO that the
+ * peripheral drains into DUTY at one entry per period (STREAM_*).
+ *
+ * @note
+ * - 8 channels, 0x40 bytes apart, starting at 0x40004000
+ * - Servo convention: 20 ms period, 1000–2000 µs duty for 0°–180°
+ */
+
+#define HALO_PWM_BASE_ADDR   0x40004000u
+#define HALO_PWM_STRIDE      0x40u
+#define HALO_PWM_CHANNELS    8
+
+// Per-channel registers
+#define HALO_PWM_PERIOD(ch)  (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x00u)
+#define HALO_PWM_DUTY(ch)    (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x04u)
+#define HALO_PWM_CTRL(ch)    (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x08u)
+#define HALO_PWM_SHADOW(ch)  (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x0Cu)
+#define HALO_PWM_STREAM_CTRL(ch)   (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x10u)
+#define HALO_PWM_STREAM_DATA(ch)   (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x14u)
+#define HALO_PWM_STREAM_STATUS(ch) (HALO_PWM_BASE_ADDR + (ch) * HALO_PWM_STRIDE + 0x18u)
+
+// Global registers
+#define HALO_PWM_COMMIT      (HALO_PWM_BASE_ADDR + 0x200u)
+
+// CTRL bits
+#define HALO_PWM_CTRL_ENABLE 0x01u
+
+// STREAM_CTRL bits
+#define HALO_PWM_STREAM_ENABLE     0x01u
+#define HALO_PWM_STREAM_FLUSH      0x02u
+
+// STREAM_STATUS bits
+#define HALO_PWM_STREAM_HALF_EMPTY 0x01u
+#define HALO_PWM_STREAM_EMPTY      0x02u
+#define HALO_PWM_STREAM_FULL       0x04u
+#define HALO_PWM_STREAM_UNDERRUN   0x08u   // write 1 to clear
+#define HALO_PWM_STREAM_OVERFLOW   0x10u   // write 1 to clear
+#define HALO_PWM_STREAM_LEVEL(st)  (((st) >> 16) & 0xFFu)
+
+#define HALO_PWM_STREAM_DEPTH      16
+
+// Servo timing
+#define HALO_SERVO_PERIOD_US 20000u
+#define HALO_SERVO_MIN_US    1000u
+#define HALO_SERVO_MAX_US    2000u
+
+// 2-DOF arm joints
+#define HALO_PWM_SHOULDER    0
+#define HALO_PWM_ELBOW       1
+
+// ---------- API ----------
+
+/**
+ * @brief Sets a channel's period and enables it.
+ */
+void halo_pwm_enable(int ch, unsigned int period_us);
+
+/**
+ * @brief Stages duty_us[i] for channels first_ch .. first_ch + n - 1 and
+ *        commits them, so they all change on the same period boundary.
+ *
+ * Shadow writes and the commit go out as one register burst. Committing
+ * again before the latch simply replaces the staged values. Channels past
+ * the last one are dropped; nothing is written if first_ch is not a
+ * channel or n <= 0.
+ */
+void halo_pwm_set_duty_sync(int first_ch, const unsigned int* duty_us, int n);
+
+/**
+ * @brief Channels whose committed duty has not been latched yet (bit n = PWMn).
+ */
+unsigned int halo_pwm_commit_pending(void);
+
+/**
+ * @brief Flushes the FIFOs of channels first_ch .. first_ch + n - 1 and
+ *        turns streaming on or off for them.
+ *
+ * Channels past the last one are skipped; nothing is written if first_ch
+ * is not a channel or n <= 0.
+ */
+void halo_pwm_stream_enable(int first_ch, int n, int enable);
+
+/**
+ * @brief Queues count duty frames; frame i holds one value per channel,
+ *        duty_us[i * n + k] for channel first_ch + k.
+ *
+ * All writes go out as one burst. The caller keeps count within the free
+ * FIFO space (see halo_pwm_stream_level), extra entries are dropped.
+ * Channels past the last one are skipped (frames keep their n values);
+ * nothing is written if first_ch is not a channel or n <= 0.
+ */
+void halo_pwm_stream_push(int first_ch, int n, const unsigned short* duty_us, int count);
+
+/**
+ * @brief Entries queued in a channel's FIFO.
+ */
+int halo_pwm_stream_level(int ch);
+
+#endif // HALO_PWM_H
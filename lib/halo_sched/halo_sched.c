@@ -0,0 +1,180 @@
+/**
+ * @file    halo_sched.c
+ * @brief   Cooperative EDF scheduler for periodic run-to-completion tasks.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Releases are kept on an absolute timeline (release += period), so a
+ *   late run never shifts later releases
+ * - A task that overruns by a whole period has the missed releases
+ *   dropped and counted instead of being run back to back
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Uses TIMER COUNT only; the TIMER tick is left to the drivers
+ */
+
+#include "halo_sched.h"
+#include "halo_timer.h"
+
+typedef struct
+{
+    halo_task_fn_t     fn;
+    void*              ctx;
+    unsigned long long release;         // absolute time of the pending release
+    halo_task_stats_t  stats;
+} task_t;
+
+static task_t             tasks[HALO_SCHED_MAX_TASKS];
+static int                num_tasks;
+static unsigned long long start_us;
+static unsigned long long idle_us;
+static int                started;
+
+int halo_sched_add(const char* name, halo_task_fn_t fn, void* ctx,
+                   unsigned int period_us, unsigned int deadline_us,
+                   unsigned int phase_us)
+{
+    if (num_tasks >= HALO_SCHED_MAX_TASKS || period_us == 0)
+        return -1;
+
+    task_t* t = &tasks[num_tasks];
+    t->fn                = fn;
+    t->ctx               = ctx;
+    t->release           = phase_us;    // made absolute when the scheduler starts
+    t->stats.name        = name;
+    t->stats.period_us   = period_us;
+    t->stats.deadline_us = deadline_us ? deadline_us : period_us;
+
+    return num_tasks++;
+}
+
+// Released task with the earliest absolute deadline, or -1
+static int pick(unsigned long long now)
+{
+    int best = -1;
+    unsigned long long best_deadline = 0;
+
+    for (int i = 0; i < num_tasks; i++)
+    {
+        if (tasks[i].release > now)
+            continue;
+
+        unsigned long long d = tasks[i].release + tasks[i].stats.deadline_us;
+        if (best < 0 || d < best_deadline)
+        {
+            best = i;
+            best_deadline = d;
+        }
+    }
+    return best;
+}
+
+static unsigned long long next_release(void)
+{
+    unsigned long long next = tasks[0].release;
+
+    for (int i = 1; i < num_tasks; i++)
+        if (tasks[i].release < next)
+            next = tasks[i].release;
+    return next;
+}
+
+static void run_task(task_t* t, unsigned long long start)
+{
+    halo_task_stats_t* s = &t->stats;
+    unsigned int late = (unsigned int)(start - t->release);
+
+    t->fn(t->ctx);
+
+    unsigned long long end = halo_timer_uptime_us();
+    unsigned int exec = (unsigned int)(end - start);
+
+    s->runs++;
+    s->busy_us += exec;
+    if (exec > s->max_exec_us) s->max_exec_us = exec;
+    if (late > s->max_late_us) s->max_late_us = late;
+    if (end > t->release + s->deadline_us)
+        s->misses++;
+
+    // Next release on the fixed timeline; drop any that are already a full
+    // period behind
+    t->release += s->period_us;
+    while (t->release + s->period_us <= end)
+    {
+        t->release += s->period_us;
+        s->skipped++;
+    }
+}
+
+static void start(void)
+{
+    if (started)
+        return;
+
+    start_us = halo_timer_uptime_us();
+    for (int i = 0; i < num_tasks; i++)
+        tasks[i].release += start_us;
+    started = 1;
+}
+
+void halo_sched_run_for(unsigned long long duration_us)
+{
+    if (num_tasks == 0)
+        return;
+
+    start();
+    unsigned long long stop = halo_timer_uptime_us() + duration_us;
+
+    for (;;)
+    {
+        unsigned long long now = halo_timer_uptime_us();
+        if (now >= stop)
+            break;
+
+        int i = pick(now);
+        if (i >= 0)
+        {
+            run_task(&tasks[i], now);
+            continue;
+        }
+
+        // Nothing released: sleep until the next release
+        unsigned long long wake = next_release();
+        if (wake > stop)
+            wake = stop;
+        halo_timer_sleep_until(wake);
+
+        idle_us += halo_timer_uptime_us() - now;
+    }
+}
+
+void halo_sched_run(void)
+{
+    while (1)
+        halo_sched_run_for(0xFFFFFFFFull);
+}
+
+const halo_task_stats_t* halo_sched_task_stats(int id)
+{
+    if (id < 0 || id >= num_tasks)
+        return 0;
+    return &tasks[id].stats;
+}
+
+int halo_sched_task_count(void)
+{
+    return num_tasks;
+}
+
+unsigned long long halo_sched_idle_us(void)
+{
+    return idle_us;
+}
+
+unsigned long long halo_sched_elapsed_us(void)
+{
+    return started ? halo_timer_uptime_us() - start_us : 0;
+}
@@ -0,0 +1,69 @@
+#ifndef HALO_SCHED_H
+#define HALO_SCHED_H
+
+/**
+ * @file    halo_sched.h
+ * @brief   Cooperative run-to-completion scheduler for periodic tasks.
+ *
+ * @details
+ * - Tasks are plain functions released every period_us; a released task
+ *   runs to completion and must not block (no delay_us loops)
+ * - Among released tasks the one with the earliest absolute deadline runs
+ *   first (EDF)
+ * - When nothing is released the scheduler sleeps until the next release;
+ *   that time is reported as slack
+ * - Time base: halo_timer_uptime_us() (TIMER COUNT), so the periodic tick
+ *   stays free for interrupt-driven drivers such as halo_matrix
+ */
+
+#define HALO_SCHED_MAX_TASKS 8
+
+typedef void (*halo_task_fn_t)(void* ctx);
+
+// Per-task timing, all times in microseconds
+typedef struct
+{
+    const char*        name;
+    unsigned int       period_us;
+    unsigned int       deadline_us;     // relative to each release
+    unsigned long      runs;
+    unsigned long      misses;          // runs that finished after their deadline
+    unsigned long      skipped;         // releases dropped after an overrun
+    unsigned int       max_exec_us;
+    unsigned int       max_late_us;     // worst release-to-start delay
+    unsigned long long busy_us;         // total run time
+} halo_task_stats_t;
+
+/**
+ * @brief Adds a periodic task. Call before halo_sched_run().
+ *
+ * @param deadline_us  Relative deadline, 0 = period_us
+ * @param phase_us     Offset of the first release from the scheduler start
+ * @return Task id, or -1 if the task table is full
+ */
+int halo_sched_add(const char* name, halo_task_fn_t fn, void* ctx,
+                   unsigned int period_us, unsigned int deadline_us,
+                   unsigned int phase_us);
+
+/**
+ * @brief Runs the tasks forever.
+ */
+void halo_sched_run(void);
+
+/**
+ * @brief Runs the tasks until duration_us has elapsed, then returns.
+ */
+void halo_sched_run_for(unsigned long long duration_us);
+
+// Timing of one task, or NULL for an unknown id
+const halo_task_stats_t* halo_sched_task_stats(int id);
+
+int halo_sched_task_count(void);
+
+// Time spent sleeping since the scheduler started
+unsigned long long halo_sched_idle_us(void);
+
+// Time since the scheduler started
+unsigned long long halo_sched_elapsed_us(void);
+
+#endif // HALO_SCHED_H
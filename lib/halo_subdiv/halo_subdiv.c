@@ -0,0 +1,149 @@
+/**
+ * @file    halo_subdiv.c
+ * @brief   Bisection subdivider and knot interpolation.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - The worst piece is split first, so when max_knots runs out the knots
+ *   already sit where the error was largest
+ * - Rating a piece costs one IK solve and one FK at its midpoint; the
+ *   midpoint is kept, so a split costs only the ratings of both halves
+ * - O(n^2) in the knot count, which is bounded by HALO_SUBDIV_MAX_KNOTS
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ */
+
+#include "halo_subdiv.h"
+
+// ---------- Helpers ----------
+
+static void solve_knot(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                       int elbow_up, float s, halo_subdiv_knot_t* k)
+{
+    k->s = s;
+    k->reachable = halo_ik_solve(arm, x1 + s * (x2 - x1), y1 + s * (y2 - y1), elbow_up,
+                                 &k->theta1_deg, &k->theta2_deg);
+}
+
+// theta1 comes from atan2: move it within 180° of ref
+static float unwrap_deg(float a, float ref)
+{
+    while (a - ref >  180.0f) a -= 360.0f;
+    while (a - ref < -180.0f) a += 360.0f;
+    return a;
+}
+
+// How far the piece a -> b is over its limits: > 1 means split it
+// (m receives the midpoint knot, unwrapped against a)
+static float piece_badness(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                           int elbow_up, const halo_subdiv_cfg_t* cfg,
+                           const halo_subdiv_knot_t* a, const halo_subdiv_knot_t* b,
+                           halo_subdiv_knot_t* m)
+{
+    const float min_width = 1.0f / (float)(1 << HALO_SUBDIV_MAX_DEPTH);
+
+    if (b->s - a->s <= min_width)
+    {
+        *m = *a;
+        return 0.0f;
+    }
+
+    solve_knot(arm, x1, y1, x2, y2, elbow_up, 0.5f * (a->s + b->s), m);
+    m->theta1_deg = unwrap_deg(m->theta1_deg, a->theta1_deg);
+
+    if (a->reachable != b->reachable)
+        return 2.0f;                    // locate where the line leaves the workspace
+    if (!a->reachable)
+        return 0.0f;
+    if (!m->reachable)
+        return 2.0f;
+
+    float d1  = fabsf(b->theta1_deg - a->theta1_deg);
+    float d2  = fabsf(b->theta2_deg - a->theta2_deg);
+    float bad = ((d1 > d2) ? d1 : d2) / cfg->max_joint_deg;
+
+    // Where the servos actually are halfway through the piece
+    float t1  = 0.5f * (a->theta1_deg + b->theta1_deg) * HALO_DEG_TO_RAD_F;
+    float t12 = t1 + 0.5f * (a->theta2_deg + b->theta2_deg) * HALO_DEG_TO_RAD_F;
+    float ex  = arm->l1 * cosf(t1) + arm->l2 * cosf(t12) - (x1 + m->s * (x2 - x1));
+    float ey  = arm->l1 * sinf(t1) + arm->l2 * sinf(t12) - (y1 + m->s * (y2 - y1));
+    float err = sqrtf(ex * ex + ey * ey) / cfg->chord_tol_cm;
+
+    return (err > bad) ? err : bad;
+}
+
+// ---------- Subdivision ----------
+
+int halo_subdiv_line(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                     int elbow_up, const halo_subdiv_cfg_t* cfg,
+                     halo_subdiv_knot_t* knots, int max_knots)
+{
+    // Piece k = knots[k] -> knots[k + 1]: its rating and its midpoint
+    float              bad[HALO_SUBDIV_MAX_KNOTS];
+    halo_subdiv_knot_t mid[HALO_SUBDIV_MAX_KNOTS];
+    int n = 2;
+
+    if (max_knots > HALO_SUBDIV_MAX_KNOTS)
+        max_knots = HALO_SUBDIV_MAX_KNOTS;
+
+    solve_knot(arm, x1, y1, x2, y2, elbow_up, 0.0f, &knots[0]);
+    solve_knot(arm, x1, y1, x2, y2, elbow_up, 1.0f, &knots[1]);
+    knots[1].theta1_deg = unwrap_deg(knots[1].theta1_deg, knots[0].theta1_deg);
+    bad[0] = piece_badness(arm, x1, y1, x2, y2, elbow_up, cfg, &knots[0], &knots[1], &mid[0]);
+
+    while (n < max_knots)
+    {
+        int w = 0;
+        for (int k = 1; k < n - 1; k++)
+            if (bad[k] > bad[w])
+                w = k;
+        if (bad[w] <= 1.0f)
+            break;
+
+        for (int k = n; k > w + 1; k--)
+        {
+            knots[k]   = knots[k - 1];
+            bad[k - 1] = bad[k - 2];
+            mid[k - 1] = mid[k - 2];
+        }
+        knots[w + 1] = mid[w];
+        n++;
+
+        bad[w]     = piece_badness(arm, x1, y1, x2, y2, elbow_up, cfg,
+                                   &knots[w], &knots[w + 1], &mid[w]);
+        bad[w + 1] = piece_badness(arm, x1, y1, x2, y2, elbow_up, cfg,
+                                   &knots[w + 1], &knots[w + 2], &mid[w + 1]);
+    }
+
+    return n;
+}
+
+// ---------- Sampling ----------
+
+int halo_subdiv_sample(const halo_subdiv_knot_t* knots, int n, int* cursor, float s,
+                     float* theta1_deg, float* theta2_deg)
+{
+    int k = *cursor;
+
+    if (k > n - 2) k = n - 2;
+    if (k < 0)     k = 0;
+    while (k > 0 && s < knots[k].s)
+        k--;
+    while (k < n - 2 && s > knots[k + 1].s)
+        k++;
+    *cursor = k;
+
+    const halo_subdiv_knot_t* a = &knots[k];
+    const halo_subdiv_knot_t* b = &knots[k + 1];
+
+    float f = (s - a->s) / (b->s - a->s);
+    if (f < 0.0f) f = 0.0f;
+    if (f > 1.0f) f = 1.0f;
+
+    *theta1_deg = a->theta1_deg + f * (b->theta1_deg - a->theta1_deg);
+    *theta2_deg = a->theta2_deg + f * (b->theta2_deg - a->theta2_deg);
+    return a->reachable & b->reachable;
+}
@@ -0,0 +1,81 @@
+#ifndef HALO_SUBDIV_H
+#define HALO_SUBDIV_H
+
+/**
+ * @file    halo_subdiv.h
+ * @brief   Adaptive subdivision of a Cartesian line into joint-space knots.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * Between two setpoints a servo pair moves on a straight line in joint
+ * space, which FK maps to a curve, not to the Cartesian chord. The
+ * subdivider bisects the line until, on every piece:
+ * - the joint-space midpoint lands within chord_tol_cm of the line (FK)
+ * - neither joint moves more than max_joint_deg
+ * Easy stretches (far from the base, small turns) end up with a few
+ * knots; folded or stretched poses near the workspace boundary get many.
+ *
+ * Between knots, joint angles are interpolated linearly, which is what
+ * the servos do anyway, so a move only solves the IK at its knots:
+ * @code
+ * halo_subdiv_knot_t knots[HALO_SUBDIV_MAX_KNOTS];
+ * int n = halo_subdiv_line(&arm, x1, y1, x2, y2, HALO_ELBOW_DOWN,
+ *                          &cfg, knots, HALO_SUBDIV_MAX_KNOTS);
+ * int k = 0;
+ * ... for each s in [0, 1]: halo_subdiv_sample(knots, n, &k, s, &t1, &t2) ...
+ * @endcode
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - The chord error is checked at each piece's midpoint, where a short
+ *   joint-linear piece deviates most
+ * - Unreachable stretches are not refined, except to locate where the
+ *   line leaves the workspace
+ */
+
+#include "halo_kinematics.h"
+
+#define HALO_SUBDIV_MAX_KNOTS 64
+#define HALO_SUBDIV_MAX_DEPTH 12    // finest piece = 1/4096 of the line
+
+// 0.2 mm chord error, 10° per piece
+#define HALO_SUBDIV_CFG_DEFAULT { 0.02f, 10.0f }
+
+typedef struct
+{
+    float chord_tol_cm;     // max distance of a piece's FK midpoint from the line
+    float max_joint_deg;    // max change of either joint across a piece
+} halo_subdiv_cfg_t;
+
+typedef struct
+{
+    float s;                // position on the line, 0..1
+    float theta1_deg;       // unwrapped against the previous knot
+    float theta2_deg;
+    int   reachable;
+} halo_subdiv_knot_t;
+
+/**
+ * @brief Splits (x1, y1) -> (x2, y2) into knots that meet cfg.
+ *
+ * Pieces stop splitting at HALO_SUBDIV_MAX_DEPTH or when max_knots (at most
+ * HALO_SUBDIV_MAX_KNOTS) is reached, so the result always covers the line.
+ *
+ * @return Number of knots written (>= 2; the first is s = 0, the last s = 1)
+ */
+int halo_subdiv_line(const halo_arm_t* arm, float x1, float y1, float x2, float y2,
+                     int elbow_up, const halo_subdiv_cfg_t* cfg,
+                     halo_subdiv_knot_t* knots, int max_knots);
+
+/**
+ * @brief Joint angles at s, interpolated between the knots around it.
+ *
+ * @param cursor  Knot index hint; start at 0 and keep it while s grows
+ * @return 1 if both surrounding knots are reachable
+ */
+int halo_subdiv_sample(const halo_subdiv_knot_t* knots, int n, int* cursor, float s,
+                     float* theta1_deg, float* theta2_deg);
+
+#endif // HALO_SUBDIV_H
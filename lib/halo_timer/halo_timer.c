@@ -0,0 +1,77 @@
+/**
+ * @file    halo_timer.c
+ * @brief   TIMER tick dispatch.
+ *          Owns TIMER_IRQHandler and fans each tick out to the attached
+ *          handlers, so several drivers can share the one timer.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - Handlers run in interrupt context: keep them short, no delay_us
+ */
+
+#include "halo_timer.h"
+#include "halo.h"
+
+static halo_timer_handler_t handlers[HALO_TIMER_MAX_HANDLERS];
+static volatile int         num_handlers;
+static unsigned int         last_count;     // COUNT at the previous uptime read
+static unsigned int         wraps;          // COUNT wraps seen so far
+
+void halo_timer_start(unsigned int period_us)
+{
+    WRITE_REGISTER(HALO_TIMER_CTRL, 0);
+    WRITE_REGISTER(HALO_TIMER_STATUS, HALO_TIMER_STATUS_TICK);
+    WRITE_REGISTER(HALO_TIMER_PERIOD, period_us);
+    WRITE_REGISTER(HALO_TIMER_CTRL, HALO_TIMER_CTRL_ENABLE | HALO_TIMER_CTRL_IRQ_EN);
+}
+
+int halo_timer_attach(halo_timer_handler_t handler)
+{
+    if (num_handlers >= HALO_TIMER_MAX_HANDLERS)
+        return 0;
+
+    // Publish the slot before the count so the ISR never sees an empty entry
+    handlers[num_handlers] = handler;
+    num_handlers = num_handlers + 1;
+    return 1;
+}
+
+unsigned int halo_timer_now_us(void)
+{
+    return READ_REGISTER(HALO_TIMER_COUNT);
+}
+
+unsigned long long halo_timer_uptime_us(void)
+{
+    unsigned int count = READ_REGISTER(HALO_TIMER_COUNT);
+
+    if (count < last_count)
+        wraps++;
+    last_count = count;
+
+    return ((unsigned long long)wraps << 32) | count;
+}
+
+void halo_timer_sleep_until(unsigned long long t_us)
+{
+    unsigned long long now = halo_timer_uptime_us();
+
+    // delay_us takes 32 bits; long sleeps go in chunks
+    while (now < t_us)
+    {
+        unsigned long long wait = t_us - now;
+        delay_us(wait > 0x7FFFFFFFull ? 0x7FFFFFFFu : (unsigned int)wait);
+        now = halo_timer_uptime_us();
+    }
+}
+
+void TIMER_IRQHandler(void)
+{
+    WRITE_REGISTER(HALO_TIMER_STATUS, HALO_TIMER_STATUS_TICK);
+
+    for (int i = 0; i < num_handlers; i++)
+        handlers[i]();
+}
@@ -0,0 +1,57 @@
+#ifndef HALO_TIMER_H
+#define HALO_TIMER_H
+
+/**
+ * @file    halo_timer.h
+ * @brief   TIMER peripheral: microsecond counter and periodic tick interrupt
+ *          (see documentation/timer).
+ */
+
+#define HALO_TIMER_BASE_ADDR    0x40002000u
+#define HALO_TIMER_COUNT        (HALO_TIMER_BASE_ADDR + 0x00u)
+#define HALO_TIMER_PERIOD       (HALO_TIMER_BASE_ADDR + 0x04u)
+#define HALO_TIMER_CTRL         (HALO_TIMER_BASE_ADDR + 0x08u)
+#define HALO_TIMER_STATUS       (HALO_TIMER_BASE_ADDR + 0x0Cu)
+
+// CTRL / STATUS bits
+#define HALO_TIMER_CTRL_ENABLE  0x01u
+#define HALO_TIMER_CTRL_IRQ_EN  0x02u
+#define HALO_TIMER_STATUS_TICK  0x01u
+
+// Handlers that can share the tick
+#define HALO_TIMER_MAX_HANDLERS 4
+
+typedef void (*halo_timer_handler_t)(void);
+
+/**
+ * @brief Starts (or re-times) the periodic tick with its interrupt enabled.
+ */
+void halo_timer_start(unsigned int period_us);
+
+/**
+ * @brief Adds a handler called from TIMER_IRQHandler on every tick.
+ * @return 1 on success, 0 if the handler table is full
+ */
+int halo_timer_attach(halo_timer_handler_t handler);
+
+/**
+ * @brief Current value of the free-running microsecond counter.
+ */
+unsigned int halo_timer_now_us(void);
+
+/**
+ * @brief Monotonic 64-bit microsecond clock built on COUNT.
+ *
+ * Extends the 32-bit counter across wraps; it has to be called at least
+ * once per wrap (~71 minutes), which any running loop does. Thread
+ * context only, not from interrupt handlers.
+ */
+unsigned long long halo_timer_uptime_us(void);
+
+/**
+ * @brief Sleeps until the uptime clock reaches t_us (returns at once if
+ *        t_us is already past).
+ */
+void halo_timer_sleep_until(unsigned long long t_us);
+
+#endif // HALO_TIMER_H
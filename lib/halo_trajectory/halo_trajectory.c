@@ -0,0 +1,123 @@
+/**
+ * @file    halo_trajectory.c
+ * @brief   Plays joint-space trajectory tables on the 2-DOF arm.
+ *
+ * @author  Adithya
+ * @date    2026-10-17
+ *
+ * @details
+ * - Tables are produced at build time by the pattern generators
+ *   (see repeating_pattern/common/halo_pattern.py)
+ * - The player only copies duty values into PWM0/PWM1, staged through
+ *   SHADOW and committed together so both joints change on one period
+ * - The streaming player hands the table to the PWM FIFOs instead: one
+ *   pair per period, timed by the peripheral rather than delay_us
+ * - Level-of-detail tables trade pairs for speed: a faster tool needs
+ *   fewer pairs per cm to stay within the servo update rate
+ *
+ * @note
+ * - Controller: Halo Ver 1.0
+ * - PWM period: 20 ms (50 Hz)
+ */
+
+#include "halo_trajectory.h"
+#include "halo_pwm.h"
+#include "halo.h"
+
+void halo_traj_init(void)
+{
+    halo_pwm_enable(HALO_PWM_SHOULDER, HALO_SERVO_PERIOD_US);
+    halo_pwm_enable(HALO_PWM_ELBOW, HALO_SERVO_PERIOD_US);
+}
+
+void halo_traj_play(const unsigned short (*duty)[2], int n, unsigned int dwell_us)
+{
+    for (int i = 0; i < n; i++)
+    {
+        unsigned int pair[2] = { duty[i][0], duty[i][1] };
+        halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pair, 2);
+        delay_us(dwell_us);
+    }
+}
+
+// ---------- Level of detail ----------
+
+int halo_traj_lod_select(const halo_traj_lod_t* lods, int count,
+                         float tool_speed_cm_s, unsigned int period_us)
+{
+    // Travel per servo period; a level finer than this cannot be realised
+    float step = tool_speed_cm_s * (float)period_us * 1e-6f;
+
+    for (int i = 0; i < count; i++)
+    {
+        if (lods[i].spacing_cm >= step * (1.0f - HALO_TRAJ_LOD_SLACK))
+            return i;
+    }
+
+    return count - 1;
+}
+
+int halo_traj_play_speed(const halo_traj_lod_t* lods, int count, float tool_speed_cm_s)
+{
+    int k = halo_traj_lod_select(lods, count, tool_speed_cm_s, HALO_SERVO_PERIOD_US);
+
+    unsigned int dwell_us = (unsigned int)(lods[k].spacing_cm / tool_speed_cm_s * 1e6f);
+    if (dwell_us < HALO_SERVO_PERIOD_US)
+        dwell_us = HALO_SERVO_PERIOD_US;
+
+    halo_traj_play(lods[k].duty, lods[k].n, dwell_us);
+    return k;
+}
+
+// ---------- Streaming playback ----------
+
+void halo_traj_stream_begin(const unsigned short first[2])
+{
+    // The COMMIT latch restarts both periods together, so the two FIFOs
+    // pop on the same boundary from here on
+    unsigned int pair[2] = { first[0], first[1] };
+    halo_pwm_set_duty_sync(HALO_PWM_SHOULDER, pair, 2);
+
+    while (halo_pwm_commit_pending())
+        delay_us(HALO_SERVO_PERIOD_US / 20);
+
+    halo_pwm_stream_enable(HALO_PWM_SHOULDER, 2, 1);
+}
+
+int halo_traj_stream(const unsigned short (*duty)[2], int n)
+{
+    int underruns = 0;
+    int i = 0;
+
+    while (i < n)
+    {
+        unsigned int status = READ_REGISTER(HALO_PWM_STREAM_STATUS(HALO_PWM_SHOULDER));
+        int room = HALO_PWM_STREAM_DEPTH - (int)HALO_PWM_STREAM_LEVEL(status);
+
+        if (status & HALO_PWM_STREAM_UNDERRUN)
+        {
+            underruns++;
+            WRITE_REGISTER(HALO_PWM_STREAM_STATUS(HALO_PWM_SHOULDER), HALO_PWM_STREAM_UNDERRUN);
+        }
+
+        if (room > n - i)
+            room = n - i;
+
+        halo_pwm_stream_push(HALO_PWM_SHOULDER, 2, &duty[i][0], room);
+        i += room;
+
+        // Sleep until the FIFO is about half empty again
+        if (i < n)
+            delay_us((HALO_PWM_STREAM_DEPTH / 2) * HALO_SERVO_PERIOD_US);
+    }
+
+    return underruns;
+}
+
+void halo_traj_stream_end(void)
+{
+    while (halo_pwm_stream_level(HALO_PWM_SHOULDER) > 0)
+        delay_us(HALO_SERVO_PERIOD_US);
+
+    halo_pwm_stream_enable(HALO_PWM_SHOULDER, 2, 0);
+}
@@ -0,0 +1,86 @@
+#ifndef HALO_TRAJECTORY_H
+#define HALO_TRAJECTORY_H
+
+#define HALO_TRAJ_LOD_SLACK 0.1f   // accepted speed shortfall before a coarser level
+
+// One level of detail of a duty table; generated tables list these from
+// the full density down to the coarsest
+typedef struct
+{
+    const unsigned short (*duty)[2];
+    int   n;
+    float spacing_cm;           // mean tool travel between pairs
+} halo_traj_lod_t;
+
+/**
+ * @brief Enables the shoulder and elbow PWM channels at the servo period.
+ */
+void halo_traj_init(void);
+
+/**
+ * @brief Streams pre-solved { shoulder, elbow } duty pairs to the servos.
+ *
+ * No floating point and no IK: each point is two table loads, two
+ * register writes and the dwell. The table is normally a generated const
+ * array, so it stays in flash.
+ *
+ * @param duty      Duty pairs in microseconds
+ * @param n         Number of pairs
+ * @param dwell_us  Delay after each point
+ */
+void halo_traj_play(const unsigned short (*duty)[2], int n, unsigned int dwell_us);
+
+// ---------- Level of detail ----------
+
+/**
+ * @brief Picks the level that a tool speed needs.
+ *
+ * A level is usable when v / spacing_cm, its pair rate, stays within one
+ * pair per servo period; the finest usable level is returned, or the
+ * coarsest one if none is. Finer pairs than the servo can follow would
+ * only cost register writes. A level up to HALO_TRAJ_LOD_SLACK finer
+ * still counts as usable and plays that much slower than commanded.
+ *
+ * @param tool_speed_cm_s  Commanded tool speed (> 0)
+ * @param period_us        Servo update period (HALO_SERVO_PERIOD_US)
+ * @return Index into lods
+ */
+int halo_traj_lod_select(const halo_traj_lod_t* lods, int count,
+                         float tool_speed_cm_s, unsigned int period_us);
+
+/**
+ * @brief Plays one pass at a tool speed using the level it needs.
+ *
+ * The dwell per pair is spacing / speed, so the commanded speed holds on
+ * any level; it is never shorter than one servo period.
+ *
+ * @return Index of the level played
+ */
+int halo_traj_play_speed(const halo_traj_lod_t* lods, int count, float tool_speed_cm_s);
+
+// ---------- Streaming playback ----------
+
+/**
+ * @brief Moves to the first pair of a table and starts PWM streaming on
+ *        the shoulder and elbow channels, with their periods aligned.
+ */
+void halo_traj_stream_begin(const unsigned short first[2]);
+
+/**
+ * @brief Queues a table into the PWM FIFOs; the peripheral plays it at
+ *        exactly one pair per servo period (20 ms).
+ *
+ * Returns once the last pair is queued, so calling it again continues the
+ * motion without a gap. Between refills the CPU only sleeps, for half a
+ * FIFO worth of periods at a time.
+ *
+ * @return Number of underruns seen while queueing (0 in normal operation)
+ */
+int halo_traj_stream(const unsigned short (*duty)[2], int n);
+
+/**
+ * @brief Waits for the queued pairs to play out and stops streaming.
+ */
+void halo_traj_stream_end(void);
+
+#endif // HALO_TRAJECTORY_H